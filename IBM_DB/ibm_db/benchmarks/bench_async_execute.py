@@ -0,0 +1,77 @@
+#
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+#  Runs the same query on many connections at once with
+#  ibm_db_dbi.Cursor.execute_async and compares the elapsed time with running
+#  the queries one after the other, reporting the threads of the process:
+#
+#    python benchmarks/bench_async_execute.py [connections] [mode] [latency]
+#
+#  mode is auto, cli or thread. latency is the time in microseconds the
+#  execute of the query takes on the stub CLI (IBM_DB_STUB_CLI=1 build, see
+#  ibm_db_stubcli.c), a server ignores it. Connection parameters are taken
+#  from config.py.
+#
+
+import sys, os, time
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+import ibm_db_dbi
+import config
+
+QUERY = "SELECT COUNT(*) FROM SYSCAT.COLUMNS -- ROWS=1 COLUMNS=INTEGER LATENCY=%d"
+MODES = {'auto': ibm_db_dbi.ASYNC_AUTO, 'cli': ibm_db_dbi.ASYNC_CLI,
+         'thread': ibm_db_dbi.ASYNC_THREAD}
+
+def threads():
+  try:
+    return len(os.listdir('/proc/self/task'))
+  except OSError:
+    return 0
+
+def main():
+  count = 100
+  mode = 'auto'
+  latency = 100000
+  if len(sys.argv) > 1:
+    count = int(sys.argv[1])
+  if len(sys.argv) > 2:
+    mode = sys.argv[2]
+  if len(sys.argv) > 3:
+    latency = int(sys.argv[3])
+  query = QUERY % latency
+  conns = [ibm_db_dbi.connect(config.database, config.user, config.password)
+           for i in range(count)]
+  cursors = [conn.cursor() for conn in conns]
+
+  start = time.time()
+  for cursor in cursors:
+    cursor.execute(query)
+    cursor.fetchall()
+  serial_time = time.time() - start
+
+  threads_before = threads()
+  max_threads = threads_before
+  start = time.time()
+  for cursor in cursors:
+    cursor.execute_async(query, None, MODES[mode])
+  modes = set([cursor._pending.mode for cursor in cursors])
+  for cursor in ibm_db_dbi.as_completed(cursors):
+    max_threads = max(max_threads, threads())
+    cursor.wait()
+    cursor.fetchall()
+  async_time = time.time() - start
+
+  print "ibm_db %s, %d connections, modes used %s" % (ibm_db_dbi.__version__,
+    count, sorted(modes))
+  print "serial: %8.1f ms" % (serial_time * 1e3)
+  print "async:  %8.1f ms" % (async_time * 1e3)
+  print "threads: %d before, at most %d while executing" % (threads_before,
+    max_threads)
+  for conn in conns:
+    conn.close()
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,71 @@
+#
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+#  Micro benchmark for the per row cost of fetching a small CLOB column,
+#  which is read through its LOB locator. Run it once against the old and
+#  once against the new build of ibm_db and compare the reported figures:
+#
+#    python benchmarks/bench_lob_fetch.py [rows] [clob length]
+#
+#  Connection parameters are taken from config.py.
+#
+
+import sys, os, time
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+import ibm_db
+import config
+
+TABLE = 'bench_lob_fetch'
+
+def connect():
+  return ibm_db.connect(config.database, config.user, config.password)
+
+def setup(conn, rows, length):
+  try:
+    ibm_db.exec_immediate(conn, "DROP TABLE %s" % TABLE)
+  except:
+    pass
+  ibm_db.exec_immediate(conn, "CREATE TABLE %s (id INTEGER, doc CLOB(1K))" % TABLE)
+  stmt = ibm_db.prepare(conn, "INSERT INTO %s VALUES (?, ?)" % TABLE)
+  rows = [(r, ('lob value %d ' % r).ljust(length, 'x')[:length]) for r in range(rows)]
+  ibm_db.execute_many(stmt, tuple(rows))
+  ibm_db.commit(conn)
+
+def fetch(conn, rows, length, options):
+  # the comment gives the shape of the result set on the stub CLI
+  stmt = ibm_db.prepare(conn, "SELECT id, doc FROM %s -- ROWS=%d COLUMNS=INTEGER,CLOB(%d)" %
+    (TABLE, rows, length), options)
+  start = time.time()
+  ibm_db.execute(stmt)
+  row = ibm_db.fetch_tuple(stmt)
+  while row:
+    if options:
+      row[1].read()
+    row = ibm_db.fetch_tuple(stmt)
+  return time.time() - start
+
+def main():
+  rows = 100000
+  length = 100
+  if len(sys.argv) > 1:
+    rows = int(sys.argv[1])
+  if len(sys.argv) > 2:
+    length = int(sys.argv[2])
+  conn = connect()
+  if not conn:
+    print "Connection failed."
+    return
+  setup(conn, rows, length)
+  fetch_time = fetch(conn, rows, length, {})
+  reader_time = fetch(conn, rows, length, {ibm_db.ATTR_LOB_READER : ibm_db.LOB_READER_ON})
+  print "ibm_db %s, %d rows, CLOB of %d characters" % (ibm_db.__version__, rows, length)
+  print "fetch:  %8.1f us/row" % (fetch_time * 1e6 / rows)
+  print "reader: %8.1f us/row" % (reader_time * 1e6 / rows)
+  ibm_db.exec_immediate(conn, "DROP TABLE %s" % TABLE)
+  ibm_db.close(conn)
+
+if __name__ == '__main__':
+  main()
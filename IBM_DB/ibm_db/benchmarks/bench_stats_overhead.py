@@ -0,0 +1,79 @@
+#
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+#  Micro benchmark for the cost of the performance counters of
+#  ibm_db.enable_stats. Runs the same prepared query and fetches its rows
+#  with the counters off and on, alternating the two to even out the
+#  noise, and reports the best time of each:
+#
+#    python benchmarks/bench_stats_overhead.py [rows] [repeat]
+#
+#  Build ibm_db with -DIBM_DB_NO_STATS to get the baseline without any
+#  counting code. Connection parameters are taken from config.py.
+#
+
+import sys, os, time
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+import ibm_db
+import config
+
+TABLE = 'bench_stats_overhead'
+
+def connect():
+  return ibm_db.connect(config.database, config.user, config.password)
+
+def setup(conn, rows):
+  try:
+    ibm_db.exec_immediate(conn, "DROP TABLE %s" % TABLE)
+  except:
+    pass
+  ibm_db.exec_immediate(conn, "CREATE TABLE %s (id INTEGER, name VARCHAR(32), amount DOUBLE)" % TABLE)
+  stmt = ibm_db.prepare(conn, "INSERT INTO %s VALUES (?, ?, ?)" % TABLE)
+  ibm_db.execute_many(stmt, tuple([(r, "name %d" % r, r * 1.5) for r in range(rows)]))
+
+def run(stmt):
+  start = time.time()
+  ibm_db.execute(stmt, (0,))
+  row = ibm_db.fetch_tuple(stmt)
+  while row:
+    row = ibm_db.fetch_tuple(stmt)
+  return time.time() - start
+
+def main():
+  rows = 100000
+  repeat = 5
+  if len(sys.argv) > 1:
+    rows = int(sys.argv[1])
+  if len(sys.argv) > 2:
+    repeat = int(sys.argv[2])
+  conn = connect()
+  if not conn:
+    print "Connection failed."
+    return
+  ibm_db.autocommit(conn, ibm_db.SQL_AUTOCOMMIT_OFF)
+  setup(conn, rows)
+  # the comment gives the shape of the result set on the stub CLI
+  stmt = ibm_db.prepare(conn, "SELECT * FROM %s WHERE id >= ? -- ROWS=%d "
+    "COLUMNS=INTEGER,VARCHAR(32),DOUBLE PARAMS=INTEGER" % (TABLE, rows))
+  off = []
+  on = []
+  for i in range(repeat):
+    ibm_db.enable_stats(False)
+    off.append(run(stmt))
+    ibm_db.enable_stats(True)
+    on.append(run(stmt))
+  ibm_db.enable_stats(False)
+  print "ibm_db %s, %d rows, best of %d" % (ibm_db.__version__, rows, repeat)
+  print "stats off: %8.1f ns/row" % (min(off) * 1e9 / rows)
+  print "stats on:  %8.1f ns/row (%+.1f%%)" % (min(on) * 1e9 / rows, (min(on) / min(off) - 1) * 100)
+  stats = ibm_db.get_stats(stmt)
+  print "counted:   %d rows, %d CLI calls, fetch %.3fs, convert %.3fs" % (stats['rows_fetched'],
+    stats['cli_calls'], stats['fetch_time'], stats['convert_time'])
+  ibm_db.rollback(conn)
+  ibm_db.close(conn)
+
+if __name__ == '__main__':
+  main()
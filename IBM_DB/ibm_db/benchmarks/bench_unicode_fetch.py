@@ -0,0 +1,91 @@
+#
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+#  Micro benchmark for the per cell cost of the SQLWCHAR <-> unicode
+#  converters. It runs on the stub CLI (see ibm_db_stubcli.c), which
+#  generates the result sets in memory, so no server time is measured:
+#
+#    IBM_DB_STUB_CLI=1 python setup.py build_ext --inplace
+#    python benchmarks/bench_unicode_fetch.py [rows] [columns] [length]
+#
+#  fetch reads VARCHAR(length) columns, which ibm_db converts from SQLWCHAR
+#  to unicode, and VARBINARY columns of the same size in bytes, which it
+#  copies as they are. bind sends rows of unicode parameters, converted to
+#  SQLWCHAR, and rows of str parameters of the same length to an insert
+#  with execute_many, which converts every cell (a repeated execute copies
+#  the new values into the buffers of the previous one instead). The
+#  difference of each pair is the cost of the converter. Run it once with
+#  the old and once with the new build of ibm_db and compare the figures.
+#
+
+import sys, os, time
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+import ibm_db
+import config
+
+REPEAT = 5
+FETCH = "SELECT * FROM bench_unicode_fetch -- ROWS=%d COLUMNS=%d*%s(%d)"
+INSERT = "INSERT INTO bench_unicode_fetch VALUES (%s) -- PARAMS=%d*VARCHAR(%d)"
+
+def fetch(conn, rows, columns, type, length):
+  best = None
+  for i in range(REPEAT):
+    stmt = ibm_db.exec_immediate(conn, FETCH % (rows, columns, type, length))
+    start = time.time()
+    row = ibm_db.fetch_tuple(stmt)
+    while row:
+      row = ibm_db.fetch_tuple(stmt)
+    elapsed = time.time() - start
+    ibm_db.free_result(stmt)
+    if best is None or elapsed < best:
+      best = elapsed
+  return best
+
+def bind(conn, rows, columns, value):
+  stmt = ibm_db.prepare(conn, INSERT % (", ".join(["?"] * columns), columns, len(value)))
+  params = tuple([tuple([value] * columns)] * rows)
+  best = None
+  for i in range(REPEAT):
+    start = time.time()
+    ibm_db.execute_many(stmt, params)
+    elapsed = time.time() - start
+    if best is None or elapsed < best:
+      best = elapsed
+  return best
+
+def report(name, converted, copied, cells):
+  print "%s: %8.1f ns/cell converted, %8.1f ns/cell copied, %8.1f ns/cell converter" % (
+    name, converted * 1e9 / cells, copied * 1e9 / cells, (converted - copied) * 1e9 / cells)
+
+def main():
+  rows = 10000
+  columns = 20
+  length = 64
+  if len(sys.argv) > 1:
+    rows = int(sys.argv[1])
+  if len(sys.argv) > 2:
+    columns = int(sys.argv[2])
+  if len(sys.argv) > 3:
+    length = int(sys.argv[3])
+  conn = ibm_db.connect(config.database, config.user, config.password)
+  if not conn:
+    print "Connection failed."
+    return
+  if ibm_db.client_info(conn).DRIVER_NAME != 'ibm_db_stubcli':
+    print "Build ibm_db with IBM_DB_STUB_CLI=1 to time the converters without a server."
+    ibm_db.close(conn)
+    return
+  cells = rows * columns
+  print "ibm_db %s, sys.maxunicode %d, %d cells of %d characters" % (
+    ibm_db.__version__, sys.maxunicode, cells, length)
+  report("fetch", fetch(conn, rows, columns, 'VARCHAR', length),
+    fetch(conn, rows, columns, 'VARBINARY', 2 * length), cells)
+  report("bind ", bind(conn, rows, columns, u"u" * length),
+    bind(conn, rows, columns, "s" * length), cells)
+  ibm_db.close(conn)
+
+if __name__ == '__main__':
+  main()
@@ -24,12 +24,21 @@
 #define MODULE_RELEASE "1.0.6"
 
 #include <Python.h>
+#include <pythread.h>
+#include <datetime.h>
 #include "ibm_db.h"
+#include "ibm_db_arrow.h"
 #include <ctype.h>
+#include <errno.h>
+#include <time.h>
 #ifdef _WIN32
 #include <windows.h>
+#define POOL_SLEEP(ms) Sleep(ms)
 #else
 #include <dlfcn.h>
+#include <unistd.h>
+#include <sys/time.h>
+#define POOL_SLEEP(ms) usleep((ms) * 1000)
 #endif
 
 /* True global resources - no need for thread safety here */
@@ -43,6 +52,16 @@ static PyObject* getSQLWCharAsPyUnicodeObject(SQLWCHAR* sqlwcharData, int sqlwch
 const int _check_i = 1;
 #define is_bigendian() ( (*(char*)&_check_i) == 0 )
 static int is_systemi, is_informix;	  /* 1 == TRUE; 0 == FALSE; */
+/* Resolved once in initibm_db: whether the interpreter stores unicode as UCS-2
+ * (sys.maxunicode <= 65536), and the byte order of SQLWCHAR data in the form
+ * PyUnicode_DecodeUTF16 takes it (1 == big endian, -1 == little endian) */
+static int is_ucs2_python = 0;
+static int sqlwchar_byteorder = -1;
+/* array.array, imported on first use by ibm_db.fetch_columns() */
+static PyObject *array_type = NULL;
+/* decimal.Decimal, imported with the datetime C API on first use by a
+ * statement with ATTR_NATIVE_TYPES on */
+static PyObject *decimal_type = NULL;
 #ifdef _WIN32
 #define DLOPEN LoadLibrary
 #define DLSYM GetProcAddress
@@ -66,7 +85,7 @@ typedef struct _error_msg_node {
 	struct _error_msg_node *next;
 } error_msg_node;
 
-/* Defines a linked list structure for caching param data */
+/* Defines the cached bind state of a parameter */
 typedef struct _param_cache_node {
 	SQLSMALLINT data_type;		/* Datatype */
 	SQLUINTEGER param_size;		/* param size */
@@ -83,9 +102,78 @@ typedef struct _param_cache_node {
 	double	fvalue;			  /* Temp storage value */
 	char	  *svalue;			/* Temp storage value */
 	SQLWCHAR *uvalue;			 /* Temp storage value */
-	struct _param_cache_node *next; /* Pointer to next node */
+	int		bound_type;		 /* Python type whose values are copied into the bound buffers, 0 when the param must be bound again */
+	SQLINTEGER	buffer_size;	 /* bytes svalue or uvalue holds, without the terminator */
+	PyObject  *stream;			/* file-like or iterator sent with SQLPutData, borrowed for the execute */
+	PyObject  *stream_chunk;	/* first chunk of stream, read when binding it to choose the C type */
+	PyObject  *stream_error;	/* exception of a failed first read, raised when the data is sent */
 } param_node;
 
+/* Defines the description of the parameters of a statement as one array per
+ * attribute, indexed by param_num - 1 */
+typedef struct _param_desc_struct {
+	SQLUINTEGER *param_size;	/* param size */
+	SQLSMALLINT *data_type;		/* Datatype */
+	SQLSMALLINT *scale;			/* Decimal scale */
+	SQLSMALLINT *nullable;		/* is Nullable */
+} param_desc;
+
+/* Defines a column-wise array of the values of one parameter, bound once
+ * for a batch of rows of execute_many */
+typedef struct _param_array_struct {
+	SQLSMALLINT value_type;		/* C type the values are converted to */
+	SQLINTEGER width;			/* bytes of one value in buffer */
+	SQLINTEGER capacity;		/* bytes allocated for buffer */
+	char *buffer;				/* values, width bytes per row */
+	SQLLEN *indicators;			/* length or SQL_NULL_DATA per row */
+} param_array;
+
+/* Defines the sub-pool of the persistent connections of one set of
+ * credentials. Guarded by the GIL, which is only released while waiting */
+typedef struct _conn_pool_struct {
+	PyObject *key;				/* credentials the connections were made with */
+	PyObject *database;
+	PyObject *uid;
+	PyObject *idle;				/* list of idle connections, least recently checked in first */
+	int in_use;					/* connections checked out or being connected */
+	long created;
+	long checkouts;
+	long waits;					/* checkouts that waited for a checkin */
+	long timeouts;				/* checkouts that gave up waiting */
+	long reaped;				/* idle connections closed after the idle timeout */
+	long invalid;				/* idle connections that failed validation */
+	struct _conn_pool_struct *next;
+} conn_pool;
+
+/* Defines the prepared statement cache entry of a connection */
+typedef struct _stmt_cache_entry {
+	PyObject *key;				/* (statement, options) tuple, NULL when free */
+	PyObject *stmt;				/* cached IBM_DBStatement */
+	unsigned long last_used;	/* stmt_cache_clock when last handed out */
+} stmt_cache_entry;
+
+/* Defines the performance counters of a statement, of a connection and of
+ * the module, see ibm_db.get_stats. Times are in seconds spent in the CLI
+ * calls of each kind, conversion is the time spent building Python rows */
+enum {
+	STATS_PREPARE,
+	STATS_EXECUTE,
+	STATS_FETCH,
+	STATS_DESCRIBE,
+	STATS_LOB,
+	STATS_CONVERT,
+	STATS_NUM_TIMERS
+};
+
+typedef struct _ibm_db_stats {
+	int refs;					/* the connection and its statements, for the counters of a connection */
+	double time[STATS_NUM_TIMERS];
+	long cli_calls;
+	long rows_fetched;
+	PY_LONG_LONG bytes_fetched;	/* bytes of the non NULL values fetched, LOB data included */
+	long params_bound;
+} ibm_db_stats;
+
 typedef struct _conn_handle_struct {
 	PyObject_HEAD
 	SQLHANDLE henv;
@@ -94,10 +182,31 @@ typedef struct _conn_handle_struct {
 	long c_bin_mode;
 	long c_case_mode;
 	long c_cursor_type;
+	SQLUINTEGER c_row_array_size;
+	SQLUINTEGER c_paramset_size;
+	SQLUINTEGER c_query_timeout;	/* seconds, for the statements of exec_immediate and prepare */
+	long c_native_types;
+	long c_lob_reader;
 	int handle_active;
 	SQLSMALLINT error_recno_tracker;
 	SQLSMALLINT errormsg_recno_tracker;
 	int flag_pconnect; /* Indicates that this connection is persistent */
+
+	/* Prepared statement cache of ibm_db.prepare, see ATTR_STMT_CACHE_SIZE */
+	int c_stmt_cache_size;		/* entries in stmt_cache, 0 disables the cache */
+	stmt_cache_entry *stmt_cache;
+	PyObject *stmt_cache_index;	/* dictionary of cache key to entry number */
+	unsigned long stmt_cache_clock;
+	long stmt_cache_hits;
+	long stmt_cache_misses;
+	long stmt_cache_evictions;
+
+	/* Persistent connections, see ibm_db.pconnect */
+	conn_pool *pool;			/* sub-pool of the connection, NULL if not pooled */
+	int pool_checked_out;
+	time_t pool_idle_since;
+
+	ibm_db_stats *stats;		/* shared with the statements of the connection */
 } conn_handle;
 
 static void _python_ibm_db_free_conn_struct(conn_handle *handle);
@@ -158,6 +267,9 @@ typedef union {
 typedef struct {
 	SQLINTEGER out_length;
 	ibm_db_row_data_type data;
+	SQLPOINTER buffer;			/* column-wise bound block of values */
+	SQLINTEGER buffer_size;		/* size of one value in buffer */
+	SQLLEN *out_lengths;		/* length/indicator of each row in buffer */
 } ibm_db_row_type;
 
 typedef struct _ibm_db_result_set_info_struct {
@@ -170,34 +282,63 @@ typedef struct _ibm_db_result_set_info_struct {
 	SQLINTEGER loc_ind;
 	SQLSMALLINT loc_type;
 	unsigned char *mem_alloc;  /* Mem free */
+	PyObject *key;			/* interned name, dictionary key of the column */
+	PyObject *position;		/* column number, dictionary key for FETCH_BOTH */
 } ibm_db_result_set_info;
 
-typedef struct _row_hash_struct {
-	PyObject *hash;
-} row_hash_struct;
-
 typedef struct _stmt_handle_struct {
 	PyObject_HEAD
 	SQLHANDLE hdbc;
 	SQLHANDLE hstmt;
+	SQLHANDLE lob_hstmt;	/* locator operations, allocated on first use */
 	long s_bin_mode;
 	long cursor_type;
 	long s_case_mode;
+	long s_native_types;
+	long s_lob_reader;
 	SQLSMALLINT error_recno_tracker;
 	SQLSMALLINT errormsg_recno_tracker;
 
-	/* Parameter Caching variables */
-	param_node *head_cache_list;
-	param_node *current_node;
+	/* Parameter Caching variables, indexed by param_num - 1 */
+	param_node *param_cache;	/* entries with a param_num of 0 are not set */
+	param_desc param_descs;
+	int param_cache_size;	/* entries allocated in param_cache and param_descs */
+	int current_param;		/* last param execute bound a value of its tuple to */
+	int dynamic_params;		/* entries were set by execute, not by bind_param */
 
 	int num_params;		  /* Number of Params */
 	int file_param;		  /* if option passed in is FILE_PARAM */
 	int num_columns;
 	ibm_db_result_set_info *column_info;
 	ibm_db_row_type *row_data;
+
+	/* Row array (block) fetch variables */
+	SQLUINTEGER row_array_size;	/* requested rows per block, 0 == default */
+	SQLUINTEGER bound_array_size;	/* rows the column buffers are bound for */
+	SQLULEN rows_fetched;			/* rows in the current block */
+	SQLULEN row_block_pos;		/* next row of the current block to return */
+	long bound_native_types;	/* s_native_types when the columns were bound */
+
+	/* Parameter array variables of execute_many */
+	SQLUINTEGER paramset_size;	/* requested rows per execution, 0 == default */
+
+	int async_pending;		/* an ibm_db.execute_async of the statement runs */
+	int options_changed;	/* ibm_db.set_option was called, not reused by the cache */
+	SQLUINTEGER query_timeout;	/* SQL_ATTR_QUERY_TIMEOUT set on hstmt, 0 == no limit */
+
+	/* Column names shared by the rows of ibm_db.fetch_row_object() */
+	PyObject *row_names;		/* tuple of the column keys */
+	PyObject *row_index;		/* dictionary of column key to position */
+
+	/* Performance counters, see ibm_db.get_stats */
+	ibm_db_stats stats;
+	ibm_db_stats *conn_stats;	/* counters of the connection, referenced */
+
+	PyObject *sql;			/* statement text, reported by the trace hook */
 } stmt_handle;
 
 static void _python_ibm_db_free_stmt_struct(stmt_handle *handle);
+static PyObject *_python_ibm_db_get_column_value(stmt_handle *stmt_res, int column_number);
 
 static PyTypeObject stmt_handleType = {
 	PyObject_HEAD_INIT(NULL)
@@ -239,3613 +380,4595 @@ static PyTypeObject stmt_handleType = {
 	0,						 /* tp_init			*/
 };
 
-/* equivalent functions on different platforms */
-#ifdef _WIN32
-#define STRCASECMP stricmp
-#else
-#define STRCASECMP strcasecmp
-#endif
-
-static void python_ibm_db_init_globals(struct _ibm_db_globals *ibm_db_globals) {
-	/* env handle */
-	ibm_db_globals->bin_mode = 1;
+/* Block of fixed-width values of one column, taken over from the column-wise
+ * bound buffers by ibm_db.fetch_block() and exported read-only through the
+ * buffer protocol; shape and strides point into the block */
+typedef struct _column_block_struct {
+	PyObject_HEAD
+	char *buffer;			/* allocation owned by the block */
+	char *data;				/* first value of the block in buffer */
+	Py_ssize_t length;		/* number of values */
+	Py_ssize_t itemsize;	/* size of one value */
+	char *format;			/* struct module format of one value */
+	PyObject *indicators;	/* block of length/indicator values, NULL for an indicator block */
+} column_block;
+
+static void _python_ibm_db_free_column_block(column_block *self)
+{
+	if ( self->buffer != NULL ) {
+		PyMem_Del(self->buffer);
+	}
+	Py_XDECREF(self->indicators);
+	self->ob_type->tp_free((PyObject*)self);
+}
 
-	memset(ibm_db_globals->__python_conn_err_msg, 0, DB2_MAX_ERR_MSG_LEN);
-	memset(ibm_db_globals->__python_stmt_err_msg, 0, DB2_MAX_ERR_MSG_LEN);
-	memset(ibm_db_globals->__python_conn_err_state, 0, SQL_SQLSTATE_SIZE + 1);
-	memset(ibm_db_globals->__python_stmt_err_state, 0, SQL_SQLSTATE_SIZE + 1);
+static Py_ssize_t _python_ibm_db_column_block_length(column_block *self)
+{
+	return self->length;
 }
 
-static PyObject *persistent_list;
+static PyObject *_python_ibm_db_column_block_item(column_block *self, Py_ssize_t i)
+{
+	char *value;
 
-char *estrdup(char *data) {
-	int len = strlen(data);
-	char *dup = ALLOC_N(char, len+1);
-	if ( dup == NULL ) {
-		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+	if ( i < 0 || i >= self->length ) {
+		PyErr_SetString(PyExc_IndexError, "column block index out of range");
 		return NULL;
 	}
-	strcpy(dup, data);
-	return dup;
-} 
-	
-char *estrndup(char *data, int max) {
-	int len = strlen(data);
-	char *dup;
-	if (len > max){
-		len = max;
-	}
-	dup = ALLOC_N(char, len+1);
-	if ( dup == NULL ) {
-		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-		return NULL;
-	}
-	strcpy(dup, data);
-	return dup;
-} 
-	
-char *strtolower(char *data, int max) {
-	while (max--){
-		data[max] = tolower(data[max]);
+	value = self->data + i * self->itemsize;
+	switch(self->format[0]) {
+		case 'h':
+			return PyInt_FromLong(*(SQLSMALLINT *)value);
+		case 'i':
+			return PyInt_FromLong(*(SQLINTEGER *)value);
+		case 'l':
+			return PyInt_FromLong(*(long *)value);
+		case 'q':
+			return PyLong_FromLongLong(*(PY_LONG_LONG *)value);
+		case 'f':
+			return PyFloat_FromDouble(*(SQLREAL *)value);
+		default:
+			return PyFloat_FromDouble(*(SQLDOUBLE *)value);
 	}
-	return data;
-} 
-	
-char *strtoupper(char *data, int max) {
-	while (max--){
-		data[max] = toupper(data[max]);
+}
+
+static Py_ssize_t _python_ibm_db_column_block_readbuffer(column_block *self, Py_ssize_t segment, void **ptr)
+{
+	if ( segment != 0 ) {
+		PyErr_SetString(PyExc_SystemError, "accessing non-existent column block segment");
+		return -1;
 	}
-	return data;
-} 
+	*ptr = self->data;
+	return self->length * self->itemsize;
+}
 
-/*	static void _python_ibm_db_free_conn_struct */
-static void _python_ibm_db_free_conn_struct(conn_handle *handle) {
-	int rc;
+static Py_ssize_t _python_ibm_db_column_block_segcount(column_block *self, Py_ssize_t *lenp)
+{
+	if ( lenp != NULL ) {
+		*lenp = self->length * self->itemsize;
+	}
+	return 1;
+}
 
-	/* Disconnect from DB. If stmt is allocated, it is freed automatically */
-	if ( handle->handle_active && !handle->flag_pconnect) {
-		if(handle->auto_commit == 0){
-			rc = SQLEndTran(SQL_HANDLE_DBC, (SQLHDBC)handle->hdbc, SQL_ROLLBACK);
-		}
-		rc = SQLDisconnect((SQLHDBC)handle->hdbc);
-		rc = SQLFreeHandle(SQL_HANDLE_DBC, handle->hdbc);
-		rc = SQLFreeHandle(SQL_HANDLE_ENV, handle->henv);
+static int _python_ibm_db_column_block_getbuffer(column_block *self, Py_buffer *view, int flags)
+{
+	if ( PyBuffer_FillInfo(view, (PyObject *)self, self->data, 
+		self->length * self->itemsize, 1, flags) < 0 ) {
+		return -1;
 	}
-	handle->ob_type->tp_free((PyObject*)handle);
+	view->itemsize = self->itemsize;
+	if ( flags & PyBUF_FORMAT ) {
+		view->format = self->format;
+	}
+	if ( flags & PyBUF_ND ) {
+		view->shape = &self->length;
+	}
+	if ( flags & PyBUF_STRIDES ) {
+		view->strides = &self->itemsize;
+	}
+	return 0;
 }
 
-/*	static void _python_ibm_db_free_row_struct */
-/*
- * static void _python_ibm_db_free_row_struct(row_hash_struct *handle) {
- *  free(handle);
- * }
- */
+static PySequenceMethods column_block_as_sequence = {
+	(lenfunc)_python_ibm_db_column_block_length,	/* sq_length */
+	0,											/* sq_concat */
+	0,											/* sq_repeat */
+	(ssizeargfunc)_python_ibm_db_column_block_item,	/* sq_item */
+};
 
-/*	static void _python_ibm_db_free_result_struct(stmt_handle* handle) */
-static void _python_ibm_db_free_result_struct(stmt_handle* handle) {
-	int i;
-	param_node *curr_ptr = NULL, *prev_ptr = NULL;
+static PyBufferProcs column_block_as_buffer = {
+	(readbufferproc)_python_ibm_db_column_block_readbuffer,	/* bf_getreadbuffer */
+	0,														/* bf_getwritebuffer */
+	(segcountproc)_python_ibm_db_column_block_segcount,		/* bf_getsegcount */
+	0,														/* bf_getcharbuffer */
+	(getbufferproc)_python_ibm_db_column_block_getbuffer,		/* bf_getbuffer */
+	0,														/* bf_releasebuffer */
+};
 
-	if ( handle != NULL ) {
-		/* Free param cache list */
-		curr_ptr = handle->head_cache_list;
-		prev_ptr = handle->head_cache_list;
+static PyMemberDef column_block_members[] = {
+	{"format", T_STRING, offsetof(column_block, format), READONLY, "struct module format of one value"},
+	{"indicators", T_OBJECT, offsetof(column_block, indicators), READONLY, "Length/indicator block, SQL_NULL_DATA for NULL values"},
+	{NULL} /* Sentinel */
+};
 
-		while (curr_ptr != NULL) {
-			curr_ptr = curr_ptr->next;
-			if (prev_ptr->varname) {
-				PyMem_Del(prev_ptr->varname);
-				prev_ptr->varname = NULL;
-			}
-			if (prev_ptr->svalue){ 
-				PyMem_Del(prev_ptr->svalue);
-				prev_ptr->svalue = NULL;
-			}
-			if (prev_ptr->uvalue){ 
-				PyMem_Del(prev_ptr->uvalue);
-				prev_ptr->uvalue = NULL;
-			}
-			PyMem_Del(prev_ptr);
+static PyTypeObject column_blockType = {
+	PyObject_HEAD_INIT(NULL)
+	0,						 /*ob_size			*/
+	"ibm_db.IBM_DBColumnBlock", /*tp_name			 */
+	sizeof(column_block), /*tp_basicsize			 */
+	0,						 /*tp_itemsize		*/
+	(destructor)_python_ibm_db_free_column_block, /*tp_dealloc	*/
+	0,						 /*tp_print			*/
+	0,						 /*tp_getattr		 */
+	0,						 /*tp_setattr		 */
+	0,						 /*tp_compare		 */
+	0,						 /*tp_repr			*/
+	0,						 /*tp_as_number		*/
+	&column_block_as_sequence, /*tp_as_sequence	 */
+	0,						 /*tp_as_mapping	  */
+	0,						 /*tp_hash			*/
+	0,						 /*tp_call			*/
+	0,						 /*tp_str			 */
+	0,						 /*tp_getattro		*/
+	0,						 /*tp_setattro		*/
+	&column_block_as_buffer,	 /*tp_as_buffer		*/
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER, /*tp_flags			*/
+	"IBM DataServer column block object", /* tp_doc		*/
+	0,						 /* tp_traverse		*/
+	0,						 /* tp_clear		  */
+	0,						 /* tp_richcompare	*/
+	0,						 /* tp_weaklistoffset */
+	0,						 /* tp_iter			*/
+	0,						 /* tp_iternext		*/
+	0,						 /* tp_methods		*/
+	column_block_members,	 /* tp_members		*/
+	0,						 /* tp_getset		 */
+	0,						 /* tp_base			*/
+	0,						 /* tp_dict			*/
+	0,						 /* tp_descr_get	  */
+	0,						 /* tp_descr_set	  */
+	0,						 /* tp_dictoffset	 */
+	0,						 /* tp_init			*/
+};
 
-			prev_ptr = curr_ptr;
-		}
-		/* free row data cache */
-		if (handle->row_data) {
-			for (i = 0; i<handle->num_columns; i++) {
-				switch (handle->column_info[i].type) {
-					case SQL_CHAR:
-					case SQL_VARCHAR:
-					case SQL_LONGVARCHAR:
-					case SQL_WCHAR:
-					case SQL_WVARCHAR:
-					case SQL_GRAPHIC:
-					case SQL_VARGRAPHIC:
-					case SQL_LONGVARGRAPHIC:
-					case SQL_TYPE_DATE:
-					case SQL_TYPE_TIME:
-					case SQL_TYPE_TIMESTAMP:
-					case SQL_BIGINT:
-					case SQL_DECIMAL:
-					case SQL_NUMERIC:
-					case SQL_XML:
-					case SQL_DECFLOAT:
-						if ( handle->row_data[i].data.str_val != NULL ) {
-							PyMem_Del(handle->row_data[i].data.str_val);
-							handle->row_data[i].data.str_val = NULL;
-						}
-						if ( handle->row_data[i].data.w_val != NULL ) {
-							PyMem_Del(handle->row_data[i].data.w_val);
-							handle->row_data[i].data.w_val = NULL;
-						}
-				}
-			}
-			PyMem_Del(handle->row_data);
-			handle->row_data = NULL;
-		}
+/* Row returned by ibm_db.fetch_row_object(), the values are held like a tuple
+ * and the column names are shared by all the rows of the result set */
+typedef struct _row_object_struct {
+	PyObject_VAR_HEAD
+	PyObject *names;		/* tuple of the column keys of the result set */
+	PyObject *index;		/* dictionary of column key to position */
+	PyObject *values[1];
+} row_object;
 
-		/* free column info cache */
-		if ( handle->column_info ) {
-			for (i = 0; i<handle->num_columns; i++) {
-				PyMem_Del(handle->column_info[i].name);
-				/* Mem free */
-				if(handle->column_info[i].mem_alloc){
-					PyMem_Del(handle->column_info[i].mem_alloc);
-				}
-			}
-			PyMem_Del(handle->column_info);
-			handle->column_info = NULL;
-			handle->num_columns = 0;
-		}
+static PyTypeObject row_objectType;
+
+static void _python_ibm_db_free_row_object(row_object *self)
+{
+	Py_ssize_t i;
+
+	for (i = 0; i < Py_SIZE(self); i++) {
+		Py_XDECREF(self->values[i]);
 	}
+	Py_XDECREF(self->names);
+	Py_XDECREF(self->index);
+	self->ob_type->tp_free((PyObject*)self);
 }
 
-/* static stmt_handle *_ibm_db_new_stmt_struct(conn_handle* conn_res) */	
-static stmt_handle *_ibm_db_new_stmt_struct(conn_handle* conn_res) {
-	stmt_handle *stmt_res;
-
-	stmt_res = PyObject_NEW(stmt_handle, &stmt_handleType);
-	/* memset(stmt_res, 0, sizeof(stmt_handle)); */
+/*	static PyObject *_python_ibm_db_row_object_tuple(row_object *self)
+	tuple of the values of the row
+*/
+static PyObject *_python_ibm_db_row_object_tuple(row_object *self)
+{
+	PyObject *tuple;
+	Py_ssize_t i;
 
-	/* Initialize stmt resource so parsing assigns updated options if needed */
-	stmt_res->hdbc = conn_res->hdbc;
-	stmt_res->s_bin_mode = conn_res->c_bin_mode;
-	stmt_res->cursor_type = conn_res->c_cursor_type;
-	stmt_res->s_case_mode = conn_res->c_case_mode;
+	tuple = PyTuple_New(Py_SIZE(self));
+	if ( tuple == NULL ) {
+		return NULL;
+	}
+	for (i = 0; i < Py_SIZE(self); i++) {
+		Py_INCREF(self->values[i]);
+		PyTuple_SET_ITEM(tuple, i, self->values[i]);
+	}
+	return tuple;
+}
 
-	stmt_res->head_cache_list = NULL;
-	stmt_res->current_node = NULL;
+static Py_ssize_t _python_ibm_db_row_object_length(row_object *self)
+{
+	return Py_SIZE(self);
+}
 
-	stmt_res->num_params = 0;
-	stmt_res->file_param = 0;
+static PyObject *_python_ibm_db_row_object_item(row_object *self, Py_ssize_t i)
+{
+	if ( i < 0 || i >= Py_SIZE(self) ) {
+		PyErr_SetString(PyExc_IndexError, "row index out of range");
+		return NULL;
+	}
+	Py_INCREF(self->values[i]);
+	return self->values[i];
+}
 
-	stmt_res->column_info = NULL;
-	stmt_res->num_columns = 0;
+/*	static PyObject *_python_ibm_db_row_object_subscript(row_object *self, PyObject *key)
+	row[position], row[slice] or row[column name]
+*/
+static PyObject *_python_ibm_db_row_object_subscript(row_object *self, PyObject *key)
+{
+	PyObject *position;
+	PyObject *tuple;
+	PyObject *value;
+	Py_ssize_t i;
+
+	if ( PyIndex_Check(key) ) {
+		i = PyNumber_AsSsize_t(key, PyExc_IndexError);
+		if ( i == -1 && PyErr_Occurred() ) {
+			return NULL;
+		}
+		if ( i < 0 ) {
+			i += Py_SIZE(self);
+		}
+		return _python_ibm_db_row_object_item(self, i);
+	}
+	if ( PySlice_Check(key) ) {
+		tuple = _python_ibm_db_row_object_tuple(self);
+		if ( tuple == NULL ) {
+			return NULL;
+		}
+		value = PyObject_GetItem(tuple, key);
+		Py_DECREF(tuple);
+		return value;
+	}
+	position = PyDict_GetItem(self->index, key);
+	if ( position == NULL ) {
+		PyErr_SetObject(PyExc_KeyError, key);
+		return NULL;
+	}
+	return _python_ibm_db_row_object_item(self, PyInt_AS_LONG(position));
+}
 
-	stmt_res->error_recno_tracker = 1;
-	stmt_res->errormsg_recno_tracker = 1;
+/*	static PyObject *_python_ibm_db_row_object_getattro(row_object *self, PyObject *name)
+	row.column_name, columns take precedence over the methods of the row
+*/
+static PyObject *_python_ibm_db_row_object_getattro(row_object *self, PyObject *name)
+{
+	PyObject *position;
 
-	stmt_res->row_data = NULL;
+	position = PyDict_GetItem(self->index, name);
+	if ( position != NULL ) {
+		return _python_ibm_db_row_object_item(self, PyInt_AS_LONG(position));
+	}
+	return PyObject_GenericGetAttr((PyObject *)self, name);
+}
 
-	return stmt_res;
+static PyObject *_python_ibm_db_row_object_repr(row_object *self)
+{
+	PyObject *result;
+	PyObject *value_repr;
+	Py_ssize_t i;
+
+	result = PyString_FromString("IBM_DBRow(");
+	for (i = 0; i < Py_SIZE(self) && result != NULL; i++) {
+		value_repr = PyObject_Repr(self->values[i]);
+		if ( value_repr == NULL ) {
+			Py_DECREF(result);
+			return NULL;
+		}
+		PyString_ConcatAndDel(&result, PyString_FromFormat("%s%s=%s", 
+			i > 0 ? ", " : "", PyString_AsString(PyTuple_GET_ITEM(self->names, i)),
+			PyString_AsString(value_repr)));
+		Py_DECREF(value_repr);
+	}
+	PyString_ConcatAndDel(&result, PyString_FromString(")"));
+	return result;
 }
 
-/*	static _python_ibm_db_free_stmt_struct */
-static void _python_ibm_db_free_stmt_struct(stmt_handle *handle) {
-	int rc;
-	
-	rc = SQLFreeHandle( SQL_HANDLE_STMT, handle->hstmt);
-	if ( handle ) {
-		_python_ibm_db_free_result_struct(handle);
+/*	static PyObject *_python_ibm_db_row_object_richcompare(PyObject *self, PyObject *other, int op)
+	rows compare like the tuple of their values
+*/
+static PyObject *_python_ibm_db_row_object_richcompare(PyObject *self, PyObject *other, int op)
+{
+	PyObject *left;
+	PyObject *right;
+	PyObject *result;
+
+	if ( !PyObject_TypeCheck(self, &row_objectType) ) {
+		Py_INCREF(Py_NotImplemented);
+		return Py_NotImplemented;
+	}
+	if ( PyObject_TypeCheck(other, &row_objectType) ) {
+		right = _python_ibm_db_row_object_tuple((row_object *)other);
+	} else if ( PyTuple_Check(other) ) {
+		right = other;
+		Py_INCREF(right);
+	} else {
+		Py_INCREF(Py_NotImplemented);
+		return Py_NotImplemented;
 	}
-	handle->ob_type->tp_free((PyObject*)handle);
+	if ( right == NULL ) {
+		return NULL;
+	}
+	left = _python_ibm_db_row_object_tuple((row_object *)self);
+	if ( left == NULL ) {
+		Py_DECREF(right);
+		return NULL;
+	}
+	result = PyObject_RichCompare(left, right, op);
+	Py_DECREF(left);
+	Py_DECREF(right);
+	return result;
 }
 
-/*	static void _python_ibm_db_init_error_info(stmt_handle *stmt_res) */
-static void _python_ibm_db_init_error_info(stmt_handle *stmt_res) {
-	stmt_res->error_recno_tracker = 1;
-	stmt_res->errormsg_recno_tracker = 1;
+static long _python_ibm_db_row_object_hash(row_object *self)
+{
+	PyObject *tuple;
+	long hash;
+
+	tuple = _python_ibm_db_row_object_tuple(self);
+	if ( tuple == NULL ) {
+		return -1;
+	}
+	hash = PyObject_Hash(tuple);
+	Py_DECREF(tuple);
+	return hash;
 }
 
-/*	static void _python_ibm_db_check_sql_errors( SQLHANDLE handle, SQLSMALLINT hType, int rc, int cpy_to_global, char* ret_str, int API SQLSMALLINT recno)
-*/
-static void _python_ibm_db_check_sql_errors( SQLHANDLE handle, SQLSMALLINT hType, int rc, int cpy_to_global, char* ret_str, int API, SQLSMALLINT recno )
+static PyObject *_python_ibm_db_row_object_keys(row_object *self)
 {
-	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
-	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
-	SQLCHAR errMsg[DB2_MAX_ERR_MSG_LEN];
-	SQLINTEGER sqlcode;
-	SQLSMALLINT length;
-	char *p;
+	return PySequence_List(self->names);
+}
 
-	memset(errMsg, '\0', DB2_MAX_ERR_MSG_LEN);
-	memset(msg, '\0', SQL_MAX_MESSAGE_LENGTH + 1);
-	if ( SQLGetDiagRec(hType, handle, recno, sqlstate, &sqlcode, msg,
-		SQL_MAX_MESSAGE_LENGTH + 1, &length ) == SQL_SUCCESS) {
+static PySequenceMethods row_object_as_sequence = {
+	(lenfunc)_python_ibm_db_row_object_length,	/* sq_length */
+	0,										/* sq_concat */
+	0,										/* sq_repeat */
+	(ssizeargfunc)_python_ibm_db_row_object_item,	/* sq_item */
+};
 
-			while ((p = strchr( (char *)msg, '\n' ))) {
-				*p = '\0';
-			}
-			sprintf((char*)errMsg, "%s SQLCODE=%d", (char*)msg, (int)sqlcode);
-			if (cpy_to_global != 0) {
-				PyErr_SetString(PyExc_Exception, (char *) errMsg);
-			}
+static PyMappingMethods row_object_as_mapping = {
+	(lenfunc)_python_ibm_db_row_object_length,		/* mp_length */
+	(binaryfunc)_python_ibm_db_row_object_subscript,	/* mp_subscript */
+	0,											/* mp_ass_subscript */
+};
 
-			switch (rc) {
-				case SQL_ERROR:
-					/* Need to copy the error msg and sqlstate into the symbol Table 
-					* to cache these results */
-					if ( cpy_to_global ) {
-						switch (hType) {
-							case SQL_HANDLE_DBC:
-								strncpy(IBM_DB_G(__python_conn_err_state), (char*)sqlstate, SQL_SQLSTATE_SIZE+1);
-								strncpy(IBM_DB_G(__python_conn_err_msg), (char*)errMsg, DB2_MAX_ERR_MSG_LEN);
-								break;
+static PyMethodDef row_object_methods[] = {
+	{"keys", (PyCFunction)_python_ibm_db_row_object_keys, METH_NOARGS, "Returns the list of the column names of the row"},
+	{NULL} /* Sentinel */
+};
 
-							case SQL_HANDLE_STMT:
-								strncpy(IBM_DB_G(__python_stmt_err_state), (char*)sqlstate, SQL_SQLSTATE_SIZE+1);
-								strncpy(IBM_DB_G(__python_stmt_err_msg), (char*)errMsg, DB2_MAX_ERR_MSG_LEN);
-								break;
-						}
-					}
-					/* This call was made from ibm_db_errmsg or ibm_db_error */
-					/* Check for error and return */
-					switch (API) {
-						case DB2_ERR:
-							if ( ret_str != NULL ) {
-								strncpy(ret_str, (char*)sqlstate, SQL_SQLSTATE_SIZE+1);
-							}
-							return;
-						case DB2_ERRMSG:
-							if ( ret_str != NULL ) {
-								strncpy(ret_str, (char*)errMsg, DB2_MAX_ERR_MSG_LEN);
-							}
-							return;
-						default:
-							break;
-					}
-					break;
-				default:
-					break;
-			}
-		}
+static PyTypeObject row_objectType = {
+	PyObject_HEAD_INIT(NULL)
+	0,						 /*ob_size			*/
+	"ibm_db.IBM_DBRow",		 /*tp_name			 */
+	sizeof(row_object) - sizeof(PyObject *), /*tp_basicsize			 */
+	sizeof(PyObject *),		 /*tp_itemsize		*/
+	(destructor)_python_ibm_db_free_row_object, /*tp_dealloc	*/
+	0,						 /*tp_print			*/
+	0,						 /*tp_getattr		 */
+	0,						 /*tp_setattr		 */
+	0,						 /*tp_compare		 */
+	(reprfunc)_python_ibm_db_row_object_repr, /*tp_repr			*/
+	0,						 /*tp_as_number		*/
+	&row_object_as_sequence, /*tp_as_sequence	 */
+	&row_object_as_mapping,	 /*tp_as_mapping	  */
+	(hashfunc)_python_ibm_db_row_object_hash, /*tp_hash			*/
+	0,						 /*tp_call			*/
+	0,						 /*tp_str			 */
+	(getattrofunc)_python_ibm_db_row_object_getattro, /*tp_getattro		*/
+	0,						 /*tp_setattro		*/
+	0,						 /*tp_as_buffer		*/
+	Py_TPFLAGS_DEFAULT,		/*tp_flags			*/
+	"IBM DataServer result set row object", /* tp_doc		*/
+	0,						 /* tp_traverse		*/
+	0,						 /* tp_clear		  */
+	_python_ibm_db_row_object_richcompare, /* tp_richcompare	*/
+	0,						 /* tp_weaklistoffset */
+	0,						 /* tp_iter			*/
+	0,						 /* tp_iternext		*/
+	row_object_methods,		 /* tp_methods		*/
+	0,						 /* tp_members		*/
+	0,						 /* tp_getset		 */
+	0,						 /* tp_base			*/
+	0,						 /* tp_dict			*/
+	0,						 /* tp_descr_get	  */
+	0,						 /* tp_descr_set	  */
+	0,						 /* tp_dictoffset	 */
+	0,						 /* tp_init			*/
+};
+
+/* BLOB, CLOB or DBCLOB value returned with ATTR_LOB_READER on, read in
+ * chunks through the locator it was fetched with */
+typedef struct _lob_reader_struct {
+	PyObject_HEAD
+	stmt_handle *stmt;		/* statement the locator was fetched from */
+	SQLSMALLINT loc_type;
+	SQLINTEGER locator;
+	SQLINTEGER length;		/* in the units of the LOB, -1 until asked for */
+	SQLINTEGER position;	/* offset of the next read */
+} lob_reader;
+
+static PyTypeObject lob_readerType;
+
+static RETCODE _python_ibm_db_get_lob_length(stmt_handle *stmt_res, SQLSMALLINT loc_type, SQLINTEGER locator, SQLINTEGER *length, SQLINTEGER *ind);
+static RETCODE _python_ibm_db_get_lob_substring(stmt_handle *stmt_res, SQLSMALLINT loc_type, SQLINTEGER locator, SQLUINTEGER start, SQLUINTEGER for_length, SQLSMALLINT ctype, SQLPOINTER buff, SQLINTEGER buff_length, SQLINTEGER *out_length, SQLINTEGER *ind);
+
+static void _python_ibm_db_free_lob_reader(lob_reader *self)
+{
+	Py_XDECREF(self->stmt);
+	self->ob_type->tp_free((PyObject*)self);
 }
 
-/*	static int _python_ibm_db_assign_options( void *handle, int type, long opt_key, PyObject *data ) */
-static int _python_ibm_db_assign_options( void *handle, int type, long opt_key, PyObject *data )
+/*	static PyObject *_python_ibm_db_new_lob_reader(stmt_handle *stmt_res, int col)
+	reader of the LOB value of column col of the current row, None when the
+	value is NULL
+*/
+static PyObject *_python_ibm_db_new_lob_reader(stmt_handle *stmt_res, int col)
 {
-	int rc = 0;
-	long option_num = 0;
-	SQLWCHAR *option_str = NULL;
-	int isNewBuffer;
+	lob_reader *reader;
 
-	/* First check to see if it is a non-cli attribut */
-	if (opt_key == ATTR_CASE) {
-		option_num = NUM2LONG(data);
-		if (type == SQL_HANDLE_STMT) {
-			switch (option_num) {
-				case CASE_LOWER:
-					((stmt_handle*)handle)->s_case_mode = CASE_LOWER;
-					break;
-				case CASE_UPPER:
-					((stmt_handle*)handle)->s_case_mode = CASE_UPPER;
-					break;
-				case CASE_NATURAL:
-					((stmt_handle*)handle)->s_case_mode = CASE_NATURAL;
-					break;
-				default:
-					PyErr_SetString(PyExc_Exception, "ATTR_CASE attribute must be one of CASE_LOWER, CASE_UPPER, or CASE_NATURAL");
-					return -1;
-			}
-		} else if (type == SQL_HANDLE_DBC) {
-			switch (option_num) {
-				case CASE_LOWER:
-					((conn_handle*)handle)->c_case_mode = CASE_LOWER;
-					break;
-				case CASE_UPPER:
-					((conn_handle*)handle)->c_case_mode = CASE_UPPER;
-					break;
-				case CASE_NATURAL:
-					((conn_handle*)handle)->c_case_mode = CASE_NATURAL;
-					break;
-				default:
-					PyErr_SetString(PyExc_Exception, "ATTR_CASE attribute must be one of CASE_LOWER, CASE_UPPER, or CASE_NATURAL");
-					return -1;
-			}
-		} else {
-			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
-			return -1;
-		}
-	} else if (type == SQL_HANDLE_STMT) {
-		if (PyString_Check(data)|| PyUnicode_Check(data)) {
-			data = PyUnicode_FromObject(data);
-			option_str = getUnicodeDataAsSQLWCHAR(data, &isNewBuffer);
-			rc = SQLSetStmtAttrW((SQLHSTMT)((stmt_handle *)handle)->hstmt, opt_key, (SQLPOINTER)option_str, SQL_IS_INTEGER );
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			}
-			if (isNewBuffer)
-				PyMem_Del(option_str);
-			
-		} else {
-			option_num = NUM2LONG(data);
-			if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_OFF) ((conn_handle*)handle)->auto_commit = 0;
-			else if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_ON) ((conn_handle*)handle)->auto_commit = 1;
-			rc = SQLSetStmtAttr((SQLHSTMT)((stmt_handle *)handle)->hstmt, opt_key, (SQLPOINTER)option_num, SQL_IS_INTEGER );
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			}
-		}
-	} else if (type == SQL_HANDLE_DBC) {
-		if (PyString_Check(data)|| PyUnicode_Check(data)) {
-			data = PyUnicode_FromObject(data);
-			option_str = getUnicodeDataAsSQLWCHAR(data, &isNewBuffer);
-			rc = SQLSetConnectAttrW((SQLHSTMT)((conn_handle*)handle)->hdbc, opt_key, (SQLPOINTER)option_str, SQL_NTS);
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			}
-			if (isNewBuffer)
-				PyMem_Del(option_str);
-			
-		} else {
-			option_num = NUM2LONG(data);
-			if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_OFF) ((conn_handle*)handle)->auto_commit = 0;
-			else if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_ON) ((conn_handle*)handle)->auto_commit = 1;
-			rc = SQLSetConnectAttrW((SQLHSTMT)((conn_handle*)handle)->hdbc, opt_key, (SQLPOINTER)option_num, SQL_IS_INTEGER);
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			}
-		}
-	} else {
-		PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
-		return -1;
+	if ( stmt_res->column_info[col].loc_ind == SQL_NULL_DATA ) {
+		Py_INCREF(Py_None);
+		return Py_None;
 	}
-	return 0;
+	reader = PyObject_NEW(lob_reader, &lob_readerType);
+	if ( reader == NULL ) {
+		return NULL;
+	}
+	Py_INCREF(stmt_res);
+	reader->stmt = stmt_res;
+	reader->loc_type = stmt_res->column_info[col].loc_type;
+	reader->locator = stmt_res->column_info[col].lob_loc;
+	reader->length = -1;
+	reader->position = 0;
+	return (PyObject *)reader;
 }
 
-/*	static int _python_ibm_db_parse_options( PyObject *options, int type, void *handle)
+/*	static Py_ssize_t _python_ibm_db_lob_reader_length(lob_reader *self)
+	length of the value, asked to the server on first use
 */
-static int _python_ibm_db_parse_options ( PyObject *options, int type, void *handle )
+static Py_ssize_t _python_ibm_db_lob_reader_length(lob_reader *self)
 {
-	int numOpts = 0, i = 0;
-	PyObject *keys = NULL;
-	PyObject *key = NULL; /* Holds the Option Index Key */
-	PyObject *data = NULL;
-	PyObject *tc_pass = NULL;
-	int rc = 0;
-
-	if ( !NIL_P(options) ) {
-		keys = PyDict_Keys(options);
-		numOpts = PyList_Size(keys);
-
-		for ( i = 0; i < numOpts; i++) {
-			key = PyList_GetItem(keys, i);
-			data = PyDict_GetItem(options, key);
+	SQLINTEGER ind = 0;
 
-			if(NUM2LONG(key) == SQL_ATTR_TRUSTED_CONTEXT_PASSWORD) {
-				tc_pass = data;
-			} else {
-				/* Assign options to handle. */
-				/* Sets the options in the handle with CLI/ODBC calls */
-				rc = _python_ibm_db_assign_options(handle, type, NUM2LONG(key), data);
-			}
-			if (rc)
-				return SQL_ERROR;
-		}
-		if (!NIL_P(tc_pass) ) {
-			rc = _python_ibm_db_assign_options(handle, type, SQL_ATTR_TRUSTED_CONTEXT_PASSWORD, tc_pass);
+	if ( self->length < 0 ) {
+		if ( _python_ibm_db_get_lob_length(self->stmt, self->loc_type, 
+			self->locator, &self->length, &ind) == SQL_ERROR ) {
+			self->length = -1;
+			return -1;
 		}
-		if (rc)
-			return SQL_ERROR;
 	}
-	return SQL_SUCCESS;
+	return self->length;
 }
 
-/*	static int _python_ibm_db_get_result_set_info(stmt_handle *stmt_res)
-initialize the result set information of each column. This must be done once
+/*	static SQLINTEGER _python_ibm_db_lob_reader_remaining(lob_reader *self, Py_ssize_t size)
+	number of units the next read of size units returns, all the remaining
+	units when size is negative. -1 with an exception set on failure
 */
-static int _python_ibm_db_get_result_set_info(stmt_handle *stmt_res)
+static SQLINTEGER _python_ibm_db_lob_reader_remaining(lob_reader *self, Py_ssize_t size)
 {
-	int rc = -1, i;
-	SQLSMALLINT nResultCols = 0, name_length;
-	SQLCHAR tmp_name[BUFSIZ];
+	SQLINTEGER remaining;
 
-	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLNumResultCols((SQLHSTMT)stmt_res->hstmt, &nResultCols);
-	Py_END_ALLOW_THREADS;
+	if ( _python_ibm_db_lob_reader_length(self) < 0 ) {
+		return -1;
+	}
+	remaining = self->length > self->position ? self->length - self->position : 0;
+	if ( size >= 0 && size < remaining ) {
+		remaining = (SQLINTEGER)size;
+	}
+	return remaining;
+}
 
-	if ( rc == SQL_ERROR || nResultCols == 0) {
-	  _python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-									  SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-	  return -1;
+static PyObject *_python_ibm_db_lob_reader_read(lob_reader *self, PyObject *args)
+{
+	Py_ssize_t size = -1;
+	SQLINTEGER count, buffer_length, out_length = 0, ind = 0;
+	int is_binary = (self->loc_type == SQL_BLOB_LOCATOR);
+	char *buffer;
+	PyObject *value;
+
+	if (!PyArg_ParseTuple(args, "|n", &size))
+		return NULL;
+
+	count = _python_ibm_db_lob_reader_remaining(self, size);
+	if ( count < 0 ) {
+		return NULL;
 	}
-	stmt_res->num_columns = nResultCols;
-	stmt_res->column_info = ALLOC_N(ibm_db_result_set_info, nResultCols);
-	if ( stmt_res->column_info == NULL ) {
-	  PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-	  return -1;
+	if ( count == 0 ) {
+		return is_binary ? PyString_FromStringAndSize("", 0) : PyUnicode_FromUnicode(NULL, 0);
 	}
-	memset(stmt_res->column_info, 0, sizeof(ibm_db_result_set_info)*nResultCols);
-	/* return a set of attributes for a column */
-	for (i = 0 ; i < nResultCols; i++) {
-	  stmt_res->column_info[i].lob_loc = 0;
-	  stmt_res->column_info[i].loc_ind = 0;
-	  stmt_res->column_info[i].loc_type = 0;
 
-	  Py_BEGIN_ALLOW_THREADS;
-	  rc = SQLDescribeCol((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT)(i + 1 ),
-						  (SQLCHAR *)&tmp_name, BUFSIZ, &name_length, 
-						  &stmt_res->column_info[i].type,
-						  &stmt_res->column_info[i].size, 
-						  &stmt_res->column_info[i].scale,
-						  &stmt_res->column_info[i].nullable);
-	  Py_END_ALLOW_THREADS;
+	/* Character LOBs are converted to SQLWCHAR by the client */
+	buffer_length = is_binary ? count : (count + 1) * sizeof(SQLWCHAR);
+	buffer = ALLOC_N(char, buffer_length);
+	if ( buffer == NULL ) {
+		return PyErr_NoMemory();
+	}
+	if ( _python_ibm_db_get_lob_substring(self->stmt, self->loc_type, 
+		self->locator, self->position + 1, count, 
+		is_binary ? SQL_C_BINARY : SQL_C_WCHAR, buffer, buffer_length, 
+		&out_length, &ind) == SQL_ERROR ) {
+		PyMem_Del(buffer);
+		return NULL;
+	}
+	if ( out_length < 0 || out_length > buffer_length ) {
+		out_length = is_binary ? count : count * sizeof(SQLWCHAR);
+	}
+	if ( is_binary ) {
+		value = PyString_FromStringAndSize(buffer, out_length);
+	} else {
+		value = getSQLWCharAsPyUnicodeObject((SQLWCHAR *)buffer, out_length);
+	}
+	PyMem_Del(buffer);
+	if ( value != NULL ) {
+		self->position += count;
+	}
+	return value;
+}
 
-	  if ( rc == SQL_ERROR ) {
-		 _python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-										 SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-		 return -1;
-	  }
-	  if ( name_length <= 0 ) {
-		 stmt_res->column_info[i].name = (SQLCHAR *)estrdup("");
-		 if ( stmt_res->column_info[i].name == NULL ) {
-			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-			 return -1;
-		 }
+static PyObject *_python_ibm_db_lob_reader_readinto(lob_reader *self, PyObject *args)
+{
+	PyObject *target;
+	void *buffer;
+	Py_ssize_t size;
+	SQLINTEGER count, out_length = 0, ind = 0;
 
-	  } else if (name_length >= BUFSIZ ) {
-		 /* column name is longer than BUFSIZ */
-		 stmt_res->column_info[i].name = (SQLCHAR*)ALLOC_N(char, name_length+1);
-		 if ( stmt_res->column_info[i].name == NULL ) {
-			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-			 return -1;
-		 }
+	if (!PyArg_ParseTuple(args, "O", &target))
+		return NULL;
 
-		 Py_BEGIN_ALLOW_THREADS;
-		 rc = SQLDescribeCol((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT)(i + 1),
-							 stmt_res->column_info[i].name, name_length, 
-							 &name_length, &stmt_res->column_info[i].type, 
-							 &stmt_res->column_info[i].size, 
-							 &stmt_res->column_info[i].scale, 
-							 &stmt_res->column_info[i].nullable);
-		 Py_END_ALLOW_THREADS;
-
-		 if ( rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-											SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			return -1;
-		 }
-	  } else {
-		 stmt_res->column_info[i].name = (SQLCHAR*)estrdup((char*)tmp_name);
-		 if ( stmt_res->column_info[i].name == NULL ) {
-			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-			 return -1;
-		 }
-
-	  }
+	if ( self->loc_type != SQL_BLOB_LOCATOR ) {
+		PyErr_SetString(PyExc_Exception, "readinto() is only supported for BLOB values");
+		return NULL;
 	}
-	return 0;
+	if ( PyObject_AsWriteBuffer(target, &buffer, &size) < 0 ) {
+		return NULL;
+	}
+	count = _python_ibm_db_lob_reader_remaining(self, size);
+	if ( count < 0 ) {
+		return NULL;
+	}
+	if ( count > 0 ) {
+		if ( _python_ibm_db_get_lob_substring(self->stmt, self->loc_type, 
+			self->locator, self->position + 1, count, SQL_C_BINARY, 
+			buffer, count, &out_length, &ind) == SQL_ERROR ) {
+			return NULL;
+		}
+		self->position += count;
+	}
+	return PyInt_FromLong(count);
 }
 
-/*	static int _python_ibn_bind_column_helper(stmt_handle *stmt_res)
-	bind columns to data, this must be done once
-*/
-static int _python_ibm_db_bind_column_helper(stmt_handle *stmt_res)
+static PyObject *_python_ibm_db_lob_reader_seek(lob_reader *self, PyObject *args)
 {
-	SQLINTEGER in_length = 0;
-	SQLSMALLINT column_type;
-	ibm_db_row_data_type *row_data;
-	int i, rc = SQL_SUCCESS;
-
-	stmt_res->row_data = ALLOC_N(ibm_db_row_type, stmt_res->num_columns);
-	if ( stmt_res->row_data == NULL ) {
-		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-		return -1;
-	}
-	memset(stmt_res->row_data, 0, sizeof(ibm_db_row_type)*stmt_res->num_columns);
-
-	for (i = 0; i<stmt_res->num_columns; i++) {
-		column_type = stmt_res->column_info[i].type;
-		row_data = &stmt_res->row_data[i].data;
-		switch(column_type) {
-			case SQL_CHAR:
-			case SQL_VARCHAR:
-			case SQL_LONGVARCHAR:
-			case SQL_WCHAR:
-			case SQL_WVARCHAR:
-			case SQL_GRAPHIC:
-			case SQL_VARGRAPHIC:
-			case SQL_LONGVARGRAPHIC:
-				in_length = stmt_res->column_info[i].size+1;
-				row_data->w_val = (SQLWCHAR *) ALLOC_N(SQLWCHAR, in_length);
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_WCHAR, row_data->w_val, in_length * sizeof(SQLWCHAR),
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, 
-						-1, 1);
-				}
-				break;
+	Py_ssize_t offset;
+	int whence = 0;
+	Py_ssize_t position;
 
-			case SQL_BINARY:
-			case SQL_LONGVARBINARY:
-			case SQL_VARBINARY:
-				if ( stmt_res->s_bin_mode == CONVERT ) {
-					in_length = 2*(stmt_res->column_info[i].size)+1;
-					row_data->str_val = (SQLCHAR *)ALLOC_N(char, in_length);
-					if ( row_data->str_val == NULL ) {
-						PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-						return -1;
-					}
+	if (!PyArg_ParseTuple(args, "n|i", &offset, &whence))
+		return NULL;
 
-					Py_BEGIN_ALLOW_THREADS;
-					rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-						SQL_C_CHAR, row_data->str_val, in_length,
-						(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-					Py_END_ALLOW_THREADS;
+	switch (whence) {
+		case 0:
+			position = offset;
+			break;
+		case 1:
+			position = self->position + offset;
+			break;
+		case 2:
+			if ( _python_ibm_db_lob_reader_length(self) < 0 ) {
+				return NULL;
+			}
+			position = self->length + offset;
+			break;
+		default:
+			PyErr_SetString(PyExc_Exception, "whence must be 0, 1 or 2");
+			return NULL;
+	}
+	if ( position < 0 ) {
+		PyErr_SetString(PyExc_Exception, "Negative seek position");
+		return NULL;
+	}
+	self->position = (SQLINTEGER)position;
+	return PyInt_FromLong(self->position);
+}
 
-					if ( rc == SQL_ERROR ) {
-						_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-							SQL_HANDLE_STMT, rc, 1, NULL,
-							-1, 1);
-					}
-				} else {
-					in_length = stmt_res->column_info[i].size+1;
-					row_data->str_val = (SQLCHAR *)ALLOC_N(char, in_length);
-					if ( row_data->str_val == NULL ) {
-						PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-						return -1;
-					}
+static PyObject *_python_ibm_db_lob_reader_tell(lob_reader *self)
+{
+	return PyInt_FromLong(self->position);
+}
 
-					Py_BEGIN_ALLOW_THREADS;
-					rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-						SQL_C_DEFAULT, row_data->str_val, in_length,
-						(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-					Py_END_ALLOW_THREADS;
+static PySequenceMethods lob_reader_as_sequence = {
+	(lenfunc)_python_ibm_db_lob_reader_length,	/* sq_length */
+};
 
-					if ( rc == SQL_ERROR ) {
-						_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-							SQL_HANDLE_STMT, rc, 1, NULL,
-							-1, 1);
-					}
-				}
-				break;
+static PyMethodDef lob_reader_methods[] = {
+	{"read", (PyCFunction)_python_ibm_db_lob_reader_read, METH_VARARGS, "Reads up to size units of the value, all the remaining ones by default"},
+	{"readinto", (PyCFunction)_python_ibm_db_lob_reader_readinto, METH_VARARGS, "Reads BLOB data into a writable buffer and returns the number of bytes read"},
+	{"seek", (PyCFunction)_python_ibm_db_lob_reader_seek, METH_VARARGS, "Moves the read position and returns it"},
+	{"tell", (PyCFunction)_python_ibm_db_lob_reader_tell, METH_NOARGS, "Returns the read position"},
+	{NULL} /* Sentinel */
+};
 
-			case SQL_TYPE_DATE:
-			case SQL_TYPE_TIME:
-			case SQL_TYPE_TIMESTAMP:
-			case SQL_BIGINT:
-			case SQL_DECFLOAT:
-				in_length = stmt_res->column_info[i].size+2;
-				row_data->str_val = (SQLCHAR *)ALLOC_N(char, in_length);
-				if ( row_data->str_val == NULL ) {
-					PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-					return -1;
-				}
+static PyTypeObject lob_readerType = {
+	PyObject_HEAD_INIT(NULL)
+	0,						 /*ob_size			*/
+	"ibm_db.IBM_DBLob",		 /*tp_name			 */
+	sizeof(lob_reader),		 /*tp_basicsize			 */
+	0,						 /*tp_itemsize		*/
+	(destructor)_python_ibm_db_free_lob_reader, /*tp_dealloc	*/
+	0,						 /*tp_print			*/
+	0,						 /*tp_getattr		 */
+	0,						 /*tp_setattr		 */
+	0,						 /*tp_compare		 */
+	0,						 /*tp_repr			*/
+	0,						 /*tp_as_number		*/
+	&lob_reader_as_sequence, /*tp_as_sequence	 */
+	0,						 /*tp_as_mapping	  */
+	0,						 /*tp_hash			*/
+	0,						 /*tp_call			*/
+	0,						 /*tp_str			 */
+	0,						 /*tp_getattro		*/
+	0,						 /*tp_setattro		*/
+	0,						 /*tp_as_buffer		*/
+	Py_TPFLAGS_DEFAULT,		/*tp_flags			*/
+	"IBM DataServer LOB reader object", /* tp_doc		*/
+	0,						 /* tp_traverse		*/
+	0,						 /* tp_clear		  */
+	0,						 /* tp_richcompare	*/
+	0,						 /* tp_weaklistoffset */
+	0,						 /* tp_iter			*/
+	0,						 /* tp_iternext		*/
+	lob_reader_methods,		 /* tp_methods		*/
+	0,						 /* tp_members		*/
+	0,						 /* tp_getset		 */
+	0,						 /* tp_base			*/
+	0,						 /* tp_dict			*/
+	0,						 /* tp_descr_get	  */
+	0,						 /* tp_descr_set	  */
+	0,						 /* tp_dictoffset	 */
+	0,						 /* tp_init			*/
+};
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_CHAR, row_data->str_val, in_length,
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+/* equivalent functions on different platforms */
+#ifdef _WIN32
+#define STRCASECMP stricmp
+#else
+#define STRCASECMP strcasecmp
+#endif
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,												1);
-				}
-				break;
+static void python_ibm_db_init_globals(struct _ibm_db_globals *ibm_db_globals) {
+	/* env handle */
+	ibm_db_globals->bin_mode = 1;
+}
 
-			case SQL_SMALLINT:
+/* Key of the error state in the thread state dictionary */
+static PyObject *err_state_key = NULL;
+#define ERR_STATE_CAPSULE "ibm_db.err_state"
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_DEFAULT, &row_data->s_val, 
-					sizeof(row_data->s_val),
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+/*	static void _python_ibm_db_free_err_state(PyObject *capsule)
+	frees the error state of a thread when its thread state is cleared
+*/
+static void _python_ibm_db_free_err_state(PyObject *capsule)
+{
+	PyMem_Del(PyCapsule_GetPointer(capsule, ERR_STATE_CAPSULE));
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+/*	static struct _ibm_db_err_state *_python_ibm_db_err_state(void)
+	error state of the calling thread, created on first use. The CLI calls
+	release the GIL, so threads keep their own last error instead of
+	overwriting a process wide one
+*/
+static struct _ibm_db_err_state *_python_ibm_db_err_state(void)
+{
+	/* used when the thread state cannot hold one */
+	static struct _ibm_db_err_state fallback;
+	struct _ibm_db_err_state *state;
+	PyObject *dict, *capsule;
+	PyObject *type, *value, *traceback;
+
+	dict = PyThreadState_GetDict();
+	if (dict == NULL || err_state_key == NULL) {
+		return &fallback;
+	}
+	capsule = PyDict_GetItem(dict, err_state_key);
+	if (capsule != NULL) {
+		return (struct _ibm_db_err_state *)PyCapsule_GetPointer(capsule, ERR_STATE_CAPSULE);
+	}
+
+	/* Keep the exception being raised by the caller */
+	PyErr_Fetch(&type, &value, &traceback);
+	state = ALLOC(struct _ibm_db_err_state);
+	if (state != NULL) {
+		memset(state, 0, sizeof(struct _ibm_db_err_state));
+		capsule = PyCapsule_New(state, ERR_STATE_CAPSULE, _python_ibm_db_free_err_state);
+		if (capsule == NULL) {
+			PyMem_Del(state);
+			state = NULL;
+		} else {
+			if (PyDict_SetItem(dict, err_state_key, capsule) == -1) {
+				state = NULL;
+			}
+			Py_DECREF(capsule);
+		}
+	}
+	PyErr_Restore(type, value, traceback);
+	return state != NULL ? state : &fallback;
+}
 
-			case SQL_INTEGER:
+/* Sub-pools of ibm_db.pconnect and their limits, see ibm_db.set_pool_options */
+static conn_pool *conn_pools = NULL;
+static int pool_min_size = DEFAULT_POOL_MIN_SIZE;
+static int pool_max_size = DEFAULT_POOL_MAX_SIZE;
+static double pool_timeout = DEFAULT_POOL_TIMEOUT;
+static long pool_idle_timeout = DEFAULT_POOL_IDLE_TIMEOUT;
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_DEFAULT, &row_data->i_val, 
-					sizeof(row_data->i_val),
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+/* Counters of all the statements and the switch of ibm_db.enable_stats.
+ * Building with IBM_DB_NO_STATS defined compiles the counting out */
+static ibm_db_stats module_stats;
+static int stats_enabled = 0;
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+static char *stats_timer_names[STATS_NUM_TIMERS] = {
+	"prepare_time", "execute_time", "fetch_time", "describe_time", "lob_time", "convert_time"
+};
 
-			case SQL_REAL:
+#ifndef IBM_DB_NO_STATS
+#define STATS_START(start) ((start) = stats_enabled ? _python_ibm_db_clock() : 0.0)
+/* Single statements, so that they can be the body of an if with an else */
+#define STATS_TIME(stmt_res, timer, start) \
+	do { \
+		if ( (start) != 0.0 ) _python_ibm_db_stats_time((stmt_res), (timer), (start)); \
+	} while (0)
+#define STATS_ADD(stmt_res, counter, n) \
+	do { \
+		if ( stats_enabled ) { \
+			(stmt_res)->stats.counter += (n); \
+			if ( (stmt_res)->conn_stats != NULL ) (stmt_res)->conn_stats->counter += (n); \
+			module_stats.counter += (n); \
+		} \
+	} while (0)
+#else
+#define STATS_START(start) ((start) = 0.0)
+#define STATS_TIME(stmt_res, timer, start) (void)(start)
+#define STATS_ADD(stmt_res, counter, n) do { } while (0)
+#endif
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_FLOAT, &row_data->r_val, 
-					sizeof(row_data->r_val),
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+/*	static double _python_ibm_db_clock(void)
+	seconds on a monotonic clock
+*/
+static double _python_ibm_db_clock(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER count, frequency;
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&frequency);
+	return (double)count.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec now;
 
-			case SQL_FLOAT:
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+#else
+	struct timeval now;
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_DEFAULT, &row_data->f_val, 
-					sizeof(row_data->f_val),
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+	gettimeofday(&now, NULL);
+	return now.tv_sec + now.tv_usec * 1e-6;
+#endif
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+/*	static ibm_db_stats *_python_ibm_db_new_stats(void)
+	zeroed counters of a new connection, NULL when they cannot be allocated
+	in which case the connection is only counted in the module counters
+*/
+static ibm_db_stats *_python_ibm_db_new_stats(void)
+{
+	ibm_db_stats *stats = ALLOC(ibm_db_stats);
 
-			case SQL_DOUBLE:
+	if ( stats != NULL ) {
+		memset(stats, 0, sizeof(ibm_db_stats));
+		stats->refs = 1;
+	}
+	return stats;
+}
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_DEFAULT, &row_data->d_val, 
-					sizeof(row_data->d_val),
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+/*	static void _python_ibm_db_release_stats(ibm_db_stats *stats)
+	drop a reference to the counters of a connection
+*/
+static void _python_ibm_db_release_stats(ibm_db_stats *stats)
+{
+	if ( stats != NULL && --stats->refs == 0 ) {
+		PyMem_Del(stats);
+	}
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+/*	static void _python_ibm_db_stats_time(stmt_handle *stmt_res, int timer, double start)
+	count a CLI call or a row conversion of the statement that started at
+	start
+*/
+static void _python_ibm_db_stats_time(stmt_handle *stmt_res, int timer, double start)
+{
+	double elapsed = _python_ibm_db_clock() - start;
 
-			case SQL_DECIMAL:
-			case SQL_NUMERIC:
-				in_length = stmt_res->column_info[i].size +
-					stmt_res->column_info[i].scale + 2 + 1;
-				row_data->str_val = (SQLCHAR *)ALLOC_N(char, in_length);
-				if ( row_data->str_val == NULL ) {
-					PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-					return -1;
-				}
+	stmt_res->stats.time[timer] += elapsed;
+	module_stats.time[timer] += elapsed;
+	if ( stmt_res->conn_stats != NULL ) {
+		stmt_res->conn_stats->time[timer] += elapsed;
+	}
+	if ( timer != STATS_CONVERT ) {
+		STATS_ADD(stmt_res, cli_calls, 1);
+	}
+}
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					SQL_C_CHAR, row_data->str_val, in_length,
-					(SQLINTEGER *)(&stmt_res->row_data[i].out_length));
-				Py_END_ALLOW_THREADS;
+/* Callable of ibm_db.set_trace_hook and the file of ibm_db.set_slow_query_log.
+ * tracing is set when either is, the call sites only read the clock then */
+static PyObject *trace_hook = NULL;
+static FILE *slow_query_log = NULL;
+static double slow_query_threshold = 0.0;
+static int tracing = 0;
+static int in_trace = 0;	/* a hook running ibm_db calls is not traced again */
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+#define TRACE_START(start) ((start) = tracing ? _python_ibm_db_clock() : 0.0)
 
-			case SQL_CLOB:
-				stmt_res->row_data[i].out_length = 0;
-				stmt_res->column_info[i].loc_type = SQL_CLOB_LOCATOR;
+/*	static void _python_ibm_db_trace(char *event, PyObject *sql, int num_params, long rows, char *sqlstate, double start)
+	report an operation that started at start to the slow query log and the
+	trace hook. The exception being raised, if any, is kept and an exception
+	of the hook is printed and ignored
+*/
+static void _python_ibm_db_trace(char *event, PyObject *sql, int num_params, long rows, char *sqlstate, double start)
+{
+	double elapsed = _python_ibm_db_clock() - start;
+	PyObject *type, *value, *traceback, *hook, *text = NULL, *result;
+	char stamp[32];
+	time_t now;
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					stmt_res->column_info[i].loc_type, 
-					&stmt_res->column_info[i].lob_loc, 4,
-					&stmt_res->column_info[i].loc_ind);
-				Py_END_ALLOW_THREADS;
+	if ( in_trace ) {
+		return;
+	}
+	in_trace = 1;
+	PyErr_Fetch(&type, &value, &traceback);
+	if ( slow_query_log != NULL && elapsed >= slow_query_threshold ) {
+		now = time(NULL);
+		strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", localtime(&now));
+		if ( sql != NULL ) {
+			text = PyUnicode_Check(sql) ? PyUnicode_AsUTF8String(sql) : PyObject_Str(sql);
+		}
+		fprintf(slow_query_log, "%s %s %.6fs rows=%ld params=%d sqlstate=%s %s\n", stamp, event, 
+			elapsed, rows, num_params, sqlstate != NULL ? sqlstate : "-", 
+			text != NULL ? PyString_AsString(text) : "");
+		fflush(slow_query_log);
+		Py_XDECREF(text);
+		PyErr_Clear();
+	}
+	if ( trace_hook != NULL ) {
+		/* the hook can replace itself */
+		hook = trace_hook;
+		Py_INCREF(hook);
+		result = PyObject_CallFunction(hook, "sOidlz", event, sql != NULL ? sql : Py_None, 
+			num_params, elapsed, rows, sqlstate);
+		if ( result == NULL ) {
+			PyErr_WriteUnraisable(hook);
+		}
+		Py_XDECREF(result);
+		Py_DECREF(hook);
+	}
+	PyErr_Restore(type, value, traceback);
+	in_trace = 0;
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
+/*	static char *_python_ibm_db_trace_sqlstate(SQLSMALLINT hType, SQLHANDLE handle, int rc, SQLCHAR *sqlstate)
+	SQLSTATE of the first diagnostic of a failed call into sqlstate, NULL
+	when the call succeeded
+*/
+static char *_python_ibm_db_trace_sqlstate(SQLSMALLINT hType, SQLHANDLE handle, int rc, SQLCHAR *sqlstate)
+{
+	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
+	SQLINTEGER sqlcode;
+	SQLSMALLINT length;
 
-			case SQL_DBCLOB:
-				stmt_res->row_data[i].out_length = 0;
-				stmt_res->column_info[i].loc_type = SQL_DBCLOB_LOCATOR;
-				stmt_res->column_info[i].loc_ind = 0;
+	if ( rc != SQL_ERROR || SQLGetDiagRec(hType, handle, 1, sqlstate, &sqlcode, msg, 
+			SQL_MAX_MESSAGE_LENGTH + 1, &length) != SQL_SUCCESS ) {
+		return NULL;
+	}
+	return (char *)sqlstate;
+}
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-						stmt_res->column_info[i].loc_type,
-						&stmt_res->column_info[i].lob_loc, 4,
-						&stmt_res->column_info[i].loc_ind);
-				Py_END_ALLOW_THREADS;
+/*	static void _python_ibm_db_trace_stmt(stmt_handle *stmt_res, char *event, int rc, long rows, double start)
+	report an operation of a statement, rows is -1 when it does not apply
+*/
+static void _python_ibm_db_trace_stmt(stmt_handle *stmt_res, char *event, int rc, long rows, double start)
+{
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt,
-							SQL_HANDLE_STMT, rc, 1, NULL, -1,
-							1);
-				}
-				break;
+	_python_ibm_db_trace(event, stmt_res->sql, stmt_res->param_cache_size, rows, 
+		_python_ibm_db_trace_sqlstate(SQL_HANDLE_STMT, stmt_res->hstmt, rc, sqlstate), start);
+}
 
-			case SQL_BLOB:
-				stmt_res->row_data[i].out_length = 0;
-				stmt_res->column_info[i].loc_type = SQL_BLOB_LOCATOR;
+/*	static void _python_ibm_db_trace_execute(stmt_handle *stmt_res, int rc, double start)
+	report an execution of a statement with the rows it affected
+*/
+static void _python_ibm_db_trace_execute(stmt_handle *stmt_res, int rc, double start)
+{
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
+	char *state;
+	SQLINTEGER rows = -1;
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
-					stmt_res->column_info[i].loc_type, 
-					&stmt_res->column_info[i].lob_loc, 4,
-					&stmt_res->column_info[i].loc_ind);
-				Py_END_ALLOW_THREADS;
+	state = _python_ibm_db_trace_sqlstate(SQL_HANDLE_STMT, stmt_res->hstmt, rc, sqlstate);
+	if ( rc != SQL_ERROR && SQLRowCount((SQLHSTMT)stmt_res->hstmt, &rows) == SQL_ERROR ) {
+		rows = -1;
+	}
+	_python_ibm_db_trace("execute", stmt_res->sql, stmt_res->param_cache_size, rows, state, start);
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-						SQL_HANDLE_STMT, rc, 1, NULL, -1,
-						1);
-				}
-				break;
-			case SQL_XML:
-				stmt_res->row_data[i].out_length = 0;
-				break;
+char *estrdup(char *data) {
+	int len = strlen(data);
+	char *dup = ALLOC_N(char, len+1);
+	if ( dup == NULL ) {
+		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+		return NULL;
+	}
+	strcpy(dup, data);
+	return dup;
+} 
+	
+char *estrndup(char *data, int max) {
+	int len = strlen(data);
+	char *dup;
+	if (len > max){
+		len = max;
+	}
+	dup = ALLOC_N(char, len+1);
+	if ( dup == NULL ) {
+		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+		return NULL;
+	}
+	strcpy(dup, data);
+	return dup;
+} 
+	
+char *strtolower(char *data, int max) {
+	while (max--){
+		data[max] = tolower(data[max]);
+	}
+	return data;
+} 
+	
+char *strtoupper(char *data, int max) {
+	while (max--){
+		data[max] = toupper(data[max]);
+	}
+	return data;
+} 
 
-			default:
-				break;
+/*	static void _python_ibm_db_clear_stmt_cache(conn_handle *conn_res)
+	releases the cached statements of a connection, statements still held
+	by the application are freed when it drops them
+*/
+static void _python_ibm_db_clear_stmt_cache(conn_handle *conn_res)
+{
+	int i;
+
+	if ( conn_res->stmt_cache != NULL ) {
+		for ( i = 0; i < conn_res->c_stmt_cache_size; i++ ) {
+			Py_XDECREF(conn_res->stmt_cache[i].key);
+			Py_XDECREF(conn_res->stmt_cache[i].stmt);
 		}
+		PyMem_Del(conn_res->stmt_cache);
+		conn_res->stmt_cache = NULL;
 	}
-	return rc;
+	Py_CLEAR(conn_res->stmt_cache_index);
 }
 
-/*	static void _python_ibm_db_clear_stmt_err_cache () */
-static void _python_ibm_db_clear_stmt_err_cache(void)
-{
-	memset(IBM_DB_G(__python_stmt_err_msg), 0, DB2_MAX_ERR_MSG_LEN);
-	memset(IBM_DB_G(__python_stmt_err_state), 0, SQL_SQLSTATE_SIZE + 1);
+static void _python_ibm_db_pool_checkin(conn_handle *conn_res);
+
+/*	static void _python_ibm_db_free_conn_struct */
+static void _python_ibm_db_free_conn_struct(conn_handle *handle) {
+	PyObject *type, *value, *traceback;
+	int rc;
+
+	/* A persistent connection dropped without ibm_db.close() goes back to
+	 * its pool, which takes over the connection and its cached statements */
+	if ( handle->pool != NULL && handle->pool_checked_out ) {
+		PyErr_Fetch(&type, &value, &traceback);
+		_python_ibm_db_pool_checkin(handle);
+		PyErr_Restore(type, value, traceback);
+	}
+
+	/* Cached statements are freed before the connection */
+	_python_ibm_db_clear_stmt_cache(handle);
+
+	/* Disconnect from DB. If stmt is allocated, it is freed automatically */
+	if ( handle->handle_active && !handle->flag_pconnect) {
+		Py_BEGIN_ALLOW_THREADS;
+		if(handle->auto_commit == 0){
+			rc = SQLEndTran(SQL_HANDLE_DBC, (SQLHDBC)handle->hdbc, SQL_ROLLBACK);
+		}
+		rc = SQLDisconnect((SQLHDBC)handle->hdbc);
+		rc = SQLFreeHandle(SQL_HANDLE_DBC, handle->hdbc);
+		rc = SQLFreeHandle(SQL_HANDLE_ENV, handle->henv);
+		Py_END_ALLOW_THREADS;
+	}
+	_python_ibm_db_release_stats(handle->stats);
+	handle->ob_type->tp_free((PyObject*)handle);
 }
 
-/*	static int _python_ibm_db_connect_helper( argc, argv, isPersistent ) */
-static PyObject *_python_ibm_db_connect_helper( PyObject *self, PyObject *args, int isPersistent )
+/*	static conn_pool *_python_ibm_db_find_conn_pool(PyObject *key, PyObject *database, PyObject *uid)
+	sub-pool of the persistent connections made with the credentials of key,
+	created on first use. NULL with a Python exception set on failure
+*/
+static conn_pool *_python_ibm_db_find_conn_pool(PyObject *key, PyObject *database, PyObject *uid)
 {
-	PyObject *databaseObj = NULL;
-	PyObject *uidObj = NULL;
-	PyObject *passwordObj = NULL;
-	SQLWCHAR *database = NULL;
-	SQLWCHAR *uid = NULL;
-	SQLWCHAR *password = NULL;
-	PyObject *options = NULL;
-	PyObject *literal_replacementObj = NULL;
-	SQLINTEGER literal_replacement;
-	PyObject *equal = PyString_FromString("=");
-	int rc = 0;
-	SQLINTEGER conn_alive;
-	conn_handle *conn_res = NULL;
-	int reused = 0;
-	PyObject *hKey = NULL;
-	PyObject *entry = NULL;
-	char server[2048];
-	int isNewBuffer;
-	
-	conn_alive = 1;	
+	conn_pool *pool;
+	int cmp;
 
-	if (!PyArg_ParseTuple(args, "OOO|OO", &databaseObj, &uidObj, &passwordObj, &options, &literal_replacementObj)){
+	for ( pool = conn_pools; pool != NULL; pool = pool->next ) {
+		cmp = PyObject_RichCompareBool(pool->key, key, Py_EQ);
+		if ( cmp == -1 ) {
+			return NULL;
+		}
+		if ( cmp == 1 ) {
+			return pool;
+		}
+	}
+	pool = ALLOC(conn_pool);
+	if ( pool == NULL ) {
+		PyErr_NoMemory();
 		return NULL;
 	}
-	do {
-		databaseObj = PyUnicode_FromObject(databaseObj);
-		uidObj = PyUnicode_FromObject(uidObj);
-		passwordObj = PyUnicode_FromObject(passwordObj);
+	memset(pool, 0, sizeof(conn_pool));
+	pool->idle = PyList_New(0);
+	if ( pool->idle == NULL ) {
+		PyMem_Del(pool);
+		return NULL;
+	}
+	Py_INCREF(key);
+	pool->key = key;
+	Py_INCREF(database);
+	pool->database = database;
+	Py_INCREF(uid);
+	pool->uid = uid;
+	pool->next = conn_pools;
+	conn_pools = pool;
+	return pool;
+}
 
-		/* Check if we already have a connection for this userID & database 
-		* combination
-		*/ 
-		if (isPersistent) {
-			hKey = PyUnicode_Concat(PyString_FromString("__ibm_db_"), uidObj);
-			hKey = PyUnicode_Concat(hKey, databaseObj);
-			hKey = PyUnicode_Concat(hKey, passwordObj);
+/*	static void _python_ibm_db_pool_discard(conn_handle *conn_res)
+	closes a connection that was taken out of its pool
+*/
+static void _python_ibm_db_pool_discard(conn_handle *conn_res)
+{
+	_python_ibm_db_clear_stmt_cache(conn_res);
+	if ( conn_res->handle_active ) {
+		Py_BEGIN_ALLOW_THREADS;
+		SQLDisconnect((SQLHDBC)conn_res->hdbc);
+		SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
+		SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
+		Py_END_ALLOW_THREADS;
+		conn_res->handle_active = 0;
+	}
+	conn_res->pool = NULL;
+	conn_res->pool_checked_out = 0;
+}
+
+/*	static void _python_ibm_db_pool_reap(conn_pool *pool)
+	closes the connections idle for longer than the idle timeout, keeping
+	at least pool_min_size connections in the pool
+*/
+static void _python_ibm_db_pool_reap(conn_pool *pool)
+{
+	conn_handle *conn_res;
+	time_t now;
 
-			entry = PyDict_GetItem(persistent_list, hKey);
+	if ( pool_idle_timeout <= 0 ) {
+		return;
+	}
+	now = time(NULL);
+	while ( PyList_GET_SIZE(pool->idle) > 0 &&
+			PyList_GET_SIZE(pool->idle) + pool->in_use > pool_min_size ) {
+		conn_res = (conn_handle *)PyList_GET_ITEM(pool->idle, 0);
+		if ( now - conn_res->pool_idle_since < pool_idle_timeout ) {
+			break;
+		}
+		Py_INCREF(conn_res);
+		PySequence_DelItem(pool->idle, 0);
+		_python_ibm_db_pool_discard(conn_res);
+		Py_DECREF(conn_res);
+		pool->reaped++;
+	}
+}
 
-			if (entry != NULL) {
-				Py_INCREF(entry);
-				conn_res = (conn_handle *)entry;
+/*	static int _python_ibm_db_pool_checkout(conn_pool *pool, conn_handle **conn_res)
+	takes a validated idle connection of the pool, or reserves room for a
+	new connection and sets *conn_res to NULL. When the pool is full, waits
+	with the GIL released for a connection to be checked in. Returns -1 with
+	a Python exception set when none is within the pool timeout
+*/
+static int _python_ibm_db_pool_checkout(conn_pool *pool, conn_handle **conn_res)
+{
+	conn_handle *curr;
+	Py_ssize_t last;
+	SQLINTEGER conn_alive;
+	int rc;
+	long waited = 0;
+
+	_python_ibm_db_pool_reap(pool);
+	while (1) {
+		/* The most recently checked in connection is the least likely to
+		 * have been dropped by the server */
+		while ( (last = PyList_GET_SIZE(pool->idle) - 1) >= 0 ) {
+			curr = (conn_handle *)PyList_GET_ITEM(pool->idle, last);
+			Py_INCREF(curr);
+			PySequence_DelItem(pool->idle, last);
+			pool->in_use++;
+			conn_alive = 1;
 #ifndef PASE /* i5/OS server mode is persistant */
-				/* Need to reinitialize connection? */
-				rc = SQLGetConnectAttr(conn_res->hdbc, SQL_ATTR_PING_DB, 
-					(SQLPOINTER)&conn_alive, 0, NULL);
-				if ( (rc == SQL_SUCCESS) && conn_alive ) {
-					_python_ibm_db_check_sql_errors( conn_res->hdbc, SQL_HANDLE_DBC, 
-						rc, 1, NULL, -1, 1);
-					reused = 1;
-				} /* else will re-connect since connection is dead */
-#endif /* PASE */
-				reused = 1;
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLGetConnectAttr(curr->hdbc, SQL_ATTR_PING_DB, 
+				(SQLPOINTER)&conn_alive, 0, NULL);
+			Py_END_ALLOW_THREADS;
+			if ( rc != SQL_SUCCESS ) {
+				conn_alive = 0;
 			}
-		} else {
-			/* Need to check for max pconnections? */
+#endif /* PASE */
+			if ( conn_alive ) {
+				curr->pool_checked_out = 1;
+				*conn_res = curr;
+				return 0;
+			}
+			pool->in_use--;
+			pool->invalid++;
+			_python_ibm_db_pool_discard(curr);
+			Py_DECREF(curr);
+		}
+		if ( pool_max_size <= 0 || pool->in_use < pool_max_size ) {
+			pool->in_use++;
+			*conn_res = NULL;
+			return 0;
+		}
+		if ( waited >= pool_timeout * 1000 ) {
+			pool->timeouts++;
+			PyErr_SetString(PyExc_Exception, "Connection pool exhausted: no connection was checked in within the pool timeout");
+			return -1;
 		}
+		if ( waited == 0 ) {
+			pool->waits++;
+		}
+		Py_BEGIN_ALLOW_THREADS;
+		POOL_SLEEP(POOL_WAIT_INTERVAL);
+		Py_END_ALLOW_THREADS;
+		waited += POOL_WAIT_INTERVAL;
+	}
+}
 
-		if ( !NIL_P(literal_replacementObj) ) {
-			literal_replacement = (SQLINTEGER) PyInt_AsLong(literal_replacementObj);
-		} else {
-			literal_replacement = SET_QUOTED_LITERAL_REPLACEMENT_ON; /*QUOTED LITERAL replacemnt is ON by default*/
+/*	static conn_handle *_python_ibm_db_pool_detach(conn_handle *conn_res)
+	moves the connection of conn_res, with its cached statements, to a new
+	handle kept by the pool. conn_res is left inactive so that a caller
+	still holding it cannot use the connection of the next pconnect caller.
+	NULL with a Python exception set on failure
+*/
+static conn_handle *_python_ibm_db_pool_detach(conn_handle *conn_res)
+{
+	conn_handle *idle_res;
+
+	idle_res = PyObject_NEW(conn_handle, &conn_handleType);
+	if ( idle_res == NULL ) {
+		return NULL;
+	}
+	memcpy((char *)idle_res + sizeof(PyObject), (char *)conn_res + sizeof(PyObject),
+		sizeof(conn_handle) - sizeof(PyObject));
+	conn_res->henv = 0;
+	conn_res->hdbc = 0;
+	conn_res->handle_active = 0;
+	conn_res->stmt_cache = NULL;
+	conn_res->stmt_cache_index = NULL;
+	conn_res->pool = NULL;
+	conn_res->pool_checked_out = 0;
+	/* The counters stay readable through the closed handle */
+	if ( conn_res->stats != NULL ) {
+		conn_res->stats->refs++;
+	}
+	return idle_res;
+}
+
+/*	static void _python_ibm_db_pool_checkin(conn_handle *conn_res)
+	returns a checked out connection to its pool, rolling back the open
+	transaction, and invalidates conn_res. Connections that cannot be
+	rolled back are closed
+*/
+static void _python_ibm_db_pool_checkin(conn_handle *conn_res)
+{
+	conn_pool *pool = conn_res->pool;
+	conn_handle *idle_res;
+	int rc = SQL_SUCCESS;
+
+	if ( pool == NULL || !conn_res->pool_checked_out ) {
+		return;
+	}
+	conn_res->pool_checked_out = 0;
+	pool->in_use--;
+	if ( conn_res->auto_commit == 0 ) {
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLEndTran(SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, SQL_ROLLBACK);
+		Py_END_ALLOW_THREADS;
+	}
+	if ( rc == SQL_ERROR || (idle_res = _python_ibm_db_pool_detach(conn_res)) == NULL ) {
+		PyErr_Clear();
+		_python_ibm_db_pool_discard(conn_res);
+		return;
+	}
+	if ( PyList_Append(pool->idle, (PyObject *)idle_res) == -1 ) {
+		PyErr_Clear();
+		_python_ibm_db_pool_discard(idle_res);
+		Py_DECREF(idle_res);
+		return;
+	}
+	Py_DECREF(idle_res);
+	idle_res->pool_idle_since = time(NULL);
+	_python_ibm_db_pool_reap(pool);
+}
+
+/*	static void _python_ibm_db_clear_param_cache(stmt_handle *stmt_res)
+	frees the values of the cached parameters and marks every entry unset,
+	keeping the cache allocated
+*/
+static void _python_ibm_db_clear_param_cache(stmt_handle *stmt_res)
+{
+	param_node *curr;
+	int i;
+
+	for ( i = 0; i < stmt_res->param_cache_size; i++ ) {
+		curr = &stmt_res->param_cache[i];
+		if ( curr->param_num == 0 ) {
+			continue;
 		}
-		if (conn_res == NULL) {
-			conn_res = PyObject_NEW(conn_handle, &conn_handleType);
-			conn_res->henv = 0;
-			conn_res->hdbc = 0;
+		if ( curr->varname ) {
+			PyMem_Del(curr->varname);
 		}
-
-		/* We need to set this early, in case we get an error below,
-		so we know how to free the connection */
-		conn_res->flag_pconnect = isPersistent;
-		/* Allocate ENV handles if not present */
-		if ( !conn_res->henv ) {
-			rc = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &(conn_res->henv));
-			if (rc != SQL_SUCCESS) {
-				_python_ibm_db_check_sql_errors( conn_res->henv, SQL_HANDLE_ENV, rc,
-					1, NULL, -1, 1);
-				break;
-			}
-			rc = SQLSetEnvAttr((SQLHENV)conn_res->henv, SQL_ATTR_ODBC_VERSION, 
-				(void *)SQL_OV_ODBC3, 0);
+		if ( curr->svalue ) {
+			PyMem_Del(curr->svalue);
 		}
-
-		if (!reused) {
-			/* Alloc CONNECT Handle */
-			rc = SQLAllocHandle(SQL_HANDLE_DBC, conn_res->henv, &(conn_res->hdbc));
-			if (rc != SQL_SUCCESS) {
-				_python_ibm_db_check_sql_errors(conn_res->henv, SQL_HANDLE_ENV, rc, 
-					1, NULL, -1, 1);
-				break;
-			}
+		if ( curr->uvalue ) {
+			PyMem_Del(curr->uvalue);
 		}
+		Py_XDECREF(curr->stream_chunk);
+		Py_XDECREF(curr->stream_error);
+		memset(curr, 0, sizeof(param_node));
+	}
+	stmt_res->num_params = 0;
+	stmt_res->file_param = 0;
+	stmt_res->dynamic_params = 0;
+}
 
-		/* Set this after the connection handle has been allocated to avoid
-		unnecessary network flows. Initialize the structure to default values */
-		conn_res->auto_commit = SQL_AUTOCOMMIT_ON;
-		rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, SQL_ATTR_AUTOCOMMIT, 
-			(SQLPOINTER)(conn_res->auto_commit), SQL_NTS);
+/*	static int _python_ibm_db_alloc_param_cache(stmt_handle *stmt_res, int num_params)
+	grows the parameter cache to hold parameters 1 to num_params. Entries
+	move when the cache grows, so it must not grow between binding the
+	parameters and executing the statement
+*/
+static int _python_ibm_db_alloc_param_cache(stmt_handle *stmt_res, int num_params)
+{
+	param_node *cache = NULL;
+	char *descs = NULL;
+	int old_size = stmt_res->param_cache_size;
+	int i;
 
-		conn_res->c_bin_mode = IBM_DB_G(bin_mode);
-		conn_res->c_case_mode = CASE_NATURAL;
-		conn_res->c_cursor_type = SQL_SCROLL_FORWARD_ONLY;
+	if ( num_params <= old_size ) {
+		return 0;
+	}
+	cache = ALLOC_N(param_node, num_params);
+	/* One block for the description arrays, widest member first */
+	descs = ALLOC_N(char, num_params * (sizeof(SQLUINTEGER) + 3 * sizeof(SQLSMALLINT)));
+	if ( cache == NULL || descs == NULL ) {
+		if ( cache != NULL ) {
+			PyMem_Del(cache);
+		}
+		if ( descs != NULL ) {
+			PyMem_Del(descs);
+		}
+		PyErr_NoMemory();
+		return -1;
+	}
+	memset(cache, 0, sizeof(param_node) * num_params);
+	memset(descs, 0, num_params * (sizeof(SQLUINTEGER) + 3 * sizeof(SQLSMALLINT)));
+	if ( old_size > 0 ) {
+		memcpy(cache, stmt_res->param_cache, sizeof(param_node) * old_size);
+		/* The CLI still points at the old entries */
+		for ( i = 0; i < old_size; i++ ) {
+			cache[i].bound_type = 0;
+		}
+		memcpy(descs, stmt_res->param_descs.param_size, sizeof(SQLUINTEGER) * old_size);
+		memcpy(descs + num_params * sizeof(SQLUINTEGER), stmt_res->param_descs.data_type, sizeof(SQLSMALLINT) * old_size);
+		memcpy(descs + num_params * (sizeof(SQLUINTEGER) + sizeof(SQLSMALLINT)), stmt_res->param_descs.scale, sizeof(SQLSMALLINT) * old_size);
+		memcpy(descs + num_params * (sizeof(SQLUINTEGER) + 2 * sizeof(SQLSMALLINT)), stmt_res->param_descs.nullable, sizeof(SQLSMALLINT) * old_size);
+		PyMem_Del(stmt_res->param_cache);
+		PyMem_Del(stmt_res->param_descs.param_size);
+	}
+	stmt_res->param_cache = cache;
+	stmt_res->param_descs.param_size = (SQLUINTEGER *)descs;
+	stmt_res->param_descs.data_type = (SQLSMALLINT *)(descs + num_params * sizeof(SQLUINTEGER));
+	stmt_res->param_descs.scale = stmt_res->param_descs.data_type + num_params;
+	stmt_res->param_descs.nullable = stmt_res->param_descs.scale + num_params;
+	/* New parameters are described on first use */
+	for ( i = old_size; i < num_params; i++ ) {
+		stmt_res->param_descs.data_type[i] = SQL_UNKNOWN_TYPE;
+	}
+	stmt_res->param_cache_size = num_params;
+	return 0;
+}
 
-		conn_res->error_recno_tracker = 1;
-		conn_res->errormsg_recno_tracker = 1;
+/*	static param_node *_python_ibm_db_set_param_node(stmt_handle *stmt_res, int param_no, SQLSMALLINT data_type, SQLUINTEGER precision, SQLSMALLINT scale, SQLSMALLINT nullable)
+	entry of parameter param_no with its description set, NULL with a Python
+	exception set when the cache cannot grow to hold it
+*/
+static param_node *_python_ibm_db_set_param_node(stmt_handle *stmt_res, int param_no, SQLSMALLINT data_type, SQLUINTEGER precision, SQLSMALLINT scale, SQLSMALLINT nullable)
+{
+	param_node *curr;
 
-		/* handle not active as of yet */
-		conn_res->handle_active = 0;
+	if ( _python_ibm_db_alloc_param_cache(stmt_res, param_no) ) {
+		return NULL;
+	}
+	curr = &stmt_res->param_cache[param_no - 1];
+	if ( curr->param_num == 0 ) {
+		stmt_res->num_params++;
+	}
+	curr->data_type = data_type;
+	curr->param_size = precision;
+	curr->nullable = nullable;
+	curr->scale = scale;
+	curr->param_num = param_no;
+	curr->file_options = SQL_FILE_READ;
+	return curr;
+}
 
-		/* Set Options */
-		if ( !NIL_P(options) ) {
-			if(!PyDict_Check(options)) {
-				PyErr_SetString(PyExc_Exception, "options Parameter must be of type dictionay");
-				return NULL;
-			}
-			rc = _python_ibm_db_parse_options( options, SQL_HANDLE_DBC, conn_res );
-			if (rc != SQL_SUCCESS) {
-				SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
-				SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
-				break;
-			}
-		}
+/*	static int _python_ibm_db_describe_param(stmt_handle *stmt_res, int param_no, SQLSMALLINT *data_type, SQLUINTEGER *precision, SQLSMALLINT *scale, SQLSMALLINT *nullable)
+	description of parameter param_no, calling SQLDescribeParam only for
+	parameters not described or declared with ATTR_PARAM_TYPES before.
+	Returns SQL_ERROR with the statement error cached on failure
+*/
+static int _python_ibm_db_describe_param(stmt_handle *stmt_res, int param_no, SQLSMALLINT *data_type, SQLUINTEGER *precision, SQLSMALLINT *scale, SQLSMALLINT *nullable)
+{
+	param_desc *descs = &stmt_res->param_descs;
+	int rc = SQL_SUCCESS;
+	int i = param_no - 1;
 
-		if (! reused) {
-			/* Connect */
-			/* If the string contains a =, use SQLDriverConnect */
-			if (NIL_P(databaseObj)) {
-				PyErr_SetString(PyExc_Exception, "Supplied Parameter is invalid");
-				return NULL;
-			}
-			database = getUnicodeDataAsSQLWCHAR(databaseObj, &isNewBuffer);
-			if ( PyUnicode_Contains(databaseObj, equal) > 0 ) {
-				rc = SQLDriverConnectW((SQLHDBC)conn_res->hdbc, (SQLHWND)NULL,
-					database, SQL_NTS, NULL, 0, NULL, 
-					SQL_DRIVER_NOPROMPT );
-			} else {
-				if (NIL_P(uidObj) || NIL_P(passwordObj)) { 
-					PyErr_SetString(PyExc_Exception, "Supplied Parameter is invalid");
-					return NULL;
-				}
-				uid = getUnicodeDataAsSQLWCHAR(uidObj, &isNewBuffer);
-				password = getUnicodeDataAsSQLWCHAR(passwordObj, &isNewBuffer);
-				rc = SQLConnectW((SQLHDBC)conn_res->hdbc,
-					database,
-					PyUnicode_GetSize(databaseObj),
-					uid, 
-					PyUnicode_GetSize(uidObj),
-					password,
-					PyUnicode_GetSize(passwordObj));
-			} 
-			if ( rc != SQL_SUCCESS ) {
-				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
-					1, NULL, -1, 1);
-				SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
-				SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
-				break;
-			}
-			
-#ifdef CLI_DBC_SERVER_TYPE_DB2LUW
-#ifdef SQL_ATTR_DECFLOAT_ROUNDING_MODE
-			/**
-			* Code for setting SQL_ATTR_DECFLOAT_ROUNDING_MODE
-			* for implementation of Decfloat Datatype
-			*/
-
-			rc = _python_ibm_db_set_decfloat_rounding_mode_client(conn_res->hdbc);
-			if (rc != SQL_SUCCESS){
-				  _python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc,
-								  1, NULL, -1, 1);
-			}
-#endif
-#endif
-
-			/* Get the server name */
-			memset(server, 0, sizeof(server));
-
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLGetInfo(conn_res->hdbc, SQL_DBMS_NAME, (SQLPOINTER)server, 
-				2048, NULL);
-			Py_END_ALLOW_THREADS;
+	if ( _python_ibm_db_alloc_param_cache(stmt_res, param_no) ) {
+		return SQL_ERROR;
+	}
+	if ( descs->data_type[i] == SQL_UNKNOWN_TYPE ) {
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)param_no,
+			&descs->data_type[i], &descs->param_size[i], &descs->scale[i],
+			&descs->nullable[i]);
+		Py_END_ALLOW_THREADS;
 
-			if (!strcmp(server, "AS")) is_systemi = 1;
-			if (!strncmp(server, "IDS", 3)) is_informix = 1;
+		if ( rc == SQL_ERROR ) {
+			descs->data_type[i] = SQL_UNKNOWN_TYPE;
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+			return rc;
+		}
+	}
+	*data_type = descs->data_type[i];
+	*precision = descs->param_size[i];
+	*scale = descs->scale[i];
+	*nullable = descs->nullable[i];
+	return rc;
+}
 
-			/* Set SQL_ATTR_REPLACE_QUOTED_LITERALS connection attribute to
-			* enable CLI numeric literal feature. This is equivalent to
-			* PATCH2=71 in the db2cli.ini file
-			* Note, for backward compatibility with older CLI drivers having a
-			* different value for SQL_ATTR_REPLACE_QUOTED_LITERALS, we call
-			* SQLSetConnectAttr() with both the old and new value
-			*/
-			/* Only enable this feature if we are not connected to an Informix data 
-			* server 
-			*/
-			if (!is_informix && (literal_replacement == SET_QUOTED_LITERAL_REPLACEMENT_ON)) {
-				rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, 
-					SQL_ATTR_REPLACE_QUOTED_LITERALS, 
-					(SQLPOINTER) (ENABLE_NUMERIC_LITERALS), 
-					SQL_IS_INTEGER);
-				if (rc != SQL_SUCCESS)
-					rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc,
-					SQL_ATTR_REPLACE_QUOTED_LITERALS_OLDVALUE,
-					(SQLPOINTER)(ENABLE_NUMERIC_LITERALS), 
-					SQL_IS_INTEGER);
-			}
-			if (rc != SQL_SUCCESS) {
-				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
-					1, NULL, -1, 1);
+/*	static int _python_ibm_db_set_param_types(stmt_handle *stmt_res, PyObject *types)
+	declares the parameters of a statement from the ATTR_PARAM_TYPES option:
+	a sequence holding an SQL type, an (SQL type, size[, scale]) tuple or
+	None (described by the server) per parameter
+*/
+static int _python_ibm_db_set_param_types(stmt_handle *stmt_res, PyObject *types)
+{
+	param_desc *descs = &stmt_res->param_descs;
+	PyObject *items = NULL;
+	PyObject *item = NULL;
+	long data_type, size, scale;
+	int i, num;
+
+	if ( !PyTuple_Check(types) && !PyList_Check(types) ) {
+		PyErr_SetString(PyExc_Exception, "ATTR_PARAM_TYPES attribute must be a tuple of parameter types");
+		return -1;
+	}
+	items = PySequence_Fast(types, "ATTR_PARAM_TYPES attribute must be a tuple of parameter types");
+	if ( items == NULL ) {
+		return -1;
+	}
+	num = PySequence_Fast_GET_SIZE(items);
+	if ( _python_ibm_db_alloc_param_cache(stmt_res, num) ) {
+		Py_DECREF(items);
+		return -1;
+	}
+	for ( i = 0; i < num; i++ ) {
+		item = PySequence_Fast_GET_ITEM(items, i);
+		data_type = SQL_UNKNOWN_TYPE;
+		size = 0;
+		scale = 0;
+		if ( PyInt_Check(item) || PyLong_Check(item) ) {
+			data_type = PyInt_AsLong(item);
+		} else if ( PyTuple_Check(item) ) {
+			if ( !PyArg_ParseTuple(item, "l|ll", &data_type, &size, &scale) ) {
+				Py_DECREF(items);
+				return -1;
 			}
+		} else if ( item != Py_None ) {
+			PyErr_SetString(PyExc_Exception, "ATTR_PARAM_TYPES entries must be an SQL type, an (SQL type, size, scale) tuple or None");
+			Py_DECREF(items);
+			return -1;
 		}
-		Py_XDECREF(databaseObj);
-		Py_XDECREF(uidObj);
-		Py_XDECREF(passwordObj);
-		conn_res->handle_active = 1;
-	} while (0);
+		descs->data_type[i] = (SQLSMALLINT)data_type;
+		descs->param_size[i] = (SQLUINTEGER)size;
+		descs->scale[i] = (SQLSMALLINT)scale;
+		descs->nullable[i] = SQL_NULLABLE_UNKNOWN;
+		/* Bound again with the new type */
+		stmt_res->param_cache[i].bound_type = 0;
+	}
+	Py_DECREF(items);
+	return 0;
+}
 
-	if (hKey != NULL) {
-		if (! reused && rc == SQL_SUCCESS) {
-			/* If we created a new persistent connection, add it to the 
-			*  persistent_list
-			*/
-			PyDict_SetItem(persistent_list, hKey, (PyObject *)conn_res);
+/*	static PyObject *_python_ibm_db_get_param_types(stmt_handle *stmt_res)
+	tuple of the cached parameter descriptions, an (SQL type, size, scale)
+	tuple per parameter or None for parameters not described yet
+*/
+static PyObject *_python_ibm_db_get_param_types(stmt_handle *stmt_res)
+{
+	param_desc *descs = &stmt_res->param_descs;
+	PyObject *types = NULL;
+	PyObject *item = NULL;
+	int i;
+
+	types = PyTuple_New(stmt_res->param_cache_size);
+	if ( types == NULL ) {
+		return NULL;
+	}
+	for ( i = 0; i < stmt_res->param_cache_size; i++ ) {
+		if ( descs->data_type[i] == SQL_UNKNOWN_TYPE ) {
+			Py_INCREF(Py_None);
+			item = Py_None;
+		} else {
+			item = Py_BuildValue("(ili)", (int)descs->data_type[i],
+				(long)descs->param_size[i], (int)descs->scale[i]);
+			if ( item == NULL ) {
+				Py_DECREF(types);
+				return NULL;
+			}
 		}
-		Py_DECREF(hKey);
+		PyTuple_SET_ITEM(types, i, item);
 	}
+	return types;
+}
 
-	if (isNewBuffer) {
-		PyMem_Del(database);
-		PyMem_Del(uid);
-		PyMem_Del(password);
+/*	static void _python_ibm_db_free_param_cache(stmt_handle *handle)
+	frees the parameter cache and the parameter descriptions
+*/
+static void _python_ibm_db_free_param_cache(stmt_handle *handle) {
+	_python_ibm_db_clear_param_cache(handle);
+	if ( handle->param_cache != NULL ) {
+		PyMem_Del(handle->param_cache);
+		handle->param_cache = NULL;
 	}
-	
-	if ( rc != SQL_SUCCESS ) {
-		if (conn_res != NULL && conn_res->handle_active) {
-			rc = SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
-			rc = SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
-		}
-		if (conn_res != NULL) {
-			PyObject_Del(conn_res);
-		}
-		return NULL;						  
-	} 
-	return (PyObject *)conn_res;
+	if ( handle->param_descs.param_size != NULL ) {
+		PyMem_Del(handle->param_descs.param_size);
+		memset(&handle->param_descs, 0, sizeof(param_desc));
+	}
+	handle->param_cache_size = 0;
 }
 
+/*	static void _python_ibm_db_free_result_struct(stmt_handle* handle)
+	frees the result set structures, the parameters are kept for the next
+	execution of the statement
+*/
+static void _python_ibm_db_free_result_struct(stmt_handle* handle) {
+	int i;
 
-/**
-*This function takes a SQLWCHAR buffer (UCS-2) and returns back a PyUnicode object 
-* of it that is in the correct current UCS encoding (either UCS2 or UCS4)of
-* the current executing python VM
-*
-* @sqlwcharBytesLen - the length of sqlwcharData in bytes (not characters)
-**/
-static PyObject* getSQLWCharAsPyUnicodeObject(SQLWCHAR* sqlwcharData, int sqlwcharBytesLen)
-{
-	PyObject *sysmodule = NULL, *maxuni = NULL;
-	long maxuniValue;
-	PyObject* u;
-	sysmodule = PyImport_ImportModule("sys");
-	maxuni = PyObject_GetAttrString(sysmodule, "maxunicode");
-	maxuniValue = PyInt_AsLong(maxuni);
+	if ( handle != NULL ) {
+		/* free row data cache; str_val/w_val point into the column buffers */
+		if (handle->row_data) {
+			for (i = 0; i<handle->num_columns; i++) {
+				if ( handle->row_data[i].buffer != NULL ) {
+					PyMem_Del(handle->row_data[i].buffer);
+					handle->row_data[i].buffer = NULL;
+				}
+				if ( handle->row_data[i].out_lengths != NULL ) {
+					PyMem_Del(handle->row_data[i].out_lengths);
+					handle->row_data[i].out_lengths = NULL;
+				}
+			}
+			PyMem_Del(handle->row_data);
+			handle->row_data = NULL;
+		}
+		handle->bound_array_size = 0;
+		handle->rows_fetched = 0;
+		handle->row_block_pos = 0;
+		Py_CLEAR(handle->row_names);
+		Py_CLEAR(handle->row_index);
 
-	if (maxuniValue <= 65536) {
-	/* this is UCS2 python.. nothing to do really */
-		return PyUnicode_FromUnicode((Py_UNICODE *)sqlwcharData, sqlwcharBytesLen / sizeof(SQLWCHAR));
-    	}
-	
-	if (is_bigendian()) {
-		int bo = 1;
-		u = PyUnicode_DecodeUTF16((char *)sqlwcharData, sqlwcharBytesLen, "strict", &bo);
-	} else {
-		int bo = -1;
-		u = PyUnicode_DecodeUTF16((char *)sqlwcharData, sqlwcharBytesLen, "strict", &bo);
+		/* free column info cache */
+		if ( handle->column_info ) {
+			for (i = 0; i<handle->num_columns; i++) {
+				PyMem_Del(handle->column_info[i].name);
+				Py_XDECREF(handle->column_info[i].key);
+				Py_XDECREF(handle->column_info[i].position);
+				/* Mem free */
+				if(handle->column_info[i].mem_alloc){
+					PyMem_Del(handle->column_info[i].mem_alloc);
+				}
+			}
+			PyMem_Del(handle->column_info);
+			handle->column_info = NULL;
+			handle->num_columns = 0;
+		}
 	}
-	return u;
 }
 
+/* static stmt_handle *_ibm_db_new_stmt_struct(conn_handle* conn_res) */	
+static stmt_handle *_ibm_db_new_stmt_struct(conn_handle* conn_res) {
+	stmt_handle *stmt_res;
 
-/**
-*This function takes value as pyObject and convert it to SQLWCHAR and return it 
-*
-**/
-static SQLWCHAR* getUnicodeDataAsSQLWCHAR(PyObject *pyobj, int *isNewBuffer)
-{	
-	PyObject *sysmodule = NULL, *maxuni = NULL;
-	long maxuniValue;
-	PyObject *pyUTFobj;
-	SQLWCHAR* pNewBuffer = NULL;
-	int nCharLen = PyUnicode_GET_SIZE(pyobj);
-
-	sysmodule = PyImport_ImportModule("sys");
-	maxuni = PyObject_GetAttrString(sysmodule, "maxunicode");
-	maxuniValue = PyInt_AsLong(maxuni);
+	stmt_res = PyObject_NEW(stmt_handle, &stmt_handleType);
+	/* memset(stmt_res, 0, sizeof(stmt_handle)); */
 
-	if (maxuniValue <= 65536) {
-		*isNewBuffer = 0;
-		return (SQLWCHAR*)PyUnicode_AS_UNICODE(pyobj);
-	}
+	/* Initialize stmt resource so parsing assigns updated options if needed */
+	stmt_res->hdbc = conn_res->hdbc;
+	stmt_res->lob_hstmt = 0;
+	stmt_res->async_pending = 0;
+	stmt_res->options_changed = 0;
+	stmt_res->query_timeout = 0;
+	stmt_res->s_bin_mode = conn_res->c_bin_mode;
+	stmt_res->cursor_type = conn_res->c_cursor_type;
+	stmt_res->s_case_mode = conn_res->c_case_mode;
+	stmt_res->s_native_types = conn_res->c_native_types;
+	stmt_res->s_lob_reader = conn_res->c_lob_reader;
 
-	*isNewBuffer = 1;
-	pNewBuffer = (SQLWCHAR *)ALLOC_N(SQLWCHAR, nCharLen + 1);
-	memset(pNewBuffer, 0, sizeof(SQLWCHAR) * (nCharLen + 1));
-	if (is_bigendian()) {
-		pyUTFobj = PyCodec_Encode(pyobj, "utf-16-be", "strict");
-	} else {
-		pyUTFobj = PyCodec_Encode(pyobj, "utf-16-le", "strict");
-	}
-	memcpy(pNewBuffer, PyString_AsString(pyUTFobj), sizeof(SQLWCHAR) * (nCharLen) );
-	Py_DECREF(pyUTFobj);
-	return pNewBuffer;
+	stmt_res->param_cache = NULL;
+	memset(&stmt_res->param_descs, 0, sizeof(param_desc));
+	stmt_res->param_cache_size = 0;
+	stmt_res->current_param = 0;
+	stmt_res->dynamic_params = 0;
 
-}
+	stmt_res->num_params = 0;
+	stmt_res->file_param = 0;
 
+	stmt_res->column_info = NULL;
+	stmt_res->num_columns = 0;
 
-#ifdef CLI_DBC_SERVER_TYPE_DB2LUW
-#ifdef SQL_ATTR_DECFLOAT_ROUNDING_MODE
+	stmt_res->error_recno_tracker = 1;
+	stmt_res->errormsg_recno_tracker = 1;
 
-/**
- * Function for implementation of DECFLOAT Datatype
- *
- * Description :
- * This function retrieves the value of special register decflt_rounding
- * from the database server which signifies the current rounding mode set
- * on the server. For using decfloat, the rounding mode has to be in sync
- * on the client as well as server. Thus we set here on the client, the
- * same rounding mode as the server.
- *
- * @return: success or failure
- * */
-static int _python_ibm_db_set_decfloat_rounding_mode_client(SQLHANDLE hdbc)
-{
-	SQLCHAR decflt_rounding[20];
-	SQLHANDLE hstmt;
-	int rc = 0;
-	int rounding_mode;
-	SQLINTEGER decfloat;
+	stmt_res->row_data = NULL;
 
+	stmt_res->row_array_size = conn_res->c_row_array_size;
+	stmt_res->paramset_size = conn_res->c_paramset_size;
+	stmt_res->bound_array_size = 0;
+	stmt_res->rows_fetched = 0;
+	stmt_res->row_block_pos = 0;
+	stmt_res->bound_native_types = NATIVE_TYPES_OFF;
+	stmt_res->row_names = NULL;
+	stmt_res->row_index = NULL;
 
-	SQLCHAR *stmt = (SQLCHAR *)"values current decfloat rounding mode";
+	stmt_res->sql = NULL;
 
-	/* Allocate a Statement Handle */
-	rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
-	if (rc == SQL_ERROR) {
-		_python_ibm_db_check_sql_errors(hdbc, SQL_HANDLE_DBC, rc, 1,
-			NULL, -1, 1);
-		return rc;
+	memset(&stmt_res->stats, 0, sizeof(ibm_db_stats));
+	stmt_res->conn_stats = conn_res->stats;
+	if ( stmt_res->conn_stats != NULL ) {
+		stmt_res->conn_stats->refs++;
 	}
 
+	return stmt_res;
+}
+
+/*	static _python_ibm_db_free_stmt_struct */
+static void _python_ibm_db_free_stmt_struct(stmt_handle *handle) {
+	int rc;
+	
 	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLExecDirect((SQLHSTMT)hstmt, stmt, SQL_NTS);
+	if ( handle->lob_hstmt ) {
+		SQLFreeHandle( SQL_HANDLE_STMT, handle->lob_hstmt);
+	}
+	rc = SQLFreeHandle( SQL_HANDLE_STMT, handle->hstmt);
 	Py_END_ALLOW_THREADS;
-
-	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors((SQLHSTMT)hstmt,
-			SQL_HANDLE_STMT, rc, 1, NULL,
-			-1, 1);
-		return rc;
+	if ( handle ) {
+		_python_ibm_db_free_param_cache(handle);
+		_python_ibm_db_free_result_struct(handle);
 	}
+	_python_ibm_db_release_stats(handle->conn_stats);
+	Py_XDECREF(handle->sql);
+	handle->ob_type->tp_free((PyObject*)handle);
+}
 
-	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLBindCol((SQLHSTMT)hstmt, 1, SQL_C_DEFAULT, decflt_rounding, 20, NULL);
-	Py_END_ALLOW_THREADS;
+/*	static int _python_ibm_db_build_column_keys(stmt_handle *stmt_res)
+	fold the column names to the case mode of the statement and create the
+	dictionary keys of the columns, once per result set
+*/
+static int _python_ibm_db_build_column_keys(stmt_handle *stmt_res)
+{
+	ibm_db_result_set_info *info;
+	int i;
 
-	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors((SQLHSTMT)hstmt,
-			SQL_HANDLE_STMT, rc, 1, NULL,
-			-1, 1);
-		return rc;
+	/* the names of the row objects are taken from the keys again */
+	Py_CLEAR(stmt_res->row_names);
+	Py_CLEAR(stmt_res->row_index);
+	for (i = 0; i < stmt_res->num_columns; i++) {
+		info = &stmt_res->column_info[i];
+		switch(stmt_res->s_case_mode) {
+			case CASE_LOWER:
+				strtolower((char*)info->name, strlen((char*)info->name));
+				break;
+			case CASE_UPPER:
+				strtoupper((char*)info->name, strlen((char*)info->name));
+				break;
+			case CASE_NATURAL:
+			default:
+				break;
+		}
+		Py_XDECREF(info->key);
+		info->key = PyString_InternFromString((char*)info->name);
+		if (info->position == NULL) {
+			info->position = PyInt_FromLong(i);
+		}
+		if (info->key == NULL || info->position == NULL) {
+			return -1;
+		}
 	}
+	return 0;
+}
 
-	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLFetch(hstmt);
-	Py_END_ALLOW_THREADS;
+/*	static void _python_ibm_db_init_error_info(stmt_handle *stmt_res) */
+static void _python_ibm_db_init_error_info(stmt_handle *stmt_res) {
+	stmt_res->error_recno_tracker = 1;
+	stmt_res->errormsg_recno_tracker = 1;
+}
 
-	rc = SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-	
-	/* Now setting up the same rounding mode on the client*/
-	if (strcmp(decflt_rounding, "ROUND_HALF_EVEN") == 0) rounding_mode = ROUND_HALF_EVEN;
-	if (strcmp(decflt_rounding, "ROUND_HALF_UP") == 0) rounding_mode = ROUND_HALF_UP;
-	if (strcmp(decflt_rounding, "ROUND_DOWN") == 0) rounding_mode = ROUND_DOWN;
-	if (strcmp(decflt_rounding, "ROUND_CEILING") == 0) rounding_mode = ROUND_CEILING;
-	if (strcmp(decflt_rounding, "ROUND_FLOOR") == 0) rounding_mode = ROUND_FLOOR;
+/*	static void _python_ibm_db_check_sql_errors( SQLHANDLE handle, SQLSMALLINT hType, int rc, int cpy_to_global, char* ret_str, int API SQLSMALLINT recno)
+*/
+static void _python_ibm_db_check_sql_errors( SQLHANDLE handle, SQLSMALLINT hType, int rc, int cpy_to_global, char* ret_str, int API, SQLSMALLINT recno )
+{
+	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
+	SQLCHAR errMsg[DB2_MAX_ERR_MSG_LEN];
+	SQLINTEGER sqlcode;
+	SQLSMALLINT length;
+	char *p;
 
-#ifndef PASE
-	rc = SQLSetConnectAttr(hdbc, SQL_ATTR_DECFLOAT_ROUNDING_MODE, (SQLPOINTER)rounding_mode, SQL_NTS);
-#else
-	rc = SQLSetConnectAttr(hdbc, SQL_ATTR_DECFLOAT_ROUNDING_MODE, (SQLPOINTER)&rounding_mode, SQL_NTS);
-#endif
+	memset(errMsg, '\0', DB2_MAX_ERR_MSG_LEN);
+	memset(msg, '\0', SQL_MAX_MESSAGE_LENGTH + 1);
+	if ( SQLGetDiagRec(hType, handle, recno, sqlstate, &sqlcode, msg,
+		SQL_MAX_MESSAGE_LENGTH + 1, &length ) == SQL_SUCCESS) {
 
-	return rc;
+			while ((p = strchr( (char *)msg, '\n' ))) {
+				*p = '\0';
+			}
+			sprintf((char*)errMsg, "%s SQLCODE=%d", (char*)msg, (int)sqlcode);
+			if (cpy_to_global != 0) {
+				PyErr_SetString(PyExc_Exception, (char *) errMsg);
+			}
 
-}
-#endif
-#endif
+			switch (rc) {
+				case SQL_ERROR:
+					/* Need to copy the error msg and sqlstate into the symbol Table 
+					* to cache these results */
+					if ( cpy_to_global ) {
+						switch (hType) {
+							case SQL_HANDLE_DBC:
+								strncpy(IBM_DB_ERR(__python_conn_err_state), (char*)sqlstate, SQL_SQLSTATE_SIZE+1);
+								strncpy(IBM_DB_ERR(__python_conn_err_msg), (char*)errMsg, DB2_MAX_ERR_MSG_LEN);
+								break;
 
-/* static void _python_ibm_db_clear_conn_err_cache () */
-static void _python_ibm_db_clear_conn_err_cache(void)
-{
-	/* Clear out the cached conn messages */
-	memset(IBM_DB_G(__python_conn_err_msg), 0, DB2_MAX_ERR_MSG_LEN);
-	memset(IBM_DB_G(__python_conn_err_state), 0, SQL_SQLSTATE_SIZE + 1);
+							case SQL_HANDLE_STMT:
+								strncpy(IBM_DB_ERR(__python_stmt_err_state), (char*)sqlstate, SQL_SQLSTATE_SIZE+1);
+								strncpy(IBM_DB_ERR(__python_stmt_err_msg), (char*)errMsg, DB2_MAX_ERR_MSG_LEN);
+								break;
+						}
+					}
+					/* This call was made from ibm_db_errmsg or ibm_db_error */
+					/* Check for error and return */
+					switch (API) {
+						case DB2_ERR:
+							if ( ret_str != NULL ) {
+								strncpy(ret_str, (char*)sqlstate, SQL_SQLSTATE_SIZE+1);
+							}
+							return;
+						case DB2_ERRMSG:
+							if ( ret_str != NULL ) {
+								strncpy(ret_str, (char*)errMsg, DB2_MAX_ERR_MSG_LEN);
+							}
+							return;
+						default:
+							break;
+					}
+					break;
+				default:
+					break;
+			}
+		}
 }
 
-/*!#
- * ibm_db.connect
- * ibm_db.pconnect
- * ibm_db.autocommit
- * ibm_db.bind_param
- * ibm_db.close
- * ibm_db.column_privileges
- * ibm_db.columns
- * ibm_db.foreign_keys
- * ibm_db.primary_keys
- * ibm_db.procedure_columns
- * ibm_db.procedures
- * ibm_db.special_columns
- * ibm_db.statistics
- * ibm_db.table_privileges
- * ibm_db.tables
- * ibm_db.commit
- * ibm_db.exec
- * ibm_db.free_result
- * ibm_db.prepare
- * ibm_db.execute
- * ibm_db.conn_errormsg
- * ibm_db.stmt_errormsg
- * ibm_db.conn_error
- * ibm_db.stmt_error
- * ibm_db.next_result
- * ibm_db.num_fields
- * ibm_db.num_rows
- * ibm_db.get_num_result
- * ibm_db.field_name
- * ibm_db.field_display_size
- * ibm_db.field_num
- * ibm_db.field_precision
- * ibm_db.field_scale
- * ibm_db.field_type
- * ibm_db.field_width
- * ibm_db.cursor_type
- * ibm_db.rollback
- * ibm_db.free_stmt
- * ibm_db.result
- * ibm_db.fetch_row
- * ibm_db.fetch_assoc
- * ibm_db.fetch_array
- * ibm_db.fetch_both
- * ibm_db.set_option
- * ibm_db.server_info
- * ibm_db.client_info
- * ibm_db.active
- * ibm_db.get_option
- */
+/*	static int _python_ibm_db_set_query_timeout(stmt_handle *stmt_res, SQLUINTEGER seconds)
+	sets SQL_ATTR_QUERY_TIMEOUT of the statement, returns SQL_ERROR with the
+	statement error cached on failure
+*/
+static int _python_ibm_db_set_query_timeout(stmt_handle *stmt_res, SQLUINTEGER seconds)
+{
+	int rc;
 
+	rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER)(long)seconds, SQL_IS_INTEGER);
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		return rc;
+	}
+	stmt_res->query_timeout = seconds;
+	return rc;
+}
 
+/*	static int _python_ibm_db_assign_options( void *handle, int type, long opt_key, PyObject *data ) */
+static int _python_ibm_db_assign_options( void *handle, int type, long opt_key, PyObject *data )
+{
+	int rc = 0;
+	long option_num = 0;
+	SQLWCHAR *option_str = NULL;
+	int isNewBuffer;
 
-/*!# ibm_db.connect
- *
- * ===Description
- *
- *  --	Returns a connection to a database
- * IBM_DBConnection ibm_db.connect (dsn=<..>, user=<..>, password=<..>,
- *								  host=<..>, database=<..>, options=<..>)
- *
- * Creates a new connection to an IBM DB2 Universal Database, IBM Cloudscape,
- * or Apache Derby database.
- *
- * ===Parameters
- *
- * ====dsn
- *
- * For an uncataloged connection to a database, database represents a complete
- * connection string in the following format:
- * DRIVER={IBM DB2 ODBC DRIVER};DATABASE=database;HOSTNAME=hostname;PORT=port;
- * PROTOCOL=TCPIP;UID=username;PWD=password;
- *	  where the parameters represent the following values:
- *		hostname
- *			The hostname or IP address of the database server.
- *		port
- *			The TCP/IP port on which the database is listening for requests.
- *		username
- *			The username with which you are connecting to the database.
- *		password
- *			The password with which you are connecting to the database.
- *
- * ====user
- *
- * The username with which you are connecting to the database.
- * This is optional if username is specified in the "dsn" string
- *
- * ====password
- *
- * The password with which you are connecting to the database.
- * This is optional if password is specified in the "dsn" string
- *
- * ====host
- *
- * The hostname or IP address of the database server.
- * This is optional if hostname is specified in the "dsn" string
- *
- * ====database
- *
- * For a cataloged connection to a database, database represents the database
- * alias in the DB2 client catalog.
- * This is optional if database is specified in the "dsn" string
- *
- * ====options
- *
- *	  An dictionary of connection options that affect the behavior of the
- *	  connection,
- *	  where valid array keys include:
- *		SQL_ATTR_AUTOCOMMIT
- *			Passing the SQL_AUTOCOMMIT_ON value turns autocommit on for this
- *			connection handle.
- *			Passing the SQL_AUTOCOMMIT_OFF value turns autocommit off for this
- *			connection handle.
- *		ATTR_CASE
- *			Passing the CASE_NATURAL value specifies that column names are
- *			returned in natural case.
- *			Passing the CASE_LOWER value specifies that column names are
- *			returned in lower case.
- *			Passing the CASE_UPPER value specifies that column names are
- *			returned in upper case.
- *		SQL_ATTR_CURSOR_TYPE
- *			Passing the SQL_SCROLL_FORWARD_ONLY value specifies a forward-only
- *			cursor for a statement resource.
- *			This is the default cursor type and is supported on all database
- *			servers.
- *			Passing the SQL_CURSOR_KEYSET_DRIVEN value specifies a scrollable
- *			cursor for a statement resource.
- *			This mode enables random access to rows in a result set, but
- *			currently is supported only by IBM DB2 Universal Database.
- * ====set_replace_quoted_literal
- *	  This variable indicates if the CLI Connection attribute SQL_ATTR_REPLACE_QUOTED_LITERAL is to be set or not
- *	  To turn it ON pass  IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
- *	  To turn it OFF pass IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_OFF
- *
- *	  Default Setting: - IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
- *
- * ===Return Values
- *
- *
- * Returns a IBM_DBConnection connection object if the connection attempt is
- * successful.
- * If the connection attempt fails, ibm_db.connect() returns None.
- *
- */ 
-static PyObject *ibm_db_connect(PyObject *self, PyObject *args)
-{
-	_python_ibm_db_clear_conn_err_cache();
-	return _python_ibm_db_connect_helper( self, args, 0 );
-}
-
-/*!# ibm_db.pconnect
- *
- * ===Description
- *  --	Returns a persistent connection to a database
- * resource ibm_db.pconnect ( string database, string username, string password
- * [, array options] )
- *
- * Returns a persistent connection to an IBM DB2 Universal Database,
- * IBM Cloudscape, Apache Derby or Informix Dynamic Server database.
- *
- * Calling ibm_db.close() on a persistent connection always returns TRUE, but
- * the underlying DB2 client connection remains open and waiting to serve the
- * next matching ibm_db.pconnect() request.
- *
- * ===Parameters
- *
- * ====database
- *		The database alias in the DB2 client catalog.
- *
- * ====username
- *		The username with which you are connecting to the database.
- *
- * ====password
- *		The password with which you are connecting to the database.
- *
- * ====options
- *		An associative array of connection options that affect the behavior of
- * the connection,
- *		where valid array keys include:
- *
- *		autocommit
- *			 Passing the DB2_AUTOCOMMIT_ON value turns autocommit on for this
- * connection handle.
- *			 Passing the DB2_AUTOCOMMIT_OFF value turns autocommit off for
- * this connection handle.
- *
- *		DB2_ATTR_CASE
- *			 Passing the DB2_CASE_NATURAL value specifies that column names
- * are returned in natural case.
- *			 Passing the DB2_CASE_LOWER value specifies that column names are
- * returned in lower case.
- *			 Passing the DB2_CASE_UPPER value specifies that column names are
- * returned in upper case.
- *
- *		CURSOR
- *			 Passing the SQL_SCROLL_FORWARD_ONLY value specifies a
- * forward-only cursor for a statement resource.  This is the default cursor
- * type and is supported on all database servers.
- *			 Passing the SQL_CURSOR_KEYSET_DRIVEN value specifies a scrollable
- * cursor for a statement resource. This mode enables random access to rows in a
- * result set, but currently is supported only by IBM DB2 Universal Database.
- *
- * ====set_replace_quoted_literal
- *	  This variable indicates if the CLI Connection attribute SQL_ATTR_REPLACE_QUOTED_LITERAL is to be set or not
- *	  To turn it ON pass  IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
- *	  To turn it OFF pass IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_OFF
- *
- *	  Default Setting: - IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
- *
- * ===Return Values
- *
- * Returns a connection handle resource if the connection attempt is successful.
- * ibm_db.pconnect() tries to reuse an existing connection resource that exactly
- * matches the database, username, and password parameters. If the connection
- * attempt fails, ibm_db.pconnect() returns FALSE.
- */
-static PyObject *ibm_db_pconnect(PyObject *self, PyObject *args)
-{
-	_python_ibm_db_clear_conn_err_cache();
-	return _python_ibm_db_connect_helper( self, args, 1);
-}
-
-/*
- * static void _python_clear_local_var(PyObject *dbNameObj, SQLWCHAR *dbName, PyObject *codesetObj, SQLWCHAR *codesetObj, PyObject *modeObj, SQLWCHAR *mode, int isNewBuffer)
- */
-static void _python_clear_local_var(PyObject *dbNameObj, SQLWCHAR *dbName, PyObject *codesetObj, SQLWCHAR *codeset, PyObject *modeObj, SQLWCHAR *mode, int isNewBuffer)
-{
-	if ( !NIL_P( dbNameObj ) ) {
-		Py_XDECREF( dbNameObj );
-		if ( isNewBuffer ) {
-			PyMem_Del( dbName );
-		}
-	}
-
-	if ( !NIL_P( codesetObj ) ) {
-		Py_XDECREF( codesetObj );
-		if ( isNewBuffer ) {
-			PyMem_Del( codeset );
+	/* First check to see if it is a non-cli attribut */
+	if (opt_key == ATTR_CASE) {
+		option_num = NUM2LONG(data);
+		if (type == SQL_HANDLE_STMT) {
+			switch (option_num) {
+				case CASE_LOWER:
+					((stmt_handle*)handle)->s_case_mode = CASE_LOWER;
+					break;
+				case CASE_UPPER:
+					((stmt_handle*)handle)->s_case_mode = CASE_UPPER;
+					break;
+				case CASE_NATURAL:
+					((stmt_handle*)handle)->s_case_mode = CASE_NATURAL;
+					break;
+				default:
+					PyErr_SetString(PyExc_Exception, "ATTR_CASE attribute must be one of CASE_LOWER, CASE_UPPER, or CASE_NATURAL");
+					return -1;
+			}
+			/* Column names of a described result set are folded again */
+			if (((stmt_handle*)handle)->column_info != NULL) {
+				return _python_ibm_db_build_column_keys((stmt_handle*)handle);
+			}
+		} else if (type == SQL_HANDLE_DBC) {
+			switch (option_num) {
+				case CASE_LOWER:
+					((conn_handle*)handle)->c_case_mode = CASE_LOWER;
+					break;
+				case CASE_UPPER:
+					((conn_handle*)handle)->c_case_mode = CASE_UPPER;
+					break;
+				case CASE_NATURAL:
+					((conn_handle*)handle)->c_case_mode = CASE_NATURAL;
+					break;
+				default:
+					PyErr_SetString(PyExc_Exception, "ATTR_CASE attribute must be one of CASE_LOWER, CASE_UPPER, or CASE_NATURAL");
+					return -1;
+			}
+		} else {
+			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
+			return -1;
 		}
-	}
-
-	if ( !NIL_P( modeObj ) ) {
-		Py_XDECREF( modeObj );
-		if ( isNewBuffer ) {
-			PyMem_Del( mode );
+	} else if (opt_key == ATTR_NATIVE_TYPES) {
+		/* Takes effect when the columns of the next result set are bound */
+		option_num = NUM2LONG(data);
+		if (option_num != NATIVE_TYPES_OFF && option_num != NATIVE_TYPES_ON) {
+			PyErr_SetString(PyExc_Exception, "ATTR_NATIVE_TYPES attribute must be one of NATIVE_TYPES_OFF or NATIVE_TYPES_ON");
+			return -1;
 		}
-	}
-}
-
-/*
- * static int _python_ibm_db_createdb(conn_handle *conn_res, PyObject *dbNameObj, PyObject *codesetObj, PyObject *modeObj, int createNX)
- */
-static int _python_ibm_db_createdb(conn_handle *conn_res, PyObject *dbNameObj, PyObject *codesetObj, PyObject *modeObj, int createNX)
-{
-	SQLWCHAR *dbName = NULL;
-	SQLWCHAR *codeset = NULL;
-	SQLWCHAR *mode = NULL;
-	SQLINTEGER sqlcode;
-	SQLSMALLINT length;
-	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
-	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
-	int isNewBuffer;
-	int rc = 0;
-#ifdef _WIN32
-	HINSTANCE cliLib = NULL;
-	FARPROC sqlcreatedb;
-#else
-	void *cliLib = NULL;
-	typedef int (*sqlcreatedbType)( SQLHDBC, SQLWCHAR *, SQLINTEGER, SQLWCHAR *, SQLINTEGER, SQLWCHAR *, SQLINTEGER );
-	sqlcreatedbType sqlcreatedb;
-#endif
-
-#if defined __APPLE__ || defined _AIX
-	PyErr_SetString( PyExc_Exception, "Not supported: This function is currently not supported on this platform" );
-	return -1;
-#else
-
-	if ( !NIL_P( conn_res ) ) {
-		if ( NIL_P( dbNameObj ) ) {
-			PyErr_SetString( PyExc_Exception, "Supplied database name Parameter is invalid" );
+		if (type == SQL_HANDLE_STMT) {
+			((stmt_handle*)handle)->s_native_types = option_num;
+		} else if (type == SQL_HANDLE_DBC) {
+			((conn_handle*)handle)->c_native_types = option_num;
+		} else {
+			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
 			return -1;
 		}
-		/* Check to ensure the connection resource given is active */
-		if ( !conn_res->handle_active ) {
-			PyErr_SetString( PyExc_Exception, "Connection is not active" );
+	} else if (opt_key == ATTR_LOB_READER) {
+		/* Takes effect on the next value fetched */
+		option_num = NUM2LONG(data);
+		if (option_num != LOB_READER_OFF && option_num != LOB_READER_ON) {
+			PyErr_SetString(PyExc_Exception, "ATTR_LOB_READER attribute must be one of LOB_READER_OFF or LOB_READER_ON");
 			return -1;
 		}
-
-		dbNameObj = PyUnicode_FromObject( dbNameObj );
-		if ( dbNameObj != NULL &&  dbNameObj != Py_None ) {
-			dbName = getUnicodeDataAsSQLWCHAR( dbNameObj, &isNewBuffer );
+		if (type == SQL_HANDLE_STMT) {
+			((stmt_handle*)handle)->s_lob_reader = option_num;
+		} else if (type == SQL_HANDLE_DBC) {
+			((conn_handle*)handle)->c_lob_reader = option_num;
 		} else {
+			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
 			return -1;
 		}
-		
-		if ( !NIL_P( codesetObj ) ) {
-			codesetObj = PyUnicode_FromObject( codesetObj );
-			if ( codesetObj != NULL &&  codesetObj != Py_None ) {
-				codeset = getUnicodeDataAsSQLWCHAR( codesetObj, &isNewBuffer );
-			} else {
-				_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
-				return -1;
-			}
-				
+	} else if (opt_key == ATTR_PARAM_TYPES) {
+		/* Replaces the cached descriptions, parameters are bound from them
+		 * on the next execute */
+		if (type != SQL_HANDLE_STMT) {
+			PyErr_SetString(PyExc_Exception, "ATTR_PARAM_TYPES attribute can only be set on a statement");
+			return -1;
 		}
-		if ( !NIL_P( modeObj ) ) {
-			modeObj = PyUnicode_FromObject( modeObj );
-			if ( codesetObj != NULL &&  codesetObj != Py_None ) {
-				mode = getUnicodeDataAsSQLWCHAR( modeObj, &isNewBuffer );	
-			} else {
-				_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, NULL, NULL, isNewBuffer );
-				return -1;
-			}
+		return _python_ibm_db_set_param_types((stmt_handle*)handle, data);
+	} else if (opt_key == ATTR_STMT_CACHE_SIZE) {
+		/* The statements cached so far are released */
+		option_num = NUM2LONG(data);
+		if (option_num < 0) {
+			PyErr_SetString(PyExc_Exception, "ATTR_STMT_CACHE_SIZE attribute must be a non-negative integer");
+			return -1;
 		}
-
-#ifdef _WIN32
-		cliLib = DLOPEN( LIBDB2 );
-#else
-		cliLib = DLOPEN( LIBDB2, RTLD_LAZY );
-#endif
-		if ( !cliLib ) {
-			sprintf( (char *)msg, "Error in loading %s library file", LIBDB2 );
-			PyErr_SetString( PyExc_Exception,  (char *)msg );
-			_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );	
+		if (type != SQL_HANDLE_DBC) {
+			PyErr_SetString(PyExc_Exception, "ATTR_STMT_CACHE_SIZE attribute can only be set on a connection");
 			return -1;
 		}
-#ifdef _WIN32
-		sqlcreatedb =  DLSYM( cliLib, "SQLCreateDbW" );
-#else
-		sqlcreatedb = (sqlcreatedbType) DLSYM( cliLib, "SQLCreateDbW" );
-#endif
-		if ( sqlcreatedb == NULL )  {
-#ifdef _WIN32
-			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp4 version of cli on window" );
-#else
-			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp3 version of cli" );
-#endif
-			PyErr_SetString( PyExc_Exception, (char *)msg );
-			DLCLOSE( cliLib );
-			_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
+		_python_ibm_db_clear_stmt_cache((conn_handle*)handle);
+		((conn_handle*)handle)->c_stmt_cache_size = (int)option_num;
+	} else if (opt_key == SQL_ATTR_ROW_ARRAY_SIZE) {
+		/* Kept on the handle, the CLI attribute is set when the columns are bound */
+		option_num = NUM2LONG(data);
+		if (option_num < 0) {
+			PyErr_SetString(PyExc_Exception, "SQL_ATTR_ROW_ARRAY_SIZE attribute must be a non-negative integer");
 			return -1;
 		}
-
-		Py_BEGIN_ALLOW_THREADS;
-		rc = (*sqlcreatedb)( (SQLHDBC)conn_res->hdbc, dbName, SQL_NTS, codeset, SQL_NTS, mode, SQL_NTS );
-		Py_END_ALLOW_THREADS;
-		
-		DLCLOSE( cliLib );		
-		if ( rc != SQL_SUCCESS ) {
-			if ( createNX == 1 ) {
-				if ( SQLGetDiagRec( SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, 1, sqlstate, &sqlcode, msg, SQL_MAX_MESSAGE_LENGTH + 1, &length ) == SQL_SUCCESS ) {
-					if ( sqlcode == -1005 ) {
-						_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
-						return 0;
-					}
-				}
-			}
-			_python_ibm_db_check_sql_errors( conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, NULL, -1, 1 );
-			_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
-			return -1;
-		}
-		_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
-		return 0;
-	} else {
-		PyErr_SetString( PyExc_Exception, "Supplied connection object Parameter is invalid" );
-		return -1;
-	}
-#endif
-}
-
-/*
- * static int _python_ibm_db_dropdb(conn_handle *conn_res, PyObject *dbNameObj, int recreate)
- */
-static int _python_ibm_db_dropdb(conn_handle *conn_res, PyObject *dbNameObj, int recreate)
-{
-	SQLWCHAR *dbName = NULL;
-	SQLINTEGER sqlcode;
-	SQLSMALLINT length;
-	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
-	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
-	int isNewBuffer;
-	int rc = 0;
-#ifdef _WIN32
-	FARPROC sqldropdb;
-	HINSTANCE cliLib = NULL;
-#else
-	typedef int (*sqldropdbType)( SQLHDBC, SQLWCHAR *, SQLINTEGER );
-	sqldropdbType sqldropdb;	
-	void *cliLib;
-#endif
-
-#if defined __APPLE__ || defined _AIX
-	PyErr_SetString( PyExc_Exception, "Not supported: This function is currently not supported on this platform" );
-	return -1;
-#else
-
-	if ( !NIL_P( conn_res ) ) {
-		if ( NIL_P( dbNameObj ) ) {
-			PyErr_SetString( PyExc_Exception, "Supplied database name Parameter is invalid" );
+		if (type == SQL_HANDLE_STMT) {
+			((stmt_handle*)handle)->row_array_size = (SQLUINTEGER)option_num;
+		} else if (type == SQL_HANDLE_DBC) {
+			((conn_handle*)handle)->c_row_array_size = (SQLUINTEGER)option_num;
+		} else {
+			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
 			return -1;
 		}
-		/* Check to ensure the connection resource given is active */
-		if ( !conn_res->handle_active ) {
-			PyErr_SetString( PyExc_Exception, "Connection is not active" );
+	} else if (opt_key == SQL_ATTR_PARAMSET_SIZE) {
+		/* Kept on the handle, the CLI attribute is set by execute_many */
+		option_num = NUM2LONG(data);
+		if (option_num < 0) {
+			PyErr_SetString(PyExc_Exception, "SQL_ATTR_PARAMSET_SIZE attribute must be a non-negative integer");
 			return -1;
 		}
-
-		dbNameObj = PyUnicode_FromObject( dbNameObj );
-		if ( dbNameObj != NULL &&  dbNameObj != Py_None ) {
-			dbName = getUnicodeDataAsSQLWCHAR( dbNameObj, &isNewBuffer );	
+		if (type == SQL_HANDLE_STMT) {
+			((stmt_handle*)handle)->paramset_size = (SQLUINTEGER)option_num;
+		} else if (type == SQL_HANDLE_DBC) {
+			((conn_handle*)handle)->c_paramset_size = (SQLUINTEGER)option_num;
 		} else {
+			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
 			return -1;
 		}
-
-#ifdef _WIN32
-		cliLib = DLOPEN( LIBDB2 );
-#else
-		cliLib = DLOPEN( LIBDB2, RTLD_LAZY );
-#endif
-		if ( !cliLib ) {
-			sprintf( (char *)msg, "Error in loading %s library file", LIBDB2 );
-			PyErr_SetString( PyExc_Exception, (char *)msg );
-			_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+	} else if (opt_key == SQL_ATTR_QUERY_TIMEOUT) {
+		/* A connection keeps it for the statements it prepares and executes */
+		option_num = NUM2LONG(data);
+		if (option_num < 0) {
+			PyErr_SetString(PyExc_Exception, "SQL_ATTR_QUERY_TIMEOUT attribute must be a non-negative integer");
 			return -1;
 		}
-#ifdef _WIN32
-		sqldropdb = DLSYM( cliLib, "SQLDropDbW" );
-#else
-		sqldropdb = (sqldropdbType)DLSYM( cliLib, "SQLDropDbW" );
-#endif
-		if ( sqldropdb == NULL)  {
-#ifdef _WIN32
-			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp4 version of cli on window" );
-#else
-			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp3 version of cli" );
-#endif
-			PyErr_SetString( PyExc_Exception, (char *)msg );
-			DLCLOSE( cliLib );
-			_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+		if (type == SQL_HANDLE_STMT) {
+			if (_python_ibm_db_set_query_timeout((stmt_handle*)handle, (SQLUINTEGER)option_num) == SQL_ERROR) {
+				PyErr_Format(PyExc_Exception, "Failed to set SQL_ATTR_QUERY_TIMEOUT: %s", IBM_DB_ERR(__python_stmt_err_msg));
+				return -1;
+			}
+		} else if (type == SQL_HANDLE_DBC) {
+			((conn_handle*)handle)->c_query_timeout = (SQLUINTEGER)option_num;
+		} else {
+			PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
 			return -1;
 		}
-
-		Py_BEGIN_ALLOW_THREADS;
-		rc = sqldropdb( conn_res->hdbc, dbName, SQL_NTS );
-		Py_END_ALLOW_THREADS;
-		
-		DLCLOSE( cliLib );
-		if ( rc != SQL_SUCCESS ) {
-			if ( recreate ) {
-				if ( SQLGetDiagRec( SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, 1, sqlstate, &sqlcode, msg, SQL_MAX_MESSAGE_LENGTH + 1, &length ) == SQL_SUCCESS ) {
-					if ( sqlcode == -1013 ) {
-						_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
-						return 0;
-					}
-				}
+	} else if (type == SQL_HANDLE_STMT) {
+		if (PyString_Check(data)|| PyUnicode_Check(data)) {
+			data = PyUnicode_FromObject(data);
+			option_str = getUnicodeDataAsSQLWCHAR(data, &isNewBuffer);
+			rc = SQLSetStmtAttrW((SQLHSTMT)((stmt_handle *)handle)->hstmt, opt_key, (SQLPOINTER)option_str, SQL_IS_INTEGER );
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+			}
+			if (isNewBuffer)
+				PyMem_Del(option_str);
+			
+		} else {
+			option_num = NUM2LONG(data);
+			if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_OFF) ((conn_handle*)handle)->auto_commit = 0;
+			else if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_ON) ((conn_handle*)handle)->auto_commit = 1;
+			rc = SQLSetStmtAttr((SQLHSTMT)((stmt_handle *)handle)->hstmt, opt_key, (SQLPOINTER)option_num, SQL_IS_INTEGER );
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+			}
+		}
+	} else if (type == SQL_HANDLE_DBC) {
+		/* Cached statements resolve unqualified names in the old schema */
+		if (opt_key == SQL_ATTR_CURRENT_SCHEMA) {
+			_python_ibm_db_clear_stmt_cache((conn_handle*)handle);
+		}
+		if (PyString_Check(data)|| PyUnicode_Check(data)) {
+			data = PyUnicode_FromObject(data);
+			option_str = getUnicodeDataAsSQLWCHAR(data, &isNewBuffer);
+			rc = SQLSetConnectAttrW((SQLHSTMT)((conn_handle*)handle)->hdbc, opt_key, (SQLPOINTER)option_str, SQL_NTS);
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+			}
+			if (isNewBuffer)
+				PyMem_Del(option_str);
+			
+		} else {
+			option_num = NUM2LONG(data);
+			if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_OFF) ((conn_handle*)handle)->auto_commit = 0;
+			else if (opt_key == SQL_ATTR_AUTOCOMMIT && option_num == SQL_AUTOCOMMIT_ON) ((conn_handle*)handle)->auto_commit = 1;
+			rc = SQLSetConnectAttrW((SQLHSTMT)((conn_handle*)handle)->hdbc, opt_key, (SQLPOINTER)option_num, SQL_IS_INTEGER);
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors((SQLHSTMT)((stmt_handle *)handle)->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
 			}
-			_python_ibm_db_check_sql_errors( conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, NULL, -1, 1 );
-			return -1;
 		}
-		_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
-		return 0;
 	} else {
-		PyErr_SetString( PyExc_Exception, "Supplied connection object Parameter is invalid" );
+		PyErr_SetString(PyExc_Exception, "Connection or statement handle must be passed in.");
 		return -1;
 	}
-#endif
+	return 0;
 }
 
-/*!# ibm_db.createdb
- *
- * ===Description
- *  True/None ibm_db.createdb ( IBM_DBConnection connection, string dbName [, codeSet, mode] )
- *
- * Creates a database by using the specified database name, code set, and mode
- *
- * ===Parameters
- *
- * ====connection
- *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
- *
- * ====dbName
- *      Name of the database that is to be created.
- *
- * ====codeSet
- *      Database code set information.
- *      Note: If the value of the codeSet argument not specified, the database is created in the Unicode code page for DB2 data servers and in the UTF-8 code page for IDS data servers.
- *
- * ====mode
- *      Database logging mode.
- *      Note: This value is applicable only to IDS data servers.
- *
- * ===Return Value
- *  Returns True on successful creation of database else return None
- */
-PyObject *ibm_db_createdb(PyObject *self, PyObject *args)
+/*	static int _python_ibm_db_parse_options( PyObject *options, int type, void *handle)
+*/
+static int _python_ibm_db_parse_options ( PyObject *options, int type, void *handle )
 {
-	conn_handle *conn_res = NULL;
-	PyObject *dbNameObj = NULL;
-	PyObject *codesetObj = NULL;
-	PyObject *modeObj = NULL;
-	int rc = -1;
+	int numOpts = 0, i = 0;
+	PyObject *keys = NULL;
+	PyObject *key = NULL; /* Holds the Option Index Key */
+	PyObject *data = NULL;
+	PyObject *tc_pass = NULL;
+	int rc = 0;
 
-	if ( !PyArg_ParseTuple( args, "OO|OO", &conn_res, &dbNameObj, &codesetObj, &modeObj ) ) {
-		return NULL;
+	if ( !NIL_P(options) ) {
+		keys = PyDict_Keys(options);
+		numOpts = PyList_Size(keys);
+
+		for ( i = 0; i < numOpts; i++) {
+			key = PyList_GetItem(keys, i);
+			data = PyDict_GetItem(options, key);
+
+			if(NUM2LONG(key) == SQL_ATTR_TRUSTED_CONTEXT_PASSWORD) {
+				tc_pass = data;
+			} else {
+				/* Assign options to handle. */
+				/* Sets the options in the handle with CLI/ODBC calls */
+				rc = _python_ibm_db_assign_options(handle, type, NUM2LONG(key), data);
+			}
+			if (rc)
+				return SQL_ERROR;
+		}
+		if (!NIL_P(tc_pass) ) {
+			rc = _python_ibm_db_assign_options(handle, type, SQL_ATTR_TRUSTED_CONTEXT_PASSWORD, tc_pass);
+		}
+		if (rc)
+			return SQL_ERROR;
 	}
-	rc = _python_ibm_db_createdb(conn_res, dbNameObj, codesetObj, modeObj, 0);
-	if ( rc == 0 ) {
-		Py_RETURN_TRUE;
-	} else {
-		return NULL;
-	}	
+	return SQL_SUCCESS;
 }
 
-/*!# ibm_db.dropdb
- *
- * ===Description
- *  True/None ibm_db.dropdb ( IBM_DBConnection connection, string dbName )
- *
- * Drops the specified database
- *
- * ===Parameters
- *
- * ====connection
- *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
- *
- * ====dbName
- *      Name of the database that is to be dropped.
- *
- * ===Return Value
- *  Returns True if specified database dropped sucessfully else None
- */
-PyObject *ibm_db_dropdb(PyObject *self, PyObject *args)
+/*	static int _python_ibm_db_get_result_set_info(stmt_handle *stmt_res)
+initialize the result set information of each column. This must be done once
+*/
+static int _python_ibm_db_get_result_set_info(stmt_handle *stmt_res)
 {
-	conn_handle *conn_res = NULL;
-	PyObject *dbNameObj = NULL;
-	int rc = -1;
+	int rc = -1, i;
+	SQLSMALLINT nResultCols = 0, name_length;
+	SQLCHAR tmp_name[BUFSIZ];
+	double stats_start;
 
-	if ( !PyArg_ParseTuple( args, "OO", &conn_res, &dbNameObj ) ) {
-		return NULL;
+	STATS_START(stats_start);
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLNumResultCols((SQLHSTMT)stmt_res->hstmt, &nResultCols);
+	Py_END_ALLOW_THREADS;
+	STATS_TIME(stmt_res, STATS_DESCRIBE, stats_start);
+
+	if ( rc == SQL_ERROR || nResultCols == 0) {
+	  _python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+									  SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+	  return -1;
 	}
-	
-	rc = _python_ibm_db_dropdb( conn_res, dbNameObj, 0 );
-	if ( rc == 0 ) {
-		Py_RETURN_TRUE;
-	} else {
-		return NULL;
+	stmt_res->num_columns = nResultCols;
+	stmt_res->column_info = ALLOC_N(ibm_db_result_set_info, nResultCols);
+	if ( stmt_res->column_info == NULL ) {
+	  PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+	  return -1;
 	}
-}
+	memset(stmt_res->column_info, 0, sizeof(ibm_db_result_set_info)*nResultCols);
+	/* return a set of attributes for a column */
+	for (i = 0 ; i < nResultCols; i++) {
+	  stmt_res->column_info[i].lob_loc = 0;
+	  stmt_res->column_info[i].loc_ind = 0;
+	  stmt_res->column_info[i].loc_type = 0;
 
-/*ibm_db.recreatedb
- *
- * ===Description
- *  True/None ibm_db.recreatedb ( IBM_DBConnection connection, string dbName [, codeSet, mode] )
- *
- * Drop and then recreates a database by using the specified database name, code set, and mode
- *
- * ===Parameters
- *
- * ====connection
- *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
- *
- * ====dbName
- *      Name of the database that is to be created.
- *
- * ====codeSet
- *      Database code set information.
- *      Note: If the value of the codeSet argument not specified, the database is created in the Unicode code page for DB2 data servers and in the UTF-8 code page for IDS data servers.
- *
- * ====mode
- *      Database logging mode.
- *      Note: This value is applicable only to IDS data servers.
- *
- * ===Return Value
- *  Returns True if specified database created successfully else return None
- */
-PyObject *ibm_db_recreatedb(PyObject *self, PyObject *args)
-{
-	conn_handle *conn_res = NULL;
-	PyObject *dbNameObj = NULL;
-	PyObject *codesetObj = NULL;
-	PyObject *modeObj = NULL;
-	int rc = -1;
+	  STATS_START(stats_start);
+	  Py_BEGIN_ALLOW_THREADS;
+	  rc = SQLDescribeCol((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT)(i + 1 ),
+						  (SQLCHAR *)&tmp_name, BUFSIZ, &name_length, 
+						  &stmt_res->column_info[i].type,
+						  &stmt_res->column_info[i].size, 
+						  &stmt_res->column_info[i].scale,
+						  &stmt_res->column_info[i].nullable);
+	  Py_END_ALLOW_THREADS;
+	  STATS_TIME(stmt_res, STATS_DESCRIBE, stats_start);
 
-	if ( !PyArg_ParseTuple( args, "OO|OO", &conn_res, &dbNameObj, &codesetObj, &modeObj ) ) {
-		return NULL;
-	}
+	  if ( rc == SQL_ERROR ) {
+		 _python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+										 SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		 return -1;
+	  }
+	  if ( name_length <= 0 ) {
+		 stmt_res->column_info[i].name = (SQLCHAR *)estrdup("");
+		 if ( stmt_res->column_info[i].name == NULL ) {
+			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+			 return -1;
+		 }
 
-	rc = _python_ibm_db_dropdb( conn_res, dbNameObj, 1 );
-	if ( rc != 0 ) {
-		return NULL; 
-	} 
+	  } else if (name_length >= BUFSIZ ) {
+		 /* column name is longer than BUFSIZ */
+		 stmt_res->column_info[i].name = (SQLCHAR*)ALLOC_N(char, name_length+1);
+		 if ( stmt_res->column_info[i].name == NULL ) {
+			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+			 return -1;
+		 }
 
-	rc = _python_ibm_db_createdb(conn_res, dbNameObj, codesetObj, modeObj, 0);
-	if ( rc == 0 ) {
-		Py_RETURN_TRUE;
-	} else {
-		return NULL;
-	}
-}
+		 STATS_START(stats_start);
+		 Py_BEGIN_ALLOW_THREADS;
+		 rc = SQLDescribeCol((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT)(i + 1),
+							 stmt_res->column_info[i].name, name_length, 
+							 &name_length, &stmt_res->column_info[i].type, 
+							 &stmt_res->column_info[i].size, 
+							 &stmt_res->column_info[i].scale, 
+							 &stmt_res->column_info[i].nullable);
+		 Py_END_ALLOW_THREADS;
+		 STATS_TIME(stmt_res, STATS_DESCRIBE, stats_start);
 
-/*!# ibm_db.createdbNX 
- *
- * ===Description
- *  True/None ibm_db.createdbNX ( IBM_DBConnection connection, string dbName [, codeSet, mode] )
- *
- * Creates the database if not exist by using the specified database name, code set, and mode
- *
- * ===Parameters
- *
- * ====connection
- *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
- *
- * ====dbName
- *      Name of the database that is to be created.
- *
- * ====codeSet
- *      Database code set information.
- *      Note: If the value of the codeSet argument not specified, the database is created in the Unicode code page for DB2 data servers and in the UTF-8 code page for IDS data servers.
- *
- * ====mode
- *      Database logging mode.
- *      Note: This value is applicable only to IDS data servers.
- *
- * ===Return Value
- *  Returns True if database already exists or created sucessfully else return None
- */
-PyObject *ibm_db_createdbNX(PyObject *self, PyObject *args)
-{
-	conn_handle *conn_res = NULL;
-	PyObject *dbNameObj = NULL;
-	PyObject *codesetObj = NULL;
-	PyObject *modeObj = NULL;
-	int rc = -1;
-	
-	if ( !PyArg_ParseTuple( args, "OO|OO", &conn_res, &dbNameObj, &codesetObj, &modeObj ) ) {
-		return NULL;
-	}
-	
-	rc = _python_ibm_db_createdb(conn_res, dbNameObj, codesetObj, modeObj, 1);
-	if ( rc == 0 ) {
-		Py_RETURN_TRUE;
-	} else {
-		return NULL;
+		 if ( rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+											SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+			return -1;
+		 }
+	  } else {
+		 stmt_res->column_info[i].name = (SQLCHAR*)estrdup((char*)tmp_name);
+		 if ( stmt_res->column_info[i].name == NULL ) {
+			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+			 return -1;
+		 }
+
+	  }
 	}
+	return _python_ibm_db_build_column_keys(stmt_res);
 }
 
-/*!# ibm_db.autocommit
- *
- * ===Description
- *
- * mixed ibm_db.autocommit ( resource connection [, bool value] )
- *
- * Returns or sets the AUTOCOMMIT behavior of the specified connection resource.
- *
- * ===Parameters
- *
- * ====connection
- *	A valid database connection resource variable as returned from connect()
- * or pconnect().
- *
- * ====value
- *	One of the following constants:
- *	SQL_AUTOCOMMIT_OFF
- *		  Turns AUTOCOMMIT off.
- *	SQL_AUTOCOMMIT_ON
- *		  Turns AUTOCOMMIT on.
- *
- * ===Return Values
- *
- * When ibm_db.autocommit() receives only the connection parameter, it returns
- * the current state of AUTOCOMMIT for the requested connection as an integer
- * value. A value of 0 indicates that AUTOCOMMIT is off, while a value of 1
- * indicates that AUTOCOMMIT is on.
- *
- * When ibm_db.autocommit() receives both the connection parameter and
- * autocommit parameter, it attempts to set the AUTOCOMMIT state of the
- * requested connection to the corresponding state.
- *
- * Returns TRUE on success or FALSE on failure.
- */ 
-static PyObject *ibm_db_autocommit(PyObject *self, PyObject *args)			
+/*	static SQLUINTEGER _python_ibm_db_get_row_array_size(stmt_handle *stmt_res, SQLINTEGER row_width, int single_row)
+	number of rows to fetch per block for a result set whose bound columns
+	take row_width bytes per row
+*/
+static SQLUINTEGER _python_ibm_db_get_row_array_size(stmt_handle *stmt_res, SQLINTEGER row_width, int single_row)
 {
-	PyObject *py_autocommit = NULL;
-	conn_handle *conn_res = NULL;
+	SQLINTEGER cursor_type = SQL_CURSOR_FORWARD_ONLY;
+	SQLUINTEGER array_size;
 	int rc;
-	SQLINTEGER autocommit = -1;
 
-	if (!PyArg_ParseTuple(args, "O|O", &conn_res, &py_autocommit)){
-		return NULL;
+	/* Columns read with SQLGetData need a rowset of a single row */
+	if ( single_row ) {
+		return 1;
+	}
+	if ( stmt_res->row_array_size > 0 ) {
+		return stmt_res->row_array_size;
 	}
 
-	if (!NIL_P(conn_res)) {
-		if (!NIL_P(py_autocommit)) {
-			if (PyInt_Check(py_autocommit)) { 
-				autocommit = (SQLINTEGER)PyInt_AsLong(py_autocommit);
-			} else {
-				PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
-				return NULL;
-			}
-		}
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			return NULL;
-		}
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLGetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_CURSOR_TYPE,
+		&cursor_type, SQL_IS_INTEGER, NULL);
+	Py_END_ALLOW_THREADS;
 
-	  /* If value in handle is different from value passed in */
-		if (PyTuple_Size(args) == 2) {
-			if(autocommit != (conn_res->auto_commit)) {
-#ifndef PASE
-				rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) (autocommit == 0 ? SQL_AUTOCOMMIT_OFF : SQL_AUTOCOMMIT_ON), SQL_IS_INTEGER);
-#else
-				rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER)&autocommit, SQL_IS_INTEGER);
-#endif
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, 
-												rc, 1, NULL, -1, 1);
-				}
-				conn_res->auto_commit = autocommit;
-			}
-			Py_INCREF(Py_True);
-			return Py_True;
-		} else {
-			return PyInt_FromLong(conn_res->auto_commit);
+	if ( rc == SQL_ERROR || cursor_type != SQL_CURSOR_FORWARD_ONLY ) {
+		return 1;
+	}
+	array_size = DEFAULT_ROW_ARRAY_SIZE;
+	if ( row_width > 0 && (SQLUINTEGER)row_width * array_size > MAX_ROW_ARRAY_BUFFER_SIZE ) {
+		array_size = MAX_ROW_ARRAY_BUFFER_SIZE / row_width;
+		if ( array_size == 0 ) {
+			array_size = 1;
 		}
 	}
-	return NULL;
+	return array_size;
 }
 
-/*	static void _python_ibm_db_add_param_cache( stmt_handle *stmt_res, int param_no, PyObject *var_pyvalue, char *varname, int varname_len, int param_type, int size, SQLSMALLINT data_type, SQLSMALLINT precision, SQLSMALLINT scale, SQLSMALLINT nullable )
+/*	static int _python_ibm_db_init_native_types(void)
+	import the datetime C API and decimal.Decimal used by ATTR_NATIVE_TYPES
 */
-static void _python_ibm_db_add_param_cache( stmt_handle *stmt_res, int param_no, PyObject *var_pyvalue, int param_type, int size, SQLSMALLINT data_type, SQLUINTEGER precision, SQLSMALLINT scale, SQLSMALLINT nullable )
+static int _python_ibm_db_init_native_types(void)
 {
-	param_node *tmp_curr = NULL, *prev = stmt_res->head_cache_list, *curr = stmt_res->head_cache_list;
-
-	while ( (curr != NULL) && (curr->param_num < param_no) ) {
-		prev = curr;
-		curr = curr->next;
-	}
+	PyObject *decimal_module = NULL;
 
-	if ( curr == NULL || curr->param_num != param_no ) {
-		/* Allocate memory and make new node to be added */
-		tmp_curr = ALLOC(param_node);
-		memset(tmp_curr, 0, sizeof(param_node));
-
-		/* assign values */
-		tmp_curr->data_type = data_type;
-		tmp_curr->param_size = precision;
-		tmp_curr->nullable = nullable;
-		tmp_curr->scale = scale;
-		tmp_curr->param_num = param_no;
-		tmp_curr->file_options = SQL_FILE_READ;
-		tmp_curr->param_type = param_type;
-		tmp_curr->size = size;
-
-		/* Set this flag in stmt_res if a FILE INPUT is present */
-		if ( param_type == PARAM_FILE) {
-			stmt_res->file_param = 1;
+	if (PyDateTimeAPI == NULL) {
+		PyDateTime_IMPORT;
+		if (PyDateTimeAPI == NULL) {
+			return -1;
 		}
-
-		if ( var_pyvalue != NULL) {
-			tmp_curr->var_pyvalue = var_pyvalue;
+	}
+	if (decimal_type == NULL) {
+		decimal_module = PyImport_ImportModule("decimal");
+		if (decimal_module == NULL) {
+			return -1;
 		}
-
-		/* link pointers for the list */
-		if ( prev == NULL ) {
-			stmt_res->head_cache_list = tmp_curr;
-		} else {
-			prev->next = tmp_curr;
+		decimal_type = PyObject_GetAttrString(decimal_module, "Decimal");
+		Py_DECREF(decimal_module);
+		if (decimal_type == NULL) {
+			return -1;
 		}
-		tmp_curr->next = curr;
+	}
+	return 0;
+}
 
-		/* Increment num params added */
-		stmt_res->num_params++;
-	} else {
-		/* Both the nodes are for the same param no */
-		/* Replace Information */
-		curr->data_type = data_type;
-		curr->param_size = precision;
-		curr->nullable = nullable;
-		curr->scale = scale;
-		curr->param_num = param_no;
-		curr->file_options = SQL_FILE_READ;
-		curr->param_type = param_type;
-		curr->size = size;
+/*	static PyObject *_python_ibm_db_native_value(SQLSMALLINT column_type, ibm_db_row_data_type *row_data)
+	datetime or Decimal object of a DATE, TIME, TIMESTAMP or DECIMAL value
+	bound with ATTR_NATIVE_TYPES on
+*/
+static PyObject *_python_ibm_db_native_value(SQLSMALLINT column_type, ibm_db_row_data_type *row_data)
+{
+	DATE_STRUCT *date_value;
+	TIME_STRUCT *time_value;
+	TIMESTAMP_STRUCT *ts_value;
+	char *str, *comma;
 
-		/* Set this flag in stmt_res if a FILE INPUT is present */
-		if ( param_type == PARAM_FILE) {
-			stmt_res->file_param = 1;
-		}
+	switch(column_type) {
+		case SQL_TYPE_DATE:
+			date_value = (DATE_STRUCT *)row_data->str_val;
+			return PyDate_FromDate(date_value->year, date_value->month, date_value->day);
 
-		if ( var_pyvalue != NULL) {
-			curr->var_pyvalue = var_pyvalue;
-		}
+		case SQL_TYPE_TIME:
+			time_value = (TIME_STRUCT *)row_data->str_val;
+			/* DB2 accepts 24:00:00, datetime does not; the C API does not
+			 * check the fields */
+			if (time_value->hour > 23) {
+				PyErr_SetString(PyExc_ValueError, "hour must be in 0..23");
+				return NULL;
+			}
+			return PyTime_FromTime(time_value->hour, time_value->minute, 
+				time_value->second, 0);
+
+		case SQL_TYPE_TIMESTAMP:
+			/* fraction is in nanoseconds */
+			ts_value = (TIMESTAMP_STRUCT *)row_data->str_val;
+			if (ts_value->hour > 23) {
+				PyErr_SetString(PyExc_ValueError, "hour must be in 0..23");
+				return NULL;
+			}
+			return PyDateTime_FromDateAndTime(ts_value->year, ts_value->month, 
+				ts_value->day, ts_value->hour, ts_value->minute, ts_value->second, 
+				ts_value->fraction / 1000);
 
+		default:
+			/* The decimal separator of the client locale is not understood by
+			 * Decimal */
+			str = (char *)row_data->str_val;
+			if ((comma = strchr(str, ',')) != NULL) {
+				*comma = '.';
+			}
+			return PyObject_CallFunction(decimal_type, "s", str);
 	}
 }
 
-/*
- * static PyObject *_python_ibm_db_bind_param_helper(int argc, stmt_handle *stmt_res, SQLUSMALLINT param_no, PyObject *var_pyvalue, long param_type,
- * 					 long data_type, long precision, long scale, long size)
- */
-static PyObject *_python_ibm_db_bind_param_helper(int argc, stmt_handle *stmt_res, SQLUSMALLINT param_no, PyObject *var_pyvalue, long param_type, long data_type, long precision, long scale, long size)
+/*	static int _python_ibn_bind_column_helper(stmt_handle *stmt_res)
+	bind columns to data, this must be done once.  Every column is bound to a
+	column-wise array of bound_array_size rows, see _python_ibm_db_load_row.
+*/
+static int _python_ibm_db_bind_column_helper(stmt_handle *stmt_res)
 {
-	SQLSMALLINT sql_data_type = 0;
-	SQLUINTEGER sql_precision = 0;
-	SQLSMALLINT sql_scale = 0;
-	SQLSMALLINT sql_nullable = SQL_NO_NULLS;
-	char error[DB2_MAX_ERR_MSG_LEN];
-	int rc = 0;
-	
-	/* Check for Param options */
-	switch (argc) {
-		/* if argc == 3, then the default value for param_type will be used */
-		case 3:
-			param_type = SQL_PARAM_INPUT;
+	SQLSMALLINT column_type, target_type;
+	SQLINTEGER row_width = 0;
+	SQLUINTEGER array_size;
+	ibm_db_row_type *row;
+	long native_types = stmt_res->s_native_types;
+	int i, single_row = 0, rc = SQL_SUCCESS;
+
+	if ( native_types == NATIVE_TYPES_ON && _python_ibm_db_init_native_types() < 0 ) {
+		return -1;
+	}
+	stmt_res->row_data = ALLOC_N(ibm_db_row_type, stmt_res->num_columns);
+	if ( stmt_res->row_data == NULL ) {
+		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+		return -1;
+	}
+	memset(stmt_res->row_data, 0, sizeof(ibm_db_row_type)*stmt_res->num_columns);
 
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)param_no, &sql_data_type, &sql_precision, &sql_scale, &sql_nullable);
-			Py_END_ALLOW_THREADS;
+	/* Size of one value of each column */
+	for (i = 0; i<stmt_res->num_columns; i++) {
+		column_type = stmt_res->column_info[i].type;
+		row = &stmt_res->row_data[i];
+		switch(column_type) {
+			case SQL_WLONGVARCHAR:
+				/* Fetched with SQLGetData, not bound */
+				single_row = 1;
+				break;
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-				sprintf(error, "Describe Param Failed: %s", 
-				IBM_DB_G(__python_stmt_err_msg));
-				PyErr_SetString(PyExc_Exception, error);
-				return NULL;
-			}
-			/* Add to cache */
-			_python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue, 
-										param_type, size, 
-										sql_data_type, sql_precision, 
-										sql_scale, sql_nullable );
-			break;
+			case SQL_LONGVARCHAR:
+				/* Fetched with SQLGetData */
+				single_row = 1;
+				/* fall-through */
+			case SQL_CHAR:
+			case SQL_VARCHAR:
+			case SQL_WCHAR:
+			case SQL_WVARCHAR:
+			case SQL_GRAPHIC:
+			case SQL_VARGRAPHIC:
+			case SQL_LONGVARGRAPHIC:
+				row->buffer_size = (stmt_res->column_info[i].size+1) * sizeof(SQLWCHAR);
+				break;
 
-		case 4:
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, 
-								(SQLUSMALLINT)param_no, &sql_data_type, 
-								&sql_precision, &sql_scale, &sql_nullable);
-			Py_END_ALLOW_THREADS;
+			case SQL_BINARY:
+			case SQL_LONGVARBINARY:
+			case SQL_VARBINARY:
+				if ( stmt_res->s_bin_mode == CONVERT ) {
+					row->buffer_size = 2*(stmt_res->column_info[i].size)+1;
+				} else {
+					row->buffer_size = stmt_res->column_info[i].size+1;
+				}
+				break;
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,
-												rc, 1, NULL, -1, 1);
-				sprintf(error, "Describe Param Failed: %s", 
-						IBM_DB_G(__python_stmt_err_msg));
-				PyErr_SetString(PyExc_Exception, error);
-				return NULL;
-			}
-			/* Add to cache */
-			_python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
-											param_type, size, 
-											sql_data_type, sql_precision, 
-											sql_scale, sql_nullable );
-			break;
+			case SQL_TYPE_DATE:
+			case SQL_TYPE_TIME:
+			case SQL_TYPE_TIMESTAMP:
+				if ( native_types == NATIVE_TYPES_ON ) {
+					row->buffer_size = (column_type == SQL_TYPE_DATE) ? sizeof(DATE_STRUCT) :
+						(column_type == SQL_TYPE_TIME) ? sizeof(TIME_STRUCT) : sizeof(TIMESTAMP_STRUCT);
+					break;
+				}
+				/* fall-through */
+			case SQL_BIGINT:
+			case SQL_DECFLOAT:
+				row->buffer_size = stmt_res->column_info[i].size+2;
+				break;
 
-		case 5:
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, 
-								(SQLUSMALLINT)param_no, &sql_data_type, 
-								&sql_precision, &sql_scale, &sql_nullable);
-			Py_END_ALLOW_THREADS;
+			case SQL_SMALLINT:
+				row->buffer_size = sizeof(row->data.s_val);
+				break;
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-								rc, 1, NULL, -1, 1);
-				sprintf(error, "Describe Param Failed: %s", 
-								IBM_DB_G(__python_stmt_err_msg));
-				PyErr_SetString(PyExc_Exception, error);
-				return NULL;
-			}
-			sql_data_type = (SQLSMALLINT)data_type;
-			/* Add to cache */
-			_python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
-											param_type, size, 
-											sql_data_type, sql_precision, 
-											sql_scale, sql_nullable );
-			break;
+			case SQL_INTEGER:
+				row->buffer_size = sizeof(row->data.i_val);
+				break;
 
-		case 6:
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, 
-								(SQLUSMALLINT)param_no, &sql_data_type, 
-							&sql_precision, &sql_scale, &sql_nullable);
-			Py_END_ALLOW_THREADS;
+			case SQL_REAL:
+				row->buffer_size = sizeof(row->data.r_val);
+				break;
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,
-												rc, 1, NULL, -1, 1);
-				sprintf(error, "Describe Param Failed: %s", 
-						IBM_DB_G(__python_stmt_err_msg));
-				PyErr_SetString(PyExc_Exception, error);
-				return NULL;
-			}
-			sql_data_type = (SQLSMALLINT)data_type;
-			sql_precision = (SQLUINTEGER)precision;
-			/* Add to cache */
-			_python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
-											param_type, size, 
-											sql_data_type, sql_precision, 
-											sql_scale, sql_nullable );
-			break;
+			case SQL_FLOAT:
+				row->buffer_size = sizeof(row->data.f_val);
+				break;
 
-		case 7:
-		case 8:
-			/* Cache param data passed 
-			* I am using a linked list of nodes here because I don't know 
-			* before hand how many params are being passed in/bound. 
-			* To determine this, a call to SQLNumParams is necessary. 
-			* This is take away any advantages an array would have over 
-			* linked list access 
-			* Data is being copied over to the correct types for subsequent 
-			* CLI call because this might cause problems on other platforms 
-			* such as AIX 
-			*/
-			sql_data_type = (SQLSMALLINT)data_type;
-			sql_precision = (SQLUINTEGER)precision;
-			sql_scale = (SQLSMALLINT)scale;
-			_python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
-											param_type, size, 
-											sql_data_type, sql_precision, 
-											sql_scale, sql_nullable );
-			break;
-	
-		default:
-			/* WRONG_PARAM_COUNT; */
-			return NULL;
+			case SQL_DOUBLE:
+				row->buffer_size = sizeof(row->data.d_val);
+				break;
+
+			case SQL_DECIMAL:
+			case SQL_NUMERIC:
+				row->buffer_size = stmt_res->column_info[i].size +
+					stmt_res->column_info[i].scale + 2 + 1;
+				break;
+
+			case SQL_CLOB:
+			case SQL_DBCLOB:
+			case SQL_BLOB:
+				row->buffer_size = sizeof(stmt_res->column_info[i].lob_loc);
+				break;
+
+			case SQL_XML:
+				/* Fetched with SQLGetData, not bound */
+				single_row = 1;
+				break;
+
+			default:
+				break;
+		}
+		row_width += row->buffer_size;
 	}
-	/* end Switch */
 
-	/* We bind data with DB2 CLI in ibm_db.execute() */
-	/* This will save network flow if we need to override params in it */
+	array_size = _python_ibm_db_get_row_array_size(stmt_res, row_width, single_row);
 
-	Py_INCREF(Py_True);
-	return Py_True;
-}
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_ROW_ARRAY_SIZE,
+		(SQLPOINTER)(size_t)array_size, SQL_IS_INTEGER);
+	if ( rc != SQL_ERROR ) {
+		rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_ROWS_FETCHED_PTR,
+			(SQLPOINTER)&stmt_res->rows_fetched, SQL_IS_POINTER);
+	}
+	Py_END_ALLOW_THREADS;
 
-/*!# ibm_db.bind_param
- *
- * ===Description
- * Py_True/Py_None ibm_db.bind_param (resource stmt, int parameter-number,
- *									string variable [, int parameter-type
- *									[, int data-type [, int precision
- *									[, int scale [, int size[]]]]]] )
- *
- * Binds a Python variable to an SQL statement parameter in a IBM_DBStatement
- * resource returned by ibm_db.prepare().
- * This function gives you more control over the parameter type, data type,
- * precision, and scale for the parameter than simply passing the variable as
- * part of the optional input array to ibm_db.execute().
- *
- * ===Parameters
- *
- * ====stmt
- *
- *	A prepared statement returned from ibm_db.prepare().
- *
- * ====parameter-number
- *
- *	Specifies the 1-indexed position of the parameter in the prepared
- * statement.
- *
- * ====variable
- *
- *	A Python variable to bind to the parameter specified by parameter-number.
- *
- * ====parameter-type
- *
- *	A constant specifying whether the Python variable should be bound to the
- * SQL parameter as an input parameter (SQL_PARAM_INPUT), an output parameter
- * (SQL_PARAM_OUTPUT), or as a parameter that accepts input and returns output
- * (SQL_PARAM_INPUT_OUTPUT). To avoid memory overhead, you can also specify
- * PARAM_FILE to bind the Python variable to the name of a file that contains
- * large object (BLOB, CLOB, or DBCLOB) data.
- *
- * ====data-type
- *
- *	A constant specifying the SQL data type that the Python variable should be
- * bound as: one of SQL_BINARY, DB2_CHAR, DB2_DOUBLE, or DB2_LONG .
- *
- * ====precision
- *
- *	Specifies the precision that the variable should be bound to the database. *
- * ====scale
- *
- *	  Specifies the scale that the variable should be bound to the database.
- *
- * ====size
- *
- *	  Specifies the size that should be retreived from an INOUT/OUT parameter.
- *
- * ===Return Values
- *
- *	Returns Py_True on success or NULL on failure.
- */
-static PyObject *ibm_db_bind_param(PyObject *self, PyObject *args)			
-{
-	PyObject *var_pyvalue = NULL;
-	PyObject *py_param_type = NULL;
-	PyObject *py_data_type = NULL;
-	PyObject *py_precision = NULL;
-	PyObject *py_scale = NULL;
-	PyObject *py_size = NULL;
-	PyObject *py_param_no = NULL;
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+			SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		return rc;
+	}
+	stmt_res->bound_array_size = array_size;
+	stmt_res->rows_fetched = 0;
+	stmt_res->row_block_pos = 0;
+	stmt_res->bound_native_types = native_types;
 
-	long param_type = SQL_PARAM_INPUT;
-	/* LONG types used for data being passed in */
-	SQLUSMALLINT param_no = 0;
-	long data_type = 0;
-	long precision = 0;
-	long scale = 0;
-	long size = 0;
-	stmt_handle *stmt_res;
-	
-	if (!PyArg_ParseTuple(args, "OOO|OOOOO", &stmt_res, &py_param_no, 
-						&var_pyvalue, &py_param_type, 
-						&py_data_type, &py_precision, 
-						&py_scale, &py_size)) {
-	
-		return NULL;
-	}
-	if (!NIL_P(py_param_no)) {
-		if (PyInt_Check(py_param_no)) {
-			param_no = (SQLUSMALLINT) PyInt_AsLong(py_param_no);
-		} else {
-			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
-			return NULL;
+	for (i = 0; i<stmt_res->num_columns; i++) {
+		column_type = stmt_res->column_info[i].type;
+		row = &stmt_res->row_data[i];
+		if ( row->buffer_size == 0 ) {
+			/* Columns without a buffer size are not bound */
+			row->out_length = 0;
+			continue;
 		}
-	}
-	if (py_param_type != NULL && py_param_type != Py_None && 
-		TYPE(py_param_type) == PYTHON_FIXNUM) {
-		param_type = PyInt_AS_LONG(py_param_type);
-	}
+		switch(column_type) {
+			case SQL_BINARY:
+			case SQL_LONGVARBINARY:
+			case SQL_VARBINARY:
+				target_type = (stmt_res->s_bin_mode == CONVERT) ? SQL_C_CHAR : SQL_C_DEFAULT;
+				break;
 
-	if (py_data_type != NULL && py_data_type != Py_None && 
-		TYPE(py_data_type) == PYTHON_FIXNUM) {
-		data_type = PyInt_AS_LONG(py_data_type);
-	}
+			case SQL_TYPE_DATE:
+				target_type = (native_types == NATIVE_TYPES_ON) ? SQL_C_TYPE_DATE : SQL_C_CHAR;
+				break;
 
-	if (py_precision != NULL && py_precision != Py_None && 
-		TYPE(py_precision) == PYTHON_FIXNUM) {
-		precision = PyInt_AS_LONG(py_precision);
-	}
+			case SQL_TYPE_TIME:
+				target_type = (native_types == NATIVE_TYPES_ON) ? SQL_C_TYPE_TIME : SQL_C_CHAR;
+				break;
 
-	if (py_scale != NULL && py_scale != Py_None && 
-		TYPE(py_scale) == PYTHON_FIXNUM) {
-		scale = PyInt_AS_LONG(py_scale);
-	}
+			case SQL_TYPE_TIMESTAMP:
+				target_type = (native_types == NATIVE_TYPES_ON) ? SQL_C_TYPE_TIMESTAMP : SQL_C_CHAR;
+				break;
 
-	if (py_size != NULL && py_size != Py_None && 
-		TYPE(py_size) == PYTHON_FIXNUM) {
-		size = PyInt_AS_LONG(py_size);
-	}
+			case SQL_BIGINT:
+			case SQL_DECFLOAT:
+			case SQL_DECIMAL:
+			case SQL_NUMERIC:
+				target_type = SQL_C_CHAR;
+				break;
 
-	if (!NIL_P(stmt_res)) {
-		return _python_ibm_db_bind_param_helper(PyTuple_Size(args), stmt_res, param_no, var_pyvalue, param_type, data_type, precision, scale, size);
-	} else {
-		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
-		return NULL;
+			case SQL_REAL:
+				target_type = SQL_C_FLOAT;
+				break;
+
+			case SQL_SMALLINT:
+			case SQL_INTEGER:
+			case SQL_FLOAT:
+			case SQL_DOUBLE:
+				target_type = SQL_C_DEFAULT;
+				break;
+
+			case SQL_CLOB:
+				target_type = stmt_res->column_info[i].loc_type = SQL_CLOB_LOCATOR;
+				break;
+
+			case SQL_DBCLOB:
+				target_type = stmt_res->column_info[i].loc_type = SQL_DBCLOB_LOCATOR;
+				break;
+
+			case SQL_BLOB:
+				target_type = stmt_res->column_info[i].loc_type = SQL_BLOB_LOCATOR;
+				break;
+
+			default:
+				target_type = SQL_C_WCHAR;
+				break;
+		}
+
+		row->buffer = (SQLPOINTER)ALLOC_N(char, row->buffer_size * array_size);
+		row->out_lengths = ALLOC_N(SQLLEN, array_size);
+		if ( row->buffer == NULL || row->out_lengths == NULL ) {
+			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+			return -1;
+		}
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(i+1),
+			target_type, row->buffer, row->buffer_size, row->out_lengths);
+		Py_END_ALLOW_THREADS;
+
+		if ( rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+				SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		}
 	}
+	return rc;
 }
 
-
-/*!# ibm_db.close
- *
- * ===Description
- *
- * bool ibm_db.close ( resource connection )
- *
- * This function closes a DB2 client connection created with ibm_db.connect()
- * and returns the corresponding resources to the database server.
- *
- * If you attempt to close a persistent DB2 client connection created with
- * ibm_db.pconnect(), the close request returns TRUE and the persistent IBM Data
- * Server client connection remains available for the next caller.
- *
- * ===Parameters
- *
- * ====connection
- *	Specifies an active DB2 client connection.
- *
- * ===Return Values
- * Returns TRUE on success or FALSE on failure.
- */
-static PyObject *ibm_db_close(PyObject *self, PyObject *args)			
+/*	static void _python_ibm_db_load_row(stmt_handle *stmt_res, SQLULEN row_num)
+	make row row_num of the fetched block the current row of every column
+*/
+static void _python_ibm_db_load_row(stmt_handle *stmt_res, SQLULEN row_num)
 {
-	conn_handle *conn_res = NULL;
-	int rc;
+	ibm_db_row_type *row;
+	char *value;
+	int i;
 
-	if (!PyArg_ParseTuple(args, "O", &conn_res))
-		return NULL;
+	STATS_ADD(stmt_res, rows_fetched, 1);
+	for (i = 0; i<stmt_res->num_columns; i++) {
+		row = &stmt_res->row_data[i];
+		if ( row->buffer == NULL ) {
+			continue;
+		}
+		value = (char *)row->buffer + row_num * row->buffer_size;
+		switch(stmt_res->column_info[i].type) {
+			case SQL_SMALLINT:
+				row->data.s_val = *(SQLSMALLINT *)value;
+				break;
 
-	if (!NIL_P(conn_res)) {
-		/* Check to see if it's a persistent connection; 
-		 * if so, just return true 
-		*/
+			case SQL_INTEGER:
+				row->data.i_val = *(SQLINTEGER *)value;
+				break;
 
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			return NULL;
+			case SQL_REAL:
+				row->data.r_val = *(SQLREAL *)value;
+				break;
+
+			case SQL_FLOAT:
+				row->data.f_val = *(SQLFLOAT *)value;
+				break;
+
+			case SQL_DOUBLE:
+				row->data.d_val = *(SQLDOUBLE *)value;
+				break;
+
+			case SQL_CLOB:
+			case SQL_DBCLOB:
+			case SQL_BLOB:
+				/* LOB data is read through the locator */
+				stmt_res->column_info[i].lob_loc = *(SQLINTEGER *)value;
+				stmt_res->column_info[i].loc_ind = row->out_lengths[row_num];
+				/* NULL values need no call on the locator */
+				row->out_length = (row->out_lengths[row_num] == SQL_NULL_DATA) ? 
+					SQL_NULL_DATA : 0;
+				continue;
+
+			default:
+				/* str_val and w_val share the pointer */
+				row->data.str_val = (SQLCHAR *)value;
+				break;
 		}
+		row->out_length = row->out_lengths[row_num];
+		if ( row->out_length > 0 ) {
+			STATS_ADD(stmt_res, bytes_fetched, row->out_length);
+		}
+	}
+}
 
-		if ( conn_res->handle_active && !conn_res->flag_pconnect ) {
-			/* Disconnect from DB. If stmt is allocated, 
-			* it is freed automatically 
-			*/
-			if (conn_res->auto_commit == 0) {
-				rc = SQLEndTran(SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, 
-								SQL_ROLLBACK);
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, 
-													rc, 1, NULL, -1, 1);
-					return NULL;
-				}
-			}
-			rc = SQLDisconnect((SQLHDBC)conn_res->hdbc);
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
-												1, NULL, -1, 1);
-				return NULL;
-			}
+/*	static void _python_ibm_db_clear_stmt_err_cache () */
+static void _python_ibm_db_clear_stmt_err_cache(void)
+{
+	memset(IBM_DB_ERR(__python_stmt_err_msg), 0, DB2_MAX_ERR_MSG_LEN);
+	memset(IBM_DB_ERR(__python_stmt_err_state), 0, SQL_SQLSTATE_SIZE + 1);
+}
 
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
-			Py_END_ALLOW_THREADS;
+/*	static int _python_ibm_db_connect_helper( argc, argv, isPersistent ) */
+static PyObject *_python_ibm_db_connect_helper( PyObject *self, PyObject *args, int isPersistent )
+{
+	PyObject *databaseObj = NULL;
+	PyObject *uidObj = NULL;
+	PyObject *passwordObj = NULL;
+	SQLWCHAR *database = NULL;
+	SQLWCHAR *uid = NULL;
+	SQLWCHAR *password = NULL;
+	PyObject *options = NULL;
+	PyObject *literal_replacementObj = NULL;
+	SQLINTEGER literal_replacement;
+	PyObject *equal = PyString_FromString("=");
+	SQLSMALLINT database_len, uid_len, password_len;
+	int rc = 0;
+	conn_handle *conn_res = NULL;
+	int reused = 0;
+	PyObject *hKey = NULL;
+	conn_pool *pool = NULL;
+	char server[2048];
+	/* Set for each of database, uid and password converted into a new buffer */
+	int isNewDatabase = 0, isNewUid = 0, isNewPassword = 0;
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
-												1, NULL, -1, 1);
+	if (!PyArg_ParseTuple(args, "OOO|OO", &databaseObj, &uidObj, &passwordObj, &options, &literal_replacementObj)){
+		return NULL;
+	}
+	if (!NIL_P(options) && !PyDict_Check(options)) {
+		PyErr_SetString(PyExc_Exception, "options Parameter must be of type dictionay");
+		return NULL;
+	}
+	do {
+		databaseObj = PyUnicode_FromObject(databaseObj);
+		uidObj = PyUnicode_FromObject(uidObj);
+		passwordObj = PyUnicode_FromObject(passwordObj);
 
-				rc = SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
-				return NULL;
+		/* Check if we already have a connection for this userID & database 
+		* combination
+		*/ 
+		if (isPersistent) {
+			if (NIL_P(databaseObj) || NIL_P(uidObj) || NIL_P(passwordObj)) {
+				PyErr_SetString(PyExc_Exception, "Supplied Parameter is invalid");
+				rc = SQL_ERROR;
+				break;
 			}
+			hKey = PyUnicode_Concat(PyString_FromString("__ibm_db_"), uidObj);
+			hKey = PyUnicode_Concat(hKey, databaseObj);
+			hKey = PyUnicode_Concat(hKey, passwordObj);
 
-			rc = SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(conn_res->henv, SQL_HANDLE_ENV, rc, 
-												1, NULL, -1, 1);
-				return NULL;
+			/* Take an idle connection of the pool or make room for a new one */
+			pool = _python_ibm_db_find_conn_pool(hKey, databaseObj, uidObj);
+			if (pool == NULL || _python_ibm_db_pool_checkout(pool, &conn_res)) {
+				pool = NULL;
+				rc = SQL_ERROR;
+				break;
+			}
+			if (conn_res != NULL) {
+				reused = 1;
 			}
+		} else {
+			/* Need to check for max pconnections? */
+		}
 
-			conn_res->handle_active = 0;
-			Py_INCREF(Py_True);
-			return Py_True;
-		} else if ( conn_res->flag_pconnect ) {
-			/* Do we need to call FreeStmt or something to close cursors? */
-			Py_INCREF(Py_True);
-			return Py_True;
+		if ( !NIL_P(literal_replacementObj) ) {
+			literal_replacement = (SQLINTEGER) PyInt_AsLong(literal_replacementObj);
 		} else {
-			return NULL;
+			literal_replacement = SET_QUOTED_LITERAL_REPLACEMENT_ON; /*QUOTED LITERAL replacemnt is ON by default*/
+		}
+		if (conn_res == NULL) {
+			conn_res = PyObject_NEW(conn_handle, &conn_handleType);
+			conn_res->henv = 0;
+			conn_res->hdbc = 0;
+			conn_res->pool = NULL;
+			conn_res->pool_checked_out = 0;
+			conn_res->pool_idle_since = 0;
+			conn_res->c_stmt_cache_size = DEFAULT_STMT_CACHE_SIZE;
+			conn_res->stmt_cache = NULL;
+			conn_res->stmt_cache_index = NULL;
+			conn_res->stmt_cache_clock = 0;
+			conn_res->stmt_cache_hits = 0;
+			conn_res->stmt_cache_misses = 0;
+			conn_res->stmt_cache_evictions = 0;
+			conn_res->stats = _python_ibm_db_new_stats();
 		}
-	} else {
-		return NULL;
-	}
-}
 
-/*!# ibm_db.column_privileges
- *
- * ===Description
- * resource ibm_db.column_privileges ( resource connection [, string qualifier
- * [, string schema [, string table-name [, string column-name]]]] )
- *
- * Returns a result set listing the columns and associated privileges for a
- * table.
- *
- * ===Parameters
- *
- * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
- *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
- *
- * ====schema
- *		The schema which contains the tables. To match all schemas, pass NULL
- * or an empty string.
- *
- * ====table-name
- *		The name of the table or view. To match all tables in the database,
- * pass NULL or an empty string.
- *
- * ====column-name
- *		The name of the column. To match all columns in the table, pass NULL
- * or an empty string.
- *
- * ===Return Values
- * Returns a statement resource with a result set containing rows describing
- * the column privileges for columns matching the specified parameters. The rows
- * are composed of the following columns:
- *
- * TABLE_CAT:: Name of the catalog. The value is NULL if this table does not
- * have catalogs.
- * TABLE_SCHEM:: Name of the schema.
- * TABLE_NAME:: Name of the table or view.
- * COLUMN_NAME:: Name of the column.
- * GRANTOR:: Authorization ID of the user who granted the privilege.
- * GRANTEE:: Authorization ID of the user to whom the privilege was granted.
- * PRIVILEGE:: The privilege for the column.
- * IS_GRANTABLE:: Whether the GRANTEE is permitted to grant this privilege to
- * other users.
- */
-static PyObject *ibm_db_column_privileges(PyObject *self, PyObject *args)
-{
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *table_name = NULL;
-	SQLWCHAR *column_name = NULL;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_table_name = NULL;
-	PyObject *py_column_name = NULL;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	int rc;
-	int isNewBuffer;
-
-	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name, &py_column_name))
-		return NULL;
-
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
-			return NULL;
+		/* We need to set this early, in case we get an error below,
+		so we know how to free the connection */
+		conn_res->flag_pconnect = isPersistent;
+		/* Allocate ENV handles if not present */
+		if ( !conn_res->henv ) {
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &(conn_res->henv));
+			Py_END_ALLOW_THREADS;
+			if (rc != SQL_SUCCESS) {
+				_python_ibm_db_check_sql_errors( conn_res->henv, SQL_HANDLE_ENV, rc,
+					1, NULL, -1, 1);
+				break;
+			}
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLSetEnvAttr((SQLHENV)conn_res->henv, SQL_ATTR_ODBC_VERSION, 
+				(void *)SQL_OV_ODBC3, 0);
+			Py_END_ALLOW_THREADS;
 		}
-	}
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			return NULL;
+		if (!reused) {
+			/* Alloc CONNECT Handle */
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLAllocHandle(SQL_HANDLE_DBC, conn_res->henv, &(conn_res->hdbc));
+			Py_END_ALLOW_THREADS;
+			if (rc != SQL_SUCCESS) {
+				_python_ibm_db_check_sql_errors(conn_res->henv, SQL_HANDLE_ENV, rc, 
+					1, NULL, -1, 1);
+				break;
+			}
 		}
-	}
 
-	if (py_table_name != NULL && py_table_name != Py_None) {
-		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
-			py_table_name = PyUnicode_FromObject(py_table_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			return NULL;
-		}
-	}
+		/* Set this after the connection handle has been allocated to avoid
+		unnecessary network flows. Initialize the structure to default values */
+		conn_res->auto_commit = SQL_AUTOCOMMIT_ON;
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, SQL_ATTR_AUTOCOMMIT, 
+			(SQLPOINTER)(conn_res->auto_commit), SQL_NTS);
+		Py_END_ALLOW_THREADS;
 
-	if (py_column_name != NULL && py_column_name != Py_None) {
-		if (PyString_Check(py_column_name) || PyUnicode_Check(py_table_name)){
-			py_column_name = PyUnicode_FromObject(py_column_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "column_name must be a string");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			return NULL;
-		}
-	}
+		conn_res->c_bin_mode = IBM_DB_G(bin_mode);
+		conn_res->c_case_mode = CASE_NATURAL;
+		conn_res->c_cursor_type = SQL_SCROLL_FORWARD_ONLY;
+		conn_res->c_row_array_size = 0;
+		conn_res->c_paramset_size = 0;
+		conn_res->c_query_timeout = 0;
+		conn_res->c_native_types = NATIVE_TYPES_OFF;
+		conn_res->c_lob_reader = LOB_READER_OFF;
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_column_name);
-			return NULL;
-		}
+		conn_res->error_recno_tracker = 1;
+		conn_res->errormsg_recno_tracker = 1;
 
-		stmt_res = _ibm_db_new_stmt_struct(conn_res);
-		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
-		if (rc == SQL_ERROR) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-				NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_column_name);
+		/* handle not active as of yet */
+		conn_res->handle_active = 0;
 
-			Py_RETURN_FALSE;
+		/* Set Options */
+		if ( !NIL_P(options) ) {
+			rc = _python_ibm_db_parse_options( options, SQL_HANDLE_DBC, conn_res );
+			if (rc != SQL_SUCCESS) {
+				if (!reused) {
+					Py_BEGIN_ALLOW_THREADS;
+					SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
+					SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
+					Py_END_ALLOW_THREADS;
+				}
+				break;
+			}
 		}
-		if (py_qualifier && py_qualifier != Py_None )
-			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
-		if (py_owner &&  py_owner != Py_None )
-			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
-		if (py_table_name && py_table_name != Py_None )
-			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
 
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLColumnPrivilegesW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS,
-							owner, SQL_NTS, table_name, SQL_NTS, column_name,
-							SQL_NTS);
-		Py_END_ALLOW_THREADS;
+		if (! reused) {
+			/* Connect */
+			/* If the string contains a =, use SQLDriverConnect */
+			if (NIL_P(databaseObj)) {
+				PyErr_SetString(PyExc_Exception, "Supplied Parameter is invalid");
+				return NULL;
+			}
+			database = getUnicodeDataAsSQLWCHAR(databaseObj, &isNewDatabase);
+			if ( PyUnicode_Contains(databaseObj, equal) > 0 ) {
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLDriverConnectW((SQLHDBC)conn_res->hdbc, (SQLHWND)NULL,
+					database, SQL_NTS, NULL, 0, NULL, 
+					SQL_DRIVER_NOPROMPT );
+				Py_END_ALLOW_THREADS;
+			} else {
+				if (NIL_P(uidObj) || NIL_P(passwordObj)) { 
+					PyErr_SetString(PyExc_Exception, "Supplied Parameter is invalid");
+					return NULL;
+				}
+				uid = getUnicodeDataAsSQLWCHAR(uidObj, &isNewUid);
+				password = getUnicodeDataAsSQLWCHAR(passwordObj, &isNewPassword);
+				database_len = (SQLSMALLINT)PyUnicode_GetSize(databaseObj);
+				uid_len = (SQLSMALLINT)PyUnicode_GetSize(uidObj);
+				password_len = (SQLSMALLINT)PyUnicode_GetSize(passwordObj);
+				/* The handshake with a remote server can take long */
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLConnectW((SQLHDBC)conn_res->hdbc,
+					database,
+					database_len,
+					uid, 
+					uid_len,
+					password,
+					password_len);
+				Py_END_ALLOW_THREADS;
+			} 
+			if ( rc != SQL_SUCCESS ) {
+				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
+					1, NULL, -1, 1);
+				Py_BEGIN_ALLOW_THREADS;
+				SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
+				SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
+				Py_END_ALLOW_THREADS;
+				break;
+			}
+			
+#ifdef CLI_DBC_SERVER_TYPE_DB2LUW
+#ifdef SQL_ATTR_DECFLOAT_ROUNDING_MODE
+			/**
+			* Code for setting SQL_ATTR_DECFLOAT_ROUNDING_MODE
+			* for implementation of Decfloat Datatype
+			*/
 
-		if (isNewBuffer) {
-			if(qualifier) PyMem_Del(qualifier);
-			if(owner) PyMem_Del(owner);
-			if(table_name) PyMem_Del(table_name);
-		}
-		
-		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-							SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_column_name);
+			rc = _python_ibm_db_set_decfloat_rounding_mode_client(conn_res->hdbc);
+			if (rc != SQL_SUCCESS){
+				  _python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc,
+								  1, NULL, -1, 1);
+			}
+#endif
+#endif
 
-			Py_RETURN_FALSE;
-		}
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
-		Py_XDECREF(py_column_name);
+			/* Get the server name */
+			memset(server, 0, sizeof(server));
 
-		return (PyObject *)stmt_res;
-	} else {
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
-		Py_XDECREF(py_column_name);
-
-		Py_RETURN_FALSE;
-	}
-}
-
-/*!# ibm_db.columns
- * ===Description
- * resource ibm_db.columns ( resource connection [, string qualifier
- * [, string schema [, string table-name [, string column-name]]]] )
- *
- * Returns a result set listing the columns and associated metadata for a table.
- *
- * ===Parameters
- * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
- *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
- *
- * ====schema
- *		The schema which contains the tables. To match all schemas, pass '%'.
- *
- * ====table-name
- *		The name of the table or view. To match all tables in the database,
- * pass NULL or an empty string.
- *
- * ====column-name
- *		The name of the column. To match all columns in the table, pass NULL or
- * an empty string.
- *
- * ===Return Values
- * Returns a statement resource with a result set containing rows describing the
- * columns matching the specified parameters.
- * The rows are composed of the following columns:
- *
- * TABLE_CAT:: Name of the catalog. The value is NULL if this table does not
- * have catalogs.
- * TABLE_SCHEM:: Name of the schema.
- * TABLE_NAME:: Name of the table or view.
- * COLUMN_NAME:: Name of the column.
- * DATA_TYPE:: The SQL data type for the column represented as an integer value.
- * TYPE_NAME:: A string representing the data type for the column.
- * COLUMN_SIZE:: An integer value representing the size of the column.
- * BUFFER_LENGTH:: Maximum number of bytes necessary to store data from this
- * column.
- * DECIMAL_DIGITS:: The scale of the column, or NULL where scale is not
- * applicable.
- * NUM_PREC_RADIX:: An integer value of either 10 (representing an exact numeric
- * data type), 2 (representing an approximate numeric data type), or NULL
- * (representing a data type for which radix is not applicable).
- * NULLABLE:: An integer value representing whether the column is nullable or
- * not.
- * REMARKS:: Description of the column.
- * COLUMN_DEF:: Default value for the column.
- * SQL_DATA_TYPE:: An integer value representing the size of the column.
- * SQL_DATETIME_SUB:: Returns an integer value representing a datetime subtype
- * code, or NULL for SQL data types to which this does not apply.
- * CHAR_OCTET_LENGTH::	Maximum length in octets for a character data type
- * column, which matches COLUMN_SIZE for single-byte character set data, or
- * NULL for non-character data types.
- * ORDINAL_POSITION:: The 1-indexed position of the column in the table.
- * IS_NULLABLE:: A string value where 'YES' means that the column is nullable
- * and 'NO' means that the column is not nullable.
- */
-static PyObject *ibm_db_columns(PyObject *self, PyObject *args)			
-{
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *table_name = NULL;
-	SQLWCHAR *column_name = NULL;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_table_name = NULL;
-	PyObject *py_column_name = NULL;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	int rc;
-	int isNewBuffer;
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLGetInfo(conn_res->hdbc, SQL_DBMS_NAME, (SQLPOINTER)server, 
+				2048, NULL);
+			Py_END_ALLOW_THREADS;
 
-	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name, &py_column_name))
-		return NULL;
+			if (!strcmp(server, "AS")) is_systemi = 1;
+			if (!strncmp(server, "IDS", 3)) is_informix = 1;
 
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
-			return NULL;
+			/* Set SQL_ATTR_REPLACE_QUOTED_LITERALS connection attribute to
+			* enable CLI numeric literal feature. This is equivalent to
+			* PATCH2=71 in the db2cli.ini file
+			* Note, for backward compatibility with older CLI drivers having a
+			* different value for SQL_ATTR_REPLACE_QUOTED_LITERALS, we call
+			* SQLSetConnectAttr() with both the old and new value
+			*/
+			/* Only enable this feature if we are not connected to an Informix data 
+			* server 
+			*/
+			if (!is_informix && (literal_replacement == SET_QUOTED_LITERAL_REPLACEMENT_ON)) {
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, 
+					SQL_ATTR_REPLACE_QUOTED_LITERALS, 
+					(SQLPOINTER) (ENABLE_NUMERIC_LITERALS), 
+					SQL_IS_INTEGER);
+				if (rc != SQL_SUCCESS)
+					rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc,
+					SQL_ATTR_REPLACE_QUOTED_LITERALS_OLDVALUE,
+					(SQLPOINTER)(ENABLE_NUMERIC_LITERALS), 
+					SQL_IS_INTEGER);
+				Py_END_ALLOW_THREADS;
+			}
+			if (rc != SQL_SUCCESS) {
+				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
+					1, NULL, -1, 1);
+			}
 		}
-	}
+		Py_XDECREF(databaseObj);
+		Py_XDECREF(uidObj);
+		Py_XDECREF(passwordObj);
+		conn_res->handle_active = 1;
+	} while (0);
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			return NULL;
+	if (pool != NULL) {
+		if (rc == SQL_SUCCESS) {
+			/* The connection is returned to the pool by ibm_db.close() */
+			if (!reused) {
+				conn_res->pool = pool;
+				pool->created++;
+			}
+			conn_res->pool_checked_out = 1;
+			pool->checkouts++;
+		} else if (reused) {
+			/* The pooled connection is still connected, close it */
+			conn_res->handle_active = 1;
+			_python_ibm_db_pool_discard(conn_res);
+			pool->in_use--;
+			Py_DECREF(conn_res);
+			conn_res = NULL;
+		} else {
+			pool->in_use--;
 		}
 	}
+	Py_XDECREF(hKey);
 
-	if (py_table_name != NULL && py_table_name != Py_None) {
-		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
-			py_table_name = PyUnicode_FromObject(py_table_name);
+	if (isNewDatabase) {
+		PyMem_Del(database);
+	}
+	if (isNewUid) {
+		PyMem_Del(uid);
+	}
+	if (isNewPassword) {
+		PyMem_Del(password);
+	}
+	
+	if ( rc != SQL_SUCCESS ) {
+		if (conn_res != NULL && conn_res->handle_active) {
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
+			rc = SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
+			Py_END_ALLOW_THREADS;
 		}
-		else {
-			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			return NULL;
+		if (conn_res != NULL) {
+			PyObject_Del(conn_res);
 		}
+		return NULL;						  
+	} 
+	return (PyObject *)conn_res;
+}
+
+
+/**
+*This function takes a SQLWCHAR buffer (UCS-2) and returns back a PyUnicode object 
+* of it that is in the correct current UCS encoding (either UCS2 or UCS4)of
+* the current executing python VM
+*
+* @sqlwcharBytesLen - the length of sqlwcharData in bytes (not characters)
+**/
+static PyObject* getSQLWCharAsPyUnicodeObject(SQLWCHAR* sqlwcharData, int sqlwcharBytesLen)
+{
+	PyObject* u;
+	Py_UNICODE *pUnicode;
+	int i, nCharLen = sqlwcharBytesLen / sizeof(SQLWCHAR);
+	int bo = sqlwchar_byteorder;
+
+	if (is_ucs2_python) {
+	/* this is UCS2 python.. nothing to do really */
+		return PyUnicode_FromUnicode((Py_UNICODE *)sqlwcharData, nCharLen);
 	}
 
-	if (py_column_name != NULL && py_column_name != Py_None) {
-		if (PyString_Check(py_column_name) || PyUnicode_Check(py_table_name)){
-			py_column_name = PyUnicode_FromObject(py_column_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "column_name must be a string");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-				return NULL;
+	/* UCS4 python: widen BMP data in place, only surrogate pairs need the
+	 * UTF-16 decoder */
+	u = PyUnicode_FromUnicode(NULL, nCharLen);
+	if (u == NULL) {
+		return NULL;
+	}
+	pUnicode = PyUnicode_AS_UNICODE(u);
+	for (i = 0; i < nCharLen; i++) {
+		if (sqlwcharData[i] >= 0xD800 && sqlwcharData[i] <= 0xDFFF) {
+			Py_DECREF(u);
+			return PyUnicode_DecodeUTF16((char *)sqlwcharData, sqlwcharBytesLen, "strict", &bo);
 		}
+		pUnicode[i] = (Py_UNICODE)sqlwcharData[i];
 	}
+	return u;
+}
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_column_name);
-			return NULL;
-		}
 
-		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+/**
+*This function takes value as pyObject and convert it to SQLWCHAR and return it 
+*
+**/
+static SQLWCHAR* getUnicodeDataAsSQLWCHAR(PyObject *pyobj, int *isNewBuffer)
+{	
+	PyObject *pyUTFobj;
+	SQLWCHAR* pNewBuffer = NULL;
+	Py_UNICODE *pUnicode;
+	int i, nCharLen = PyUnicode_GET_SIZE(pyobj);
 
-		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
-		if (rc == SQL_ERROR) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-				NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_column_name);
+	if (is_ucs2_python) {
+		*isNewBuffer = 0;
+		return (SQLWCHAR*)PyUnicode_AS_UNICODE(pyobj);
+	}
 
-			Py_RETURN_FALSE;
+	*isNewBuffer = 1;
+	pNewBuffer = (SQLWCHAR *)ALLOC_N(SQLWCHAR, nCharLen + 1);
+	pUnicode = PyUnicode_AS_UNICODE(pyobj);
+	/* UCS4 python: narrow BMP data directly, only characters outside the BMP
+	 * need the UTF-16 encoder */
+	for (i = 0; i < nCharLen; i++) {
+		if (pUnicode[i] > 0xFFFF) {
+			break;
 		}
+		pNewBuffer[i] = (SQLWCHAR)pUnicode[i];
+	}
+	pNewBuffer[i] = 0;
+	if (i == nCharLen) {
+		return pNewBuffer;
+	}
 
-		if (py_qualifier && py_qualifier != Py_None )
-			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
-		if (py_owner &&  py_owner != Py_None )
-			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
-		if (py_table_name && py_table_name != Py_None )
-			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
-		if (py_column_name && py_column_name != Py_None )
-			column_name = getUnicodeDataAsSQLWCHAR(py_column_name, &isNewBuffer);
+	memset(pNewBuffer, 0, sizeof(SQLWCHAR) * (nCharLen + 1));
+	if (sqlwchar_byteorder == 1) {
+		pyUTFobj = PyCodec_Encode(pyobj, "utf-16-be", "strict");
+	} else {
+		pyUTFobj = PyCodec_Encode(pyobj, "utf-16-le", "strict");
+	}
+	memcpy(pNewBuffer, PyString_AsString(pyUTFobj), sizeof(SQLWCHAR) * (nCharLen) );
+	Py_DECREF(pyUTFobj);
+	return pNewBuffer;
 
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLColumnsW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS,
-			owner,SQL_NTS, table_name, SQL_NTS, column_name, SQL_NTS);
-		Py_END_ALLOW_THREADS;
+}
 
-		if (isNewBuffer) {
-		    if(qualifier) PyMem_Del(qualifier);
-		    if(owner) PyMem_Del(owner);
-		    if(table_name) PyMem_Del(table_name);
-		    if(column_name) PyMem_Del(column_name);
-		}	
-				
-		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
-				SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_column_name);
 
-			Py_RETURN_FALSE;
-		}
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
-		Py_XDECREF(py_column_name);
+#ifdef CLI_DBC_SERVER_TYPE_DB2LUW
+#ifdef SQL_ATTR_DECFLOAT_ROUNDING_MODE
 
-		return (PyObject *)stmt_res;				  
-	} else {
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
-		Py_XDECREF(py_column_name);
+/**
+ * Function for implementation of DECFLOAT Datatype
+ *
+ * Description :
+ * This function retrieves the value of special register decflt_rounding
+ * from the database server which signifies the current rounding mode set
+ * on the server. For using decfloat, the rounding mode has to be in sync
+ * on the client as well as server. Thus we set here on the client, the
+ * same rounding mode as the server.
+ *
+ * @return: success or failure
+ * */
+static int _python_ibm_db_set_decfloat_rounding_mode_client(SQLHANDLE hdbc)
+{
+	SQLCHAR decflt_rounding[20];
+	SQLHANDLE hstmt;
+	int rc = 0;
+	int rounding_mode;
+	SQLINTEGER decfloat;
 
-		Py_RETURN_FALSE;
+
+	SQLCHAR *stmt = (SQLCHAR *)"values current decfloat rounding mode";
+
+	/* Allocate a Statement Handle */
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
+	Py_END_ALLOW_THREADS;
+	if (rc == SQL_ERROR) {
+		_python_ibm_db_check_sql_errors(hdbc, SQL_HANDLE_DBC, rc, 1,
+			NULL, -1, 1);
+		return rc;
+	}
+
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLExecDirect((SQLHSTMT)hstmt, stmt, SQL_NTS);
+	Py_END_ALLOW_THREADS;
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors((SQLHSTMT)hstmt,
+			SQL_HANDLE_STMT, rc, 1, NULL,
+			-1, 1);
+		return rc;
 	}
+
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLBindCol((SQLHSTMT)hstmt, 1, SQL_C_DEFAULT, decflt_rounding, 20, NULL);
+	Py_END_ALLOW_THREADS;
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors((SQLHSTMT)hstmt,
+			SQL_HANDLE_STMT, rc, 1, NULL,
+			-1, 1);
+		return rc;
+	}
+
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLFetch(hstmt);
+	rc = SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+	Py_END_ALLOW_THREADS;
+	
+	/* Now setting up the same rounding mode on the client*/
+	if (strcmp(decflt_rounding, "ROUND_HALF_EVEN") == 0) rounding_mode = ROUND_HALF_EVEN;
+	if (strcmp(decflt_rounding, "ROUND_HALF_UP") == 0) rounding_mode = ROUND_HALF_UP;
+	if (strcmp(decflt_rounding, "ROUND_DOWN") == 0) rounding_mode = ROUND_DOWN;
+	if (strcmp(decflt_rounding, "ROUND_CEILING") == 0) rounding_mode = ROUND_CEILING;
+	if (strcmp(decflt_rounding, "ROUND_FLOOR") == 0) rounding_mode = ROUND_FLOOR;
+
+	Py_BEGIN_ALLOW_THREADS;
+#ifndef PASE
+	rc = SQLSetConnectAttr(hdbc, SQL_ATTR_DECFLOAT_ROUNDING_MODE, (SQLPOINTER)rounding_mode, SQL_NTS);
+#else
+	rc = SQLSetConnectAttr(hdbc, SQL_ATTR_DECFLOAT_ROUNDING_MODE, (SQLPOINTER)&rounding_mode, SQL_NTS);
+#endif
+	Py_END_ALLOW_THREADS;
+
+	return rc;
+
 }
+#endif
+#endif
 
-/*!# ibm_db.foreign_keys
+/* static void _python_ibm_db_clear_conn_err_cache () */
+static void _python_ibm_db_clear_conn_err_cache(void)
+{
+	/* Clear out the cached conn messages */
+	memset(IBM_DB_ERR(__python_conn_err_msg), 0, DB2_MAX_ERR_MSG_LEN);
+	memset(IBM_DB_ERR(__python_conn_err_state), 0, SQL_SQLSTATE_SIZE + 1);
+}
+
+/*!#
+ * ibm_db.connect
+ * ibm_db.pconnect
+ * ibm_db.autocommit
+ * ibm_db.bind_param
+ * ibm_db.close
+ * ibm_db.column_privileges
+ * ibm_db.columns
+ * ibm_db.foreign_keys
+ * ibm_db.primary_keys
+ * ibm_db.procedure_columns
+ * ibm_db.procedures
+ * ibm_db.special_columns
+ * ibm_db.statistics
+ * ibm_db.table_privileges
+ * ibm_db.tables
+ * ibm_db.commit
+ * ibm_db.exec
+ * ibm_db.free_result
+ * ibm_db.prepare
+ * ibm_db.execute
+ * ibm_db.conn_errormsg
+ * ibm_db.stmt_errormsg
+ * ibm_db.conn_error
+ * ibm_db.stmt_error
+ * ibm_db.next_result
+ * ibm_db.num_fields
+ * ibm_db.num_rows
+ * ibm_db.get_num_result
+ * ibm_db.field_name
+ * ibm_db.field_display_size
+ * ibm_db.field_num
+ * ibm_db.field_precision
+ * ibm_db.field_scale
+ * ibm_db.field_type
+ * ibm_db.field_width
+ * ibm_db.cursor_type
+ * ibm_db.rollback
+ * ibm_db.free_stmt
+ * ibm_db.result
+ * ibm_db.fetch_row
+ * ibm_db.fetch_assoc
+ * ibm_db.fetch_array
+ * ibm_db.fetch_both
+ * ibm_db.fetch_row_object
+ * ibm_db.fetch_many
+ * ibm_db.fetch_all
+ * ibm_db.fetch_columns
+ * ibm_db.fetch_block
+ * ibm_db.write_arrow
+ * ibm_db.set_option
+ * ibm_db.server_info
+ * ibm_db.client_info
+ * ibm_db.active
+ * ibm_db.get_option
+ */
+
+
+
+/*!# ibm_db.connect
  *
  * ===Description
- * resource ibm_db.foreign_keys ( resource connection, string pk_qualifier,
- * string pk_schema, string pk_table-name, string fk_qualifier
- * string fk_schema, string fk_table-name )
  *
- * Returns a result set listing the foreign keys for a table.
+ *  --	Returns a connection to a database
+ * IBM_DBConnection ibm_db.connect (dsn=<..>, user=<..>, password=<..>,
+ *								  host=<..>, database=<..>, options=<..>)
+ *
+ * Creates a new connection to an IBM DB2 Universal Database, IBM Cloudscape,
+ * or Apache Derby database.
  *
  * ===Parameters
  *
- * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ * ====dsn
  *
- * ====pk_qualifier
- *		A qualifier for the pk_table-name argument for the DB2 databases 
- * running on OS/390 or z/OS servers. For other databases, pass NULL or an empty 
- * string. 
+ * For an uncataloged connection to a database, database represents a complete
+ * connection string in the following format:
+ * DRIVER={IBM DB2 ODBC DRIVER};DATABASE=database;HOSTNAME=hostname;PORT=port;
+ * PROTOCOL=TCPIP;UID=username;PWD=password;
+ *	  where the parameters represent the following values:
+ *		hostname
+ *			The hostname or IP address of the database server.
+ *		port
+ *			The TCP/IP port on which the database is listening for requests.
+ *		username
+ *			The username with which you are connecting to the database.
+ *		password
+ *			The password with which you are connecting to the database.
  *
- * ====pk_schema
- *		The schema for the pk_table-name argument which contains the tables. If 
- * schema is NULL, ibm_db.foreign_keys() matches the schema for the current 
- * connection. 
+ * ====user
  *
- * ====pk_table-name
- *		The name of the table which contains the primary key.
+ * The username with which you are connecting to the database.
+ * This is optional if username is specified in the "dsn" string
  *
- * ====fk_qualifier
- *		A qualifier for the fk_table-name argument for the DB2 databases
- * running on OS/390 or z/OS servers. For other databases, pass NULL or an empty
- * string.
+ * ====password
  *
- * ====fk_schema
- *		The schema for the fk_table-name argument which contains the tables. If
- * schema is NULL, ibm_db.foreign_keys() matches the schema for the current
- * connection.
+ * The password with which you are connecting to the database.
+ * This is optional if password is specified in the "dsn" string
  *
- * ====fk_table-name
- *		The name of the table which contains the foreign key.
+ * ====host
  *
- * ===Return Values
+ * The hostname or IP address of the database server.
+ * This is optional if hostname is specified in the "dsn" string
  *
- * Returns a statement resource with a result set containing rows describing the
- * foreign keys for the specified table. The result set is composed of the
- * following columns:
+ * ====database
  *
- * Column name::	Description
- * PKTABLE_CAT:: Name of the catalog for the table containing the primary key.
- * The value is NULL if this table does not have catalogs.
- * PKTABLE_SCHEM:: Name of the schema for the table containing the primary key.
- * PKTABLE_NAME:: Name of the table containing the primary key.
- * PKCOLUMN_NAME:: Name of the column containing the primary key.
- * FKTABLE_CAT:: Name of the catalog for the table containing the foreign key.
- * The value is NULL if this table does not have catalogs.
- * FKTABLE_SCHEM:: Name of the schema for the table containing the foreign key.
- * FKTABLE_NAME:: Name of the table containing the foreign key.
- * FKCOLUMN_NAME:: Name of the column containing the foreign key.
- * KEY_SEQ:: 1-indexed position of the column in the key.
- * UPDATE_RULE:: Integer value representing the action applied to the foreign
- * key when the SQL operation is UPDATE.
- * DELETE_RULE:: Integer value representing the action applied to the foreign
- * key when the SQL operation is DELETE.
- * FK_NAME:: The name of the foreign key.
- * PK_NAME:: The name of the primary key.
- * DEFERRABILITY:: An integer value representing whether the foreign key
- * deferrability is SQL_INITIALLY_DEFERRED, SQL_INITIALLY_IMMEDIATE, or
- * SQL_NOT_DEFERRABLE.
- */
-static PyObject *ibm_db_foreign_keys(PyObject *self, PyObject *args)
-{
-	SQLWCHAR *pk_qualifier = NULL;
-	SQLWCHAR *pk_owner = NULL;
-	SQLWCHAR *pk_table_name = NULL;
-	SQLWCHAR *fk_qualifier = NULL;
-	SQLWCHAR *fk_owner = NULL;
-	SQLWCHAR *fk_table_name = NULL;
-	int rc;
-	conn_handle *conn_res = NULL;
-	stmt_handle *stmt_res;
-	PyObject *py_pk_qualifier = NULL;
-	PyObject *py_pk_owner = NULL;
-	PyObject *py_pk_table_name = NULL;
-	PyObject *py_fk_qualifier = NULL;
-	PyObject *py_fk_owner = NULL;
-	PyObject *py_fk_table_name = NULL;
-	int isNewBuffer;
+ * For a cataloged connection to a database, database represents the database
+ * alias in the DB2 client catalog.
+ * This is optional if database is specified in the "dsn" string
+ *
+ * ====options
+ *
+ *	  An dictionary of connection options that affect the behavior of the
+ *	  connection,
+ *	  where valid array keys include:
+ *		SQL_ATTR_AUTOCOMMIT
+ *			Passing the SQL_AUTOCOMMIT_ON value turns autocommit on for this
+ *			connection handle.
+ *			Passing the SQL_AUTOCOMMIT_OFF value turns autocommit off for this
+ *			connection handle.
+ *		ATTR_CASE
+ *			Passing the CASE_NATURAL value specifies that column names are
+ *			returned in natural case.
+ *			Passing the CASE_LOWER value specifies that column names are
+ *			returned in lower case.
+ *			Passing the CASE_UPPER value specifies that column names are
+ *			returned in upper case.
+ *		SQL_ATTR_CURSOR_TYPE
+ *			Passing the SQL_SCROLL_FORWARD_ONLY value specifies a forward-only
+ *			cursor for a statement resource.
+ *			This is the default cursor type and is supported on all database
+ *			servers.
+ *			Passing the SQL_CURSOR_KEYSET_DRIVEN value specifies a scrollable
+ *			cursor for a statement resource.
+ *			This mode enables random access to rows in a result set, but
+ *			currently is supported only by IBM DB2 Universal Database.
+ *		SQL_ATTR_ROW_ARRAY_SIZE
+ *			Default number of rows fetched per block by the statements of
+ *			this connection, see ibm_db.prepare().
+ *		SQL_ATTR_PARAMSET_SIZE
+ *			Default number of rows sent per execution by ibm_db.execute_many()
+ *			for the statements of this connection, see ibm_db.prepare().
+ *		ATTR_NATIVE_TYPES
+ *			Default conversion of DATE, TIME, TIMESTAMP and DECIMAL values
+ *			for the statements of this connection, see ibm_db.prepare().
+ *		ATTR_LOB_READER
+ *			Default conversion of BLOB, CLOB and DBCLOB values for the
+ *			statements of this connection, see ibm_db.prepare().
+ *		SQL_ATTR_QUERY_TIMEOUT
+ *			Default query timeout of the statements of ibm_db.exec_immediate()
+ *			and ibm_db.prepare() on this connection, see ibm_db.prepare().
+ *		ATTR_STMT_CACHE_SIZE
+ *			Number of prepared statements the connection keeps. ibm_db.prepare()
+ *			returns a cached statement of the same SQL text and options when
+ *			the application no longer holds it, instead of preparing the
+ *			statement again; the least recently used statement is released
+ *			when the cache is full. Passing 0 (the default) disables the
+ *			cache. See ibm_db.get_stmt_cache_stats().
+ *			A statement dropped by the application keeps its cursor open
+ *			until it is handed out again, call ibm_db.free_result() on a
+ *			statement that was not fetched to the end before dropping it.
+ *			Statements changed with ibm_db.set_option() are not reused.
+ * ====set_replace_quoted_literal
+ *	  This variable indicates if the CLI Connection attribute SQL_ATTR_REPLACE_QUOTED_LITERAL is to be set or not
+ *	  To turn it ON pass  IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
+ *	  To turn it OFF pass IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_OFF
+ *
+ *	  Default Setting: - IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
+ *
+ * ===Return Values
+ *
+ *
+ * Returns a IBM_DBConnection connection object if the connection attempt is
+ * successful.
+ * If the connection attempt fails, ibm_db.connect() returns None.
+ *
+ */ 
+static PyObject *ibm_db_connect(PyObject *self, PyObject *args)
+{
+	_python_ibm_db_clear_conn_err_cache();
+	return _python_ibm_db_connect_helper( self, args, 0 );
+}
 
-	if (!PyArg_ParseTuple(args, "OOOO|OOO", &conn_res, &py_pk_qualifier, 
-		&py_pk_owner, &py_pk_table_name, &py_fk_qualifier,
-		&py_fk_owner, &py_fk_table_name))
-		return NULL;
+/*!# ibm_db.pconnect
+ *
+ * ===Description
+ *  --	Returns a persistent connection to a database
+ * resource ibm_db.pconnect ( string database, string username, string password
+ * [, array options] )
+ *
+ * Returns a persistent connection to an IBM DB2 Universal Database,
+ * IBM Cloudscape, Apache Derby or Informix Dynamic Server database.
+ *
+ * Persistent connections are kept in a pool per database, username and
+ * password. Calling ibm_db.close() on a persistent connection always returns
+ * TRUE, but the underlying DB2 client connection is rolled back and returned
+ * to the pool, where it waits to serve the next matching ibm_db.pconnect()
+ * request. A connection that is no longer referenced is returned to the pool
+ * the same way, so an application does not have to close it. A connection is
+ * handed to one caller at a time: every ibm_db.pconnect() returns a new
+ * connection resource, and a resource closed with ibm_db.close() is no longer
+ * active. The size of the pools and how long idle connections are kept are
+ * set with ibm_db.set_pool_options().
+ *
+ * ===Parameters
+ *
+ * ====database
+ *		The database alias in the DB2 client catalog.
+ *
+ * ====username
+ *		The username with which you are connecting to the database.
+ *
+ * ====password
+ *		The password with which you are connecting to the database.
+ *
+ * ====options
+ *		An associative array of connection options that affect the behavior of
+ * the connection,
+ *		where valid array keys include:
+ *
+ *		autocommit
+ *			 Passing the DB2_AUTOCOMMIT_ON value turns autocommit on for this
+ * connection handle.
+ *			 Passing the DB2_AUTOCOMMIT_OFF value turns autocommit off for
+ * this connection handle.
+ *
+ *		DB2_ATTR_CASE
+ *			 Passing the DB2_CASE_NATURAL value specifies that column names
+ * are returned in natural case.
+ *			 Passing the DB2_CASE_LOWER value specifies that column names are
+ * returned in lower case.
+ *			 Passing the DB2_CASE_UPPER value specifies that column names are
+ * returned in upper case.
+ *
+ *		CURSOR
+ *			 Passing the SQL_SCROLL_FORWARD_ONLY value specifies a
+ * forward-only cursor for a statement resource.  This is the default cursor
+ * type and is supported on all database servers.
+ *			 Passing the SQL_CURSOR_KEYSET_DRIVEN value specifies a scrollable
+ * cursor for a statement resource. This mode enables random access to rows in a
+ * result set, but currently is supported only by IBM DB2 Universal Database.
+ *
+ * ====set_replace_quoted_literal
+ *	  This variable indicates if the CLI Connection attribute SQL_ATTR_REPLACE_QUOTED_LITERAL is to be set or not
+ *	  To turn it ON pass  IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
+ *	  To turn it OFF pass IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_OFF
+ *
+ *	  Default Setting: - IBM_DB::SET_QUOTED_LITERAL_REPLACEMENT_ON
+ *
+ * ===Return Values
+ *
+ * Returns a connection handle resource if the connection attempt is successful.
+ * ibm_db.pconnect() tries to reuse an idle pooled connection that exactly
+ * matches the database, username, and password parameters, after checking
+ * that it is still alive. When the pool is full, ibm_db.pconnect() waits for
+ * a connection to be closed and raises an exception once the pool timeout
+ * expires. If the connection attempt fails, ibm_db.pconnect() returns FALSE.
+ */
+static PyObject *ibm_db_pconnect(PyObject *self, PyObject *args)
+{
+	_python_ibm_db_clear_conn_err_cache();
+	return _python_ibm_db_connect_helper( self, args, 1);
+}
 
-	if (py_pk_qualifier != NULL && py_pk_qualifier != Py_None) {
-		if (PyString_Check(py_pk_qualifier) || PyUnicode_Check(py_pk_qualifier)){
-			py_pk_qualifier = PyUnicode_FromObject(py_pk_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, 
-				"qualifier for table containing primary key must be a string or unicode");
-			return NULL;
+/*
+ * static void _python_clear_local_var(PyObject *dbNameObj, SQLWCHAR *dbName, PyObject *codesetObj, SQLWCHAR *codesetObj, PyObject *modeObj, SQLWCHAR *mode, int isNewBuffer)
+ */
+static void _python_clear_local_var(PyObject *dbNameObj, SQLWCHAR *dbName, PyObject *codesetObj, SQLWCHAR *codeset, PyObject *modeObj, SQLWCHAR *mode, int isNewBuffer)
+{
+	if ( !NIL_P( dbNameObj ) ) {
+		Py_XDECREF( dbNameObj );
+		if ( isNewBuffer ) {
+			PyMem_Del( dbName );
 		}
 	}
 
-	if (py_pk_owner != NULL && py_pk_owner != Py_None) {
-		if (PyString_Check(py_pk_owner) || PyUnicode_Check(py_pk_owner)){
-			py_pk_owner = PyUnicode_FromObject(py_pk_owner);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception,  
-				"owner of table containing primary key must be a string or unicode");
-			Py_XDECREF(py_pk_qualifier);
-			return NULL;
+	if ( !NIL_P( codesetObj ) ) {
+		Py_XDECREF( codesetObj );
+		if ( isNewBuffer ) {
+			PyMem_Del( codeset );
 		}
 	}
 
-	if (py_pk_table_name != NULL && py_pk_table_name != Py_None) {
-		if (PyString_Check(py_pk_table_name) || PyUnicode_Check(py_pk_table_name)){
-			py_pk_table_name = PyUnicode_FromObject(py_pk_table_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, 
-				"name of the table that contains primary key must be a string or unicode");
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			return NULL;
+	if ( !NIL_P( modeObj ) ) {
+		Py_XDECREF( modeObj );
+		if ( isNewBuffer ) {
+			PyMem_Del( mode );
 		}
 	}
+}
 
-	if (py_fk_qualifier != NULL && py_fk_qualifier != Py_None) {
-		if (PyString_Check(py_fk_qualifier) || PyUnicode_Check(py_fk_qualifier)){
-			py_fk_qualifier = PyUnicode_FromObject(py_fk_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, 
-				"qualifier for table containing the foreign key must be a string or unicode");
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			Py_XDECREF(py_pk_table_name);
-			return NULL;
-		}
-	}
+/*
+ * static int _python_ibm_db_createdb(conn_handle *conn_res, PyObject *dbNameObj, PyObject *codesetObj, PyObject *modeObj, int createNX)
+ */
+static int _python_ibm_db_createdb(conn_handle *conn_res, PyObject *dbNameObj, PyObject *codesetObj, PyObject *modeObj, int createNX)
+{
+	SQLWCHAR *dbName = NULL;
+	SQLWCHAR *codeset = NULL;
+	SQLWCHAR *mode = NULL;
+	SQLINTEGER sqlcode;
+	SQLSMALLINT length;
+	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
+	int isNewBuffer;
+	int rc = 0;
+#ifdef _WIN32
+	HINSTANCE cliLib = NULL;
+	FARPROC sqlcreatedb;
+#else
+	void *cliLib = NULL;
+	typedef int (*sqlcreatedbType)( SQLHDBC, SQLWCHAR *, SQLINTEGER, SQLWCHAR *, SQLINTEGER, SQLWCHAR *, SQLINTEGER );
+	sqlcreatedbType sqlcreatedb;
+#endif
 
-	if (py_fk_owner != NULL && py_fk_owner != Py_None) {
-		if (PyString_Check(py_fk_owner) || PyUnicode_Check(py_fk_owner)){
-			py_fk_owner = PyUnicode_FromObject(py_fk_owner);
+#if defined __APPLE__ || defined _AIX
+	PyErr_SetString( PyExc_Exception, "Not supported: This function is currently not supported on this platform" );
+	return -1;
+#else
+
+	if ( !NIL_P( conn_res ) ) {
+		if ( NIL_P( dbNameObj ) ) {
+			PyErr_SetString( PyExc_Exception, "Supplied database name Parameter is invalid" );
+			return -1;
 		}
-		else {
-			PyErr_SetString(PyExc_Exception, 
-				"owner of table containing the foreign key must be a string or unicode");
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			Py_XDECREF(py_pk_table_name);
-			Py_XDECREF(py_fk_qualifier);
-			return NULL;
+		/* Check to ensure the connection resource given is active */
+		if ( !conn_res->handle_active ) {
+			PyErr_SetString( PyExc_Exception, "Connection is not active" );
+			return -1;
 		}
-	}
 
-	if (py_fk_table_name != NULL && py_fk_table_name != Py_None) {
-		if (PyString_Check(py_fk_table_name) || PyUnicode_Check(py_fk_table_name)){
-			py_fk_table_name = PyUnicode_FromObject(py_fk_table_name);
+		dbNameObj = PyUnicode_FromObject( dbNameObj );
+		if ( dbNameObj != NULL &&  dbNameObj != Py_None ) {
+			dbName = getUnicodeDataAsSQLWCHAR( dbNameObj, &isNewBuffer );
+		} else {
+			return -1;
 		}
-		else {
-			PyErr_SetString(PyExc_Exception, 
-				"name of the table that contains foreign key must be a string or unicode");
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			Py_XDECREF(py_pk_table_name);
-			Py_XDECREF(py_fk_qualifier);
-			Py_XDECREF(py_fk_owner);
-			return NULL;
+		
+		if ( !NIL_P( codesetObj ) ) {
+			codesetObj = PyUnicode_FromObject( codesetObj );
+			if ( codesetObj != NULL &&  codesetObj != Py_None ) {
+				codeset = getUnicodeDataAsSQLWCHAR( codesetObj, &isNewBuffer );
+			} else {
+				_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+				return -1;
+			}
+				
 		}
-	}
-
-	if (conn_res) {
-
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			Py_XDECREF(py_pk_table_name);
-			Py_XDECREF(py_fk_qualifier);
-			Py_XDECREF(py_fk_owner);
-			Py_XDECREF(py_fk_table_name);
-			return NULL;
+		if ( !NIL_P( modeObj ) ) {
+			modeObj = PyUnicode_FromObject( modeObj );
+			if ( codesetObj != NULL &&  codesetObj != Py_None ) {
+				mode = getUnicodeDataAsSQLWCHAR( modeObj, &isNewBuffer );	
+			} else {
+				_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, NULL, NULL, isNewBuffer );
+				return -1;
+			}
 		}
 
-		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+#ifdef _WIN32
+		cliLib = DLOPEN( LIBDB2 );
+#else
+		cliLib = DLOPEN( LIBDB2, RTLD_LAZY );
+#endif
+		if ( !cliLib ) {
+			sprintf( (char *)msg, "Error in loading %s library file", LIBDB2 );
+			PyErr_SetString( PyExc_Exception,  (char *)msg );
+			_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );	
+			return -1;
+		}
+#ifdef _WIN32
+		sqlcreatedb =  DLSYM( cliLib, "SQLCreateDbW" );
+#else
+		sqlcreatedb = (sqlcreatedbType) DLSYM( cliLib, "SQLCreateDbW" );
+#endif
+		if ( sqlcreatedb == NULL )  {
+#ifdef _WIN32
+			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp4 version of cli on window" );
+#else
+			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp3 version of cli" );
+#endif
+			PyErr_SetString( PyExc_Exception, (char *)msg );
+			DLCLOSE( cliLib );
+			_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
+			return -1;
+		}
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		rc = (*sqlcreatedb)( (SQLHDBC)conn_res->hdbc, dbName, SQL_NTS, codeset, SQL_NTS, mode, SQL_NTS );
 		Py_END_ALLOW_THREADS;
+		
+		DLCLOSE( cliLib );		
+		if ( rc != SQL_SUCCESS ) {
+			if ( createNX == 1 ) {
+				if ( SQLGetDiagRec( SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, 1, sqlstate, &sqlcode, msg, SQL_MAX_MESSAGE_LENGTH + 1, &length ) == SQL_SUCCESS ) {
+					if ( sqlcode == -1005 ) {
+						_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
+						return 0;
+					}
+				}
+			}
+			_python_ibm_db_check_sql_errors( conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, NULL, -1, 1 );
+			_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
+			return -1;
+		}
+		_python_clear_local_var( dbNameObj, dbName, codesetObj, codeset, modeObj, mode, isNewBuffer );
+		return 0;
+	} else {
+		PyErr_SetString( PyExc_Exception, "Supplied connection object Parameter is invalid" );
+		return -1;
+	}
+#endif
+}
 
-		if (rc == SQL_ERROR) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-				NULL, -1, 1);
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			Py_XDECREF(py_pk_table_name);
-			Py_XDECREF(py_fk_qualifier);
-			Py_XDECREF(py_fk_owner);
-			Py_XDECREF(py_fk_table_name);
+/*
+ * static int _python_ibm_db_dropdb(conn_handle *conn_res, PyObject *dbNameObj, int recreate)
+ */
+static int _python_ibm_db_dropdb(conn_handle *conn_res, PyObject *dbNameObj, int recreate)
+{
+	SQLWCHAR *dbName = NULL;
+	SQLINTEGER sqlcode;
+	SQLSMALLINT length;
+	SQLCHAR msg[SQL_MAX_MESSAGE_LENGTH + 1];
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
+	int isNewBuffer;
+	int rc = 0;
+#ifdef _WIN32
+	FARPROC sqldropdb;
+	HINSTANCE cliLib = NULL;
+#else
+	typedef int (*sqldropdbType)( SQLHDBC, SQLWCHAR *, SQLINTEGER );
+	sqldropdbType sqldropdb;	
+	void *cliLib;
+#endif
 
-			Py_RETURN_FALSE;
+#if defined __APPLE__ || defined _AIX
+	PyErr_SetString( PyExc_Exception, "Not supported: This function is currently not supported on this platform" );
+	return -1;
+#else
+
+	if ( !NIL_P( conn_res ) ) {
+		if ( NIL_P( dbNameObj ) ) {
+			PyErr_SetString( PyExc_Exception, "Supplied database name Parameter is invalid" );
+			return -1;
+		}
+		/* Check to ensure the connection resource given is active */
+		if ( !conn_res->handle_active ) {
+			PyErr_SetString( PyExc_Exception, "Connection is not active" );
+			return -1;
 		}
 
-		if(py_pk_qualifier && py_pk_qualifier != Py_None)
-			pk_qualifier = getUnicodeDataAsSQLWCHAR(py_pk_qualifier, &isNewBuffer);
-		if(py_pk_owner && py_pk_owner != Py_None)
-			pk_owner = getUnicodeDataAsSQLWCHAR(py_pk_owner, &isNewBuffer);
-		if(py_pk_table_name && py_pk_table_name != Py_None)
-			pk_table_name = getUnicodeDataAsSQLWCHAR(py_pk_table_name, &isNewBuffer);
-		if(py_fk_qualifier && py_fk_qualifier != Py_None)
-			fk_qualifier = getUnicodeDataAsSQLWCHAR(py_fk_qualifier, &isNewBuffer);
-		if(py_fk_owner && py_fk_owner != Py_None)
-			fk_owner = getUnicodeDataAsSQLWCHAR(py_fk_owner, &isNewBuffer);
-		if(py_fk_table_name && py_fk_table_name != Py_None)
-			fk_table_name = getUnicodeDataAsSQLWCHAR(py_fk_table_name, &isNewBuffer);
+		dbNameObj = PyUnicode_FromObject( dbNameObj );
+		if ( dbNameObj != NULL &&  dbNameObj != Py_None ) {
+			dbName = getUnicodeDataAsSQLWCHAR( dbNameObj, &isNewBuffer );	
+		} else {
+			return -1;
+		}
+
+#ifdef _WIN32
+		cliLib = DLOPEN( LIBDB2 );
+#else
+		cliLib = DLOPEN( LIBDB2, RTLD_LAZY );
+#endif
+		if ( !cliLib ) {
+			sprintf( (char *)msg, "Error in loading %s library file", LIBDB2 );
+			PyErr_SetString( PyExc_Exception, (char *)msg );
+			_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+			return -1;
+		}
+#ifdef _WIN32
+		sqldropdb = DLSYM( cliLib, "SQLDropDbW" );
+#else
+		sqldropdb = (sqldropdbType)DLSYM( cliLib, "SQLDropDbW" );
+#endif
+		if ( sqldropdb == NULL)  {
+#ifdef _WIN32
+			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp4 version of cli on window" );
+#else
+			sprintf( (char *)msg, "Not supported: This function is only supported from v97fp3 version of cli" );
+#endif
+			PyErr_SetString( PyExc_Exception, (char *)msg );
+			DLCLOSE( cliLib );
+			_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+			return -1;
+		}
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLForeignKeysW((SQLHSTMT)stmt_res->hstmt, pk_qualifier, SQL_NTS,
-						pk_owner, SQL_NTS, pk_table_name, SQL_NTS, fk_qualifier, SQL_NTS,
-						fk_owner, SQL_NTS, fk_table_name, SQL_NTS);
+		rc = sqldropdb( conn_res->hdbc, dbName, SQL_NTS );
 		Py_END_ALLOW_THREADS;
-
-		if (isNewBuffer) {
-		    if(pk_qualifier) PyMem_Del(pk_qualifier);
-		    if(pk_owner) PyMem_Del(pk_owner);
-		    if(pk_table_name) PyMem_Del(pk_table_name);
-			if(fk_qualifier) PyMem_Del(fk_qualifier);
-		    if(fk_owner) PyMem_Del(fk_owner);
-		    if(fk_table_name) PyMem_Del(fk_table_name);
-		}	
 		
-		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-											1, NULL, -1, 1);
-			Py_XDECREF(py_pk_qualifier);
-			Py_XDECREF(py_pk_owner);
-			Py_XDECREF(py_pk_table_name);
-			Py_XDECREF(py_fk_qualifier);
-			Py_XDECREF(py_fk_owner);
-			Py_XDECREF(py_fk_table_name);
-
-			Py_RETURN_FALSE;
+		DLCLOSE( cliLib );
+		if ( rc != SQL_SUCCESS ) {
+			if ( recreate ) {
+				if ( SQLGetDiagRec( SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, 1, sqlstate, &sqlcode, msg, SQL_MAX_MESSAGE_LENGTH + 1, &length ) == SQL_SUCCESS ) {
+					if ( sqlcode == -1013 ) {
+						_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+						return 0;
+					}
+				}
+			}
+			_python_ibm_db_check_sql_errors( conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, NULL, -1, 1 );
+			return -1;
 		}
-		Py_XDECREF(py_pk_qualifier);
-		Py_XDECREF(py_pk_owner);
-		Py_XDECREF(py_pk_table_name);
-		Py_XDECREF(py_fk_qualifier);
-		Py_XDECREF(py_fk_owner);
-		Py_XDECREF(py_fk_table_name);
-		return (PyObject *)stmt_res;				  
-
+		_python_clear_local_var( dbNameObj, dbName, NULL, NULL, NULL, NULL, isNewBuffer );
+		return 0;
 	} else {
-		Py_XDECREF(py_pk_qualifier);
-		Py_XDECREF(py_pk_owner);
-		Py_XDECREF(py_pk_table_name);
-		Py_XDECREF(py_fk_qualifier);
-		Py_XDECREF(py_fk_owner);
-		Py_XDECREF(py_fk_table_name);
-		Py_RETURN_FALSE;
+		PyErr_SetString( PyExc_Exception, "Supplied connection object Parameter is invalid" );
+		return -1;
 	}
+#endif
 }
 
-/*!# ibm_db.primary_keys
+/*!# ibm_db.createdb
  *
  * ===Description
- * resource ibm_db.primary_keys ( resource connection, string qualifier,
- * string schema, string table-name )
+ *  True/None ibm_db.createdb ( IBM_DBConnection connection, string dbName [, codeSet, mode] )
  *
- * Returns a result set listing the primary keys for a table.
+ * Creates a database by using the specified database name, code set, and mode
  *
  * ===Parameters
  *
  * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
- *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
- *
- * ====schema
- *		The schema which contains the tables. If schema is NULL,
- * ibm_db.primary_keys() matches the schema for the current connection.
+ *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
  *
- * ====table-name
- *		The name of the table.
+ * ====dbName
+ *      Name of the database that is to be created.
  *
- * ===Return Values
+ * ====codeSet
+ *      Database code set information.
+ *      Note: If the value of the codeSet argument not specified, the database is created in the Unicode code page for DB2 data servers and in the UTF-8 code page for IDS data servers.
  *
- * Returns a statement resource with a result set containing rows describing the
- * primary keys for the specified table.
- * The result set is composed of the following columns:
+ * ====mode
+ *      Database logging mode.
+ *      Note: This value is applicable only to IDS data servers.
  *
- * Column name:: Description
- * TABLE_CAT:: Name of the catalog for the table containing the primary key.
- * The value is NULL if this table does not have catalogs.
- * TABLE_SCHEM:: Name of the schema for the table containing the primary key.
- * TABLE_NAME:: Name of the table containing the primary key.
- * COLUMN_NAME:: Name of the column containing the primary key.
- * KEY_SEQ:: 1-indexed position of the column in the key.
- * PK_NAME:: The name of the primary key.
+ * ===Return Value
+ *  Returns True on successful creation of database else return None
  */
-static PyObject *ibm_db_primary_keys(PyObject *self, PyObject *args)
+PyObject *ibm_db_createdb(PyObject *self, PyObject *args)
 {
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *table_name = NULL;
-	int rc;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_table_name = NULL;
-	int isNewBuffer;
+	conn_handle *conn_res = NULL;
+	PyObject *dbNameObj = NULL;
+	PyObject *codesetObj = NULL;
+	PyObject *modeObj = NULL;
+	int rc = -1;
 
-	if (!PyArg_ParseTuple(args, "OOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name))
+	if ( !PyArg_ParseTuple( args, "OO|OO", &conn_res, &dbNameObj, &codesetObj, &modeObj ) ) {
 		return NULL;
-
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
-			return NULL;
-		}
 	}
+	rc = _python_ibm_db_createdb(conn_res, dbNameObj, codesetObj, modeObj, 0);
+	if ( rc == 0 ) {
+		Py_RETURN_TRUE;
+	} else {
+		return NULL;
+	}	
+}
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			return NULL;
-		}
-	}
+/*!# ibm_db.dropdb
+ *
+ * ===Description
+ *  True/None ibm_db.dropdb ( IBM_DBConnection connection, string dbName )
+ *
+ * Drops the specified database
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
+ *
+ * ====dbName
+ *      Name of the database that is to be dropped.
+ *
+ * ===Return Value
+ *  Returns True if specified database dropped sucessfully else None
+ */
+PyObject *ibm_db_dropdb(PyObject *self, PyObject *args)
+{
+	conn_handle *conn_res = NULL;
+	PyObject *dbNameObj = NULL;
+	int rc = -1;
 
-	if (py_table_name != NULL && py_table_name != Py_None) {
-		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
-			py_table_name = PyUnicode_FromObject(py_table_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			return NULL;
-		}
+	if ( !PyArg_ParseTuple( args, "OO", &conn_res, &dbNameObj ) ) {
+		return NULL;
 	}
+	
+	rc = _python_ibm_db_dropdb( conn_res, dbNameObj, 0 );
+	if ( rc == 0 ) {
+		Py_RETURN_TRUE;
+	} else {
+		return NULL;
+	}
+}
 
-	if (conn_res) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			return NULL;
-		}
-
-		stmt_res = _ibm_db_new_stmt_struct(conn_res);
-
-		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
-		if (rc == SQL_ERROR) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-				NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-
-			Py_RETURN_FALSE;
-		}
-		if (py_qualifier && py_qualifier != Py_None )
-			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
-		if (py_owner &&  py_owner != Py_None )
-			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
-		if (py_table_name && py_table_name != Py_None )
-			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
-
-		Py_BEGIN_ALLOW_THREADS;	
-		rc = SQLPrimaryKeysW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS,
-			owner, SQL_NTS, table_name, SQL_NTS);
-		Py_END_ALLOW_THREADS;
-
-		if (isNewBuffer) {
-		    if(qualifier) PyMem_Del(qualifier);
-		    if(owner) PyMem_Del(owner);
-		    if(table_name) PyMem_Del(table_name);
-		}
-		
-		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-				1, NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
+/*ibm_db.recreatedb
+ *
+ * ===Description
+ *  True/None ibm_db.recreatedb ( IBM_DBConnection connection, string dbName [, codeSet, mode] )
+ *
+ * Drop and then recreates a database by using the specified database name, code set, and mode
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
+ *
+ * ====dbName
+ *      Name of the database that is to be created.
+ *
+ * ====codeSet
+ *      Database code set information.
+ *      Note: If the value of the codeSet argument not specified, the database is created in the Unicode code page for DB2 data servers and in the UTF-8 code page for IDS data servers.
+ *
+ * ====mode
+ *      Database logging mode.
+ *      Note: This value is applicable only to IDS data servers.
+ *
+ * ===Return Value
+ *  Returns True if specified database created successfully else return None
+ */
+PyObject *ibm_db_recreatedb(PyObject *self, PyObject *args)
+{
+	conn_handle *conn_res = NULL;
+	PyObject *dbNameObj = NULL;
+	PyObject *codesetObj = NULL;
+	PyObject *modeObj = NULL;
+	int rc = -1;
 
-			Py_RETURN_FALSE;
-		}
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
+	if ( !PyArg_ParseTuple( args, "OO|OO", &conn_res, &dbNameObj, &codesetObj, &modeObj ) ) {
+		return NULL;
+	}
 
-		return (PyObject *)stmt_res;			 
+	rc = _python_ibm_db_dropdb( conn_res, dbNameObj, 1 );
+	if ( rc != 0 ) {
+		return NULL; 
+	} 
 
+	rc = _python_ibm_db_createdb(conn_res, dbNameObj, codesetObj, modeObj, 0);
+	if ( rc == 0 ) {
+		Py_RETURN_TRUE;
 	} else {
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
-
-		Py_RETURN_FALSE;
+		return NULL;
 	}
 }
 
-/*!# ibm_db.procedure_columns
+/*!# ibm_db.createdbNX 
  *
  * ===Description
- * resource ibm_db.procedure_columns ( resource connection, string qualifier,
- * string schema, string procedure, string parameter )
+ *  True/None ibm_db.createdbNX ( IBM_DBConnection connection, string dbName [, codeSet, mode] )
  *
- * Returns a result set listing the parameters for one or more stored procedures
+ * Creates the database if not exist by using the specified database name, code set, and mode
  *
  * ===Parameters
  *
  * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ *      A valid database server instance connection resource variable as returned from ibm_db.connect() by specifying the ATTACH keyword.
  *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
+ * ====dbName
+ *      Name of the database that is to be created.
  *
- * ====schema
- *		The schema which contains the procedures. This parameter accepts a
- * search pattern containing _ and % as wildcards.
+ * ====codeSet
+ *      Database code set information.
+ *      Note: If the value of the codeSet argument not specified, the database is created in the Unicode code page for DB2 data servers and in the UTF-8 code page for IDS data servers.
  *
- * ====procedure
- *		The name of the procedure. This parameter accepts a search pattern
- * containing _ and % as wildcards.
+ * ====mode
+ *      Database logging mode.
+ *      Note: This value is applicable only to IDS data servers.
  *
- * ====parameter
- *		The name of the parameter. This parameter accepts a search pattern
- * containing _ and % as wildcards.
- *		If this parameter is NULL, all parameters for the specified stored
- * procedures are returned.
+ * ===Return Value
+ *  Returns True if database already exists or created sucessfully else return None
+ */
+PyObject *ibm_db_createdbNX(PyObject *self, PyObject *args)
+{
+	conn_handle *conn_res = NULL;
+	PyObject *dbNameObj = NULL;
+	PyObject *codesetObj = NULL;
+	PyObject *modeObj = NULL;
+	int rc = -1;
+	
+	if ( !PyArg_ParseTuple( args, "OO|OO", &conn_res, &dbNameObj, &codesetObj, &modeObj ) ) {
+		return NULL;
+	}
+	
+	rc = _python_ibm_db_createdb(conn_res, dbNameObj, codesetObj, modeObj, 1);
+	if ( rc == 0 ) {
+		Py_RETURN_TRUE;
+	} else {
+		return NULL;
+	}
+}
+
+/*!# ibm_db.autocommit
  *
- * ===Return Values
+ * ===Description
  *
- * Returns a statement resource with a result set containing rows describing the
- * parameters for the stored procedures matching the specified parameters. The
- * rows are composed of the following columns:
+ * mixed ibm_db.autocommit ( resource connection [, bool value] )
  *
- * Column name::	Description
- * PROCEDURE_CAT:: The catalog that contains the procedure. The value is NULL
- * if this table does not have catalogs.
- * PROCEDURE_SCHEM:: Name of the schema that contains the stored procedure.
- * PROCEDURE_NAME:: Name of the procedure.
- * COLUMN_NAME:: Name of the parameter.
- * COLUMN_TYPE:: An integer value representing the type of the parameter:
- *					  Return value:: Parameter type
- *					  1:: (SQL_PARAM_INPUT)	Input (IN) parameter.
- *					  2:: (SQL_PARAM_INPUT_OUTPUT) Input/output (INOUT)
- *						  parameter.
- *					  3:: (SQL_PARAM_OUTPUT) Output (OUT) parameter.
- * DATA_TYPE:: The SQL data type for the parameter represented as an integer
- * value.
- * TYPE_NAME:: A string representing the data type for the parameter.
- * COLUMN_SIZE:: An integer value representing the size of the parameter.
- * BUFFER_LENGTH:: Maximum number of bytes necessary to store data for this
- * parameter.
- * DECIMAL_DIGITS:: The scale of the parameter, or NULL where scale is not
- * applicable.
- * NUM_PREC_RADIX:: An integer value of either 10 (representing an exact numeric
- * data type), 2 (representing anapproximate numeric data type), or NULL
- * (representing a data type for which radix is not applicable).
- * NULLABLE:: An integer value representing whether the parameter is nullable or
- * not.
- * REMARKS:: Description of the parameter.
- * COLUMN_DEF:: Default value for the parameter.
- * SQL_DATA_TYPE:: An integer value representing the size of the parameter.
- * SQL_DATETIME_SUB:: Returns an integer value representing a datetime subtype
- * code, or NULL for SQL data types to which this does not apply.
- * CHAR_OCTET_LENGTH:: Maximum length in octets for a character data type
- * parameter, which matches COLUMN_SIZE for single-byte character set data, or
- * NULL for non-character data types.
- * ORDINAL_POSITION:: The 1-indexed position of the parameter in the CALL
- * statement.
- * IS_NULLABLE:: A string value where 'YES' means that the parameter accepts or
- * returns NULL values and 'NO' means that the parameter does not accept or
- * return NULL values.
- */
-static PyObject *ibm_db_procedure_columns(PyObject *self, PyObject *args)
+ * Returns or sets the AUTOCOMMIT behavior of the specified connection resource.
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *	A valid database connection resource variable as returned from connect()
+ * or pconnect().
+ *
+ * ====value
+ *	One of the following constants:
+ *	SQL_AUTOCOMMIT_OFF
+ *		  Turns AUTOCOMMIT off.
+ *	SQL_AUTOCOMMIT_ON
+ *		  Turns AUTOCOMMIT on.
+ *
+ * ===Return Values
+ *
+ * When ibm_db.autocommit() receives only the connection parameter, it returns
+ * the current state of AUTOCOMMIT for the requested connection as an integer
+ * value. A value of 0 indicates that AUTOCOMMIT is off, while a value of 1
+ * indicates that AUTOCOMMIT is on.
+ *
+ * When ibm_db.autocommit() receives both the connection parameter and
+ * autocommit parameter, it attempts to set the AUTOCOMMIT state of the
+ * requested connection to the corresponding state.
+ *
+ * Returns TRUE on success or FALSE on failure.
+ */ 
+static PyObject *ibm_db_autocommit(PyObject *self, PyObject *args)			
 {
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *proc_name = NULL;
-	SQLWCHAR *column_name = NULL;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_proc_name = NULL;
-	PyObject *py_column_name = NULL;
-	int rc = 0;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	int isNewBuffer;
+	PyObject *py_autocommit = NULL;
+	conn_handle *conn_res = NULL;
+	int rc;
+	SQLINTEGER autocommit = -1;
 
-	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_proc_name, &py_column_name))
+	if (!PyArg_ParseTuple(args, "O|O", &conn_res, &py_autocommit)){
 		return NULL;
-
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
-			return NULL;
-		}
 	}
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
+	if (!NIL_P(conn_res)) {
+		if (!NIL_P(py_autocommit)) {
+			if (PyInt_Check(py_autocommit)) { 
+				autocommit = (SQLINTEGER)PyInt_AsLong(py_autocommit);
+			} else {
+				PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+				return NULL;
+			}
 		}
-		else {
-			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
-			Py_XDECREF(py_qualifier);
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
 			return NULL;
 		}
-	}
 
-	if (py_proc_name != NULL && py_proc_name != Py_None) {
-		if (PyString_Check(py_proc_name) || PyUnicode_Check(py_proc_name)){
-			py_proc_name = PyUnicode_FromObject(py_proc_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			return NULL;
+	  /* If value in handle is different from value passed in */
+		if (PyTuple_Size(args) == 2) {
+			if(autocommit != (conn_res->auto_commit)) {
+				Py_BEGIN_ALLOW_THREADS;
+#ifndef PASE
+				rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) (autocommit == 0 ? SQL_AUTOCOMMIT_OFF : SQL_AUTOCOMMIT_ON), SQL_IS_INTEGER);
+#else
+				rc = SQLSetConnectAttr((SQLHDBC)conn_res->hdbc, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER)&autocommit, SQL_IS_INTEGER);
+#endif
+				Py_END_ALLOW_THREADS;
+				if ( rc == SQL_ERROR ) {
+					_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, 
+												rc, 1, NULL, -1, 1);
+				}
+				conn_res->auto_commit = autocommit;
+			}
+			Py_INCREF(Py_True);
+			return Py_True;
+		} else {
+			return PyInt_FromLong(conn_res->auto_commit);
 		}
 	}
+	return NULL;
+}
 
-	if (py_column_name != NULL && py_column_name != Py_None) {
-		if (PyString_Check(py_column_name) || PyUnicode_Check(py_column_name)){
-			py_column_name = PyUnicode_FromObject(py_column_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "column_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
-			return NULL;
-		}
-	}
+/*	static int _python_ibm_db_add_param_cache( stmt_handle *stmt_res, int param_no, PyObject *var_pyvalue, int param_type, int size, SQLSMALLINT data_type, SQLUINTEGER precision, SQLSMALLINT scale, SQLSMALLINT nullable )
+	sets the cache entry of parameter param_no, replacing the information of
+	a parameter bound before. Returns -1 with a Python exception set when out
+	of memory
+*/
+static int _python_ibm_db_add_param_cache( stmt_handle *stmt_res, int param_no, PyObject *var_pyvalue, int param_type, int size, SQLSMALLINT data_type, SQLUINTEGER precision, SQLSMALLINT scale, SQLSMALLINT nullable )
+{
+	param_node *curr = NULL;
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
-			Py_XDECREF(py_column_name);
-			return NULL;
-		}
+	curr = _python_ibm_db_set_param_node(stmt_res, param_no, data_type, precision, scale, nullable);
+	if ( curr == NULL ) {
+		return -1;
+	}
+	curr->param_type = param_type;
+	curr->size = size;
 
-		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+	/* Set this flag in stmt_res if a FILE INPUT is present */
+	if ( param_type == PARAM_FILE) {
+		stmt_res->file_param = 1;
+	}
 
-		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
-		if (rc == SQL_ERROR) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-				NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
-			Py_XDECREF(py_column_name);
+	if ( var_pyvalue != NULL) {
+		curr->var_pyvalue = var_pyvalue;
+	}
+	return 0;
+}
 
-			Py_RETURN_FALSE;
-		}
-		if (py_qualifier && py_qualifier != Py_None )
-			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
-		if (py_owner &&  py_owner != Py_None )
-			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
-		if (py_proc_name && py_proc_name != Py_None )
-			proc_name = getUnicodeDataAsSQLWCHAR(py_proc_name, &isNewBuffer);
-		if (py_column_name && py_column_name != Py_None )
-			column_name = getUnicodeDataAsSQLWCHAR(py_column_name, &isNewBuffer);
+/*
+ * static PyObject *_python_ibm_db_bind_param_helper(int argc, stmt_handle *stmt_res, SQLUSMALLINT param_no, PyObject *var_pyvalue, long param_type,
+ * 					 long data_type, long precision, long scale, long size)
+ */
+static PyObject *_python_ibm_db_bind_param_helper(int argc, stmt_handle *stmt_res, SQLUSMALLINT param_no, PyObject *var_pyvalue, long param_type, long data_type, long precision, long scale, long size)
+{
+	SQLSMALLINT sql_data_type = 0;
+	SQLUINTEGER sql_precision = 0;
+	SQLSMALLINT sql_scale = 0;
+	SQLSMALLINT sql_nullable = SQL_NO_NULLS;
+	char error[DB2_MAX_ERR_MSG_LEN];
+	int rc = 0;
+	
+	/* Params set by ibm_db.execute() or ibm_db.execute_many() are replaced */
+	if ( stmt_res->dynamic_params ) {
+		_python_ibm_db_clear_param_cache(stmt_res);
+	}
 
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLProcedureColumnsW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, 
-			owner, SQL_NTS, proc_name, SQL_NTS, column_name, 
-			SQL_NTS);
-		Py_END_ALLOW_THREADS;
+	/* Check for Param options */
+	switch (argc) {
+		/* if argc == 3, then the default value for param_type will be used */
+		case 3:
+			param_type = SQL_PARAM_INPUT;
 
-		if (isNewBuffer) {
-		    if(qualifier) PyMem_Del(qualifier);
-		    if(owner) PyMem_Del(owner);
-		    if(proc_name) PyMem_Del(proc_name);
-			if(column_name) PyMem_Del(column_name);
-		}
-		
-		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-				1, NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
-			Py_XDECREF(py_column_name);
+			rc = _python_ibm_db_describe_param(stmt_res, param_no, &sql_data_type,
+								&sql_precision, &sql_scale, &sql_nullable);
 
-			Py_RETURN_FALSE;
-		}
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_proc_name);
-		Py_XDECREF(py_column_name);
+			if ( rc == SQL_ERROR ) {
+				sprintf(error, "Describe Param Failed: %s", 
+				IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return NULL;
+			}
+			/* Add to cache */
+			if ( _python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue, 
+											param_type, size, 
+											sql_data_type, sql_precision, 
+											sql_scale, sql_nullable ) ) {
+				return NULL;
+			}
+			break;
 
-		return (PyObject *)stmt_res;			
-	} else {
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_proc_name);
-		Py_XDECREF(py_column_name);
+		case 4:
+			rc = _python_ibm_db_describe_param(stmt_res, param_no, &sql_data_type,
+								&sql_precision, &sql_scale, &sql_nullable);
 
-		Py_RETURN_FALSE;
+			if ( rc == SQL_ERROR ) {
+				sprintf(error, "Describe Param Failed: %s", 
+						IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return NULL;
+			}
+			/* Add to cache */
+			if ( _python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
+												param_type, size, 
+												sql_data_type, sql_precision, 
+												sql_scale, sql_nullable ) ) {
+				return NULL;
+			}
+			break;
+
+		case 5:
+			rc = _python_ibm_db_describe_param(stmt_res, param_no, &sql_data_type,
+								&sql_precision, &sql_scale, &sql_nullable);
+
+			if ( rc == SQL_ERROR ) {
+				sprintf(error, "Describe Param Failed: %s", 
+								IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return NULL;
+			}
+			sql_data_type = (SQLSMALLINT)data_type;
+			/* Add to cache */
+			if ( _python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
+												param_type, size, 
+												sql_data_type, sql_precision, 
+												sql_scale, sql_nullable ) ) {
+				return NULL;
+			}
+			break;
+
+		case 6:
+			rc = _python_ibm_db_describe_param(stmt_res, param_no, &sql_data_type,
+								&sql_precision, &sql_scale, &sql_nullable);
+
+			if ( rc == SQL_ERROR ) {
+				sprintf(error, "Describe Param Failed: %s", 
+						IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return NULL;
+			}
+			sql_data_type = (SQLSMALLINT)data_type;
+			sql_precision = (SQLUINTEGER)precision;
+			/* Add to cache */
+			if ( _python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
+												param_type, size, 
+												sql_data_type, sql_precision, 
+												sql_scale, sql_nullable ) ) {
+				return NULL;
+			}
+			break;
+
+		case 7:
+		case 8:
+			/* Cache param data passed 
+			* The cache is an array indexed by the param number, sized from
+			* SQLNumParams when the statement is prepared.
+			* Data is being copied over to the correct types for subsequent 
+			* CLI call because this might cause problems on other platforms 
+			* such as AIX 
+			*/
+			sql_data_type = (SQLSMALLINT)data_type;
+			sql_precision = (SQLUINTEGER)precision;
+			sql_scale = (SQLSMALLINT)scale;
+			if ( _python_ibm_db_add_param_cache(stmt_res, param_no, var_pyvalue,
+												param_type, size, 
+												sql_data_type, sql_precision, 
+												sql_scale, sql_nullable ) ) {
+				return NULL;
+			}
+			break;
+	
+		default:
+			/* WRONG_PARAM_COUNT; */
+			return NULL;
 	}
+	/* end Switch */
+
+	/* We bind data with DB2 CLI in ibm_db.execute() */
+	/* This will save network flow if we need to override params in it */
+
+	Py_INCREF(Py_True);
+	return Py_True;
 }
 
-/*!# ibm_db.procedures
+/*!# ibm_db.bind_param
  *
  * ===Description
- * resource ibm_db.procedures ( resource connection, string qualifier,
- * string schema, string procedure )
+ * Py_True/Py_None ibm_db.bind_param (resource stmt, int parameter-number,
+ *									string variable [, int parameter-type
+ *									[, int data-type [, int precision
+ *									[, int scale [, int size[]]]]]] )
  *
- * Returns a result set listing the stored procedures registered in a database.
+ * Binds a Python variable to an SQL statement parameter in a IBM_DBStatement
+ * resource returned by ibm_db.prepare().
+ * This function gives you more control over the parameter type, data type,
+ * precision, and scale for the parameter than simply passing the variable as
+ * part of the optional input array to ibm_db.execute().
  *
  * ===Parameters
  *
- * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ * ====stmt
  *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
+ *	A prepared statement returned from ibm_db.prepare().
  *
- * ====schema
- *		The schema which contains the procedures. This parameter accepts a
- * search pattern containing _ and % as wildcards.
+ * ====parameter-number
  *
- * ====procedure
- *		The name of the procedure. This parameter accepts a search pattern
- * containing _ and % as wildcards.
+ *	Specifies the 1-indexed position of the parameter in the prepared
+ * statement.
  *
- * ===Return Values
+ * ====variable
  *
- * Returns a statement resource with a result set containing rows describing the
- * stored procedures matching the specified parameters. The rows are composed of
- * the following columns:
+ *	A Python variable to bind to the parameter specified by parameter-number.
  *
- * Column name:: Description
- * PROCEDURE_CAT:: The catalog that contains the procedure. The value is NULL if
- * this table does not have catalogs.
- * PROCEDURE_SCHEM:: Name of the schema that contains the stored procedure.
- * PROCEDURE_NAME:: Name of the procedure.
- * NUM_INPUT_PARAMS:: Number of input (IN) parameters for the stored procedure.
- * NUM_OUTPUT_PARAMS:: Number of output (OUT) parameters for the stored
- * procedure.
- * NUM_RESULT_SETS:: Number of result sets returned by the stored procedure.
- * REMARKS:: Any comments about the stored procedure.
- * PROCEDURE_TYPE:: Always returns 1, indicating that the stored procedure does
- * not return a return value.
+ * ====parameter-type
+ *
+ *	A constant specifying whether the Python variable should be bound to the
+ * SQL parameter as an input parameter (SQL_PARAM_INPUT), an output parameter
+ * (SQL_PARAM_OUTPUT), or as a parameter that accepts input and returns output
+ * (SQL_PARAM_INPUT_OUTPUT). To avoid memory overhead, you can also specify
+ * PARAM_FILE to bind the Python variable to the name of a file that contains
+ * large object (BLOB, CLOB, or DBCLOB) data.
+ *
+ * ====data-type
+ *
+ *	A constant specifying the SQL data type that the Python variable should be
+ * bound as: one of SQL_BINARY, DB2_CHAR, DB2_DOUBLE, or DB2_LONG .
+ *
+ * ====precision
+ *
+ *	Specifies the precision that the variable should be bound to the database. *
+ * ====scale
+ *
+ *	  Specifies the scale that the variable should be bound to the database.
+ *
+ * ====size
+ *
+ *	  Specifies the size that should be retreived from an INOUT/OUT parameter.
+ *
+ * ===Return Values
+ *
+ *	Returns Py_True on success or NULL on failure.
  */
-static PyObject *ibm_db_procedures(PyObject *self, PyObject *args)			
+static PyObject *ibm_db_bind_param(PyObject *self, PyObject *args)			
 {
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *proc_name = NULL;
-	int rc = 0;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_proc_name = NULL;
-	int isNewBuffer;
+	PyObject *var_pyvalue = NULL;
+	PyObject *py_param_type = NULL;
+	PyObject *py_data_type = NULL;
+	PyObject *py_precision = NULL;
+	PyObject *py_scale = NULL;
+	PyObject *py_size = NULL;
+	PyObject *py_param_no = NULL;
 
-	if (!PyArg_ParseTuple(args, "OOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_proc_name))
+	long param_type = SQL_PARAM_INPUT;
+	/* LONG types used for data being passed in */
+	SQLUSMALLINT param_no = 0;
+	long data_type = 0;
+	long precision = 0;
+	long scale = 0;
+	long size = 0;
+	stmt_handle *stmt_res;
+	
+	if (!PyArg_ParseTuple(args, "OOO|OOOOO", &stmt_res, &py_param_no, 
+						&var_pyvalue, &py_param_type, 
+						&py_data_type, &py_precision, 
+						&py_scale, &py_size)) {
+	
 		return NULL;
-
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+	}
+	if (!NIL_P(py_param_no)) {
+		if (PyInt_Check(py_param_no)) {
+			param_no = (SQLUSMALLINT) PyInt_AsLong(py_param_no);
+		} else {
+			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
 			return NULL;
 		}
 	}
+	if (py_param_type != NULL && py_param_type != Py_None && 
+		TYPE(py_param_type) == PYTHON_FIXNUM) {
+		param_type = PyInt_AS_LONG(py_param_type);
+	}
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			return NULL;
-		}
+	if (py_data_type != NULL && py_data_type != Py_None && 
+		TYPE(py_data_type) == PYTHON_FIXNUM) {
+		data_type = PyInt_AS_LONG(py_data_type);
 	}
 
-	if (py_proc_name != NULL && py_proc_name != Py_None) {
-		if (PyString_Check(py_proc_name) || PyUnicode_Check(py_proc_name)){
-			py_proc_name = PyUnicode_FromObject(py_proc_name);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			return NULL;
-		}
+	if (py_precision != NULL && py_precision != Py_None && 
+		TYPE(py_precision) == PYTHON_FIXNUM) {
+		precision = PyInt_AS_LONG(py_precision);
 	}
 
+	if (py_scale != NULL && py_scale != Py_None && 
+		TYPE(py_scale) == PYTHON_FIXNUM) {
+		scale = PyInt_AS_LONG(py_scale);
+	}
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
-			return NULL;
-		}
+	if (py_size != NULL && py_size != Py_None && 
+		TYPE(py_size) == PYTHON_FIXNUM) {
+		size = PyInt_AS_LONG(py_size);
+	}
 
-		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+	if (!NIL_P(stmt_res)) {
+		return _python_ibm_db_bind_param_helper(PyTuple_Size(args), stmt_res, param_no, var_pyvalue, param_type, data_type, precision, scale, size);
+	} else {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+}
 
-		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
-		if (rc == SQL_ERROR) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-				NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
 
-			Py_RETURN_FALSE;
-		}
-		if (py_qualifier && py_qualifier != Py_None )
-			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
-		if (py_owner &&  py_owner != Py_None )
-			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
-		if (py_proc_name && py_proc_name != Py_None )
-			proc_name = getUnicodeDataAsSQLWCHAR(py_proc_name, &isNewBuffer);
+/*!# ibm_db.close
+ *
+ * ===Description
+ *
+ * bool ibm_db.close ( resource connection )
+ *
+ * This function closes a DB2 client connection created with ibm_db.connect()
+ * and returns the corresponding resources to the database server.
+ *
+ * If you attempt to close a persistent DB2 client connection created with
+ * ibm_db.pconnect(), the close request returns TRUE and the persistent IBM Data
+ * Server client connection remains available for the next caller.
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *	Specifies an active DB2 client connection.
+ *
+ * ===Return Values
+ * Returns TRUE on success or FALSE on failure.
+ */
+static PyObject *ibm_db_close(PyObject *self, PyObject *args)			
+{
+	conn_handle *conn_res = NULL;
+	int rc;
 
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLProceduresW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, owner,
-			SQL_NTS, proc_name, SQL_NTS);
-		Py_END_ALLOW_THREADS;
+	if (!PyArg_ParseTuple(args, "O", &conn_res))
+		return NULL;
 
-		if (isNewBuffer) {
-		    if(qualifier) PyMem_Del(qualifier);
-		    if(owner) PyMem_Del(owner);
-		    if(proc_name) PyMem_Del(proc_name);
+	if (!NIL_P(conn_res)) {
+		/* Check to see if it's a persistent connection; 
+		 * if so, just return true 
+		*/
+
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			return NULL;
 		}
-		
-		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-				1, NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_proc_name);
 
-			Py_RETURN_FALSE;
+		if ( conn_res->handle_active && !conn_res->flag_pconnect ) {
+			/* Free the cached statements while the connection is alive */
+			_python_ibm_db_clear_stmt_cache(conn_res);
+
+			/* Disconnect from DB. If stmt is allocated, 
+			* it is freed automatically 
+			*/
+			if (conn_res->auto_commit == 0) {
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLEndTran(SQL_HANDLE_DBC, (SQLHDBC)conn_res->hdbc, 
+								SQL_ROLLBACK);
+				Py_END_ALLOW_THREADS;
+				if ( rc == SQL_ERROR ) {
+					_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, 
+													rc, 1, NULL, -1, 1);
+					return NULL;
+				}
+			}
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLDisconnect((SQLHDBC)conn_res->hdbc);
+			Py_END_ALLOW_THREADS;
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
+												1, NULL, -1, 1);
+				return NULL;
+			}
+
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLFreeHandle(SQL_HANDLE_DBC, conn_res->hdbc);
+			Py_END_ALLOW_THREADS;
+
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 
+												1, NULL, -1, 1);
+
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
+				Py_END_ALLOW_THREADS;
+				return NULL;
+			}
+
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLFreeHandle(SQL_HANDLE_ENV, conn_res->henv);
+			Py_END_ALLOW_THREADS;
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(conn_res->henv, SQL_HANDLE_ENV, rc, 
+												1, NULL, -1, 1);
+				return NULL;
+			}
+
+			conn_res->handle_active = 0;
+			Py_INCREF(Py_True);
+			return Py_True;
+		} else if ( conn_res->flag_pconnect ) {
+			/* Back to the pool for the next matching ibm_db.pconnect() */
+			_python_ibm_db_pool_checkin(conn_res);
+			Py_INCREF(Py_True);
+			return Py_True;
+		} else {
+			return NULL;
 		}
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_proc_name);
-		return (PyObject *)stmt_res;				
 	} else {
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_proc_name);
-
-		Py_RETURN_FALSE;
+		return NULL;
 	}
 }
 
-/*!# ibm_db.special_columns
+/*!# ibm_db.get_stmt_cache_stats
  *
  * ===Description
- * resource ibm_db.special_columns ( resource connection, string qualifier,
- * string schema, string table_name, int scope )
+ * dictionary ibm_db.get_stmt_cache_stats ( IBM_DBConnection connection )
  *
- * Returns a result set listing the unique row identifier columns for a table.
+ * Returns the counters of the prepared statement cache of a connection, see
+ * the ATTR_STMT_CACHE_SIZE connection option.
  *
  * ===Parameters
  *
  * ====connection
- *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ *		A valid database connection resource variable as returned from
+ *		ibm_db.connect() or ibm_db.pconnect().
  *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
+ * ===Return Values
  *
- * ====schema
- *		The schema which contains the tables.
+ * Returns a dictionary with the following keys:
+ *		size		- the number of statements the cache holds at most
+ *		statements	- the number of statements cached
+ *		hits		- calls to ibm_db.prepare() served from the cache
+ *		misses		- calls to ibm_db.prepare() that prepared the statement
+ *		evictions	- statements released to make room for another one
+ */
+static PyObject *ibm_db_get_stmt_cache_stats(PyObject *self, PyObject *args)
+{
+	conn_handle *conn_res = NULL;
+	int i, statements = 0;
+
+	if (!PyArg_ParseTuple(args, "O", &conn_res))
+		return NULL;
+
+	if (NIL_P(conn_res) || !PyObject_TypeCheck(conn_res, &conn_handleType)) {
+		PyErr_SetString(PyExc_Exception, "Supplied connection object Parameter is invalid");
+		return NULL;
+	}
+	if (conn_res->stmt_cache != NULL) {
+		for (i = 0; i < conn_res->c_stmt_cache_size; i++) {
+			if (conn_res->stmt_cache[i].key != NULL) {
+				statements++;
+			}
+		}
+	}
+	return Py_BuildValue("{s:i,s:i,s:l,s:l,s:l}", "size", conn_res->c_stmt_cache_size,
+		"statements", statements, "hits", conn_res->stmt_cache_hits,
+		"misses", conn_res->stmt_cache_misses, "evictions", conn_res->stmt_cache_evictions);
+}
+
+/*!# ibm_db.set_pool_options
  *
- * ====table_name
- *		The name of the table.
+ * ===Description
+ * bool ibm_db.set_pool_options ( [int min_size [, int max_size
+ * [, float timeout [, int idle_timeout]]]] )
  *
- * ====scope
- *		Integer value representing the minimum duration for which the unique
- * row identifier is valid. This can be one of the following values:
+ * Sets the limits of the pools of persistent connections made by
+ * ibm_db.pconnect(). There is one pool per database, username and password.
+ * Options that are not passed keep their value.
  *
- *		0: Row identifier is valid only while the cursor is positioned on the
- * row. (SQL_SCOPE_CURROW)
- *		1: Row identifier is valid for the duration of the transaction.
- * (SQL_SCOPE_TRANSACTION)
- *		2: Row identifier is valid for the duration of the connection.
- * (SQL_SCOPE_SESSION)
+ * ===Parameters
  *
- * ===Return Values
+ * ====min_size
+ *		The number of connections a pool keeps open when idle connections
+ * are closed after idle_timeout. Defaults to 0.
  *
- * Returns a statement resource with a result set containing rows with unique
- * row identifier information for a table.
- * The rows are composed of the following columns:
+ * ====max_size
+ *		The maximum number of connections of a pool, 0 for no limit. Defaults
+ * to 0.
  *
- * Column name:: Description
+ * ====timeout
+ *		The number of seconds ibm_db.pconnect() waits for a connection of a
+ * full pool to be closed before raising an exception. Defaults to 30.
  *
- * SCOPE:: Integer value representing the minimum duration for which the unique
- * row identifier is valid.
+ * ====idle_timeout
+ *		The number of seconds after which an idle connection is closed, 0 to
+ * keep idle connections open. Defaults to 0.
  *
- *			 0: Row identifier is valid only while the cursor is positioned on
- * the row. (SQL_SCOPE_CURROW)
+ * ===Return Values
  *
- *			 1: Row identifier is valid for the duration of the transaction.
- * (SQL_SCOPE_TRANSACTION)
+ * Returns TRUE on success or raises an exception for a negative value.
+ */
+static PyObject *ibm_db_set_pool_options(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+	static char *kwlist[] = { "min_size", "max_size", "timeout", "idle_timeout", NULL };
+	int min_size = pool_min_size;
+	int max_size = pool_max_size;
+	double timeout = pool_timeout;
+	long idle_timeout = pool_idle_timeout;
+	conn_pool *pool;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|iidl", kwlist, 
+		&min_size, &max_size, &timeout, &idle_timeout))
+		return NULL;
+
+	if (min_size < 0 || max_size < 0 || timeout < 0 || idle_timeout < 0) {
+		PyErr_SetString(PyExc_Exception, "Pool options must not be negative");
+		return NULL;
+	}
+	pool_min_size = min_size;
+	pool_max_size = max_size;
+	pool_timeout = timeout;
+	pool_idle_timeout = idle_timeout;
+
+	for (pool = conn_pools; pool != NULL; pool = pool->next) {
+		_python_ibm_db_pool_reap(pool);
+	}
+	Py_INCREF(Py_True);
+	return Py_True;
+}
+
+/*!# ibm_db.get_pool_stats
  *
- *			 2: Row identifier is valid for the duration of the connection.
- * (SQL_SCOPE_SESSION)
+ * ===Description
+ * list ibm_db.get_pool_stats ( )
  *
- * COLUMN_NAME:: Name of the unique column.
+ * Returns the counters of the pools of persistent connections, see
+ * ibm_db.pconnect() and ibm_db.set_pool_options().
  *
- * DATA_TYPE:: SQL data type for the column.
+ * ===Return Values
  *
- * TYPE_NAME:: Character string representation of the SQL data type for the
- * column.
+ * Returns a list with a dictionary per pool with the following keys:
+ *		database	- the database the connections were made to
+ *		user		- the username the connections were made with
+ *		idle		- connections waiting for ibm_db.pconnect()
+ *		in_use		- connections that were not returned by ibm_db.close()
+ *		created		- connections opened by the pool
+ *		checkouts	- connections returned by ibm_db.pconnect()
+ *		waits		- calls to ibm_db.pconnect() that waited for a connection
+ *		timeouts	- calls to ibm_db.pconnect() that gave up waiting
+ *		reaped		- idle connections closed after the idle timeout
+ *		invalid		- idle connections closed because they were no longer alive
+ */
+static PyObject *ibm_db_get_pool_stats(PyObject *self, PyObject *args)
+{
+	PyObject *list, *stats;
+	conn_pool *pool;
+
+	list = PyList_New(0);
+	if (list == NULL) {
+		return NULL;
+	}
+	for (pool = conn_pools; pool != NULL; pool = pool->next) {
+		stats = Py_BuildValue("{s:O,s:O,s:n,s:i,s:l,s:l,s:l,s:l,s:l,s:l}", 
+			"database", pool->database, "user", pool->uid, 
+			"idle", PyList_GET_SIZE(pool->idle), "in_use", pool->in_use, 
+			"created", pool->created, "checkouts", pool->checkouts, 
+			"waits", pool->waits, "timeouts", pool->timeouts, 
+			"reaped", pool->reaped, "invalid", pool->invalid);
+		if (stats == NULL || PyList_Append(list, stats) == -1) {
+			Py_XDECREF(stats);
+			Py_DECREF(list);
+			return NULL;
+		}
+		Py_DECREF(stats);
+	}
+	return list;
+}
+
+/*	static ibm_db_stats *_python_ibm_db_handle_stats(PyObject *handle)
+	counters of a connection or statement resource, or of the module when
+	handle is NULL or None. NULL with a Python exception set on failure
+*/
+static ibm_db_stats *_python_ibm_db_handle_stats(PyObject *handle)
+{
+	static ibm_db_stats no_stats;
+
+	if ( NIL_P(handle) ) {
+		return &module_stats;
+	} else if ( PyObject_TypeCheck(handle, &conn_handleType) ) {
+		/* the counters of the connection could not be allocated */
+		memset(&no_stats, 0, sizeof(ibm_db_stats));
+		return ((conn_handle *)handle)->stats != NULL ? ((conn_handle *)handle)->stats : &no_stats;
+	} else if ( PyObject_TypeCheck(handle, &stmt_handleType) ) {
+		return &((stmt_handle *)handle)->stats;
+	}
+	PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+	return NULL;
+}
+
+/*!# ibm_db.enable_stats
  *
- * COLUMN_SIZE:: An integer value representing the size of the column.
+ * ===Description
+ * bool ibm_db.enable_stats ( bool enable )
  *
- * BUFFER_LENGTH:: Maximum number of bytes necessary to store data from this
- * column.
+ * Turns the performance counters returned by ibm_db.get_stats() on or off.
+ * The counters are off by default and then cost a test per CLI call; a
+ * build with IBM_DB_NO_STATS defined leaves them out altogether.
  *
- * DECIMAL_DIGITS:: The scale of the column, or NULL where scale is not
- * applicable.
+ * ===Parameters
  *
- * NUM_PREC_RADIX:: An integer value of either 10 (representing an exact numeric
- * data type), 2 (representing an approximate numeric data type), or NULL
- * (representing a data type for which radix is not applicable).
+ * ====enable
+ *		True to start counting, False to stop. The counters keep their values
+ * while counting is off.
  *
- * PSEUDO_COLUMN:: Always returns 1.
+ * ===Return Values
+ *
+ * Returns whether the counters were on before the call.
  */
-static PyObject *ibm_db_special_columns(PyObject *self, PyObject *args)
+static PyObject *ibm_db_enable_stats(PyObject *self, PyObject *args)
 {
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *table_name = NULL;
-	int scope = 0;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	int rc;
-	PyObject *py_scope = NULL;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_table_name = NULL;
-	int isNewBuffer;
+	PyObject *py_enable = NULL;
+	int was_enabled = stats_enabled;
+	int enable;
 
-	if (!PyArg_ParseTuple(args, "OOOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name, &py_scope))
+	if (!PyArg_ParseTuple(args, "O", &py_enable))
+		return NULL;
+
+	enable = PyObject_IsTrue(py_enable);
+	if (enable < 0) {
 		return NULL;
-	if (!NIL_P(py_scope)) {
-		if (PyInt_Check(py_scope)) {
-			scope = (int) PyInt_AsLong(py_scope);
-		} else {
-			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
-			return NULL;
-		}
 	}
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
-			return NULL;
-		}
+#ifdef IBM_DB_NO_STATS
+	if (enable) {
+		PyErr_SetString(PyExc_Exception, "ibm_db was built without performance counters");
+		return NULL;
 	}
+#endif
+	stats_enabled = enable;
+	return PyBool_FromLong(was_enabled);
+}
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
-		}
+/*!# ibm_db.get_stats
+ *
+ * ===Description
+ * dictionary ibm_db.get_stats ( [resource handle] )
+ *
+ * Returns the performance counters of a statement, of a connection or of all
+ * the statements of the module, see ibm_db.enable_stats(). The counters of a
+ * connection add up those of its statements, including the closed ones.
+ * Executions started by ibm_db.execute_async() are not timed.
+ *
+ * ===Parameters
+ *
+ * ====handle
+ *		A valid connection or statement resource. The counters of the module
+ * are returned when it is omitted or None.
+ *
+ * ===Return Values
+ *
+ * Returns a dictionary with the following keys:
+ *		prepare_time	- seconds spent preparing statements
+ *		execute_time	- seconds spent executing statements
+ *		fetch_time		- seconds spent fetching rows and column data
+ *		describe_time	- seconds spent describing result sets
+ *		lob_time		- seconds spent reading LOB values through their locators
+ *		convert_time	- seconds spent building Python rows, including the
+ *						  LOB reads of ibm_db.fetch_tuple() and friends
+ *		cli_calls		- CLI calls of the kinds timed above
+ *		rows_fetched	- rows fetched
+ *		bytes_fetched	- bytes of the non NULL values fetched
+ *		params_bound	- parameter values sent with the executions
+ */
+static PyObject *ibm_db_get_stats(PyObject *self, PyObject *args)
+{
+	PyObject *handle = NULL;
+	PyObject *value, *result;
+	ibm_db_stats *stats;
+	int i;
+
+	if (!PyArg_ParseTuple(args, "|O", &handle))
+		return NULL;
+
+	stats = _python_ibm_db_handle_stats(handle);
+	if (stats == NULL) {
+		return NULL;
+	}
+	result = Py_BuildValue("{s:l,s:l,s:L,s:l}", "cli_calls", stats->cli_calls,
+		"rows_fetched", stats->rows_fetched, "bytes_fetched", stats->bytes_fetched,
+		"params_bound", stats->params_bound);
+	if (result == NULL) {
+		return NULL;
+	}
+	for (i = 0; i < STATS_NUM_TIMERS; i++) {
+		value = PyFloat_FromDouble(stats->time[i]);
+		if (value == NULL || PyDict_SetItemString(result, stats_timer_names[i], value) < 0) {
+			Py_XDECREF(value);
+			Py_DECREF(result);
+			return NULL;
+		}
+		Py_DECREF(value);
+	}
+	return result;
+}
+
+/*!# ibm_db.reset_stats
+ *
+ * ===Description
+ * bool ibm_db.reset_stats ( [resource handle] )
+ *
+ * Sets the performance counters of a statement, of a connection or of the
+ * module back to zero. Only the counters of the given handle are reset.
+ *
+ * ===Parameters
+ *
+ * ====handle
+ *		A valid connection or statement resource. The counters of the module
+ * are reset when it is omitted or None.
+ *
+ * ===Return Values
+ *
+ * Returns True.
+ */
+static PyObject *ibm_db_reset_stats(PyObject *self, PyObject *args)
+{
+	PyObject *handle = NULL;
+	ibm_db_stats *stats;
+	int refs;
+
+	if (!PyArg_ParseTuple(args, "|O", &handle))
+		return NULL;
+
+	stats = _python_ibm_db_handle_stats(handle);
+	if (stats == NULL) {
+		return NULL;
+	}
+	refs = stats->refs;
+	memset(stats, 0, sizeof(ibm_db_stats));
+	stats->refs = refs;
+	Py_RETURN_TRUE;
+}
+
+/*!# ibm_db.set_trace_hook
+ *
+ * ===Description
+ * bool ibm_db.set_trace_hook ( callable hook )
+ *
+ * Registers a function called after each prepare, execute, fetch of a block
+ * of rows, commit and rollback, to build query logs or tracing spans. No
+ * work is done for the reports while neither a hook nor a slow query log is
+ * set. Executions started by ibm_db.execute_async() are not reported.
+ *
+ * ===Parameters
+ *
+ * ====hook
+ *		The function to call, or None to remove the hook. It is called as
+ * hook(event, sql, params, elapsed, rows, sqlstate) where event is one of
+ * 'prepare', 'execute', 'fetch', 'commit' and 'rollback', sql the statement
+ * text (None for a commit or rollback), params the number of parameter
+ * markers, elapsed the seconds the operation took, rows the rows affected by
+ * an execute or fetched by a fetch (-1 when unknown), and sqlstate the
+ * SQLSTATE of a failed operation or None. ibm_db calls made by the hook are
+ * not reported, and an exception raised by the hook is printed and ignored.
+ *
+ * ===Return Values
+ *
+ * Returns True.
+ */
+static PyObject *ibm_db_set_trace_hook(PyObject *self, PyObject *args)
+{
+	PyObject *hook = NULL;
+	PyObject *old_hook = trace_hook;
+
+	if (!PyArg_ParseTuple(args, "O", &hook))
+		return NULL;
+
+	if (hook == Py_None) {
+		hook = NULL;
+	} else if (!PyCallable_Check(hook)) {
+		PyErr_SetString(PyExc_Exception, "Supplied hook must be callable");
+		return NULL;
+	}
+	Py_XINCREF(hook);
+	trace_hook = hook;
+	tracing = trace_hook != NULL || slow_query_log != NULL;
+	Py_XDECREF(old_hook);
+	Py_RETURN_TRUE;
+}
+
+/*!# ibm_db.set_slow_query_log
+ *
+ * ===Description
+ * bool ibm_db.set_slow_query_log ( string filename [, float threshold] )
+ *
+ * Appends the operations reported to the trace hook that take threshold
+ * seconds or more to a file, see ibm_db.set_trace_hook(). Each line holds
+ * the local time, the event, the elapsed seconds, the rows, the parameter
+ * count, the SQLSTATE or - and the statement text:
+ *
+ *		2009-03-01 12:00:00 execute 2.503127s rows=12 params=1 sqlstate=- SELECT ...
+ *
+ * ===Parameters
+ *
+ * ====filename
+ *		The file to append to, or None to close the log.
+ *
+ * ====threshold
+ *		Seconds an operation must take to be logged, 1.0 by default.
+ *
+ * ===Return Values
+ *
+ * Returns True, raises an exception when the file cannot be opened.
+ */
+static PyObject *ibm_db_set_slow_query_log(PyObject *self, PyObject *args)
+{
+	PyObject *py_filename = NULL;
+	double threshold = 1.0;
+	FILE *log = NULL;
+
+	if (!PyArg_ParseTuple(args, "O|d", &py_filename, &threshold))
+		return NULL;
+
+	if (threshold < 0) {
+		PyErr_SetString(PyExc_Exception, "threshold must be a non-negative number");
+		return NULL;
+	}
+	if (py_filename != Py_None) {
+		if (!PyString_Check(py_filename)) {
+			PyErr_SetString(PyExc_Exception, "filename must be a string or None");
+			return NULL;
+		}
+		log = fopen(PyString_AsString(py_filename), "a");
+		if (log == NULL) {
+			PyErr_Format(PyExc_Exception, "Failed to open slow query log %s: %s", 
+				PyString_AsString(py_filename), strerror(errno));
+			return NULL;
+		}
+	}
+	if (slow_query_log != NULL) {
+		fclose(slow_query_log);
+	}
+	slow_query_log = log;
+	slow_query_threshold = threshold;
+	tracing = trace_hook != NULL || slow_query_log != NULL;
+	Py_RETURN_TRUE;
+}
+
+/*!# ibm_db.column_privileges
+ *
+ * ===Description
+ * resource ibm_db.column_privileges ( resource connection [, string qualifier
+ * [, string schema [, string table-name [, string column-name]]]] )
+ *
+ * Returns a result set listing the columns and associated privileges for a
+ * table.
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ *
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
+ *
+ * ====schema
+ *		The schema which contains the tables. To match all schemas, pass NULL
+ * or an empty string.
+ *
+ * ====table-name
+ *		The name of the table or view. To match all tables in the database,
+ * pass NULL or an empty string.
+ *
+ * ====column-name
+ *		The name of the column. To match all columns in the table, pass NULL
+ * or an empty string.
+ *
+ * ===Return Values
+ * Returns a statement resource with a result set containing rows describing
+ * the column privileges for columns matching the specified parameters. The rows
+ * are composed of the following columns:
+ *
+ * TABLE_CAT:: Name of the catalog. The value is NULL if this table does not
+ * have catalogs.
+ * TABLE_SCHEM:: Name of the schema.
+ * TABLE_NAME:: Name of the table or view.
+ * COLUMN_NAME:: Name of the column.
+ * GRANTOR:: Authorization ID of the user who granted the privilege.
+ * GRANTEE:: Authorization ID of the user to whom the privilege was granted.
+ * PRIVILEGE:: The privilege for the column.
+ * IS_GRANTABLE:: Whether the GRANTEE is permitted to grant this privilege to
+ * other users.
+ */
+static PyObject *ibm_db_column_privileges(PyObject *self, PyObject *args)
+{
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *table_name = NULL;
+	SQLWCHAR *column_name = NULL;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_table_name = NULL;
+	PyObject *py_column_name = NULL;
+	conn_handle *conn_res;
+	stmt_handle *stmt_res;
+	int rc;
+	int isNewBuffer;
+
+	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name, &py_column_name))
+		return NULL;
+
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+			return NULL;
+		}
+	}
+
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
+		}
 		else {
 			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
 			Py_XDECREF(py_qualifier);
@@ -3865,24 +4988,40 @@ static PyObject *ibm_db_special_columns(PyObject *self, PyObject *args)
 		}
 	}
 
+	if (py_column_name != NULL && py_column_name != Py_None) {
+		if (PyString_Check(py_column_name) || PyUnicode_Check(py_table_name)){
+			py_column_name = PyUnicode_FromObject(py_column_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "column_name must be a string");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			return NULL;
+		}
+	}
+
 	if (!NIL_P(conn_res)) {
 		if (!conn_res->handle_active) {
 			PyErr_SetString(PyExc_Exception, "Connection is not active");
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_column_name);
 			return NULL;
 		}
 
 		stmt_res = _ibm_db_new_stmt_struct(conn_res);
-
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
 		if (rc == SQL_ERROR) {
 			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
 				NULL, -1, 1);
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_column_name);
 
 			Py_RETURN_FALSE;
 		}
@@ -3894,51 +5033,51 @@ static PyObject *ibm_db_special_columns(PyObject *self, PyObject *args)
 			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLSpecialColumnsW((SQLHSTMT)stmt_res->hstmt, SQL_BEST_ROWID, 
-			qualifier, SQL_NTS, owner, SQL_NTS, table_name,
-			SQL_NTS, scope, SQL_NULLABLE);
+		rc = SQLColumnPrivilegesW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS,
+							owner, SQL_NTS, table_name, SQL_NTS, column_name,
+							SQL_NTS);
 		Py_END_ALLOW_THREADS;
 
 		if (isNewBuffer) {
-		    if(qualifier) PyMem_Del(qualifier);
-		    if(owner) PyMem_Del(owner);
-		    if(table_name) PyMem_Del(table_name);	
+			if(qualifier) PyMem_Del(qualifier);
+			if(owner) PyMem_Del(owner);
+			if(table_name) PyMem_Del(table_name);
 		}
 		
 		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-				1, NULL, -1, 1);
+			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+							SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_column_name);
 
 			Py_RETURN_FALSE;
 		}
 		Py_XDECREF(py_qualifier);
 		Py_XDECREF(py_owner);
 		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_column_name);
 
 		return (PyObject *)stmt_res;
 	} else {
 		Py_XDECREF(py_qualifier);
 		Py_XDECREF(py_owner);
 		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_column_name);
 
 		Py_RETURN_FALSE;
-
 	}
 }
 
-/*!# ibm_db.statistics
- *
+/*!# ibm_db.columns
  * ===Description
- * resource ibm_db.statistics ( resource connection, string qualifier,
- * string schema, string table-name, bool unique )
+ * resource ibm_db.columns ( resource connection [, string qualifier
+ * [, string schema [, string table-name [, string column-name]]]] )
  *
- * Returns a result set listing the index and statistics for a table.
+ * Returns a result set listing the columns and associated metadata for a table.
  *
  * ===Parameters
- *
  * ====connection
  *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
  *
@@ -3947,90 +5086,67 @@ static PyObject *ibm_db_special_columns(PyObject *self, PyObject *args)
  * other databases, pass NULL or an empty string.
  *
  * ====schema
- *		The schema that contains the targeted table. If this parameter is NULL,
- * the statistics and indexes are returned for the schema of the current user.
- *
- * ====table_name
- *		The name of the table.
- *
- * ====unique
- *		A boolean value representing the type of index information to return.
+ *		The schema which contains the tables. To match all schemas, pass '%'.
  *
- *		False	 Return only the information for unique indexes on the table.
+ * ====table-name
+ *		The name of the table or view. To match all tables in the database,
+ * pass NULL or an empty string.
  *
- *		True	  Return the information for all indexes on the table.
+ * ====column-name
+ *		The name of the column. To match all columns in the table, pass NULL or
+ * an empty string.
  *
  * ===Return Values
- *
  * Returns a statement resource with a result set containing rows describing the
- * statistics and indexes for the base tables matching the specified parameters.
+ * columns matching the specified parameters.
  * The rows are composed of the following columns:
  *
- * Column name:: Description
- * TABLE_CAT:: The catalog that contains the table. The value is NULL if this
- * table does not have catalogs.
- * TABLE_SCHEM:: Name of the schema that contains the table.
- * TABLE_NAME:: Name of the table.
- * NON_UNIQUE:: An integer value representing whether the index prohibits unique
- * values, or whether the row represents statistics on the table itself:
- *
- *					 Return value:: Parameter type
- *					 0 (SQL_FALSE):: The index allows duplicate values.
- *					 1 (SQL_TRUE):: The index values must be unique.
- *					 NULL:: This row is statistics information for the table
- *					 itself.
- *
- * INDEX_QUALIFIER:: A string value representing the qualifier that would have
- * to be prepended to INDEX_NAME to fully qualify the index.
- * INDEX_NAME:: A string representing the name of the index.
- * TYPE:: An integer value representing the type of information contained in
- * this row of the result set:
- *
- *			Return value:: Parameter type
- *			0 (SQL_TABLE_STAT):: The row contains statistics about the table
- *								 itself.
- *			1 (SQL_INDEX_CLUSTERED):: The row contains information about a
- *									  clustered index.
- *			2 (SQL_INDEX_HASH):: The row contains information about a hashed
- *								 index.
- *			3 (SQL_INDEX_OTHER):: The row contains information about a type of
- * index that is neither clustered nor hashed.
- *
- * ORDINAL_POSITION:: The 1-indexed position of the column in the index. NULL if
- * the row contains statistics information about the table itself.
- * COLUMN_NAME:: The name of the column in the index. NULL if the row contains
- * statistics information about the table itself.
- * ASC_OR_DESC:: A if the column is sorted in ascending order, D if the column
- * is sorted in descending order, NULL if the row contains statistics
- * information about the table itself.
- * CARDINALITY:: If the row contains information about an index, this column
- * contains an integer value representing the number of unique values in the
- * index. If the row contains information about the table itself, this column
- * contains an integer value representing the number of rows in the table.
- * PAGES:: If the row contains information about an index, this column contains
- * an integer value representing the number of pages used to store the index. If
- * the row contains information about the table itself, this column contains an
- * integer value representing the number of pages used to store the table.
- * FILTER_CONDITION:: Always returns NULL.
- */ 
-static PyObject *ibm_db_statistics(PyObject *self, PyObject *args)
+ * TABLE_CAT:: Name of the catalog. The value is NULL if this table does not
+ * have catalogs.
+ * TABLE_SCHEM:: Name of the schema.
+ * TABLE_NAME:: Name of the table or view.
+ * COLUMN_NAME:: Name of the column.
+ * DATA_TYPE:: The SQL data type for the column represented as an integer value.
+ * TYPE_NAME:: A string representing the data type for the column.
+ * COLUMN_SIZE:: An integer value representing the size of the column.
+ * BUFFER_LENGTH:: Maximum number of bytes necessary to store data from this
+ * column.
+ * DECIMAL_DIGITS:: The scale of the column, or NULL where scale is not
+ * applicable.
+ * NUM_PREC_RADIX:: An integer value of either 10 (representing an exact numeric
+ * data type), 2 (representing an approximate numeric data type), or NULL
+ * (representing a data type for which radix is not applicable).
+ * NULLABLE:: An integer value representing whether the column is nullable or
+ * not.
+ * REMARKS:: Description of the column.
+ * COLUMN_DEF:: Default value for the column.
+ * SQL_DATA_TYPE:: An integer value representing the size of the column.
+ * SQL_DATETIME_SUB:: Returns an integer value representing a datetime subtype
+ * code, or NULL for SQL data types to which this does not apply.
+ * CHAR_OCTET_LENGTH::	Maximum length in octets for a character data type
+ * column, which matches COLUMN_SIZE for single-byte character set data, or
+ * NULL for non-character data types.
+ * ORDINAL_POSITION:: The 1-indexed position of the column in the table.
+ * IS_NULLABLE:: A string value where 'YES' means that the column is nullable
+ * and 'NO' means that the column is not nullable.
+ */
+static PyObject *ibm_db_columns(PyObject *self, PyObject *args)			
 {
 	SQLWCHAR *qualifier = NULL;
 	SQLWCHAR *owner = NULL;
 	SQLWCHAR *table_name = NULL;
-	int unique = 0;
-	int rc = 0;
-	SQLUSMALLINT sql_unique;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
+	SQLWCHAR *column_name = NULL;
 	PyObject *py_qualifier = NULL;
 	PyObject *py_owner = NULL;
 	PyObject *py_table_name = NULL;
-	PyObject *py_unique = NULL;
+	PyObject *py_column_name = NULL;
+	conn_handle *conn_res;
+	stmt_handle *stmt_res;
+	int rc;
 	int isNewBuffer;
 
-	if (!PyArg_ParseTuple(args, "OOOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name, &py_unique))
+	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name, &py_column_name))
 		return NULL;
 
 	if (py_qualifier != NULL && py_qualifier != Py_None) {
@@ -4066,16 +5182,16 @@ static PyObject *ibm_db_statistics(PyObject *self, PyObject *args)
 		}
 	}
 
-	if (py_unique != NULL && py_unique != Py_None) {
-		if (PyBool_Check(py_unique)) {
-			if (py_unique == Py_True)
-				unique = 1;
-			else
-				unique = 0;
+	if (py_column_name != NULL && py_column_name != Py_None) {
+		if (PyString_Check(py_column_name) || PyUnicode_Check(py_table_name)){
+			py_column_name = PyUnicode_FromObject(py_column_name);
 		}
 		else {
-			PyErr_SetString(PyExc_Exception, "unique must be a boolean");
-			return NULL;
+			PyErr_SetString(PyExc_Exception, "column_name must be a string");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+				return NULL;
 		}
 	}
 
@@ -4085,231 +5201,344 @@ static PyObject *ibm_db_statistics(PyObject *self, PyObject *args)
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_column_name);
 			return NULL;
 		}
 
 		stmt_res = _ibm_db_new_stmt_struct(conn_res);
-		sql_unique = unique;
 
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
 		if (rc == SQL_ERROR) {
 			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
 				NULL, -1, 1);
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_column_name);
 
 			Py_RETURN_FALSE;
 		}
+
 		if (py_qualifier && py_qualifier != Py_None )
 			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
 		if (py_owner &&  py_owner != Py_None )
 			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
 		if (py_table_name && py_table_name != Py_None )
 			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
+		if (py_column_name && py_column_name != Py_None )
+			column_name = getUnicodeDataAsSQLWCHAR(py_column_name, &isNewBuffer);
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLStatisticsW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, owner,
-			SQL_NTS, table_name, SQL_NTS, sql_unique, SQL_QUICK);
+		rc = SQLColumnsW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS,
+			owner,SQL_NTS, table_name, SQL_NTS, column_name, SQL_NTS);
 		Py_END_ALLOW_THREADS;
 
 		if (isNewBuffer) {
 		    if(qualifier) PyMem_Del(qualifier);
 		    if(owner) PyMem_Del(owner);
 		    if(table_name) PyMem_Del(table_name);
-		}
-		
+		    if(column_name) PyMem_Del(column_name);
+		}	
+				
 		if (rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-				1, NULL, -1, 1);
+			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+				SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_column_name);
 
 			Py_RETURN_FALSE;
 		}
 		Py_XDECREF(py_qualifier);
 		Py_XDECREF(py_owner);
 		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_column_name);
 
-		return (PyObject *)stmt_res;
+		return (PyObject *)stmt_res;				  
 	} else {
 		Py_XDECREF(py_qualifier);
 		Py_XDECREF(py_owner);
 		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_column_name);
 
 		Py_RETURN_FALSE;
 	}
 }
 
-/*!# ibm_db.table_privileges
+/*!# ibm_db.foreign_keys
  *
  * ===Description
- * resource ibm_db.table_privileges ( resource connection [, string qualifier
- * [, string schema [, string table_name]]] )
+ * resource ibm_db.foreign_keys ( resource connection, string pk_qualifier,
+ * string pk_schema, string pk_table-name, string fk_qualifier
+ * string fk_schema, string fk_table-name )
  *
- * Returns a result set listing the tables and associated privileges in a
- * database.
+ * Returns a result set listing the foreign keys for a table.
  *
  * ===Parameters
  *
  * ====connection
  *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
  *
- * ====qualifier
- *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
- * other databases, pass NULL or an empty string.
+ * ====pk_qualifier
+ *		A qualifier for the pk_table-name argument for the DB2 databases 
+ * running on OS/390 or z/OS servers. For other databases, pass NULL or an empty 
+ * string. 
  *
- * ====schema
- *		The schema which contains the tables. This parameter accepts a search
- * pattern containing _ and % as wildcards.
+ * ====pk_schema
+ *		The schema for the pk_table-name argument which contains the tables. If 
+ * schema is NULL, ibm_db.foreign_keys() matches the schema for the current 
+ * connection. 
  *
- * ====table_name
- *		The name of the table. This parameter accepts a search pattern
- * containing _ and % as wildcards.
+ * ====pk_table-name
+ *		The name of the table which contains the primary key.
+ *
+ * ====fk_qualifier
+ *		A qualifier for the fk_table-name argument for the DB2 databases
+ * running on OS/390 or z/OS servers. For other databases, pass NULL or an empty
+ * string.
+ *
+ * ====fk_schema
+ *		The schema for the fk_table-name argument which contains the tables. If
+ * schema is NULL, ibm_db.foreign_keys() matches the schema for the current
+ * connection.
+ *
+ * ====fk_table-name
+ *		The name of the table which contains the foreign key.
  *
  * ===Return Values
  *
- * Returns a statement resource with a result set containing rows describing
- * the privileges for the tables that match the specified parameters. The rows
- * are composed of the following columns:
+ * Returns a statement resource with a result set containing rows describing the
+ * foreign keys for the specified table. The result set is composed of the
+ * following columns:
  *
- * Column name:: Description
- * TABLE_CAT:: The catalog that contains the table. The value is NULL if this
- * table does not have catalogs.
- * TABLE_SCHEM:: Name of the schema that contains the table.
- * TABLE_NAME:: Name of the table.
- * GRANTOR:: Authorization ID of the user who granted the privilege.
- * GRANTEE:: Authorization ID of the user to whom the privilege was granted.
- * PRIVILEGE:: The privilege that has been granted. This can be one of ALTER,
- * CONTROL, DELETE, INDEX, INSERT, REFERENCES, SELECT, or UPDATE.
- * IS_GRANTABLE:: A string value of "YES" or "NO" indicating whether the grantee
- * can grant the privilege to other users.
+ * Column name::	Description
+ * PKTABLE_CAT:: Name of the catalog for the table containing the primary key.
+ * The value is NULL if this table does not have catalogs.
+ * PKTABLE_SCHEM:: Name of the schema for the table containing the primary key.
+ * PKTABLE_NAME:: Name of the table containing the primary key.
+ * PKCOLUMN_NAME:: Name of the column containing the primary key.
+ * FKTABLE_CAT:: Name of the catalog for the table containing the foreign key.
+ * The value is NULL if this table does not have catalogs.
+ * FKTABLE_SCHEM:: Name of the schema for the table containing the foreign key.
+ * FKTABLE_NAME:: Name of the table containing the foreign key.
+ * FKCOLUMN_NAME:: Name of the column containing the foreign key.
+ * KEY_SEQ:: 1-indexed position of the column in the key.
+ * UPDATE_RULE:: Integer value representing the action applied to the foreign
+ * key when the SQL operation is UPDATE.
+ * DELETE_RULE:: Integer value representing the action applied to the foreign
+ * key when the SQL operation is DELETE.
+ * FK_NAME:: The name of the foreign key.
+ * PK_NAME:: The name of the primary key.
+ * DEFERRABILITY:: An integer value representing whether the foreign key
+ * deferrability is SQL_INITIALLY_DEFERRED, SQL_INITIALLY_IMMEDIATE, or
+ * SQL_NOT_DEFERRABLE.
  */
-static PyObject *ibm_db_table_privileges(PyObject *self, PyObject *args)
+static PyObject *ibm_db_foreign_keys(PyObject *self, PyObject *args)
 {
-	SQLWCHAR *qualifier = NULL;
-	SQLWCHAR *owner = NULL;
-	SQLWCHAR *table_name = NULL;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
+	SQLWCHAR *pk_qualifier = NULL;
+	SQLWCHAR *pk_owner = NULL;
+	SQLWCHAR *pk_table_name = NULL;
+	SQLWCHAR *fk_qualifier = NULL;
+	SQLWCHAR *fk_owner = NULL;
+	SQLWCHAR *fk_table_name = NULL;
 	int rc;
-	PyObject *py_qualifier = NULL;
-	PyObject *py_owner = NULL;
-	PyObject *py_table_name = NULL;
+	conn_handle *conn_res = NULL;
+	stmt_handle *stmt_res;
+	PyObject *py_pk_qualifier = NULL;
+	PyObject *py_pk_owner = NULL;
+	PyObject *py_pk_table_name = NULL;
+	PyObject *py_fk_qualifier = NULL;
+	PyObject *py_fk_owner = NULL;
+	PyObject *py_fk_table_name = NULL;
 	int isNewBuffer;
 
-	if (!PyArg_ParseTuple(args, "O|OOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name))
+	if (!PyArg_ParseTuple(args, "OOOO|OOO", &conn_res, &py_pk_qualifier, 
+		&py_pk_owner, &py_pk_table_name, &py_fk_qualifier,
+		&py_fk_owner, &py_fk_table_name))
 		return NULL;
 
-	if (py_qualifier != NULL && py_qualifier != Py_None) {
-		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
-			py_qualifier = PyUnicode_FromObject(py_qualifier);
+	if (py_pk_qualifier != NULL && py_pk_qualifier != Py_None) {
+		if (PyString_Check(py_pk_qualifier) || PyUnicode_Check(py_pk_qualifier)){
+			py_pk_qualifier = PyUnicode_FromObject(py_pk_qualifier);
 		}
 		else {
-			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+			PyErr_SetString(PyExc_Exception, 
+				"qualifier for table containing primary key must be a string or unicode");
 			return NULL;
 		}
 	}
 
-	if (py_owner != NULL && py_owner != Py_None) {
-		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
-			py_owner = PyUnicode_FromObject(py_owner);
+	if (py_pk_owner != NULL && py_pk_owner != Py_None) {
+		if (PyString_Check(py_pk_owner) || PyUnicode_Check(py_pk_owner)){
+			py_pk_owner = PyUnicode_FromObject(py_pk_owner);
 		}
 		else {
-			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
-			Py_XDECREF(py_qualifier);
+			PyErr_SetString(PyExc_Exception,  
+				"owner of table containing primary key must be a string or unicode");
+			Py_XDECREF(py_pk_qualifier);
 			return NULL;
 		}
 	}
 
-	if (py_table_name != NULL && py_table_name != Py_None) {
-		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
-			py_table_name = PyUnicode_FromObject(py_table_name);
+	if (py_pk_table_name != NULL && py_pk_table_name != Py_None) {
+		if (PyString_Check(py_pk_table_name) || PyUnicode_Check(py_pk_table_name)){
+			py_pk_table_name = PyUnicode_FromObject(py_pk_table_name);
 		}
 		else {
-			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
+			PyErr_SetString(PyExc_Exception, 
+				"name of the table that contains primary key must be a string or unicode");
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
 			return NULL;
 		}
 	}
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
+	if (py_fk_qualifier != NULL && py_fk_qualifier != Py_None) {
+		if (PyString_Check(py_fk_qualifier) || PyUnicode_Check(py_fk_qualifier)){
+			py_fk_qualifier = PyUnicode_FromObject(py_fk_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, 
+				"qualifier for table containing the foreign key must be a string or unicode");
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
+			Py_XDECREF(py_pk_table_name);
 			return NULL;
 		}
+	}
 
-		if (!conn_res) {
-			PyErr_SetString(PyExc_Exception,"Connection Resource cannot be found");
-			Py_RETURN_FALSE;
+	if (py_fk_owner != NULL && py_fk_owner != Py_None) {
+		if (PyString_Check(py_fk_owner) || PyUnicode_Check(py_fk_owner)){
+			py_fk_owner = PyUnicode_FromObject(py_fk_owner);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, 
+				"owner of table containing the foreign key must be a string or unicode");
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
+			Py_XDECREF(py_pk_table_name);
+			Py_XDECREF(py_fk_qualifier);
+			return NULL;
+		}
+	}
+
+	if (py_fk_table_name != NULL && py_fk_table_name != Py_None) {
+		if (PyString_Check(py_fk_table_name) || PyUnicode_Check(py_fk_table_name)){
+			py_fk_table_name = PyUnicode_FromObject(py_fk_table_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, 
+				"name of the table that contains foreign key must be a string or unicode");
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
+			Py_XDECREF(py_pk_table_name);
+			Py_XDECREF(py_fk_qualifier);
+			Py_XDECREF(py_fk_owner);
+			return NULL;
+		}
+	}
+
+	if (conn_res) {
+
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
+			Py_XDECREF(py_pk_table_name);
+			Py_XDECREF(py_fk_qualifier);
+			Py_XDECREF(py_fk_owner);
+			Py_XDECREF(py_fk_table_name);
+			return NULL;
 		}
 
 		stmt_res = _ibm_db_new_stmt_struct(conn_res);
 
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+
 		if (rc == SQL_ERROR) {
 			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
 				NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
+			Py_XDECREF(py_pk_table_name);
+			Py_XDECREF(py_fk_qualifier);
+			Py_XDECREF(py_fk_owner);
+			Py_XDECREF(py_fk_table_name);
 
 			Py_RETURN_FALSE;
 		}
-		if (py_qualifier && py_qualifier != Py_None )
-			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
-		if (py_owner &&  py_owner != Py_None )
-			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
-		if (py_table_name && py_table_name != Py_None )
-			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
+
+		if(py_pk_qualifier && py_pk_qualifier != Py_None)
+			pk_qualifier = getUnicodeDataAsSQLWCHAR(py_pk_qualifier, &isNewBuffer);
+		if(py_pk_owner && py_pk_owner != Py_None)
+			pk_owner = getUnicodeDataAsSQLWCHAR(py_pk_owner, &isNewBuffer);
+		if(py_pk_table_name && py_pk_table_name != Py_None)
+			pk_table_name = getUnicodeDataAsSQLWCHAR(py_pk_table_name, &isNewBuffer);
+		if(py_fk_qualifier && py_fk_qualifier != Py_None)
+			fk_qualifier = getUnicodeDataAsSQLWCHAR(py_fk_qualifier, &isNewBuffer);
+		if(py_fk_owner && py_fk_owner != Py_None)
+			fk_owner = getUnicodeDataAsSQLWCHAR(py_fk_owner, &isNewBuffer);
+		if(py_fk_table_name && py_fk_table_name != Py_None)
+			fk_table_name = getUnicodeDataAsSQLWCHAR(py_fk_table_name, &isNewBuffer);
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLTablePrivilegesW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, 
-			owner, SQL_NTS, table_name, SQL_NTS);
+		rc = SQLForeignKeysW((SQLHSTMT)stmt_res->hstmt, pk_qualifier, SQL_NTS,
+						pk_owner, SQL_NTS, pk_table_name, SQL_NTS, fk_qualifier, SQL_NTS,
+						fk_owner, SQL_NTS, fk_table_name, SQL_NTS);
 		Py_END_ALLOW_THREADS;
 
 		if (isNewBuffer) {
-		    if(qualifier) PyMem_Del(qualifier);
-		    if(owner) PyMem_Del(owner);
-		    if(table_name) PyMem_Del(table_name);
-		}
+		    if(pk_qualifier) PyMem_Del(pk_qualifier);
+		    if(pk_owner) PyMem_Del(pk_owner);
+		    if(pk_table_name) PyMem_Del(pk_table_name);
+			if(fk_qualifier) PyMem_Del(fk_qualifier);
+		    if(fk_owner) PyMem_Del(fk_owner);
+		    if(fk_table_name) PyMem_Del(fk_table_name);
+		}	
 		
 		if (rc == SQL_ERROR ) {
 			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-				1, NULL, -1, 1);
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
+											1, NULL, -1, 1);
+			Py_XDECREF(py_pk_qualifier);
+			Py_XDECREF(py_pk_owner);
+			Py_XDECREF(py_pk_table_name);
+			Py_XDECREF(py_fk_qualifier);
+			Py_XDECREF(py_fk_owner);
+			Py_XDECREF(py_fk_table_name);
 
 			Py_RETURN_FALSE;
 		}
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_pk_qualifier);
+		Py_XDECREF(py_pk_owner);
+		Py_XDECREF(py_pk_table_name);
+		Py_XDECREF(py_fk_qualifier);
+		Py_XDECREF(py_fk_owner);
+		Py_XDECREF(py_fk_table_name);
+		return (PyObject *)stmt_res;				  
 
-		return (PyObject *)stmt_res;
 	} else {
-		Py_XDECREF(py_qualifier);
-		Py_XDECREF(py_owner);
-		Py_XDECREF(py_table_name);
-
+		Py_XDECREF(py_pk_qualifier);
+		Py_XDECREF(py_pk_owner);
+		Py_XDECREF(py_pk_table_name);
+		Py_XDECREF(py_fk_qualifier);
+		Py_XDECREF(py_fk_owner);
+		Py_XDECREF(py_fk_table_name);
 		Py_RETURN_FALSE;
 	}
 }
 
-/*!# ibm_db.tables
+/*!# ibm_db.primary_keys
  *
  * ===Description
- * resource ibm_db.tables ( resource connection [, string qualifier [, string
- * schema [, string table-name [, string table-type]]]] )
+ * resource ibm_db.primary_keys ( resource connection, string qualifier,
+ * string schema, string table-name )
  *
- * Returns a result set listing the tables and associated metadata in a database
+ * Returns a result set listing the primary keys for a table.
  *
  * ===Parameters
  *
@@ -4321,51 +5550,42 @@ static PyObject *ibm_db_table_privileges(PyObject *self, PyObject *args)
  * other databases, pass NULL or an empty string.
  *
  * ====schema
- *		The schema which contains the tables. This parameter accepts a search
- * pattern containing _ and % as wildcards.
+ *		The schema which contains the tables. If schema is NULL,
+ * ibm_db.primary_keys() matches the schema for the current connection.
  *
  * ====table-name
- *		The name of the table. This parameter accepts a search pattern
- * containing _ and % as wildcards.
- *
- * ====table-type
- *		A list of comma-delimited table type identifiers. To match all table
- * types, pass NULL or an empty string.
- *		Valid table type identifiers include: ALIAS, HIERARCHY TABLE,
- * INOPERATIVE VIEW, NICKNAME, MATERIALIZED QUERY TABLE, SYSTEM TABLE, TABLE,
- * TYPED TABLE, TYPED VIEW, and VIEW.
+ *		The name of the table.
  *
  * ===Return Values
  *
- * Returns a statement resource with a result set containing rows describing
- * the tables that match the specified parameters.
- * The rows are composed of the following columns:
+ * Returns a statement resource with a result set containing rows describing the
+ * primary keys for the specified table.
+ * The result set is composed of the following columns:
  *
  * Column name:: Description
- * TABLE_CAT:: The catalog that contains the table. The value is NULL if this
- * table does not have catalogs.
- * TABLE_SCHEMA:: Name of the schema that contains the table.
- * TABLE_NAME:: Name of the table.
- * TABLE_TYPE:: Table type identifier for the table.
- * REMARKS:: Description of the table.
+ * TABLE_CAT:: Name of the catalog for the table containing the primary key.
+ * The value is NULL if this table does not have catalogs.
+ * TABLE_SCHEM:: Name of the schema for the table containing the primary key.
+ * TABLE_NAME:: Name of the table containing the primary key.
+ * COLUMN_NAME:: Name of the column containing the primary key.
+ * KEY_SEQ:: 1-indexed position of the column in the key.
+ * PK_NAME:: The name of the primary key.
  */
-static PyObject *ibm_db_tables(PyObject *self, PyObject *args)
+static PyObject *ibm_db_primary_keys(PyObject *self, PyObject *args)
 {
 	SQLWCHAR *qualifier = NULL;
 	SQLWCHAR *owner = NULL;
 	SQLWCHAR *table_name = NULL;
-	SQLWCHAR *table_type = NULL;
+	int rc;
+	conn_handle *conn_res;
+	stmt_handle *stmt_res;
 	PyObject *py_qualifier = NULL;
 	PyObject *py_owner = NULL;
 	PyObject *py_table_name = NULL;
-	PyObject *py_table_type = NULL;
-	conn_handle *conn_res;
-	stmt_handle *stmt_res;
-	int rc;
 	int isNewBuffer;
 
-	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
-		&py_table_name, &py_table_type))
+	if (!PyArg_ParseTuple(args, "OOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name))
 		return NULL;
 
 	if (py_qualifier != NULL && py_qualifier != Py_None) {
@@ -4401,40 +5621,27 @@ static PyObject *ibm_db_tables(PyObject *self, PyObject *args)
 		}
 	}
 
-	if (py_table_type != NULL && py_table_type != Py_None) {
-		if (PyString_Check(py_table_type) || PyUnicode_Check(py_table_type)){
-			py_table_type = PyUnicode_FromObject(py_table_type);
-		}
-		else {
-			PyErr_SetString(PyExc_Exception, "table type must be a string or unicode");
-			Py_XDECREF(py_qualifier);
-			Py_XDECREF(py_owner);
-			Py_XDECREF(py_table_name);
-			return NULL;
-		}
-	}
-
-	if (!NIL_P(conn_res)) {
+	if (conn_res) {
 		if (!conn_res->handle_active) {
 			PyErr_SetString(PyExc_Exception, "Connection is not active");
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_table_type);
 			return NULL;
 		}
 
 		stmt_res = _ibm_db_new_stmt_struct(conn_res);
 
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
 		if (rc == SQL_ERROR) {
 			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
 				NULL, -1, 1);
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_table_type);
-			
+
 			Py_RETURN_FALSE;
 		}
 		if (py_qualifier && py_qualifier != Py_None )
@@ -4443,19 +5650,16 @@ static PyObject *ibm_db_tables(PyObject *self, PyObject *args)
 			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
 		if (py_table_name && py_table_name != Py_None )
 			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
-		if(py_table_type && py_table_type != Py_None)
-			table_type = getUnicodeDataAsSQLWCHAR(py_table_type, &isNewBuffer);
 
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLTablesW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, owner,
-			SQL_NTS, table_name, SQL_NTS, table_type, SQL_NTS);
+		Py_BEGIN_ALLOW_THREADS;	
+		rc = SQLPrimaryKeysW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS,
+			owner, SQL_NTS, table_name, SQL_NTS);
 		Py_END_ALLOW_THREADS;
 
 		if (isNewBuffer) {
 		    if(qualifier) PyMem_Del(qualifier);
 		    if(owner) PyMem_Del(owner);
 		    if(table_name) PyMem_Del(table_name);
-			if(table_type) PyMem_Del(table_type);
 		}
 		
 		if (rc == SQL_ERROR ) {
@@ -4464,1263 +5668,3517 @@ static PyObject *ibm_db_tables(PyObject *self, PyObject *args)
 			Py_XDECREF(py_qualifier);
 			Py_XDECREF(py_owner);
 			Py_XDECREF(py_table_name);
-			Py_XDECREF(py_table_type);
 
 			Py_RETURN_FALSE;
 		}
 		Py_XDECREF(py_qualifier);
 		Py_XDECREF(py_owner);
 		Py_XDECREF(py_table_name);
-		Py_XDECREF(py_table_type);
-		
-		return (PyObject *)stmt_res;
+
+		return (PyObject *)stmt_res;			 
+
 	} else {
 		Py_XDECREF(py_qualifier);
 		Py_XDECREF(py_owner);
 		Py_XDECREF(py_table_name);
-		Py_XDECREF(py_table_type);
 
 		Py_RETURN_FALSE;
 	}
 }
 
-/*!# ibm_db.commit
- * ===Description
- * bool ibm_db.commit ( resource connection )
+/*!# ibm_db.procedure_columns
  *
- * Commits an in-progress transaction on the specified connection resource and
- * begins a new transaction.
- * Python applications normally default to AUTOCOMMIT mode, so ibm_db.commit()
- * is not necessary unless AUTOCOMMIT has been turned off for the connection
- * resource.
+ * ===Description
+ * resource ibm_db.procedure_columns ( resource connection, string qualifier,
+ * string schema, string procedure, string parameter )
  *
- * Note: If the specified connection resource is a persistent connection, all
- * transactions in progress for all applications using that persistent
- * connection will be committed. For this reason, persistent connections are
- * not recommended for use in applications that require transactions.
+ * Returns a result set listing the parameters for one or more stored procedures
  *
  * ===Parameters
  *
  * ====connection
- *		A valid database connection resource variable as returned from
- * ibm_db.connect() or ibm_db.pconnect().
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
  *
- * ===Return Values
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
  *
- * Returns TRUE on success or FALSE on failure.
+ * ====schema
+ *		The schema which contains the procedures. This parameter accepts a
+ * search pattern containing _ and % as wildcards.
+ *
+ * ====procedure
+ *		The name of the procedure. This parameter accepts a search pattern
+ * containing _ and % as wildcards.
+ *
+ * ====parameter
+ *		The name of the parameter. This parameter accepts a search pattern
+ * containing _ and % as wildcards.
+ *		If this parameter is NULL, all parameters for the specified stored
+ * procedures are returned.
+ *
+ * ===Return Values
+ *
+ * Returns a statement resource with a result set containing rows describing the
+ * parameters for the stored procedures matching the specified parameters. The
+ * rows are composed of the following columns:
+ *
+ * Column name::	Description
+ * PROCEDURE_CAT:: The catalog that contains the procedure. The value is NULL
+ * if this table does not have catalogs.
+ * PROCEDURE_SCHEM:: Name of the schema that contains the stored procedure.
+ * PROCEDURE_NAME:: Name of the procedure.
+ * COLUMN_NAME:: Name of the parameter.
+ * COLUMN_TYPE:: An integer value representing the type of the parameter:
+ *					  Return value:: Parameter type
+ *					  1:: (SQL_PARAM_INPUT)	Input (IN) parameter.
+ *					  2:: (SQL_PARAM_INPUT_OUTPUT) Input/output (INOUT)
+ *						  parameter.
+ *					  3:: (SQL_PARAM_OUTPUT) Output (OUT) parameter.
+ * DATA_TYPE:: The SQL data type for the parameter represented as an integer
+ * value.
+ * TYPE_NAME:: A string representing the data type for the parameter.
+ * COLUMN_SIZE:: An integer value representing the size of the parameter.
+ * BUFFER_LENGTH:: Maximum number of bytes necessary to store data for this
+ * parameter.
+ * DECIMAL_DIGITS:: The scale of the parameter, or NULL where scale is not
+ * applicable.
+ * NUM_PREC_RADIX:: An integer value of either 10 (representing an exact numeric
+ * data type), 2 (representing anapproximate numeric data type), or NULL
+ * (representing a data type for which radix is not applicable).
+ * NULLABLE:: An integer value representing whether the parameter is nullable or
+ * not.
+ * REMARKS:: Description of the parameter.
+ * COLUMN_DEF:: Default value for the parameter.
+ * SQL_DATA_TYPE:: An integer value representing the size of the parameter.
+ * SQL_DATETIME_SUB:: Returns an integer value representing a datetime subtype
+ * code, or NULL for SQL data types to which this does not apply.
+ * CHAR_OCTET_LENGTH:: Maximum length in octets for a character data type
+ * parameter, which matches COLUMN_SIZE for single-byte character set data, or
+ * NULL for non-character data types.
+ * ORDINAL_POSITION:: The 1-indexed position of the parameter in the CALL
+ * statement.
+ * IS_NULLABLE:: A string value where 'YES' means that the parameter accepts or
+ * returns NULL values and 'NO' means that the parameter does not accept or
+ * return NULL values.
  */
-static PyObject *ibm_db_commit(PyObject *self, PyObject *args)			
+static PyObject *ibm_db_procedure_columns(PyObject *self, PyObject *args)
 {
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *proc_name = NULL;
+	SQLWCHAR *column_name = NULL;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_proc_name = NULL;
+	PyObject *py_column_name = NULL;
+	int rc = 0;
 	conn_handle *conn_res;
-	int rc;
+	stmt_handle *stmt_res;
+	int isNewBuffer;
 
-	if (!PyArg_ParseTuple(args, "O", &conn_res))
+	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_proc_name, &py_column_name))
 		return NULL;
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
 			return NULL;
 		}
+	}
 
-		rc = SQLEndTran(SQL_HANDLE_DBC, conn_res->hdbc, SQL_COMMIT);
-
-		if ( rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
-											 NULL, -1, 1);
-			Py_INCREF(Py_False);
-			return Py_False;
-		} else {
-			Py_INCREF(Py_True);
-			return Py_True;
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			return NULL;
 		}
 	}
-	Py_INCREF(Py_False);
-	return Py_False;
-}
-
-/* static int _python_ibm_db_do_prepare(SQLHANDLE hdbc, char *stmt_string, stmt_handle *stmt_res, PyObject *options)
-*/
-static int _python_ibm_db_do_prepare(SQLHANDLE hdbc, SQLWCHAR *stmt, int stmt_size, stmt_handle *stmt_res, PyObject *options)
-{
-	int rc;
 
-	/* alloc handle and return only if it errors */
-	rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &(stmt_res->hstmt));
-	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-										1, NULL, -1, 1);
-		return rc;
+	if (py_proc_name != NULL && py_proc_name != Py_None) {
+		if (PyString_Check(py_proc_name) || PyUnicode_Check(py_proc_name)){
+			py_proc_name = PyUnicode_FromObject(py_proc_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			return NULL;
+		}
 	}
 
-	/* get the string and its length */
-	if (NIL_P(stmt)) {
-		PyErr_SetString(PyExc_Exception, 
-			"Supplied statement parameter is invalid");
-		return rc;
+	if (py_column_name != NULL && py_column_name != Py_None) {
+		if (PyString_Check(py_column_name) || PyUnicode_Check(py_column_name)){
+			py_column_name = PyUnicode_FromObject(py_column_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "column_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
+			return NULL;
+		}
 	}
 
-	if ( rc < SQL_SUCCESS ) {
-		_python_ibm_db_check_sql_errors(hdbc, SQL_HANDLE_DBC, rc, 1, NULL, -1, 1);
-		PyErr_SetString(PyExc_Exception, "Statement prepare Failed: ");
-		return rc;
-	}
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
+			Py_XDECREF(py_column_name);
+			return NULL;
+		}
 
-	if (!NIL_P(options)) {
-		rc = _python_ibm_db_parse_options( options, SQL_HANDLE_STMT, stmt_res );
-		if ( rc == SQL_ERROR ) {
-			return rc;
+		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+		if (rc == SQL_ERROR) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+				NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
+			Py_XDECREF(py_column_name);
+
+			Py_RETURN_FALSE;
 		}
-	}
+		if (py_qualifier && py_qualifier != Py_None )
+			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
+		if (py_owner &&  py_owner != Py_None )
+			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
+		if (py_proc_name && py_proc_name != Py_None )
+			proc_name = getUnicodeDataAsSQLWCHAR(py_proc_name, &isNewBuffer);
+		if (py_column_name && py_column_name != Py_None )
+			column_name = getUnicodeDataAsSQLWCHAR(py_column_name, &isNewBuffer);
 
-	/* Prepare the stmt. The cursor type requested has already been set in 
-	* _python_ibm_db_assign_options 
-	*/
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLProcedureColumnsW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, 
+			owner, SQL_NTS, proc_name, SQL_NTS, column_name, 
+			SQL_NTS);
+		Py_END_ALLOW_THREADS;
 
-	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLPrepareW((SQLHSTMT)stmt_res->hstmt, stmt, 
-				stmt_size);
-	Py_END_ALLOW_THREADS;
+		if (isNewBuffer) {
+		    if(qualifier) PyMem_Del(qualifier);
+		    if(owner) PyMem_Del(owner);
+		    if(proc_name) PyMem_Del(proc_name);
+			if(column_name) PyMem_Del(column_name);
+		}
+		
+		if (rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+				1, NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
+			Py_XDECREF(py_column_name);
 
-	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
-										1, NULL, -1, 1);
+			Py_RETURN_FALSE;
+		}
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_proc_name);
+		Py_XDECREF(py_column_name);
+
+		return (PyObject *)stmt_res;			
+	} else {
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_proc_name);
+		Py_XDECREF(py_column_name);
+
+		Py_RETURN_FALSE;
 	}
-	return rc;
 }
 
-/*!# ibm_db.exec
+/*!# ibm_db.procedures
  *
  * ===Description
- * stmt_handle ibm_db.exec ( IBM_DBConnection connection, string statement
- *								[, array options] )
- *
- * Prepares and executes an SQL statement.
- *
- * If you plan to interpolate Python variables into the SQL statement,
- * understand that this is one of the more common security exposures. Consider
- * calling ibm_db.prepare() to prepare an SQL statement with parameter markers	* for input values. Then you can call ibm_db.execute() to pass in the input
- * values and avoid SQL injection attacks.
+ * resource ibm_db.procedures ( resource connection, string qualifier,
+ * string schema, string procedure )
  *
- * If you plan to repeatedly issue the same SQL statement with different
- * parameters, consider calling ibm_db.:prepare() and ibm_db.execute() to
- * enable the database server to reuse its access plan and increase the
- * efficiency of your database access.
+ * Returns a result set listing the stored procedures registered in a database.
  *
  * ===Parameters
  *
  * ====connection
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
  *
- *		A valid database connection resource variable as returned from
- * ibm_db.connect() or ibm_db.pconnect().
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
  *
- * ====statement
- *
- *		An SQL statement. The statement cannot contain any parameter markers.
- *
- * ====options
- *
- *		An dictionary containing statement options. You can use this parameter  * to request a scrollable cursor on database servers that support this
- * functionality.
- *
- *		SQL_ATTR_CURSOR_TYPE
- *			 Passing the SQL_SCROLL_FORWARD_ONLY value requests a forward-only
- *			 cursor for this SQL statement. This is the default type of
- *			 cursor, and it is supported by all database servers. It is also
- *			 much faster than a scrollable cursor.
+ * ====schema
+ *		The schema which contains the procedures. This parameter accepts a
+ * search pattern containing _ and % as wildcards.
  *
- *			 Passing the SQL_CURSOR_KEYSET_DRIVEN value requests a scrollable  *			 cursor for this SQL statement. This type of cursor enables you to
- *			 fetch rows non-sequentially from the database server. However, it
- *			 is only supported by DB2 servers, and is much slower than
- *			 forward-only cursors.
+ * ====procedure
+ *		The name of the procedure. This parameter accepts a search pattern
+ * containing _ and % as wildcards.
  *
  * ===Return Values
  *
- * Returns a stmt_handle resource if the SQL statement was issued
- * successfully, or FALSE if the database failed to execute the SQL statement.
+ * Returns a statement resource with a result set containing rows describing the
+ * stored procedures matching the specified parameters. The rows are composed of
+ * the following columns:
+ *
+ * Column name:: Description
+ * PROCEDURE_CAT:: The catalog that contains the procedure. The value is NULL if
+ * this table does not have catalogs.
+ * PROCEDURE_SCHEM:: Name of the schema that contains the stored procedure.
+ * PROCEDURE_NAME:: Name of the procedure.
+ * NUM_INPUT_PARAMS:: Number of input (IN) parameters for the stored procedure.
+ * NUM_OUTPUT_PARAMS:: Number of output (OUT) parameters for the stored
+ * procedure.
+ * NUM_RESULT_SETS:: Number of result sets returned by the stored procedure.
+ * REMARKS:: Any comments about the stored procedure.
+ * PROCEDURE_TYPE:: Always returns 1, indicating that the stored procedure does
+ * not return a return value.
  */
-static PyObject *ibm_db_exec(PyObject *self, PyObject *args)			
+static PyObject *ibm_db_procedures(PyObject *self, PyObject *args)			
 {
-	PyObject *options = NULL;
-	stmt_handle *stmt_res;
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *proc_name = NULL;
+	int rc = 0;
 	conn_handle *conn_res;
-	int rc;
+	stmt_handle *stmt_res;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_proc_name = NULL;
 	int isNewBuffer;
-	char* return_str = NULL; /* This variable is used by 
-							 * _python_ibm_db_check_sql_errors to return err 
-							 * strings 
-							 */
-	SQLWCHAR *stmt = NULL;
-	PyObject *py_stmt = NULL;
-
-	/* This function basically is a wrap of the _python_ibm_db_do_prepare and 
-	* _python_ibm_db_Execute_stmt 
-	* After completing statement execution, it returns the statement resource 
-	*/
 
-	if (!PyArg_ParseTuple(args, "OO|O", &conn_res, &py_stmt,  &options))
+	if (!PyArg_ParseTuple(args, "OOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_proc_name))
 		return NULL;
 
-	if (py_stmt != NULL && py_stmt != Py_None) {
-		if (PyString_Check(py_stmt) || PyUnicode_Check(py_stmt)){
-			py_stmt = PyUnicode_FromObject(py_stmt);
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
 		}
 		else {
-			PyErr_SetString(PyExc_Exception, "statement must be a string or unicode");
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
 			return NULL;
 		}
 	}
 
-	if (!NIL_P(conn_res)) {
-		if (!conn_res->handle_active) {
-			PyErr_SetString(PyExc_Exception, "Connection is not active");
-			Py_XDECREF(py_stmt);
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
+			Py_XDECREF(py_qualifier);
 			return NULL;
 		}
+	}
 
-		return_str = ALLOC_N(char, DB2_MAX_ERR_MSG_LEN);
-		if ( return_str == NULL ) {
-			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-			Py_XDECREF(py_stmt);
+	if (py_proc_name != NULL && py_proc_name != Py_None) {
+		if (PyString_Check(py_proc_name) || PyUnicode_Check(py_proc_name)){
+			py_proc_name = PyUnicode_FromObject(py_proc_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
 			return NULL;
 		}
+	}
 
-		memset(return_str, 0, DB2_MAX_ERR_MSG_LEN);
 
-		_python_ibm_db_clear_stmt_err_cache();
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
+			return NULL;
+		}
 
 		stmt_res = _ibm_db_new_stmt_struct(conn_res);
 
-		/* Allocates the stmt handle */
-		/* returns the stat_handle back to the calling function */
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
-		if ( rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1,
+		Py_END_ALLOW_THREADS;
+		if (rc == SQL_ERROR) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
 				NULL, -1, 1);
-			PyMem_Del(return_str);
-			Py_XDECREF(py_stmt);
-			return NULL;
-		}
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
 
-		if (!NIL_P(options)) {
-			rc = _python_ibm_db_parse_options(options, SQL_HANDLE_STMT, stmt_res);
-			if ( rc == SQL_ERROR ) {
-				Py_XDECREF(py_stmt);
-				return NULL;
-			}
+			Py_RETURN_FALSE;
 		}
-		if (py_stmt != NULL && py_stmt != Py_None){
-			stmt = getUnicodeDataAsSQLWCHAR(py_stmt, &isNewBuffer);
-     		}
+		if (py_qualifier && py_qualifier != Py_None )
+			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
+		if (py_owner &&  py_owner != Py_None )
+			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
+		if (py_proc_name && py_proc_name != Py_None )
+			proc_name = getUnicodeDataAsSQLWCHAR(py_proc_name, &isNewBuffer);
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLExecDirectW((SQLHSTMT)stmt_res->hstmt, stmt, SQL_NTS);
+		rc = SQLProceduresW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, owner,
+			SQL_NTS, proc_name, SQL_NTS);
 		Py_END_ALLOW_THREADS;
 
-		if ( rc < SQL_SUCCESS ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, -1, 
-				1, return_str, DB2_ERRMSG, 
-				stmt_res->errormsg_recno_tracker);
-			SQLFreeHandle( SQL_HANDLE_STMT, stmt_res->hstmt );
-			/* TODO: Object freeing */
-			/* free(stmt_res); */
-			if (isNewBuffer) {
-				if(stmt) PyMem_Del(stmt);
-			}
-			Py_XDECREF(py_stmt);
-			PyMem_Del(return_str);
-			return NULL;
-		}
 		if (isNewBuffer) {
-			if(stmt) PyMem_Del(stmt);
-		}	
-		PyMem_Del(return_str);
-		Py_XDECREF(py_stmt);
-		return (PyObject *)stmt_res;				 
+		    if(qualifier) PyMem_Del(qualifier);
+		    if(owner) PyMem_Del(owner);
+		    if(proc_name) PyMem_Del(proc_name);
+		}
+		
+		if (rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+				1, NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_proc_name);
+
+			Py_RETURN_FALSE;
+		}
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_proc_name);
+		return (PyObject *)stmt_res;				
+	} else {
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_proc_name);
+
+		Py_RETURN_FALSE;
 	}
-	Py_XDECREF(py_stmt);
-	return NULL;
 }
 
-/*!# ibm_db.free_result
+/*!# ibm_db.special_columns
  *
  * ===Description
- * bool ibm_db.free_result ( resource stmt )
+ * resource ibm_db.special_columns ( resource connection, string qualifier,
+ * string schema, string table_name, int scope )
  *
- * Frees the system and database resources that are associated with a result
- * set. These resources are freed implicitly when a script finishes, but you
- * can call ibm_db.free_result() to explicitly free the result set resources
- * before the end of the script.
+ * Returns a result set listing the unique row identifier columns for a table.
  *
  * ===Parameters
  *
- * ====stmt
- *		A valid statement resource.
+ * ====connection
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
  *
- * ===Return Values
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
  *
- * Returns TRUE on success or FALSE on failure.
- */
-static PyObject *ibm_db_free_result(PyObject *self, PyObject *args)
-{
-	stmt_handle *stmt_res;
-	int rc = 0;
-
-	if (!PyArg_ParseTuple(args, "O", &stmt_res))
-		return NULL;
-
-	if (!NIL_P(stmt_res)) {
-		if ( stmt_res->hstmt ) {
-			/* Free any cursors that might have been allocated in a previous call 
-			* to SQLExecute 
-			*/
-			Py_BEGIN_ALLOW_THREADS;
-			SQLFreeStmt((SQLHSTMT)stmt_res->hstmt, SQL_CLOSE);
-			Py_END_ALLOW_THREADS;
-
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-												rc, 1, NULL, -1, 1);
-			}
-		}
-		_python_ibm_db_free_result_struct(stmt_res);
-	} else {
-		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
-		Py_INCREF(Py_False);
-		return Py_False;
-	}
-	Py_INCREF(Py_True);
-	return Py_True;
-}
-
-/*
- * static PyObject *_python_ibm_db_prepare_helper(conn_handle *conn_res, PyObject *py_stmt, PyObject *options)
+ * ====schema
+ *		The schema which contains the tables.
  *
- */
-static PyObject *_python_ibm_db_prepare_helper(conn_handle *conn_res, PyObject *py_stmt, PyObject *options)
-{
-	stmt_handle *stmt_res;
-	int rc;
-	char error[DB2_MAX_ERR_MSG_LEN];
-	SQLWCHAR *stmt = NULL;
-	int stmt_size = 0;
-	int isNewBuffer;
-
-	if (!conn_res->handle_active) {
-		PyErr_SetString(PyExc_Exception, "Connection is not active");
+ * ====table_name
+ *		The name of the table.
+ *
+ * ====scope
+ *		Integer value representing the minimum duration for which the unique
+ * row identifier is valid. This can be one of the following values:
+ *
+ *		0: Row identifier is valid only while the cursor is positioned on the
+ * row. (SQL_SCOPE_CURROW)
+ *		1: Row identifier is valid for the duration of the transaction.
+ * (SQL_SCOPE_TRANSACTION)
+ *		2: Row identifier is valid for the duration of the connection.
+ * (SQL_SCOPE_SESSION)
+ *
+ * ===Return Values
+ *
+ * Returns a statement resource with a result set containing rows with unique
+ * row identifier information for a table.
+ * The rows are composed of the following columns:
+ *
+ * Column name:: Description
+ *
+ * SCOPE:: Integer value representing the minimum duration for which the unique
+ * row identifier is valid.
+ *
+ *			 0: Row identifier is valid only while the cursor is positioned on
+ * the row. (SQL_SCOPE_CURROW)
+ *
+ *			 1: Row identifier is valid for the duration of the transaction.
+ * (SQL_SCOPE_TRANSACTION)
+ *
+ *			 2: Row identifier is valid for the duration of the connection.
+ * (SQL_SCOPE_SESSION)
+ *
+ * COLUMN_NAME:: Name of the unique column.
+ *
+ * DATA_TYPE:: SQL data type for the column.
+ *
+ * TYPE_NAME:: Character string representation of the SQL data type for the
+ * column.
+ *
+ * COLUMN_SIZE:: An integer value representing the size of the column.
+ *
+ * BUFFER_LENGTH:: Maximum number of bytes necessary to store data from this
+ * column.
+ *
+ * DECIMAL_DIGITS:: The scale of the column, or NULL where scale is not
+ * applicable.
+ *
+ * NUM_PREC_RADIX:: An integer value of either 10 (representing an exact numeric
+ * data type), 2 (representing an approximate numeric data type), or NULL
+ * (representing a data type for which radix is not applicable).
+ *
+ * PSEUDO_COLUMN:: Always returns 1.
+ */
+static PyObject *ibm_db_special_columns(PyObject *self, PyObject *args)
+{
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *table_name = NULL;
+	int scope = 0;
+	conn_handle *conn_res;
+	stmt_handle *stmt_res;
+	int rc;
+	PyObject *py_scope = NULL;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_table_name = NULL;
+	int isNewBuffer;
+
+	if (!PyArg_ParseTuple(args, "OOOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name, &py_scope))
 		return NULL;
+	if (!NIL_P(py_scope)) {
+		if (PyInt_Check(py_scope)) {
+			scope = (int) PyInt_AsLong(py_scope);
+		} else {
+			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+			return NULL;
+		}
+	}
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+			return NULL;
+		}
 	}
 
-	if (py_stmt != NULL && py_stmt != Py_None) {
-		if (PyString_Check(py_stmt) || PyUnicode_Check(py_stmt)) {
-			py_stmt = PyUnicode_FromObject(py_stmt);
-			if (py_stmt != NULL &&  py_stmt != Py_None) {
-				stmt_size = PyUnicode_GetSize(py_stmt);
-			} else {
-				PyErr_SetString(PyExc_Exception, "Error occure during processing of statement");
-				return NULL;	
-			}
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
 		}
 		else {
-			PyErr_SetString(PyExc_Exception, "statement must be a string or unicode");
+			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
+			Py_XDECREF(py_qualifier);
 			return NULL;
 		}
 	}
 
-	_python_ibm_db_clear_stmt_err_cache();
+	if (py_table_name != NULL && py_table_name != Py_None) {
+		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
+			py_table_name = PyUnicode_FromObject(py_table_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			return NULL;
+		}
+	}
 
-	/* Initialize stmt resource members with default values. */
-	/* Parsing will update options if needed */
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			return NULL;
+		}
 
-	stmt_res = _ibm_db_new_stmt_struct(conn_res);
+		stmt_res = _ibm_db_new_stmt_struct(conn_res);
 
-	/* Allocates the stmt handle */
-	/* Prepares the statement */
-	/* returns the stat_handle back to the calling function */
-	if( py_stmt && py_stmt != Py_None)
-		stmt = getUnicodeDataAsSQLWCHAR(py_stmt, &isNewBuffer);
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+		if (rc == SQL_ERROR) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+				NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+
+			Py_RETURN_FALSE;
+		}
+		if (py_qualifier && py_qualifier != Py_None )
+			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
+		if (py_owner &&  py_owner != Py_None )
+			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
+		if (py_table_name && py_table_name != Py_None )
+			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLSpecialColumnsW((SQLHSTMT)stmt_res->hstmt, SQL_BEST_ROWID, 
+			qualifier, SQL_NTS, owner, SQL_NTS, table_name,
+			SQL_NTS, scope, SQL_NULLABLE);
+		Py_END_ALLOW_THREADS;
+
+		if (isNewBuffer) {
+		    if(qualifier) PyMem_Del(qualifier);
+		    if(owner) PyMem_Del(owner);
+		    if(table_name) PyMem_Del(table_name);	
+		}
 		
-	rc = _python_ibm_db_do_prepare(conn_res->hdbc, stmt, stmt_size, stmt_res, options);
-	if (isNewBuffer) {
-		if(stmt) PyMem_Del(stmt);
-	}
-	
-	if ( rc < SQL_SUCCESS ) {
-		sprintf(error, "Statement Prepare Failed: %s", IBM_DB_G(__python_stmt_err_msg));
-		Py_XDECREF(py_stmt);
-		return NULL;
+		if (rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+				1, NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+
+			Py_RETURN_FALSE;
+		}
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
+
+		return (PyObject *)stmt_res;
+	} else {
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
+
+		Py_RETURN_FALSE;
+
 	}
-	Py_XDECREF(py_stmt);
-	return (PyObject *)stmt_res;		
 }
 
-/*!# ibm_db.prepare
+/*!# ibm_db.statistics
  *
  * ===Description
- * IBMDB_Statement ibm_db.prepare ( IBM_DBConnection connection,
- *								  string statement [, array options] )
- *
- * ibm_db.prepare() creates a prepared SQL statement which can include 0 or
- * more parameter markers (? characters) representing parameters for input,
- * output, or input/output. You can pass parameters to the prepared statement
- * using ibm_db.bind_param(), or for input values only, as an array passed to
- * ibm_db.execute().
+ * resource ibm_db.statistics ( resource connection, string qualifier,
+ * string schema, string table-name, bool unique )
  *
- * There are three main advantages to using prepared statements in your
- * application:
- *		* Performance: when you prepare a statement, the database server
- *		 creates an optimized access plan for retrieving data with that
- *		 statement. Subsequently issuing the prepared statement with
- *		 ibm_db.execute() enables the statements to reuse that access plan
- *		 and avoids the overhead of dynamically creating a new access plan
- *		 for every statement you issue.
- *		* Security: when you prepare a statement, you can include parameter
- *		 markers for input values. When you execute a prepared statement
- *		 with input values for placeholders, the database server checks each
- *		 input value to ensure that the type matches the column definition or
- *		 parameter definition.
- *		* Advanced functionality: Parameter markers not only enable you to
- *		 pass input values to prepared SQL statements, they also enable you
- *		 to retrieve OUT and INOUT parameters from stored procedures using
- *		 ibm_db.bind_param().
+ * Returns a result set listing the index and statistics for a table.
  *
  * ===Parameters
+ *
  * ====connection
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
  *
- *		A valid database connection resource variable as returned from
- *		ibm_db.connect() or ibm_db.pconnect().
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
  *
- * ====statement
+ * ====schema
+ *		The schema that contains the targeted table. If this parameter is NULL,
+ * the statistics and indexes are returned for the schema of the current user.
  *
- *		An SQL statement, optionally containing one or more parameter markers.
+ * ====table_name
+ *		The name of the table.
  *
- * ====options
+ * ====unique
+ *		A boolean value representing the type of index information to return.
  *
- *		An dictionary containing statement options. You can use this parameter
- *		to request a scrollable cursor on database servers that support this
- *		functionality.
+ *		False	 Return only the information for unique indexes on the table.
  *
- *		SQL_ATTR_CURSOR_TYPE
- *			 Passing the SQL_SCROLL_FORWARD_ONLY value requests a forward-only
- *			 cursor for this SQL statement. This is the default type of
- *			 cursor, and it is supported by all database servers. It is also
- *			 much faster than a scrollable cursor.
- *			 Passing the SQL_CURSOR_KEYSET_DRIVEN value requests a scrollable  
- *			 cursor for this SQL statement. This type of cursor enables you
- *			 to fetch rows non-sequentially from the database server. However, 
- *			 it is only supported by DB2 servers, and is much slower than
- *			 forward-only cursors.
+ *		True	  Return the information for all indexes on the table.
  *
  * ===Return Values
- * Returns a IBM_DBStatement object if the SQL statement was successfully
- * parsed and prepared by the database server. Returns FALSE if the database
- * server returned an error. You can determine which error was returned by
- * calling ibm_db.stmt_error() or ibm_db.stmt_errormsg().
- */					 
-static PyObject *ibm_db_prepare(PyObject *self, PyObject *args)			
+ *
+ * Returns a statement resource with a result set containing rows describing the
+ * statistics and indexes for the base tables matching the specified parameters.
+ * The rows are composed of the following columns:
+ *
+ * Column name:: Description
+ * TABLE_CAT:: The catalog that contains the table. The value is NULL if this
+ * table does not have catalogs.
+ * TABLE_SCHEM:: Name of the schema that contains the table.
+ * TABLE_NAME:: Name of the table.
+ * NON_UNIQUE:: An integer value representing whether the index prohibits unique
+ * values, or whether the row represents statistics on the table itself:
+ *
+ *					 Return value:: Parameter type
+ *					 0 (SQL_FALSE):: The index allows duplicate values.
+ *					 1 (SQL_TRUE):: The index values must be unique.
+ *					 NULL:: This row is statistics information for the table
+ *					 itself.
+ *
+ * INDEX_QUALIFIER:: A string value representing the qualifier that would have
+ * to be prepended to INDEX_NAME to fully qualify the index.
+ * INDEX_NAME:: A string representing the name of the index.
+ * TYPE:: An integer value representing the type of information contained in
+ * this row of the result set:
+ *
+ *			Return value:: Parameter type
+ *			0 (SQL_TABLE_STAT):: The row contains statistics about the table
+ *								 itself.
+ *			1 (SQL_INDEX_CLUSTERED):: The row contains information about a
+ *									  clustered index.
+ *			2 (SQL_INDEX_HASH):: The row contains information about a hashed
+ *								 index.
+ *			3 (SQL_INDEX_OTHER):: The row contains information about a type of
+ * index that is neither clustered nor hashed.
+ *
+ * ORDINAL_POSITION:: The 1-indexed position of the column in the index. NULL if
+ * the row contains statistics information about the table itself.
+ * COLUMN_NAME:: The name of the column in the index. NULL if the row contains
+ * statistics information about the table itself.
+ * ASC_OR_DESC:: A if the column is sorted in ascending order, D if the column
+ * is sorted in descending order, NULL if the row contains statistics
+ * information about the table itself.
+ * CARDINALITY:: If the row contains information about an index, this column
+ * contains an integer value representing the number of unique values in the
+ * index. If the row contains information about the table itself, this column
+ * contains an integer value representing the number of rows in the table.
+ * PAGES:: If the row contains information about an index, this column contains
+ * an integer value representing the number of pages used to store the index. If
+ * the row contains information about the table itself, this column contains an
+ * integer value representing the number of pages used to store the table.
+ * FILTER_CONDITION:: Always returns NULL.
+ */ 
+static PyObject *ibm_db_statistics(PyObject *self, PyObject *args)
 {
-	PyObject *options = NULL;
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *table_name = NULL;
+	int unique = 0;
+	int rc = 0;
+	SQLUSMALLINT sql_unique;
 	conn_handle *conn_res;
-	
-	PyObject *py_stmt = NULL;
-	
-	if (!PyArg_ParseTuple(args, "OO|O", &conn_res, &py_stmt, &options))
+	stmt_handle *stmt_res;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_table_name = NULL;
+	PyObject *py_unique = NULL;
+	int isNewBuffer;
+
+	if (!PyArg_ParseTuple(args, "OOOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name, &py_unique))
 		return NULL;
 
-	if (!NIL_P(conn_res)) {
-		return _python_ibm_db_prepare_helper(conn_res, py_stmt, options);	 
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+			return NULL;
+		}
 	}
 
-	return NULL;
-}
-
-/*	static param_node* build_list( stmt_res, param_no, data_type, precision, scale, nullable )
-*/
-static param_node* build_list( stmt_handle *stmt_res, int param_no, SQLSMALLINT data_type, SQLUINTEGER precision, SQLSMALLINT scale, SQLSMALLINT nullable )
-{
-	param_node *tmp_curr = NULL, *curr = stmt_res->head_cache_list, *prev = NULL;
-
-	/* Allocate memory and make new node to be added */
-	tmp_curr = ALLOC(param_node);
-	memset(tmp_curr, 0, sizeof(param_node));
-	/* assign values */
-	tmp_curr->data_type = data_type;
-	tmp_curr->param_size = precision;
-	tmp_curr->nullable = nullable;
-	tmp_curr->scale = scale;
-	tmp_curr->param_num = param_no;
-	tmp_curr->file_options = SQL_FILE_READ;
-	tmp_curr->param_type = SQL_PARAM_INPUT;
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			return NULL;
+		}
+	}
 
-	while ( curr != NULL ) {
-		prev = curr;
-		curr = curr->next;
+	if (py_table_name != NULL && py_table_name != Py_None) {
+		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
+			py_table_name = PyUnicode_FromObject(py_table_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			return NULL;
+		}
 	}
 
-	if (stmt_res->head_cache_list == NULL) {
-		stmt_res->head_cache_list = tmp_curr;
-	} else {
-		prev->next = tmp_curr;
+	if (py_unique != NULL && py_unique != Py_None) {
+		if (PyBool_Check(py_unique)) {
+			if (py_unique == Py_True)
+				unique = 1;
+			else
+				unique = 0;
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "unique must be a boolean");
+			return NULL;
+		}
 	}
 
-	tmp_curr->next = curr;
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			return NULL;
+		}
+
+		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+		sql_unique = unique;
 
-	return tmp_curr;
-}
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+		if (rc == SQL_ERROR) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+				NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
 
-/*	static int _python_ibm_db_bind_data( stmt_handle *stmt_res, param_node *curr, PyObject *bind_data )
-*/
-static int _python_ibm_db_bind_data( stmt_handle *stmt_res, param_node *curr, PyObject *bind_data)
-{
-	int rc;
-	SQLSMALLINT valueType = 0;
-	SQLPOINTER	paramValuePtr;
-	Py_ssize_t buffer_len = 0;
-	int param_length;
-	
-	/* Have to use SQLBindFileToParam if PARAM is type PARAM_FILE */
-	if ( curr->param_type == PARAM_FILE) {
-		/* Only string types can be bound */
-		if (!PyString_Check(bind_data)) {
-			return SQL_ERROR;
-		}
-		curr->bind_indicator = 0;
-		if(curr->svalue != NULL) {
-			PyMem_Del(curr->svalue);
-			curr->svalue = NULL;
+			Py_RETURN_FALSE;
 		}
-		curr->svalue = PyString_AsString(bind_data);
-		curr->ivalue = strlen(curr->svalue);
-		valueType = (SQLSMALLINT) curr->ivalue;
-		/* Bind file name string */
+		if (py_qualifier && py_qualifier != Py_None )
+			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
+		if (py_owner &&  py_owner != Py_None )
+			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
+		if (py_table_name && py_table_name != Py_None )
+			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
 
 		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLBindFileToParam((SQLHSTMT)stmt_res->hstmt, curr->param_num,
-					curr->data_type, (SQLCHAR*)curr->svalue,
-					(SQLSMALLINT*)&(curr->ivalue), &(curr->file_options), 
-					(SQLSMALLINT) curr->ivalue, &(curr->bind_indicator));
+		rc = SQLStatisticsW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, owner,
+			SQL_NTS, table_name, SQL_NTS, sql_unique, SQL_QUICK);
 		Py_END_ALLOW_THREADS;
 
-		if ( rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-											 rc, 1, NULL, -1, 1);
+		if (isNewBuffer) {
+		    if(qualifier) PyMem_Del(qualifier);
+		    if(owner) PyMem_Del(owner);
+		    if(table_name) PyMem_Del(table_name);
 		}
-		return rc;
-	}
-	
-	switch(TYPE(bind_data)) {
-		case PYTHON_FIXNUM:
-			if(curr->data_type == SQL_BIGINT || curr->data_type == SQL_DECIMAL ){
-				PyObject *tempobj = NULL;
-				tempobj = PyObject_Str(bind_data);
-				curr->svalue = PyString_AsString(tempobj);
-				curr->ivalue = strlen(curr->svalue);
-				curr->svalue = memcpy(PyMem_Malloc((sizeof(char))*(curr->ivalue+1)), curr->svalue, curr->ivalue);
-				curr->svalue[curr->ivalue] = '\0'; 
-				curr->bind_indicator = curr->ivalue;
-
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
-					curr->param_type, SQL_C_CHAR, curr->data_type,
-					curr->param_size, curr->scale, curr->svalue, curr->param_size, NULL);
-				Py_END_ALLOW_THREADS;
+		
+		if (rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+				1, NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
 
-				if ( rc == SQL_ERROR ){
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-												rc, 1, NULL, -1, 1);
-				}
-				Py_XDECREF(tempobj);
-			}
-			else{
-				curr->ivalue = (SQLINTEGER) PyLong_AsLong(bind_data);
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
-							curr->param_type, SQL_C_LONG, curr->data_type,
-							curr->param_size, curr->scale, &curr->ivalue, 0, NULL);
-				Py_END_ALLOW_THREADS;
+			Py_RETURN_FALSE;
+		}
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-												rc, 1, NULL, -1, 1);
-				}
-				curr->data_type = SQL_C_LONG;
-			}
-			break;
+		return (PyObject *)stmt_res;
+	} else {
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
 
-		/* Convert BOOLEAN types to LONG for DB2 / Cloudscape */
-		case PYTHON_FALSE:
-			curr->ivalue = 0;
+		Py_RETURN_FALSE;
+	}
+}
 
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+/*!# ibm_db.table_privileges
+ *
+ * ===Description
+ * resource ibm_db.table_privileges ( resource connection [, string qualifier
+ * [, string schema [, string table_name]]] )
+ *
+ * Returns a result set listing the tables and associated privileges in a
+ * database.
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ *
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
+ *
+ * ====schema
+ *		The schema which contains the tables. This parameter accepts a search
+ * pattern containing _ and % as wildcards.
+ *
+ * ====table_name
+ *		The name of the table. This parameter accepts a search pattern
+ * containing _ and % as wildcards.
+ *
+ * ===Return Values
+ *
+ * Returns a statement resource with a result set containing rows describing
+ * the privileges for the tables that match the specified parameters. The rows
+ * are composed of the following columns:
+ *
+ * Column name:: Description
+ * TABLE_CAT:: The catalog that contains the table. The value is NULL if this
+ * table does not have catalogs.
+ * TABLE_SCHEM:: Name of the schema that contains the table.
+ * TABLE_NAME:: Name of the table.
+ * GRANTOR:: Authorization ID of the user who granted the privilege.
+ * GRANTEE:: Authorization ID of the user to whom the privilege was granted.
+ * PRIVILEGE:: The privilege that has been granted. This can be one of ALTER,
+ * CONTROL, DELETE, INDEX, INSERT, REFERENCES, SELECT, or UPDATE.
+ * IS_GRANTABLE:: A string value of "YES" or "NO" indicating whether the grantee
+ * can grant the privilege to other users.
+ */
+static PyObject *ibm_db_table_privileges(PyObject *self, PyObject *args)
+{
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *table_name = NULL;
+	conn_handle *conn_res;
+	stmt_handle *stmt_res;
+	int rc;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_table_name = NULL;
+	int isNewBuffer;
+
+	if (!PyArg_ParseTuple(args, "O|OOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name))
+		return NULL;
+
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+			return NULL;
+		}
+	}
+
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			return NULL;
+		}
+	}
+
+	if (py_table_name != NULL && py_table_name != Py_None) {
+		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
+			py_table_name = PyUnicode_FromObject(py_table_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			return NULL;
+		}
+	}
+
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			return NULL;
+		}
+
+		if (!conn_res) {
+			PyErr_SetString(PyExc_Exception,"Connection Resource cannot be found");
+			Py_RETURN_FALSE;
+		}
+
+		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+		if (rc == SQL_ERROR) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+				NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+
+			Py_RETURN_FALSE;
+		}
+		if (py_qualifier && py_qualifier != Py_None )
+			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
+		if (py_owner &&  py_owner != Py_None )
+			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
+		if (py_table_name && py_table_name != Py_None )
+			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLTablePrivilegesW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, 
+			owner, SQL_NTS, table_name, SQL_NTS);
+		Py_END_ALLOW_THREADS;
+
+		if (isNewBuffer) {
+		    if(qualifier) PyMem_Del(qualifier);
+		    if(owner) PyMem_Del(owner);
+		    if(table_name) PyMem_Del(table_name);
+		}
+		
+		if (rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+				1, NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+
+			Py_RETURN_FALSE;
+		}
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
+
+		return (PyObject *)stmt_res;
+	} else {
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
+
+		Py_RETURN_FALSE;
+	}
+}
+
+/*!# ibm_db.tables
+ *
+ * ===Description
+ * resource ibm_db.tables ( resource connection [, string qualifier [, string
+ * schema [, string table-name [, string table-type]]]] )
+ *
+ * Returns a result set listing the tables and associated metadata in a database
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *		A valid connection to an IBM DB2, Cloudscape, or Apache Derby database.
+ *
+ * ====qualifier
+ *		A qualifier for DB2 databases running on OS/390 or z/OS servers. For
+ * other databases, pass NULL or an empty string.
+ *
+ * ====schema
+ *		The schema which contains the tables. This parameter accepts a search
+ * pattern containing _ and % as wildcards.
+ *
+ * ====table-name
+ *		The name of the table. This parameter accepts a search pattern
+ * containing _ and % as wildcards.
+ *
+ * ====table-type
+ *		A list of comma-delimited table type identifiers. To match all table
+ * types, pass NULL or an empty string.
+ *		Valid table type identifiers include: ALIAS, HIERARCHY TABLE,
+ * INOPERATIVE VIEW, NICKNAME, MATERIALIZED QUERY TABLE, SYSTEM TABLE, TABLE,
+ * TYPED TABLE, TYPED VIEW, and VIEW.
+ *
+ * ===Return Values
+ *
+ * Returns a statement resource with a result set containing rows describing
+ * the tables that match the specified parameters.
+ * The rows are composed of the following columns:
+ *
+ * Column name:: Description
+ * TABLE_CAT:: The catalog that contains the table. The value is NULL if this
+ * table does not have catalogs.
+ * TABLE_SCHEMA:: Name of the schema that contains the table.
+ * TABLE_NAME:: Name of the table.
+ * TABLE_TYPE:: Table type identifier for the table.
+ * REMARKS:: Description of the table.
+ */
+static PyObject *ibm_db_tables(PyObject *self, PyObject *args)
+{
+	SQLWCHAR *qualifier = NULL;
+	SQLWCHAR *owner = NULL;
+	SQLWCHAR *table_name = NULL;
+	SQLWCHAR *table_type = NULL;
+	PyObject *py_qualifier = NULL;
+	PyObject *py_owner = NULL;
+	PyObject *py_table_name = NULL;
+	PyObject *py_table_type = NULL;
+	conn_handle *conn_res;
+	stmt_handle *stmt_res;
+	int rc;
+	int isNewBuffer;
+
+	if (!PyArg_ParseTuple(args, "O|OOOO", &conn_res, &py_qualifier, &py_owner,
+		&py_table_name, &py_table_type))
+		return NULL;
+
+	if (py_qualifier != NULL && py_qualifier != Py_None) {
+		if (PyString_Check(py_qualifier) || PyUnicode_Check(py_qualifier)){
+			py_qualifier = PyUnicode_FromObject(py_qualifier);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "qualifier must be a string or unicode");
+			return NULL;
+		}
+	}
+
+	if (py_owner != NULL && py_owner != Py_None) {
+		if (PyString_Check(py_owner) || PyUnicode_Check(py_owner)){
+			py_owner = PyUnicode_FromObject(py_owner);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "owner must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			return NULL;
+		}
+	}
+
+	if (py_table_name != NULL && py_table_name != Py_None) {
+		if (PyString_Check(py_table_name) || PyUnicode_Check(py_table_name)){
+			py_table_name = PyUnicode_FromObject(py_table_name);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table_name must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			return NULL;
+		}
+	}
+
+	if (py_table_type != NULL && py_table_type != Py_None) {
+		if (PyString_Check(py_table_type) || PyUnicode_Check(py_table_type)){
+			py_table_type = PyUnicode_FromObject(py_table_type);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "table type must be a string or unicode");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			return NULL;
+		}
+	}
+
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_table_type);
+			return NULL;
+		}
+
+		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+		if (rc == SQL_ERROR) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+				NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_table_type);
+			
+			Py_RETURN_FALSE;
+		}
+		if (py_qualifier && py_qualifier != Py_None )
+			qualifier = getUnicodeDataAsSQLWCHAR(py_qualifier, &isNewBuffer);
+		if (py_owner &&  py_owner != Py_None )
+			owner = getUnicodeDataAsSQLWCHAR(py_owner, &isNewBuffer);
+		if (py_table_name && py_table_name != Py_None )
+			table_name = getUnicodeDataAsSQLWCHAR(py_table_name, &isNewBuffer);
+		if(py_table_type && py_table_type != Py_None)
+			table_type = getUnicodeDataAsSQLWCHAR(py_table_type, &isNewBuffer);
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLTablesW((SQLHSTMT)stmt_res->hstmt, qualifier, SQL_NTS, owner,
+			SQL_NTS, table_name, SQL_NTS, table_type, SQL_NTS);
+		Py_END_ALLOW_THREADS;
+
+		if (isNewBuffer) {
+		    if(qualifier) PyMem_Del(qualifier);
+		    if(owner) PyMem_Del(owner);
+		    if(table_name) PyMem_Del(table_name);
+			if(table_type) PyMem_Del(table_type);
+		}
+		
+		if (rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+				1, NULL, -1, 1);
+			Py_XDECREF(py_qualifier);
+			Py_XDECREF(py_owner);
+			Py_XDECREF(py_table_name);
+			Py_XDECREF(py_table_type);
+
+			Py_RETURN_FALSE;
+		}
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_table_type);
+		
+		return (PyObject *)stmt_res;
+	} else {
+		Py_XDECREF(py_qualifier);
+		Py_XDECREF(py_owner);
+		Py_XDECREF(py_table_name);
+		Py_XDECREF(py_table_type);
+
+		Py_RETURN_FALSE;
+	}
+}
+
+/*!# ibm_db.commit
+ * ===Description
+ * bool ibm_db.commit ( resource connection )
+ *
+ * Commits an in-progress transaction on the specified connection resource and
+ * begins a new transaction.
+ * Python applications normally default to AUTOCOMMIT mode, so ibm_db.commit()
+ * is not necessary unless AUTOCOMMIT has been turned off for the connection
+ * resource.
+ *
+ * Note: If the specified connection resource is a persistent connection, all
+ * transactions in progress for all applications using that persistent
+ * connection will be committed. For this reason, persistent connections are
+ * not recommended for use in applications that require transactions.
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *		A valid database connection resource variable as returned from
+ * ibm_db.connect() or ibm_db.pconnect().
+ *
+ * ===Return Values
+ *
+ * Returns TRUE on success or FALSE on failure.
+ */
+static PyObject *ibm_db_commit(PyObject *self, PyObject *args)			
+{
+	conn_handle *conn_res;
+	int rc;
+	double trace_start;
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
+
+	if (!PyArg_ParseTuple(args, "O", &conn_res))
+		return NULL;
+
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			return NULL;
+		}
+
+		TRACE_START(trace_start);
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLEndTran(SQL_HANDLE_DBC, conn_res->hdbc, SQL_COMMIT);
+		Py_END_ALLOW_THREADS;
+		if ( trace_start != 0.0 ) {
+			_python_ibm_db_trace("commit", NULL, 0, -1, 
+				_python_ibm_db_trace_sqlstate(SQL_HANDLE_DBC, conn_res->hdbc, rc, sqlstate), trace_start);
+		}
+
+		if ( rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+											 NULL, -1, 1);
+			Py_INCREF(Py_False);
+			return Py_False;
+		} else {
+			Py_INCREF(Py_True);
+			return Py_True;
+		}
+	}
+	Py_INCREF(Py_False);
+	return Py_False;
+}
+
+/* static int _python_ibm_db_do_prepare(SQLHANDLE hdbc, char *stmt_string, stmt_handle *stmt_res, PyObject *options)
+*/
+static int _python_ibm_db_do_prepare(SQLHANDLE hdbc, SQLWCHAR *stmt, int stmt_size, stmt_handle *stmt_res, PyObject *options)
+{
+	int rc;
+	int num_params_rc = SQL_ERROR;
+	SQLSMALLINT num_params = 0;
+	double stats_start;
+
+	/* alloc handle and return only if it errors */
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &(stmt_res->hstmt));
+	Py_END_ALLOW_THREADS;
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+										1, NULL, -1, 1);
+		return rc;
+	}
+
+	/* get the string and its length */
+	if (NIL_P(stmt)) {
+		PyErr_SetString(PyExc_Exception, 
+			"Supplied statement parameter is invalid");
+		return SQL_ERROR;
+	}
+
+	if ( rc < SQL_SUCCESS ) {
+		_python_ibm_db_check_sql_errors(hdbc, SQL_HANDLE_DBC, rc, 1, NULL, -1, 1);
+		PyErr_SetString(PyExc_Exception, "Statement prepare Failed: ");
+		return rc;
+	}
+
+	/* Timeout of the connection, the options can override it */
+	if ( stmt_res->query_timeout != 0 ) {
+		rc = _python_ibm_db_set_query_timeout(stmt_res, stmt_res->query_timeout);
+		if ( rc == SQL_ERROR ) {
+			return rc;
+		}
+	}
+
+	if (!NIL_P(options)) {
+		rc = _python_ibm_db_parse_options( options, SQL_HANDLE_STMT, stmt_res );
+		if ( rc == SQL_ERROR ) {
+			return rc;
+		}
+	}
+
+	/* Prepare the stmt. The cursor type requested has already been set in 
+	* _python_ibm_db_assign_options 
+	*/
+
+	STATS_START(stats_start);
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLPrepareW((SQLHSTMT)stmt_res->hstmt, stmt, 
+				stmt_size);
+	if ( rc != SQL_ERROR ) {
+		num_params_rc = SQLNumParams((SQLHSTMT)stmt_res->hstmt, &num_params);
+	}
+	Py_END_ALLOW_THREADS;
+	STATS_TIME(stmt_res, STATS_PREPARE, stats_start);
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
+										1, NULL, -1, 1);
+	} else if ( num_params_rc != SQL_ERROR && num_params > 0 ) {
+		/* One param cache entry per parameter marker */
+		if ( _python_ibm_db_alloc_param_cache(stmt_res, num_params) ) {
+			return SQL_ERROR;
+		}
+	}
+	return rc;
+}
+
+/*!# ibm_db.exec
+ *
+ * ===Description
+ * stmt_handle ibm_db.exec ( IBM_DBConnection connection, string statement
+ *								[, array options] )
+ *
+ * Prepares and executes an SQL statement.
+ *
+ * If you plan to interpolate Python variables into the SQL statement,
+ * understand that this is one of the more common security exposures. Consider
+ * calling ibm_db.prepare() to prepare an SQL statement with parameter markers	* for input values. Then you can call ibm_db.execute() to pass in the input
+ * values and avoid SQL injection attacks.
+ *
+ * If you plan to repeatedly issue the same SQL statement with different
+ * parameters, consider calling ibm_db.:prepare() and ibm_db.execute() to
+ * enable the database server to reuse its access plan and increase the
+ * efficiency of your database access.
+ *
+ * ===Parameters
+ *
+ * ====connection
+ *
+ *		A valid database connection resource variable as returned from
+ * ibm_db.connect() or ibm_db.pconnect().
+ *
+ * ====statement
+ *
+ *		An SQL statement. The statement cannot contain any parameter markers.
+ *
+ * ====options
+ *
+ *		An dictionary containing statement options. You can use this parameter  * to request a scrollable cursor on database servers that support this
+ * functionality.
+ *
+ *		SQL_ATTR_CURSOR_TYPE
+ *			 Passing the SQL_SCROLL_FORWARD_ONLY value requests a forward-only
+ *			 cursor for this SQL statement. This is the default type of
+ *			 cursor, and it is supported by all database servers. It is also
+ *			 much faster than a scrollable cursor.
+ *
+ *			 Passing the SQL_CURSOR_KEYSET_DRIVEN value requests a scrollable  *			 cursor for this SQL statement. This type of cursor enables you to
+ *			 fetch rows non-sequentially from the database server. However, it
+ *			 is only supported by DB2 servers, and is much slower than
+ *			 forward-only cursors.
+ *
+ * ===Return Values
+ *
+ * Returns a stmt_handle resource if the SQL statement was issued
+ * successfully, or FALSE if the database failed to execute the SQL statement.
+ */
+static PyObject *ibm_db_exec(PyObject *self, PyObject *args)			
+{
+	PyObject *options = NULL;
+	stmt_handle *stmt_res;
+	conn_handle *conn_res;
+	int rc;
+	int isNewBuffer;
+	char* return_str = NULL; /* This variable is used by 
+							 * _python_ibm_db_check_sql_errors to return err 
+							 * strings 
+							 */
+	SQLWCHAR *stmt = NULL;
+	PyObject *py_stmt = NULL;
+	double stats_start, trace_start;
+
+	/* This function basically is a wrap of the _python_ibm_db_do_prepare and 
+	* _python_ibm_db_Execute_stmt 
+	* After completing statement execution, it returns the statement resource 
+	*/
+
+	if (!PyArg_ParseTuple(args, "OO|O", &conn_res, &py_stmt,  &options))
+		return NULL;
+
+	if (py_stmt != NULL && py_stmt != Py_None) {
+		if (PyString_Check(py_stmt) || PyUnicode_Check(py_stmt)){
+			py_stmt = PyUnicode_FromObject(py_stmt);
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "statement must be a string or unicode");
+			return NULL;
+		}
+	}
+
+	if (!NIL_P(conn_res)) {
+		if (!conn_res->handle_active) {
+			PyErr_SetString(PyExc_Exception, "Connection is not active");
+			Py_XDECREF(py_stmt);
+			return NULL;
+		}
+
+		return_str = ALLOC_N(char, DB2_MAX_ERR_MSG_LEN);
+		if ( return_str == NULL ) {
+			PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+			Py_XDECREF(py_stmt);
+			return NULL;
+		}
+
+		memset(return_str, 0, DB2_MAX_ERR_MSG_LEN);
+
+		_python_ibm_db_clear_stmt_err_cache();
+
+		stmt_res = _ibm_db_new_stmt_struct(conn_res);
+
+		/* Allocates the stmt handle */
+		/* returns the stat_handle back to the calling function */
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, conn_res->hdbc, &(stmt_res->hstmt));
+		Py_END_ALLOW_THREADS;
+		if ( rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1,
+				NULL, -1, 1);
+			PyMem_Del(return_str);
+			Py_XDECREF(py_stmt);
+			return NULL;
+		}
+
+		if ( conn_res->c_query_timeout != 0 &&
+				_python_ibm_db_set_query_timeout(stmt_res, conn_res->c_query_timeout) == SQL_ERROR ) {
+			PyErr_Format(PyExc_Exception, "Failed to set SQL_ATTR_QUERY_TIMEOUT: %s", IBM_DB_ERR(__python_stmt_err_msg));
+			PyMem_Del(return_str);
+			Py_XDECREF(py_stmt);
+			return NULL;
+		}
+
+		if (!NIL_P(options)) {
+			rc = _python_ibm_db_parse_options(options, SQL_HANDLE_STMT, stmt_res);
+			if ( rc == SQL_ERROR ) {
+				Py_XDECREF(py_stmt);
+				return NULL;
+			}
+		}
+		if (py_stmt != NULL && py_stmt != Py_None){
+			stmt = getUnicodeDataAsSQLWCHAR(py_stmt, &isNewBuffer);
+     		}
+
+		Py_XINCREF(py_stmt);
+		stmt_res->sql = py_stmt;
+
+		STATS_START(stats_start);
+		TRACE_START(trace_start);
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLExecDirectW((SQLHSTMT)stmt_res->hstmt, stmt, SQL_NTS);
+		Py_END_ALLOW_THREADS;
+		STATS_TIME(stmt_res, STATS_EXECUTE, stats_start);
+		if ( trace_start != 0.0 ) {
+			_python_ibm_db_trace_execute(stmt_res, rc, trace_start);
+		}
+
+		if ( rc < SQL_SUCCESS ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, -1, 
+				1, return_str, DB2_ERRMSG, 
+				stmt_res->errormsg_recno_tracker);
+			SQLFreeHandle( SQL_HANDLE_STMT, stmt_res->hstmt );
+			/* TODO: Object freeing */
+			/* free(stmt_res); */
+			if (isNewBuffer) {
+				if(stmt) PyMem_Del(stmt);
+			}
+			Py_XDECREF(py_stmt);
+			PyMem_Del(return_str);
+			return NULL;
+		}
+		if (isNewBuffer) {
+			if(stmt) PyMem_Del(stmt);
+		}	
+		PyMem_Del(return_str);
+		Py_XDECREF(py_stmt);
+		return (PyObject *)stmt_res;				 
+	}
+	Py_XDECREF(py_stmt);
+	return NULL;
+}
+
+/*!# ibm_db.free_result
+ *
+ * ===Description
+ * bool ibm_db.free_result ( resource stmt )
+ *
+ * Frees the system and database resources that are associated with a result
+ * set. These resources are freed implicitly when a script finishes, but you
+ * can call ibm_db.free_result() to explicitly free the result set resources
+ * before the end of the script. The statement can be executed again, the
+ * parameters bound to it are kept.
+ *
+ * ===Parameters
+ *
+ * ====stmt
+ *		A valid statement resource.
+ *
+ * ===Return Values
+ *
+ * Returns TRUE on success or FALSE on failure.
+ */
+static PyObject *ibm_db_free_result(PyObject *self, PyObject *args)
+{
+	stmt_handle *stmt_res;
+	int rc = 0;
+
+	if (!PyArg_ParseTuple(args, "O", &stmt_res))
+		return NULL;
+
+	if (!NIL_P(stmt_res)) {
+		if ( stmt_res->hstmt ) {
+			/* Free any cursors that might have been allocated in a previous call 
+			* to SQLExecute 
+			*/
+			Py_BEGIN_ALLOW_THREADS;
+			SQLFreeStmt((SQLHSTMT)stmt_res->hstmt, SQL_CLOSE);
+			Py_END_ALLOW_THREADS;
+
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+												rc, 1, NULL, -1, 1);
+			}
+		}
+		_python_ibm_db_free_result_struct(stmt_res);
+	} else {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		Py_INCREF(Py_False);
+		return Py_False;
+	}
+	Py_INCREF(Py_True);
+	return Py_True;
+}
+
+/*	static PyObject *_python_ibm_db_stmt_cache_key(PyObject *py_stmt, PyObject *options)
+	key of a statement in the prepared statement cache, the statement text
+	and the sorted options. NULL when the options cannot be part of a key
+*/
+static PyObject *_python_ibm_db_stmt_cache_key(PyObject *py_stmt, PyObject *options)
+{
+	PyObject *items = NULL;
+	PyObject *opts = NULL;
+	PyObject *key = NULL;
+
+	if ( !NIL_P(options) && PyDict_Check(options) && PyDict_Size(options) > 0 ) {
+		items = PyDict_Items(options);
+		if ( items == NULL || PyList_Sort(items) == -1 ) {
+			Py_XDECREF(items);
+			PyErr_Clear();
+			return NULL;
+		}
+		opts = PyList_AsTuple(items);
+		Py_DECREF(items);
+	} else {
+		Py_INCREF(Py_None);
+		opts = Py_None;
+	}
+	if ( opts != NULL ) {
+		key = PyTuple_Pack(2, py_stmt, opts);
+		Py_DECREF(opts);
+	}
+	/* Options such as a list of ATTR_PARAM_TYPES are not hashable */
+	if ( key == NULL || PyObject_Hash(key) == -1 ) {
+		Py_XDECREF(key);
+		PyErr_Clear();
+		return NULL;
+	}
+	return key;
+}
+
+/*	static stmt_handle *_python_ibm_db_stmt_cache_get(conn_handle *conn_res, PyObject *key, PyObject *options)
+	new reference to the cached statement of key, reset for a new execution,
+	or NULL if the statement is not cached or is held by the application.
+	Returns NULL with a Python exception set when the options fail
+*/
+static stmt_handle *_python_ibm_db_stmt_cache_get(conn_handle *conn_res, PyObject *key, PyObject *options)
+{
+	stmt_cache_entry *entry;
+	stmt_handle *stmt_res;
+	PyObject *index;
+
+	if ( conn_res->stmt_cache_index == NULL ) {
+		return NULL;
+	}
+	index = PyDict_GetItem(conn_res->stmt_cache_index, key);
+	if ( index == NULL ) {
+		return NULL;
+	}
+	entry = &conn_res->stmt_cache[PyInt_AS_LONG(index)];
+	/* Only the cache holds statements that are not in use */
+	if ( Py_REFCNT(entry->stmt) > 1 ) {
+		return NULL;
+	}
+	stmt_res = (stmt_handle *)entry->stmt;
+
+	/* The CLI attributes ibm_db.set_option changed are not known to the
+	 * cache, such a statement is released and prepared again */
+	if ( stmt_res->options_changed ) {
+		PyDict_DelItem(conn_res->stmt_cache_index, entry->key);
+		Py_CLEAR(entry->key);
+		Py_CLEAR(entry->stmt);
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS;
+	SQLFreeStmt((SQLHSTMT)stmt_res->hstmt, SQL_CLOSE);
+	Py_END_ALLOW_THREADS;
+
+	/* Parameters bound with ibm_db.bind_param refer to variables of the
+	 * previous user, the described parameters are kept */
+	if ( !stmt_res->dynamic_params ) {
+		_python_ibm_db_clear_param_cache(stmt_res);
+	}
+	stmt_res->current_param = 0;
+	stmt_res->error_recno_tracker = 1;
+	stmt_res->errormsg_recno_tracker = 1;
+
+	/* Options set on the statement after it was prepared are undone */
+	stmt_res->s_bin_mode = conn_res->c_bin_mode;
+	stmt_res->s_case_mode = conn_res->c_case_mode;
+	stmt_res->s_native_types = conn_res->c_native_types;
+	stmt_res->s_lob_reader = conn_res->c_lob_reader;
+	stmt_res->row_array_size = conn_res->c_row_array_size;
+	stmt_res->paramset_size = conn_res->c_paramset_size;
+	if ( stmt_res->query_timeout != conn_res->c_query_timeout &&
+			_python_ibm_db_set_query_timeout(stmt_res, conn_res->c_query_timeout) == SQL_ERROR ) {
+		PyErr_Format(PyExc_Exception, "Failed to set SQL_ATTR_QUERY_TIMEOUT: %s", IBM_DB_ERR(__python_stmt_err_msg));
+		return NULL;
+	}
+	if ( !NIL_P(options) ) {
+		if ( _python_ibm_db_parse_options(options, SQL_HANDLE_STMT, stmt_res) == SQL_ERROR ) {
+			return NULL;
+		}
+	}
+
+	entry->last_used = ++conn_res->stmt_cache_clock;
+	Py_INCREF(stmt_res);
+	return stmt_res;
+}
+
+/*	static void _python_ibm_db_stmt_cache_put(conn_handle *conn_res, PyObject *key, stmt_handle *stmt_res)
+	caches a prepared statement, evicting the least recently used one when
+	the cache is full. The statement is not cached if the cache cannot grow
+*/
+static void _python_ibm_db_stmt_cache_put(conn_handle *conn_res, PyObject *key, stmt_handle *stmt_res)
+{
+	stmt_cache_entry *entry = NULL;
+	PyObject *index = NULL;
+	int i, slot = -1;
+
+	if ( conn_res->stmt_cache == NULL ) {
+		conn_res->stmt_cache = ALLOC_N(stmt_cache_entry, conn_res->c_stmt_cache_size);
+		conn_res->stmt_cache_index = PyDict_New();
+		if ( conn_res->stmt_cache == NULL || conn_res->stmt_cache_index == NULL ) {
+			if ( conn_res->stmt_cache != NULL ) {
+				PyMem_Del(conn_res->stmt_cache);
+				conn_res->stmt_cache = NULL;
+			}
+			Py_CLEAR(conn_res->stmt_cache_index);
+			PyErr_Clear();
+			return;
+		}
+		memset(conn_res->stmt_cache, 0, sizeof(stmt_cache_entry) * conn_res->c_stmt_cache_size);
+	}
+	/* A statement of the same key held by the application stays cached */
+	if ( PyDict_GetItem(conn_res->stmt_cache_index, key) != NULL ) {
+		return;
+	}
+	for ( i = 0; i < conn_res->c_stmt_cache_size; i++ ) {
+		if ( conn_res->stmt_cache[i].key == NULL ) {
+			slot = i;
+			break;
+		}
+		if ( slot == -1 || conn_res->stmt_cache[i].last_used < conn_res->stmt_cache[slot].last_used ) {
+			slot = i;
+		}
+	}
+	index = PyInt_FromLong(slot);
+	if ( index == NULL ) {
+		PyErr_Clear();
+		return;
+	}
+	entry = &conn_res->stmt_cache[slot];
+	if ( entry->key != NULL ) {
+		PyDict_DelItem(conn_res->stmt_cache_index, entry->key);
+		Py_CLEAR(entry->key);
+		Py_CLEAR(entry->stmt);
+		conn_res->stmt_cache_evictions++;
+	}
+	if ( PyDict_SetItem(conn_res->stmt_cache_index, key, index) == 0 ) {
+		Py_INCREF(key);
+		entry->key = key;
+		Py_INCREF(stmt_res);
+		entry->stmt = (PyObject *)stmt_res;
+		entry->last_used = ++conn_res->stmt_cache_clock;
+	} else {
+		PyErr_Clear();
+	}
+	Py_DECREF(index);
+}
+
+/*
+ * static PyObject *_python_ibm_db_prepare_helper(conn_handle *conn_res, PyObject *py_stmt, PyObject *options)
+ *
+ */
+static PyObject *_python_ibm_db_prepare_helper(conn_handle *conn_res, PyObject *py_stmt, PyObject *options)
+{
+	stmt_handle *stmt_res;
+	int rc;
+	char error[DB2_MAX_ERR_MSG_LEN];
+	SQLWCHAR *stmt = NULL;
+	int stmt_size = 0;
+	int isNewBuffer;
+	PyObject *cache_key = NULL;
+	double trace_start;
+
+	if (!conn_res->handle_active) {
+		PyErr_SetString(PyExc_Exception, "Connection is not active");
+		return NULL;
+	}
+
+	/* Statements prepared before are taken from the cache of the connection */
+	if (conn_res->c_stmt_cache_size > 0 && !NIL_P(py_stmt) && (PyString_Check(py_stmt) || PyUnicode_Check(py_stmt)) &&
+			(NIL_P(options) || PyDict_Check(options))) {
+		cache_key = _python_ibm_db_stmt_cache_key(py_stmt, options);
+		if (cache_key != NULL) {
+			stmt_res = _python_ibm_db_stmt_cache_get(conn_res, cache_key, options);
+			if (stmt_res != NULL || PyErr_Occurred()) {
+				if (stmt_res != NULL) {
+					conn_res->stmt_cache_hits++;
+				}
+				Py_DECREF(cache_key);
+				return (PyObject *)stmt_res;
+			}
+			conn_res->stmt_cache_misses++;
+		}
+	}
+
+	if (py_stmt != NULL && py_stmt != Py_None) {
+		if (PyString_Check(py_stmt) || PyUnicode_Check(py_stmt)) {
+			py_stmt = PyUnicode_FromObject(py_stmt);
+			if (py_stmt != NULL &&  py_stmt != Py_None) {
+				stmt_size = PyUnicode_GetSize(py_stmt);
+			} else {
+				PyErr_SetString(PyExc_Exception, "Error occure during processing of statement");
+				return NULL;	
+			}
+		}
+		else {
+			PyErr_SetString(PyExc_Exception, "statement must be a string or unicode");
+			return NULL;
+		}
+	}
+
+	_python_ibm_db_clear_stmt_err_cache();
+
+	/* Initialize stmt resource members with default values. */
+	/* Parsing will update options if needed */
+
+	stmt_res = _ibm_db_new_stmt_struct(conn_res);
+	stmt_res->query_timeout = conn_res->c_query_timeout;
+
+	/* Allocates the stmt handle */
+	/* Prepares the statement */
+	/* returns the stat_handle back to the calling function */
+	if( py_stmt && py_stmt != Py_None) {
+		stmt = getUnicodeDataAsSQLWCHAR(py_stmt, &isNewBuffer);
+	} else {
+		/* Not converted above, so the reference is still borrowed */
+		Py_XINCREF(py_stmt);
+	}
+	/* The statement owns the reference from here on */
+	stmt_res->sql = py_stmt;
+		
+	TRACE_START(trace_start);
+	rc = _python_ibm_db_do_prepare(conn_res->hdbc, stmt, stmt_size, stmt_res, options);
+	if (isNewBuffer) {
+		if(stmt) PyMem_Del(stmt);
+	}
+	if ( trace_start != 0.0 ) {
+		_python_ibm_db_trace_stmt(stmt_res, "prepare", rc, -1, trace_start);
+	}
+	
+	if ( rc < SQL_SUCCESS ) {
+		sprintf(error, "Statement Prepare Failed: %s", IBM_DB_ERR(__python_stmt_err_msg));
+		Py_XDECREF(cache_key);
+		/* Frees the handle and the statement text */
+		Py_DECREF(stmt_res);
+		return NULL;
+	}
+	if (cache_key != NULL) {
+		_python_ibm_db_stmt_cache_put(conn_res, cache_key, stmt_res);
+		Py_DECREF(cache_key);
+	}
+	return (PyObject *)stmt_res;		
+}
+
+/*!# ibm_db.prepare
+ *
+ * ===Description
+ * IBMDB_Statement ibm_db.prepare ( IBM_DBConnection connection,
+ *								  string statement [, array options] )
+ *
+ * ibm_db.prepare() creates a prepared SQL statement which can include 0 or
+ * more parameter markers (? characters) representing parameters for input,
+ * output, or input/output. You can pass parameters to the prepared statement
+ * using ibm_db.bind_param(), or for input values only, as an array passed to
+ * ibm_db.execute().
+ *
+ * There are three main advantages to using prepared statements in your
+ * application:
+ *		* Performance: when you prepare a statement, the database server
+ *		 creates an optimized access plan for retrieving data with that
+ *		 statement. Subsequently issuing the prepared statement with
+ *		 ibm_db.execute() enables the statements to reuse that access plan
+ *		 and avoids the overhead of dynamically creating a new access plan
+ *		 for every statement you issue.
+ *		* Security: when you prepare a statement, you can include parameter
+ *		 markers for input values. When you execute a prepared statement
+ *		 with input values for placeholders, the database server checks each
+ *		 input value to ensure that the type matches the column definition or
+ *		 parameter definition.
+ *		* Advanced functionality: Parameter markers not only enable you to
+ *		 pass input values to prepared SQL statements, they also enable you
+ *		 to retrieve OUT and INOUT parameters from stored procedures using
+ *		 ibm_db.bind_param().
+ *
+ * ===Parameters
+ * ====connection
+ *
+ *		A valid database connection resource variable as returned from
+ *		ibm_db.connect() or ibm_db.pconnect().
+ *
+ * ====statement
+ *
+ *		An SQL statement, optionally containing one or more parameter markers.
+ *
+ * ====options
+ *
+ *		An dictionary containing statement options. You can use this parameter
+ *		to request a scrollable cursor on database servers that support this
+ *		functionality.
+ *
+ *		SQL_ATTR_CURSOR_TYPE
+ *			 Passing the SQL_SCROLL_FORWARD_ONLY value requests a forward-only
+ *			 cursor for this SQL statement. This is the default type of
+ *			 cursor, and it is supported by all database servers. It is also
+ *			 much faster than a scrollable cursor.
+ *			 Passing the SQL_CURSOR_KEYSET_DRIVEN value requests a scrollable  
+ *			 cursor for this SQL statement. This type of cursor enables you
+ *			 to fetch rows non-sequentially from the database server. However, 
+ *			 it is only supported by DB2 servers, and is much slower than
+ *			 forward-only cursors.
+ *
+ *		SQL_ATTR_ROW_ARRAY_SIZE
+ *			 The number of rows ibm_db.fetch_tuple(), ibm_db.fetch_assoc() and
+ *			 ibm_db.fetch_both() retrieve from the server in one block; rows
+ *			 are then returned from the block until it is exhausted. Passing 0
+ *			 (the default) uses blocks of up to 100 rows for forward-only
+ *			 cursors and single rows for scrollable cursors. Result sets with
+ *			 XML or LONG VARCHAR columns are always fetched a row at a time.
+ *			 Once one of these functions has fetched a block,
+ *			 ibm_db.fetch_row() steps through the same block and
+ *			 ibm_db.result() reads the current row from it.
+ *
+ *		SQL_ATTR_PARAMSET_SIZE
+ *			 The number of rows of parameters ibm_db.execute_many() binds as
+ *			 arrays and sends to the server in one execution. Passing 0 (the
+ *			 default) sends up to 1000 rows per execution.
+ *
+ *		ATTR_NATIVE_TYPES
+ *			 Passing the NATIVE_TYPES_ON value makes the fetch functions
+ *			 return DATE, TIME and TIMESTAMP values as datetime.date,
+ *			 datetime.time and datetime.datetime objects and DECIMAL and
+ *			 NUMERIC values as decimal.Decimal objects, instead of strings.
+ *			 Date and time values are fetched in their binary form. The
+ *			 option applies to result sets whose columns are bound after it
+ *			 is set. Passing NATIVE_TYPES_OFF (the default) returns strings.
+ *
+ *		ATTR_LOB_READER
+ *			 Passing the LOB_READER_ON value makes the fetch functions and
+ *			 ibm_db.result() return BLOB, CLOB and DBCLOB values as
+ *			 ibm_db.IBM_DBLob objects instead of reading the whole value.
+ *			 The object reads the value through its LOB locator in chunks:
+ *			 read([size]) returns up to size bytes of a BLOB or characters
+ *			 of a CLOB or DBCLOB, readinto(buffer) fills a writable buffer
+ *			 with BLOB data, seek(offset[, whence]) and tell() move and
+ *			 report the read position and len() returns the length of the
+ *			 value. Lengths and positions are in the units of the LOB type.
+ *			 The locator, and so the object, is valid until the transaction
+ *			 ends. NULL values are returned as None. Passing LOB_READER_OFF
+ *			 (the default) returns the whole value.
+ *
+ *		SQL_ATTR_QUERY_TIMEOUT
+ *			 The number of seconds the server may spend executing the
+ *			 statement before the execute fails with a timeout error.
+ *			 Passing 0 (the default) does not limit it. Running statements
+ *			 can also be stopped with ibm_db.cancel().
+ *
+ *		ATTR_PARAM_TYPES
+ *			 A tuple with one entry per parameter marker: an SQL type such as
+ *			 SQL_INTEGER, an (SQL type, size, scale) tuple, or None. Parameters
+ *			 given a type are bound with it and never described on the
+ *			 server; the others are described once, when the statement is
+ *			 first executed, and the description is reused by later calls to
+ *			 ibm_db.execute() and ibm_db.execute_many(). ibm_db.get_option()
+ *			 returns the types in use.
+ *
+ * ===Return Values
+ * Returns a IBM_DBStatement object if the SQL statement was successfully
+ * parsed and prepared by the database server. Returns FALSE if the database
+ * server returned an error. You can determine which error was returned by
+ * calling ibm_db.stmt_error() or ibm_db.stmt_errormsg().
+ */					 
+static PyObject *ibm_db_prepare(PyObject *self, PyObject *args)			
+{
+	PyObject *options = NULL;
+	conn_handle *conn_res;
+	
+	PyObject *py_stmt = NULL;
+	
+	if (!PyArg_ParseTuple(args, "OO|O", &conn_res, &py_stmt, &options))
+		return NULL;
+
+	if (!NIL_P(conn_res)) {
+		return _python_ibm_db_prepare_helper(conn_res, py_stmt, options);	 
+	}
+
+	return NULL;
+}
+
+/*	static PyObject *_python_ibm_db_next_stream_chunk(param_node *curr)
+	returns the next chunk of a streamed LOB parameter, the one read when it
+	was bound first: read(LOB_STREAM_CHUNK_SIZE) of a file-like object or the
+	next non-empty item of an iterator. Returns NULL at the end of the stream,
+	with a Python exception set when the stream fails or produces a value
+	that is neither a string nor unicode
+*/
+static PyObject *_python_ibm_db_next_stream_chunk(param_node *curr)
+{
+	int is_file = PyObject_HasAttrString(curr->stream, "read");
+	PyObject *chunk = NULL;
+	const void *data = NULL;
+	Py_ssize_t length = 0;
+
+	if ( curr->stream_chunk != NULL ) {
+		chunk = curr->stream_chunk;
+		curr->stream_chunk = NULL;
+		return chunk;
+	}
+	if ( curr->stream_error != NULL ) {
+		PyErr_SetObject(PyExceptionInstance_Class(curr->stream_error), curr->stream_error);
+		Py_CLEAR(curr->stream_error);
+		return NULL;
+	}
+	while ( 1 ) {
+		if ( is_file ) {
+			chunk = PyObject_CallMethod(curr->stream, "read", "i", LOB_STREAM_CHUNK_SIZE);
+		} else {
+			chunk = PyIter_Next(curr->stream);
+		}
+		if ( chunk == NULL ) {
+			return NULL;
+		}
+		if ( PyUnicode_Check(chunk) ) {
+			length = PyUnicode_GET_SIZE(chunk);
+		} else if ( PyObject_AsReadBuffer(chunk, &data, &length) ) {
+			Py_DECREF(chunk);
+			PyErr_Format(PyExc_Exception, "LOB stream of param %d must produce strings", curr->param_num);
+			return NULL;
+		}
+		if ( length > 0 ) {
+			return chunk;
+		}
+		Py_DECREF(chunk);
+		/* An empty read is the end of a file */
+		if ( is_file ) {
+			return NULL;
+		}
+	}
+}
+
+/*	static int _python_ibm_db_bind_data( stmt_handle *stmt_res, param_node *curr, PyObject *bind_data )
+*/
+static int _python_ibm_db_bind_data( stmt_handle *stmt_res, param_node *curr, PyObject *bind_data)
+{
+	int rc;
+	SQLSMALLINT valueType = 0;
+	SQLPOINTER	paramValuePtr;
+	Py_ssize_t buffer_len = 0;
+	int param_length;
+	PyObject *type, *value, *traceback;
+	
+	curr->bound_type = 0;
+	curr->stream = NULL;
+	Py_CLEAR(curr->stream_chunk);
+	Py_CLEAR(curr->stream_error);
+
+	/* Have to use SQLBindFileToParam if PARAM is type PARAM_FILE */
+	if ( curr->param_type == PARAM_FILE) {
+		/* Only string types can be bound */
+		if (!PyString_Check(bind_data)) {
+			return SQL_ERROR;
+		}
+		curr->bind_indicator = 0;
+		if(curr->svalue != NULL) {
+			PyMem_Del(curr->svalue);
+			curr->svalue = NULL;
+		}
+		curr->svalue = PyString_AsString(bind_data);
+		curr->ivalue = strlen(curr->svalue);
+		valueType = (SQLSMALLINT) curr->ivalue;
+		/* Bind file name string */
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLBindFileToParam((SQLHSTMT)stmt_res->hstmt, curr->param_num,
+					curr->data_type, (SQLCHAR*)curr->svalue,
+					(SQLSMALLINT*)&(curr->ivalue), &(curr->file_options), 
+					(SQLSMALLINT) curr->ivalue, &(curr->bind_indicator));
+		Py_END_ALLOW_THREADS;
+
+		if ( rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+											 rc, 1, NULL, -1, 1);
+		}
+		return rc;
+	}
+	
+	switch(TYPE(bind_data)) {
+		case PYTHON_FIXNUM:
+			if(curr->data_type == SQL_BIGINT || curr->data_type == SQL_DECIMAL ){
+				PyObject *tempobj = NULL;
+				if(curr->svalue != NULL) {
+					PyMem_Del(curr->svalue);
+					curr->svalue = NULL;
+				}
+				tempobj = PyObject_Str(bind_data);
+				curr->svalue = PyString_AsString(tempobj);
+				curr->ivalue = strlen(curr->svalue);
+				curr->svalue = memcpy(PyMem_Malloc((sizeof(char))*(curr->ivalue+1)), curr->svalue, curr->ivalue);
+				curr->svalue[curr->ivalue] = '\0'; 
+				curr->bind_indicator = curr->ivalue;
+
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+					curr->param_type, SQL_C_CHAR, curr->data_type,
+					curr->param_size, curr->scale, curr->svalue, curr->param_size, NULL);
+				Py_END_ALLOW_THREADS;
+
+				if ( rc == SQL_ERROR ){
+					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+												rc, 1, NULL, -1, 1);
+				}
+				Py_XDECREF(tempobj);
+			}
+			else{
+				curr->ivalue = (SQLINTEGER) PyLong_AsLong(bind_data);
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+							curr->param_type, SQL_C_LONG, curr->data_type,
+							curr->param_size, curr->scale, &curr->ivalue, 0, NULL);
+				Py_END_ALLOW_THREADS;
+
+				if ( rc == SQL_ERROR ) {
+					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+												rc, 1, NULL, -1, 1);
+				}
+				curr->data_type = SQL_C_LONG;
+				curr->bound_type = PYTHON_FIXNUM;
+			}
+			break;
+
+		/* Convert BOOLEAN types to LONG for DB2 / Cloudscape */
+		case PYTHON_FALSE:
+			curr->ivalue = 0;
+
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
 						curr->param_type, SQL_C_LONG, curr->data_type, curr->param_size,
 						curr->scale, &curr->ivalue, 0, NULL);
 			Py_END_ALLOW_THREADS;
 
 			if ( rc == SQL_ERROR ) {
 				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-													rc, 1, NULL, -1, 1);
+													rc, 1, NULL, -1, 1);
+			}
+			curr->data_type = SQL_C_LONG;
+			curr->bound_type = PYTHON_FALSE;
+			break;
+
+		case PYTHON_TRUE:
+			curr->ivalue = 1;
+
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+			curr->param_type, SQL_C_LONG, curr->data_type, curr->param_size,
+						curr->scale, &curr->ivalue, 0, NULL);
+			Py_END_ALLOW_THREADS;
+
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+												rc, 1, NULL, -1, 1);
+			}
+			curr->data_type = SQL_C_LONG;
+			curr->bound_type = PYTHON_TRUE;
+			break;
+
+		case PYTHON_FLOAT:
+			curr->fvalue = PyFloat_AsDouble(bind_data);
+			
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+					curr->param_type, SQL_C_DOUBLE, curr->data_type, curr->param_size,
+					curr->scale, &curr->fvalue, 0, NULL);
+			Py_END_ALLOW_THREADS;
+
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+												rc, 1, NULL, -1, 1);
+			}
+			curr->data_type = SQL_C_DOUBLE;
+			curr->bound_type = PYTHON_FLOAT;
+			break;
+
+		case PYTHON_UNICODE:
+			{
+				int isNewBuffer = 0;
+				if(curr->data_type == SQL_BLOB || curr->data_type == SQL_BINARY || curr->data_type == SQL_VARBINARY) {
+					/* Copied below, the cache owns uvalue */
+					if(curr->uvalue != NULL) {
+						PyMem_Del(curr->uvalue);
+						curr->uvalue = NULL;
+					}
+					PyObject_AsReadBuffer(bind_data, (const void **) &(curr->uvalue), &buffer_len);
+					curr->ivalue = buffer_len;
+				} else {
+					if(curr->uvalue != NULL) {
+						PyMem_Del(curr->uvalue);
+						curr->uvalue = NULL;
+					}
+					curr->uvalue = getUnicodeDataAsSQLWCHAR(bind_data, &isNewBuffer);
+					curr->ivalue = PyUnicode_GetSize(bind_data);
+					curr->ivalue = curr->ivalue * sizeof(SQLWCHAR);
+				}
+				param_length = curr->ivalue;
+				if (curr->size != 0) {
+					curr->ivalue = (curr->size + 1) * sizeof(SQLWCHAR);
+				}
+
+				if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+					if (curr->size == 0) {
+						if (curr->data_type == SQL_DBCLOB) {
+							if (curr->ivalue <= (curr->param_size * sizeof(SQLWCHAR))) {
+								curr->ivalue = (curr->param_size + 1) * sizeof(SQLWCHAR);
+							}
+						} else {
+							if (curr->ivalue <= curr->param_size) {
+								curr->ivalue = curr->param_size + sizeof(SQLWCHAR);
+							}
+						}
+					}
+				}
+
+				if (isNewBuffer == 0 ){
+					/* actually make a copy, since this will uvalue will be freed explicitly */
+					SQLWCHAR* tmp = (SQLWCHAR*)ALLOC_N(SQLWCHAR, curr->ivalue + 1);
+					memcpy(tmp, curr->uvalue, (param_length + sizeof(SQLWCHAR)));
+					curr->uvalue = tmp;
+				}
+				
+				switch( curr->data_type ){
+					case SQL_CLOB:
+                    case SQL_DBCLOB:
+						if(curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT){
+							curr->bind_indicator = param_length;
+							paramValuePtr = (SQLPOINTER)curr->uvalue;
+						} else {
+							curr->bind_indicator = SQL_DATA_AT_EXEC;
+#ifndef PASE
+							paramValuePtr = (SQLPOINTER)(curr);
+#else
+							paramValuePtr = (SQLPOINTER)&(curr);
+#endif
+						}
+						valueType = SQL_C_WCHAR;
+						break;
+					
+					case SQL_BLOB:
+						if (curr->param_type == SQL_PARAM_OUTPUT ||curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+							curr->bind_indicator =  param_length;
+							valueType = SQL_C_BINARY;
+							paramValuePtr = (SQLPOINTER)curr;
+						} else {
+							curr->bind_indicator = SQL_DATA_AT_EXEC;
+							valueType = SQL_C_BINARY;
+#ifndef PASE
+							paramValuePtr = (SQLPOINTER)(curr);
+#else
+							paramValuePtr = (SQLPOINTER)&(curr);
+#endif
+						}
+						break;
+					
+					case SQL_BINARY:
+#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
+					case SQL_LONGVARBINARY:
+#endif /* PASE */
+					case SQL_VARBINARY:
+						/* account for bin_mode settings as well */
+						curr->bind_indicator = param_length;
+						valueType = SQL_C_BINARY;
+						paramValuePtr = (SQLPOINTER)curr->uvalue;
+						break;
+
+					case SQL_XML:
+						curr->bind_indicator = param_length;
+						paramValuePtr = (SQLPOINTER)curr->uvalue;
+						valueType = SQL_C_WCHAR;
+						break;
+					
+					default:
+						valueType = SQL_C_WCHAR;
+						curr->bind_indicator = param_length;
+						paramValuePtr = (SQLPOINTER)(curr->uvalue);
+						curr->bound_type = PYTHON_UNICODE;
+						curr->buffer_size = param_length;
+				}
+
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num, curr->param_type, valueType, curr->data_type, curr->param_size, curr->scale, paramValuePtr, curr->ivalue, &(curr->bind_indicator));
+				Py_END_ALLOW_THREADS;
+
+				if ( rc == SQL_ERROR ) {
+					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+				}
+				curr->data_type = valueType;
+			}
+			break;
+		
+		case PYTHON_STRING:
+			{
+				char* tmp;
+				if(curr->svalue != NULL) {
+					PyMem_Del(curr->svalue);
+					curr->svalue = NULL;
+				}
+				if (curr->data_type == SQL_BLOB || curr->data_type == SQL_BINARY
+											 || curr->data_type == SQL_VARBINARY ) {
+					PyObject_AsReadBuffer(bind_data, (const void **) &(curr->svalue), &buffer_len);
+					curr->ivalue = buffer_len;
+				} else {
+					curr->svalue = PyString_AsString(bind_data);
+					curr->ivalue = strlen(curr->svalue);
+				}
+				param_length = curr->ivalue;
+				/*
+				* An extra parameter is given by the client to pick the size of the 
+				* string returned. The string is then truncate past that size.	
+				* If no size is given then use BUFSIZ to return the string.
+				*/
+				if (curr->size != 0) {
+					curr->ivalue = curr->size;
+				}
+	            
+				if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+					if (curr->size == 0) {
+						if (curr->ivalue <= curr->param_size) {
+							curr->ivalue = curr->param_size + 1;
+						}
+					}
+				}
+			
+				tmp = ALLOC_N(char, curr->ivalue+1);
+				curr->svalue = memcpy(tmp, curr->svalue, param_length);
+				curr->svalue[param_length] = '\0';
+
+				switch ( curr->data_type ) {
+					case SQL_CLOB:
+					case SQL_DBCLOB:
+						if (curr->param_type == SQL_PARAM_OUTPUT || 
+							curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+							curr->bind_indicator = param_length;
+							valueType = SQL_C_CHAR;
+							paramValuePtr = (SQLPOINTER)curr->svalue;
+						} else {
+							curr->bind_indicator = SQL_DATA_AT_EXEC;
+							valueType = SQL_C_CHAR;
+							/* The correct dataPtr will be set during SQLPutData with 
+							* the len from this struct 
+							*/
+#ifndef PASE
+							paramValuePtr = (SQLPOINTER)(curr);
+#else
+							paramValuePtr = (SQLPOINTER)&(curr);
+#endif
+						}
+						break;
+
+					case SQL_BLOB:
+						if (curr->param_type == SQL_PARAM_OUTPUT || 
+							curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+							curr->ivalue = curr->ivalue -1;
+							curr->bind_indicator = param_length;
+							valueType = SQL_C_BINARY;
+							paramValuePtr = (SQLPOINTER)curr;
+						} else {
+							curr->bind_indicator = SQL_DATA_AT_EXEC;
+							valueType = SQL_C_BINARY;
+#ifndef PASE
+							paramValuePtr = (SQLPOINTER)(curr);
+#else
+							paramValuePtr = (SQLPOINTER)&(curr);
+#endif
+						}
+						break;
+
+					case SQL_BINARY:
+#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
+					case SQL_LONGVARBINARY:
+#endif /* PASE */
+					case SQL_VARBINARY:
+					case SQL_XML:
+						/* account for bin_mode settings as well */
+						curr->bind_indicator = curr->ivalue;
+						if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+							curr->ivalue = curr->ivalue - 1;
+							curr->bind_indicator = param_length;
+						}
+						valueType = SQL_C_BINARY;
+						paramValuePtr = (SQLPOINTER)curr->svalue;
+						break;
+
+						/* This option should handle most other types such as DATE, 
+						* VARCHAR etc 
+						*/
+					default:
+						valueType = SQL_C_CHAR;
+						curr->bind_indicator = curr->ivalue;
+						if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
+							curr->bind_indicator = SQL_NTS;
+						}	
+						paramValuePtr = (SQLPOINTER)(curr->svalue);
+						curr->bound_type = PYTHON_STRING;
+						curr->buffer_size = param_length;
+					}
+		
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+					curr->param_type, valueType, curr->data_type, curr->param_size,
+					curr->scale, paramValuePtr, curr->ivalue, &(curr->bind_indicator));
+				Py_END_ALLOW_THREADS;
+
+				if ( rc == SQL_ERROR ) {
+					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+											rc, 1, NULL, -1, 1);
+				}
+				curr->data_type = valueType;
+			}
+				break;
+
+		case PYTHON_DECIMAL:
+			if (curr->data_type == SQL_DECIMAL || curr->data_type == SQL_DECFLOAT) {
+				PyObject *tempobj = NULL;
+				if(curr->svalue != NULL) {
+					PyMem_Del(curr->svalue);
+					curr->svalue = NULL;
+				}
+				tempobj = PyObject_Str(bind_data);
+				curr->svalue = PyString_AsString(tempobj);
+				curr->ivalue = strlen(curr->svalue);
+				curr->svalue = estrdup(curr->svalue);
+				curr->svalue[curr->ivalue] = '\0'; 
+				valueType = SQL_C_CHAR;
+				paramValuePtr = (SQLPOINTER)(curr->svalue);
+				curr->bind_indicator = curr->ivalue;
+
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num, curr->param_type, valueType, curr->data_type, curr->param_size, curr->scale, paramValuePtr, curr->ivalue, &(curr->bind_indicator));
+				Py_END_ALLOW_THREADS;
+
+				if ( rc == SQL_ERROR ) {
+					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,rc, 1, NULL, -1, 1);
+				}
+				curr->data_type = valueType;
+				Py_XDECREF(tempobj);
+				break;
+			}
+
+
+		case PYTHON_NIL:
+			curr->ivalue = SQL_NULL_DATA;
+
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
+				curr->param_type, SQL_C_DEFAULT, curr->data_type, curr->param_size,
+				curr->scale, &curr->ivalue, 0, (SQLLEN *)&(curr->ivalue));
+			Py_END_ALLOW_THREADS;
+
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
+											rc, 1, NULL, -1, 1);
 			}
-			curr->data_type = SQL_C_LONG;
+			curr->bound_type = PYTHON_NIL;
 			break;
 
-		case PYTHON_TRUE:
-			curr->ivalue = 1;
+		/* LOB input data is read from the object in the SQLPutData loop of
+		 * the execute, without a copy of the whole value */
+		case PYTHON_STREAM:
+			if ( curr->param_type != SQL_PARAM_INPUT ) {
+				sprintf(IBM_DB_ERR(__python_stmt_err_msg), "Param %d: only input parameters can be streamed", curr->param_num);
+				return SQL_ERROR;
+			}
+			curr->stream = bind_data;
+			switch ( curr->data_type ) {
+				case SQL_BLOB:
+					valueType = SQL_C_BINARY;
+					break;
+				case SQL_CLOB:
+				case SQL_DBCLOB:
+					/* A stream of unicode is sent as SQLWCHAR data, like a
+					 * unicode value */
+					curr->stream_chunk = _python_ibm_db_next_stream_chunk(curr);
+					if ( curr->stream_chunk == NULL && PyErr_Occurred() ) {
+						/* Raised by the execute like the errors of later reads */
+						PyErr_Fetch(&type, &value, &traceback);
+						PyErr_NormalizeException(&type, &value, &traceback);
+						curr->stream_error = value;
+						Py_XDECREF(type);
+						Py_XDECREF(traceback);
+					}
+					if ( curr->stream_chunk != NULL && PyUnicode_Check(curr->stream_chunk) ) {
+						valueType = SQL_C_WCHAR;
+					} else {
+						valueType = SQL_C_CHAR;
+					}
+					break;
+				default:
+					curr->stream = NULL;
+					sprintf(IBM_DB_ERR(__python_stmt_err_msg), "Param %d: only BLOB, CLOB and DBCLOB parameters can be streamed", curr->param_num);
+					return SQL_ERROR;
+			}
+			curr->bind_indicator = SQL_DATA_AT_EXEC;
+#ifndef PASE
+			paramValuePtr = (SQLPOINTER)(curr);
+#else
+			paramValuePtr = (SQLPOINTER)&(curr);
+#endif
 
 			Py_BEGIN_ALLOW_THREADS;
 			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
-			curr->param_type, SQL_C_LONG, curr->data_type, curr->param_size,
-						curr->scale, &curr->ivalue, 0, NULL);
+				curr->param_type, valueType, curr->data_type, curr->param_size,
+				curr->scale, paramValuePtr, 0, &(curr->bind_indicator));
 			Py_END_ALLOW_THREADS;
 
 			if ( rc == SQL_ERROR ) {
 				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-												rc, 1, NULL, -1, 1);
+											rc, 1, NULL, -1, 1);
+				curr->stream = NULL;
 			}
-			curr->data_type = SQL_C_LONG;
 			break;
 
+		default:
+			return SQL_ERROR;
+	}
+	/* Only input params bound from the execute tuple are updated in place */
+	if ( rc == SQL_ERROR || curr->param_type != SQL_PARAM_INPUT ) {
+		curr->bound_type = 0;
+	}
+	return rc;
+}
+
+/*	static int _python_ibm_db_copy_bound_data(param_node *curr, PyObject *bind_data)
+	copies a value of the Python type the param was last bound for into
+	the buffers bound by the previous execute. Returns 0 when the value does
+	not fit and the param must be bound again
+*/
+static int _python_ibm_db_copy_bound_data(param_node *curr, PyObject *bind_data)
+{
+	Py_ssize_t length;
+	Py_UNICODE *pUnicode;
+	char *str;
+	int i;
+
+	switch ( curr->bound_type ) {
+		case PYTHON_FIXNUM:
+			curr->ivalue = (SQLINTEGER) PyLong_AsLong(bind_data);
+			return 1;
+
 		case PYTHON_FLOAT:
 			curr->fvalue = PyFloat_AsDouble(bind_data);
-			
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
-					curr->param_type, SQL_C_DOUBLE, curr->data_type, curr->param_size,
-					curr->scale, &curr->fvalue, 0, NULL);
-			Py_END_ALLOW_THREADS;
+			return 1;
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-												rc, 1, NULL, -1, 1);
+		/* The bound value or NULL indicator is unchanged */
+		case PYTHON_TRUE:
+		case PYTHON_FALSE:
+		case PYTHON_NIL:
+			return 1;
+
+		case PYTHON_STRING:
+			str = PyString_AS_STRING(bind_data);
+			length = strlen(str);
+			if ( length > curr->buffer_size ) {
+				return 0;
 			}
-			curr->data_type = SQL_C_DOUBLE;
-			break;
+			memcpy(curr->svalue, str, length + 1);
+			curr->bind_indicator = length;
+			return 1;
 
 		case PYTHON_UNICODE:
-			{
-				int isNewBuffer;
-				if(curr->data_type == SQL_BLOB || curr->data_type == SQL_BINARY || curr->data_type == SQL_VARBINARY) {
-					PyObject_AsReadBuffer(bind_data, (const void **) &(curr->uvalue), &buffer_len);
-					curr->ivalue = buffer_len;
-				} else {
-					if(curr->uvalue != NULL) {
-						PyMem_Del(curr->uvalue);
-						curr->uvalue = NULL;
+			length = PyUnicode_GET_SIZE(bind_data);
+			if ( length * sizeof(SQLWCHAR) > (size_t)curr->buffer_size ) {
+				return 0;
+			}
+			pUnicode = PyUnicode_AS_UNICODE(bind_data);
+			if ( is_ucs2_python ) {
+				memcpy(curr->uvalue, pUnicode, length * sizeof(SQLWCHAR));
+			} else {
+				for ( i = 0; i < length; i++ ) {
+					/* Characters outside the BMP take surrogate pairs */
+					if ( pUnicode[i] > 0xFFFF ) {
+						return 0;
 					}
-					curr->uvalue = getUnicodeDataAsSQLWCHAR(bind_data, &isNewBuffer);
-					curr->ivalue = PyUnicode_GetSize(bind_data);
-					curr->ivalue = curr->ivalue * sizeof(SQLWCHAR);
-				}
-				param_length = curr->ivalue;
-				if (curr->size != 0) {
-					curr->ivalue = (curr->size + 1) * sizeof(SQLWCHAR);
+					curr->uvalue[i] = (SQLWCHAR)pUnicode[i];
 				}
+			}
+			curr->uvalue[length] = 0;
+			curr->bind_indicator = length * sizeof(SQLWCHAR);
+			return 1;
+	}
+	return 0;
+}
 
-				if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-					if (curr->size == 0) {
-						if (curr->data_type == SQL_DBCLOB) {
-							if (curr->ivalue <= (curr->param_size * sizeof(SQLWCHAR))) {
-								curr->ivalue = (curr->param_size + 1) * sizeof(SQLWCHAR);
-							}
-						} else {
-							if (curr->ivalue <= curr->param_size) {
-								curr->ivalue = curr->param_size + sizeof(SQLWCHAR);
-							}
-						}
-					}
+/* static int _python_ibm_db_execute_helper2(stmt_res, data, int bind_cmp_list)
+	*/
+static int _python_ibm_db_execute_helper2(stmt_handle *stmt_res, PyObject *data, int bind_cmp_list)
+{
+	int rc = SQL_SUCCESS;
+	param_node *curr = NULL;	/* Cached param being bound */
+	PyObject *bind_data;		 /* Data value from symbol table */
+	char error[DB2_MAX_ERR_MSG_LEN];
+
+	/* Used in call to _python_ibm_db_describe_param if needed */
+	SQLSMALLINT param_no;
+	SQLSMALLINT data_type;
+	SQLUINTEGER precision;
+	SQLSMALLINT scale;
+	SQLSMALLINT nullable;
+
+	/* This variable means that we bind the complete list of params cached */
+	/* The values used are fetched from the active symbol table */
+	/* TODO: Enhance this part to check for stmt_res->file_param */
+	/* If this flag is set, then use SQLBindParam, else use SQLExtendedBind */
+	if ( bind_cmp_list ) {
+		/* Bind the complete list sequentially */
+		/* Used when no parameters array is passed in */
+		for ( param_no = 0; param_no < stmt_res->param_cache_size; param_no++ ) {
+			curr = &stmt_res->param_cache[param_no];
+			if ( curr->param_num == 0 ) {
+				continue;
+			}
+			/* Fetch data from symbol table */
+			if (curr->param_type == PARAM_FILE)
+				bind_data = curr->var_pyvalue;
+			else {
+				bind_data = curr->var_pyvalue;
+			}
+			if (bind_data == NULL)
+				return -1;
+				
+			rc = _python_ibm_db_bind_data( stmt_res, curr, bind_data);
+			if ( rc == SQL_ERROR ) {
+				sprintf(error, "Binding Error 1: %s", 
+						IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return rc;
+			}
+		}
+		return 0;
+	} else {
+		/* Bind only the data value passed in to the next param */
+		if ( data != NULL ) {
+			param_no = ++stmt_res->current_param;
+			curr = NULL;
+			if ( param_no <= stmt_res->param_cache_size ) {
+				curr = &stmt_res->param_cache[param_no - 1];
+				if ( curr->param_num == 0 ) {
+					curr = NULL;
+				}
+			}
+			/* Values of the type bound by the previous execute are copied
+			 * into the bound buffers, without binding the param again */
+			if ( curr != NULL && stmt_res->dynamic_params && curr->bound_type == TYPE(data)
+					&& _python_ibm_db_copy_bound_data(curr, data) ) {
+				return SQL_SUCCESS;
+			}
+			if ( curr == NULL || stmt_res->dynamic_params ) {
+				/* This condition applies if the parameter has not been
+				* bound using ibm_db.bind_param. The description is
+				* cached on the statement, the entry and its buffers are
+				* reused by the next execute.
+				*/
+				rc = _python_ibm_db_describe_param(stmt_res, param_no, &data_type,
+					&precision, &scale, &nullable);
+				if ( rc == SQL_ERROR ) {
+					sprintf(error, "Describe Param Failed: %s", 
+							IBM_DB_ERR(__python_stmt_err_msg));
+					PyErr_SetString(PyExc_Exception, error);
+					return rc;
 				}
 
-				if (isNewBuffer == 0 ){
-					/* actually make a copy, since this will uvalue will be freed explicitly */
-					SQLWCHAR* tmp = (SQLWCHAR*)ALLOC_N(SQLWCHAR, curr->ivalue + 1);
-					memcpy(tmp, curr->uvalue, (param_length + sizeof(SQLWCHAR)));
-					curr->uvalue = tmp;
+				curr = _python_ibm_db_set_param_node(stmt_res, param_no, data_type,
+							  precision, scale, nullable);
+				if ( curr == NULL ) {
+					return SQL_ERROR;
 				}
-				
-				switch( curr->data_type ){
-					case SQL_CLOB:
-                    case SQL_DBCLOB:
-						if(curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT){
-							curr->bind_indicator = param_length;
-							paramValuePtr = (SQLPOINTER)curr->uvalue;
-						} else {
-							curr->bind_indicator = SQL_DATA_AT_EXEC;
-#ifndef PASE
-							paramValuePtr = (SQLPOINTER)(curr);
-#else
-							paramValuePtr = (SQLPOINTER)&(curr);
-#endif
-						}
-						valueType = SQL_C_WCHAR;
-						break;
-					
-					case SQL_BLOB:
-						if (curr->param_type == SQL_PARAM_OUTPUT ||curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-							curr->bind_indicator =  param_length;
-							valueType = SQL_C_BINARY;
-							paramValuePtr = (SQLPOINTER)curr;
-						} else {
-							curr->bind_indicator = SQL_DATA_AT_EXEC;
-							valueType = SQL_C_BINARY;
-#ifndef PASE
-							paramValuePtr = (SQLPOINTER)(curr);
-#else
-							paramValuePtr = (SQLPOINTER)&(curr);
-#endif
-						}
-						break;
-					
-					case SQL_BINARY:
-#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
-					case SQL_LONGVARBINARY:
-#endif /* PASE */
-					case SQL_VARBINARY:
-						/* account for bin_mode settings as well */
-						curr->bind_indicator = param_length;
-						valueType = SQL_C_BINARY;
-						paramValuePtr = (SQLPOINTER)curr->uvalue;
-						break;
+				curr->param_type = SQL_PARAM_INPUT;
+			}
+			/* Param bound using ibm_db.bind_param or described above */
+			rc = _python_ibm_db_bind_data( stmt_res, curr, data);
+			if ( rc == SQL_ERROR ) {
+				sprintf(error, "Binding Error 2: %s", 
+						IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return rc;
+			}
+			return rc;
+		}
+	}
+	return rc;
+}
+
+/*	static int _python_ibm_db_put_stream_data(stmt_handle *stmt_res, param_node *curr)
+	sends the data of a streamed LOB parameter with one SQLPutData call per
+	chunk. A CLOB or DBCLOB stream whose first chunk is unicode is bound as
+	SQL_C_WCHAR and must go on with unicode, the others must produce
+	strings. Returns SQL_ERROR with a Python exception set when the stream
+	fails or produces a value of the wrong type
+*/
+static int _python_ibm_db_put_stream_data(stmt_handle *stmt_res, param_node *curr)
+{
+	int rc = SQL_SUCCESS;
+	int sent = 0;
+	int is_wide = 0;
+	PyObject *chunk = NULL;
+	PyObject *encoded = NULL;
+	const void *data = NULL;
+	Py_ssize_t length = 0;
+
+	/* The first chunk decided how the stream was bound */
+	if ( curr->stream_chunk != NULL && PyUnicode_Check(curr->stream_chunk) ) {
+		is_wide = 1;
+	}
+	while ( (chunk = _python_ibm_db_next_stream_chunk(curr)) != NULL ) {
+		if ( PyUnicode_Check(chunk) != is_wide ) {
+			Py_DECREF(chunk);
+			if ( curr->data_type == SQL_BLOB ) {
+				PyErr_Format(PyExc_Exception, "LOB stream of param %d must produce strings", curr->param_num);
+			} else {
+				PyErr_Format(PyExc_Exception, "LOB stream of param %d mixes strings and unicode", curr->param_num);
+			}
+			return SQL_ERROR;
+		}
+		if ( !is_wide ) {
+			PyObject_AsReadBuffer(chunk, &data, &length);
+		} else if ( is_ucs2_python ) {
+			data = PyUnicode_AS_UNICODE(chunk);
+			length = PyUnicode_GET_SIZE(chunk) * sizeof(SQLWCHAR);
+		} else {
+			/* Characters outside the BMP take surrogate pairs */
+			encoded = PyCodec_Encode(chunk, sqlwchar_byteorder == 1 ? "utf-16-be" : "utf-16-le", "strict");
+			if ( encoded == NULL ) {
+				Py_DECREF(chunk);
+				return SQL_ERROR;
+			}
+			data = PyString_AS_STRING(encoded);
+			length = PyString_GET_SIZE(encoded);
+		}
+
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLPutData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER)data, length);
+		Py_END_ALLOW_THREADS;
+
+		Py_CLEAR(encoded);
+		Py_DECREF(chunk);
+		if ( rc == SQL_ERROR ) {
+			return rc;
+		}
+		sent = 1;
+	}
+	if ( PyErr_Occurred() ) {
+		return SQL_ERROR;
+	}
+
+	/* An empty stream sends a zero length value */
+	if ( !sent ) {
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLPutData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER)"", 0);
+		Py_END_ALLOW_THREADS;
+	}
+	return rc;
+}
+
+/*	static int _python_ibm_db_bind_execute_params(stmt_handle *stmt_res, PyObject *parameters_tuple)
+	closes the cursor of the previous execute and binds the parameters of the
+	next one from parameters_tuple, or checks the values bound with
+	ibm_db.bind_param. Returns -1 with a Python exception set on failure
+*/
+static int _python_ibm_db_bind_execute_params(stmt_handle *stmt_res, PyObject *parameters_tuple)
+{
+	int rc, numOpts, i;
+	SQLSMALLINT num;
+	PyObject *data;
+	char error[DB2_MAX_ERR_MSG_LEN];
+
+	if ( stmt_res->async_pending ) {
+		PyErr_SetString(PyExc_Exception, "Statement has an asynchronous execute pending");
+		return -1;
+	}
+	/* Free any cursors that might have been allocated in a previous call to 
+	* SQLExecute 
+	*/
+	Py_BEGIN_ALLOW_THREADS;
+	SQLFreeStmt((SQLHSTMT)stmt_res->hstmt, SQL_CLOSE);
+	Py_END_ALLOW_THREADS;
+
+	/* This ensures that each call to ibm_db.execute start from scratch */
+	stmt_res->current_param = 0;
+	stmt_res->rows_fetched = 0;
+	stmt_res->row_block_pos = 0;
+	
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLNumParams((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT*)&num);
+	Py_END_ALLOW_THREADS;
+	
+	if ( num != 0 ) {
+		/* The cache entries are bound by address, size the cache before
+		 * binding any of them */
+		if ( _python_ibm_db_alloc_param_cache(stmt_res, num) ) {
+			return -1;
+		}
+		/* Parameter Handling */
+		if ( !NIL_P(parameters_tuple) ) {
+			/* Parameters not bound with ibm_db.bind_param are bound
+			 * from the tuple, their entries stay in the cache so the
+			 * next execute reuses the description and the buffers
+			 */
+			if ( stmt_res->num_params == 0 ) {
+				stmt_res->dynamic_params = 1;
+			}
+
+			if (!PyTuple_Check(parameters_tuple)) {
+				PyErr_SetString(PyExc_Exception, "Param is not a tuple");
+				return -1;
+			}
 
-					case SQL_XML:
-						curr->bind_indicator = param_length;
-						paramValuePtr = (SQLPOINTER)curr->uvalue;
-						valueType = SQL_C_WCHAR;
-						break;
-					
-					default:
-						valueType = SQL_C_WCHAR;
-						curr->bind_indicator = param_length;
-						paramValuePtr = (SQLPOINTER)(curr->uvalue);
-				}
+			numOpts = PyTuple_Size(parameters_tuple);
+	
+			if (numOpts > num) {
+				/* More are passed in -- Warning - Use the max number present */
+				sprintf(error, "%d params bound not matching %d required", 
+						numOpts, num);
+				PyErr_SetString(PyExc_Exception, error);
+				numOpts = stmt_res->num_params;
+			} else if (numOpts < num) {
+				/* If there are less params passed in, than are present 
+				* -- Error 
+				*/
+				sprintf(error, "%d params bound not matching %d required", 
+						numOpts, num);
+				PyErr_SetString(PyExc_Exception, error);
+				return -1;
+			}
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num, curr->param_type, valueType, curr->data_type, curr->param_size, curr->scale, paramValuePtr, curr->ivalue, &(curr->bind_indicator));
-				Py_END_ALLOW_THREADS;
+			for ( i = 0; i < numOpts; i++) {
+				/* Bind values from the parameters_tuple to params */
+				data = PyTuple_GetItem(parameters_tuple, i);
 
+				/* The 0 denotes that you work only with the current node.
+				* Parameters without a cache entry are described once,
+				* on the first execute.
+				*/
+				rc = _python_ibm_db_execute_helper2(stmt_res, data, 0);
+				if ( rc == SQL_ERROR) {
+					sprintf(error, "Binding Error: %s", IBM_DB_ERR(__python_stmt_err_msg));
+					PyErr_SetString(PyExc_Exception, error);
+					return -1;
+				}
+			}
+		} else {
+			/* No additional params passed in. Use values already bound. */
+			if ( num > stmt_res->num_params ) {
+				/* More parameters than we expected */
+				sprintf(error, "%d params bound not matching %d required", 
+						stmt_res->num_params, num);
+				PyErr_SetString(PyExc_Exception, error);
+			} else if ( num < stmt_res->num_params ) {
+				/* Fewer parameters than we expected */
+				sprintf(error, "%d params bound not matching %d required", 
+						stmt_res->num_params, num);
+				PyErr_SetString(PyExc_Exception, error);
+				return -1;
+			}
+			
+			/* Param cache is empty or only holds values of a previous
+			 * execute -- No params bound */
+			if ( stmt_res->num_params == 0 || stmt_res->dynamic_params ) {
+				PyErr_SetString(PyExc_Exception, "Parameters not bound");
+				return -1;
+			} else {
+				/* The 1 denotes that you work with the whole list 
+				 * And bind sequentially 				
+				 */
+				rc = _python_ibm_db_execute_helper2(stmt_res, NULL, 1);
 				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+					sprintf(error, "Binding Error 3: %s", IBM_DB_ERR(__python_stmt_err_msg));
+					PyErr_SetString(PyExc_Exception, error);
+					return -1;
 				}
-				curr->data_type = valueType;
 			}
-			break;
+		}
+	}
+	return 0;
+}
+
+/*	static PyObject *_python_ibm_db_execute_result(stmt_handle *stmt_res, int rc)
+	completes the execute that SQLExecute returned rc for, sending the data
+	of the params bound with SQL_DATA_AT_EXEC. Returns Py_True, or NULL with
+	a Python exception set
+*/
+static PyObject *_python_ibm_db_execute_result(stmt_handle *stmt_res, int rc)
+{
+	SQLPOINTER valuePtr;
+	char error[DB2_MAX_ERR_MSG_LEN];
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		sprintf(error, "Statement Execute Failed: %s", IBM_DB_ERR(__python_stmt_err_msg));
+		PyErr_SetString(PyExc_Exception, error);
+		return NULL;
+	}
 		
-		case PYTHON_STRING:
-			{
-				char* tmp;
-				if (curr->data_type == SQL_BLOB || curr->data_type == SQL_BINARY
-											 || curr->data_type == SQL_VARBINARY ) {
-					PyObject_AsReadBuffer(bind_data, (const void **) &(curr->svalue), &buffer_len);
-					curr->ivalue = buffer_len;
-				} else {
-					if(curr->svalue != NULL) {
-						PyMem_Del(curr->svalue);
-						curr->svalue = NULL;
-					}
-					curr->svalue = PyString_AsString(bind_data);
-					curr->ivalue = strlen(curr->svalue);
-				}
-				param_length = curr->ivalue;
-				/*
-				* An extra parameter is given by the client to pick the size of the 
-				* string returned. The string is then truncate past that size.	
-				* If no size is given then use BUFSIZ to return the string.
-				*/
-				if (curr->size != 0) {
-					curr->ivalue = curr->size;
-				}
-	            
-				if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-					if (curr->size == 0) {
-						if (curr->ivalue <= curr->param_size) {
-							curr->ivalue = curr->param_size + 1;
-						}
-					}
+	if ( rc == SQL_NEED_DATA ) {
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLParamData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER *)&valuePtr);
+		Py_END_ALLOW_THREADS;
+		while ( rc == SQL_NEED_DATA ) {
+			/* passing data value for a parameter */
+			if ( ((param_node*)valuePtr)->stream != NULL ) {
+				rc = _python_ibm_db_put_stream_data(stmt_res, (param_node*)valuePtr);
+				if ( rc == SQL_ERROR && PyErr_Occurred() ) {
+					/* Ends the data at execute sequence of the statement */
+					Py_BEGIN_ALLOW_THREADS;
+					SQLCancel((SQLHSTMT)stmt_res->hstmt);
+					Py_END_ALLOW_THREADS;
+					return NULL;
 				}
+			} else if ( !NIL_P(((param_node*)valuePtr)->svalue)) {
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLPutData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER)(((param_node*)valuePtr)->svalue), ((param_node*)valuePtr)->ivalue);
+				Py_END_ALLOW_THREADS;
+			} else {
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLPutData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER)(((param_node*)valuePtr)->uvalue), ((param_node*)valuePtr)->ivalue);
+				Py_END_ALLOW_THREADS;
+			}
 			
-				tmp = ALLOC_N(char, curr->ivalue+1);
-				curr->svalue = memcpy(tmp, curr->svalue, param_length);
-				curr->svalue[param_length] = '\0';
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,
+						rc, 1, NULL, -1, 1);
+				sprintf(error, "Sending data failed: %s", 
+						IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
+				return NULL;
+			}
 
-				switch ( curr->data_type ) {
-					case SQL_CLOB:
-					case SQL_DBCLOB:
-						if (curr->param_type == SQL_PARAM_OUTPUT || 
-							curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-							curr->bind_indicator = param_length;
-							valueType = SQL_C_CHAR;
-							paramValuePtr = (SQLPOINTER)curr->svalue;
-						} else {
-							curr->bind_indicator = SQL_DATA_AT_EXEC;
-							valueType = SQL_C_CHAR;
-							/* The correct dataPtr will be set during SQLPutData with 
-							* the len from this struct 
-							*/
-#ifndef PASE
-							paramValuePtr = (SQLPOINTER)(curr);
-#else
-							paramValuePtr = (SQLPOINTER)&(curr);
-#endif
-						}
-						break;
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLParamData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER *)&valuePtr);
+			Py_END_ALLOW_THREADS;
+		}
 
-					case SQL_BLOB:
-						if (curr->param_type == SQL_PARAM_OUTPUT || 
-							curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-							curr->ivalue = curr->ivalue -1;
-							curr->bind_indicator = param_length;
-							valueType = SQL_C_BINARY;
-							paramValuePtr = (SQLPOINTER)curr;
-						} else {
-							curr->bind_indicator = SQL_DATA_AT_EXEC;
-							valueType = SQL_C_BINARY;
-#ifndef PASE
-							paramValuePtr = (SQLPOINTER)(curr);
-#else
-							paramValuePtr = (SQLPOINTER)&(curr);
-#endif
-						}
-						break;
+		if ( rc == SQL_ERROR ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+			sprintf(error, "Sending data failed: %s", IBM_DB_ERR(__python_stmt_err_msg));
+			PyErr_SetString(PyExc_Exception, error);
+			return NULL;
+		}
+	}
+	
+	if ( rc != SQL_ERROR ) {
+		Py_INCREF(Py_True);
+		return Py_True;
+	}
+	return NULL;
+}
 
-					case SQL_BINARY:
-#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
-					case SQL_LONGVARBINARY:
-#endif /* PASE */
-					case SQL_VARBINARY:
-					case SQL_XML:
-						/* account for bin_mode settings as well */
-						curr->bind_indicator = curr->ivalue;
-						if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-							curr->ivalue = curr->ivalue - 1;
-							curr->bind_indicator = param_length;
-						}
-						valueType = SQL_C_BINARY;
-						paramValuePtr = (SQLPOINTER)curr->svalue;
-						break;
+/*
+ * static PyObject *_python_ibm_db_execute_helper1(stmt_handle *stmt_res, PyObject *parameters_tuple)
+ *
+ */ 
+static PyObject *_python_ibm_db_execute_helper1(stmt_handle *stmt_res, PyObject *parameters_tuple)
+{
+	int rc;
+	double stats_start, trace_start;
+	PyObject *result;
+
+	if ( _python_ibm_db_bind_execute_params(stmt_res, parameters_tuple) ) {
+		return NULL;
+	}
+	STATS_ADD(stmt_res, params_bound, stmt_res->num_params);
+
+	STATS_START(stats_start);
+	TRACE_START(trace_start);
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLExecute((SQLHSTMT)stmt_res->hstmt);
+	Py_END_ALLOW_THREADS;
+	STATS_TIME(stmt_res, STATS_EXECUTE, stats_start);
+
+	result = _python_ibm_db_execute_result(stmt_res, rc);
+	if ( trace_start != 0.0 ) {
+		/* the data at execute parameters were sent by then */
+		_python_ibm_db_trace_execute(stmt_res, result == NULL ? SQL_ERROR : rc, trace_start);
+	}
+	return result;
+}
+
+/*!# ibm_db.execute
+ *
+ * ===Description
+ * Py_True/Py_False ibm_db.execute ( IBM_DBStatement stmt [, tuple parameters] )
+ *
+ * ibm_db.execute() executes an SQL statement that was prepared by
+ * ibm_db.prepare().
+ *
+ * If the SQL statement returns a result set, for example, a SELECT statement
+ * or a CALL to a stored procedure that returns one or more result sets, you
+ * can retrieve a row as an tuple/dictionary from the stmt resource using
+ * ibm_db.fetch_assoc(), ibm_db.fetch_both(), or ibm_db.fetch_tuple().
+ * Alternatively, you can use ibm_db.fetch_row() to move the result set pointer
+ * to the next row and fetch a column at a time from that row with
+ * ibm_db.result().
+ *
+ * Refer to ibm_db.prepare() for a brief discussion of the advantages of using
+ * ibm_db.prepare() and ibm_db.execute() rather than ibm_db.exec().
+ *
+ * ===Parameters
+ * ====stmt
+ *
+ *		A prepared statement returned from ibm_db.prepare().
+ *
+ * ====parameters
+ *
+ *		An tuple of input parameters matching any parameter markers contained
+ * in the prepared statement.
+ *
+ *		The value of a BLOB, CLOB or DBCLOB input parameter can be a file-like
+ * object or an iterator of strings. Its data is sent to the server while the
+ * statement executes, in read() calls of 64 KB or one
+ * item of the iterator at a time, so the value is never held in memory whole.
+ * A CLOB or DBCLOB stream can also produce unicode, such as a text file of
+ * io.open() or codecs.open(), and is then sent as SQLWCHAR data. The first
+ * chunk is read when the parameter is bound.
+ * The object is left at its end when execute returns.
+ *
+ * ===Return Values
+ *
+ * Returns Py_True on success or Py_False on failure.
+ */
+static PyObject *ibm_db_execute(PyObject *self, PyObject *args)			
+{
+	PyObject *parameters_tuple = NULL;
+	stmt_handle *stmt_res;
+	if (!PyArg_ParseTuple(args, "O|O", &stmt_res, &parameters_tuple))
+		return NULL;
 
-						/* This option should handle most other types such as DATE, 
-						* VARCHAR etc 
-						*/
-					default:
-						valueType = SQL_C_CHAR;
-						curr->bind_indicator = curr->ivalue;
-						if (curr->param_type == SQL_PARAM_OUTPUT || curr->param_type == SQL_PARAM_INPUT_OUTPUT) {
-							curr->bind_indicator = SQL_NTS;
-						}	
-						paramValuePtr = (SQLPOINTER)(curr->svalue);
-					}
-		
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
-					curr->param_type, valueType, curr->data_type, curr->param_size,
-					curr->scale, paramValuePtr, curr->ivalue, &(curr->bind_indicator));
-				Py_END_ALLOW_THREADS;
+	if (!NIL_P(stmt_res)) {
+		return _python_ibm_db_execute_helper1(stmt_res, parameters_tuple);
+	} else {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-											rc, 1, NULL, -1, 1);
-				}
-				curr->data_type = valueType;
-			}
-				break;
 
-		case PYTHON_DECIMAL:
-			if (curr->data_type == SQL_DECIMAL || curr->data_type == SQL_DECFLOAT) {
-				PyObject *tempobj = NULL;
-				if(curr->svalue != NULL) {
-					PyMem_Del(curr->svalue);
-					curr->svalue = NULL;
-				}
-				tempobj = PyObject_Str(bind_data);
-				curr->svalue = PyString_AsString(tempobj);
-				curr->ivalue = strlen(curr->svalue);
-				curr->svalue = estrdup(curr->svalue);
-				curr->svalue[curr->ivalue] = '\0'; 
-				valueType = SQL_C_CHAR;
-				paramValuePtr = (SQLPOINTER)(curr->svalue);
-				curr->bind_indicator = curr->ivalue;
+/* Execute started by ibm_db.execute_async. In ASYNC_CLI mode SQLExecute is
+ * called again on the statement until it no longer returns
+ * SQL_STILL_EXECUTING, in ASYNC_THREAD mode it is queued for a worker
+ * thread, which calls it once and releases lock when it returns */
+typedef struct _async_handle_struct {
+	PyObject_HEAD
+	stmt_handle *stmt;
+	int mode;
+	int done;					/* rc of the execute is known */
+	int rc;						/* return code of SQLExecute */
+	PyThread_type_lock lock;	/* held until the worker thread has executed */
+	int notify_fd[2];			/* pipe the worker writes a byte to, -1 when not open */
+	int queued;					/* waits in async_queue for a worker */
+	struct _async_handle_struct *next_queued;
+	int collected;				/* result() completed the execute */
+	PyObject *exc_type;			/* exception result() raised, NULL on success */
+	PyObject *exc_value;
+	PyObject *exc_tb;
+} async_handle;
+
+static PyTypeObject async_handleType;
+
+/* Worker thread of the ASYNC_THREAD executes, sleeping on wake when the
+ * queue is empty */
+typedef struct _async_worker_struct {
+	PyThread_type_lock wake;	/* held while the worker sleeps */
+	struct _async_worker_struct *next_idle;
+} async_worker;
+
+/* Queue of the ASYNC_THREAD executes and the idle workers, guarded by
+ * async_queue_lock as the workers run without the GIL */
+static PyThread_type_lock async_queue_lock = NULL;
+static async_handle *async_queue_head = NULL;
+static async_handle *async_queue_tail = NULL;
+static async_worker *async_idle_workers = NULL;
+static int async_num_workers = 0;
+
+/*	static void _python_ibm_db_async_worker(void *arg)
+	body of a worker thread, runs the queued executes without the GIL and
+	does not touch a handle once its lock is released
+*/
+static void _python_ibm_db_async_worker(void *arg)
+{
+	async_worker *worker = (async_worker *)arg;
+	async_handle *handle;
+
+	for ( ;; ) {
+		PyThread_acquire_lock(async_queue_lock, WAIT_LOCK);
+		handle = async_queue_head;
+		if ( handle != NULL ) {
+			async_queue_head = handle->next_queued;
+			if ( async_queue_head == NULL ) {
+				async_queue_tail = NULL;
+			}
+			handle->queued = 0;
+		} else {
+			worker->next_idle = async_idle_workers;
+			async_idle_workers = worker;
+		}
+		PyThread_release_lock(async_queue_lock);
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLBindParameter(stmt_res->hstmt, curr->param_num, curr->param_type, valueType, curr->data_type, curr->param_size, curr->scale, paramValuePtr, curr->ivalue, &(curr->bind_indicator));
-				Py_END_ALLOW_THREADS;
+		if ( handle == NULL ) {
+			/* Until _python_ibm_db_async_start releases wake */
+			PyThread_acquire_lock(worker->wake, WAIT_LOCK);
+			continue;
+		}
+		handle->rc = SQLExecute((SQLHSTMT)handle->stmt->hstmt);
+#ifndef _WIN32
+		if ( handle->notify_fd[1] != -1 ) {
+			if ( write(handle->notify_fd[1], "", 1) < 0 ) {
+				/* Nothing waits on the pipe */
+			}
+		}
+#endif
+		PyThread_release_lock(handle->lock);
+	}
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,rc, 1, NULL, -1, 1);
+/*	static int _python_ibm_db_async_dequeue(async_handle *handle)
+	takes an ASYNC_THREAD execute no worker has started out of the queue,
+	returns 1 when it was still queued
+*/
+static int _python_ibm_db_async_dequeue(async_handle *handle)
+{
+	async_handle **link, *previous = NULL;
+	int removed = 0;
+
+	PyThread_acquire_lock(async_queue_lock, WAIT_LOCK);
+	if ( handle->queued ) {
+		for ( link = &async_queue_head; *link != NULL; link = &(*link)->next_queued ) {
+			if ( *link == handle ) {
+				*link = handle->next_queued;
+				if ( async_queue_tail == handle ) {
+					async_queue_tail = previous;
 				}
-				curr->data_type = valueType;
-				Py_XDECREF(tempobj);
 				break;
 			}
+			previous = *link;
+		}
+		handle->queued = 0;
+		removed = 1;
+	}
+	PyThread_release_lock(async_queue_lock);
+	return removed;
+}
 
+/*	static int _python_ibm_db_async_start(async_handle *handle)
+	queues an ASYNC_THREAD execute and wakes an idle worker, or starts one
+	while there are fewer than ASYNC_THREAD_WORKERS. Returns -1 when no
+	worker can run it
+*/
+static int _python_ibm_db_async_start(async_handle *handle)
+{
+	async_worker *worker = NULL;
+	int start_worker = 0;
 
-		case PYTHON_NIL:
-			curr->ivalue = SQL_NULL_DATA;
-
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLBindParameter(stmt_res->hstmt, curr->param_num,
-				curr->param_type, SQL_C_DEFAULT, curr->data_type, curr->param_size,
-				curr->scale, &curr->ivalue, 0, (SQLLEN *)&(curr->ivalue));
-			Py_END_ALLOW_THREADS;
+	if ( async_queue_lock == NULL ) {
+		async_queue_lock = PyThread_allocate_lock();
+		if ( async_queue_lock == NULL ) {
+			return -1;
+		}
+	}
+	PyThread_acquire_lock(async_queue_lock, WAIT_LOCK);
+	handle->queued = 1;
+	handle->next_queued = NULL;
+	if ( async_queue_tail != NULL ) {
+		async_queue_tail->next_queued = handle;
+	} else {
+		async_queue_head = handle;
+	}
+	async_queue_tail = handle;
+	if ( async_idle_workers != NULL ) {
+		worker = async_idle_workers;
+		async_idle_workers = worker->next_idle;
+	} else if ( async_num_workers < ASYNC_THREAD_WORKERS ) {
+		async_num_workers++;
+		start_worker = 1;
+	}
+	PyThread_release_lock(async_queue_lock);
 
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
-											rc, 1, NULL, -1, 1);
+	if ( worker != NULL ) {
+		PyThread_release_lock(worker->wake);
+		return 0;
+	}
+	if ( !start_worker ) {
+		/* A busy worker takes it from the queue */
+		return 0;
+	}
+	worker = (async_worker *)malloc(sizeof(async_worker));
+	if ( worker != NULL ) {
+		worker->wake = PyThread_allocate_lock();
+		if ( worker->wake != NULL ) {
+			PyThread_acquire_lock(worker->wake, WAIT_LOCK);
+			if ( PyThread_start_new_thread(_python_ibm_db_async_worker, worker) != -1 ) {
+				return 0;
 			}
-			break;
-
-		default:
-			return SQL_ERROR;
+			PyThread_free_lock(worker->wake);
+		}
+		free(worker);
 	}
-	return rc;
+	PyThread_acquire_lock(async_queue_lock, WAIT_LOCK);
+	async_num_workers--;
+	start_worker = async_num_workers;
+	PyThread_release_lock(async_queue_lock);
+	if ( start_worker == 0 && _python_ibm_db_async_dequeue(handle) ) {
+		return -1;
+	}
+	return 0;
 }
 
-/* static int _python_ibm_db_execute_helper2(stmt_res, data, int bind_cmp_list)
-	*/
-static int _python_ibm_db_execute_helper2(stmt_handle *stmt_res, PyObject *data, int bind_cmp_list, int bind_params)
+/*	static int _python_ibm_db_async_complete(async_handle *self, int wait)
+	checks whether the SQLExecute of the handle has returned, waiting for it
+	with the GIL released when wait is set. Returns 1 once it has
+*/
+static int _python_ibm_db_async_complete(async_handle *self, int wait)
 {
-	int rc = SQL_SUCCESS;
-	param_node *curr = NULL;	/* To traverse the list */
-	PyObject *bind_data;		 /* Data value from symbol table */
-	char error[DB2_MAX_ERR_MSG_LEN];
-
-	/* Used in call to SQLDescribeParam if needed */
-	SQLSMALLINT param_no;
-	SQLSMALLINT data_type;
-	SQLUINTEGER precision;
-	SQLSMALLINT scale;
-	SQLSMALLINT nullable;
-
-	/* This variable means that we bind the complete list of params cached */
-	/* The values used are fetched from the active symbol table */
-	/* TODO: Enhance this part to check for stmt_res->file_param */
-	/* If this flag is set, then use SQLBindParam, else use SQLExtendedBind */
-	if ( bind_cmp_list ) {
-		/* Bind the complete list sequentially */
-		/* Used when no parameters array is passed in */
-		curr = stmt_res->head_cache_list;
+	int rc;
 
-		while (curr != NULL ) {
-			/* Fetch data from symbol table */
-			if (curr->param_type == PARAM_FILE)
-				bind_data = curr->var_pyvalue;
-			else {
-				bind_data = curr->var_pyvalue;
-			}
-			if (bind_data == NULL)
-				return -1;
-				
-			rc = _python_ibm_db_bind_data( stmt_res, curr, bind_data);
-			if ( rc == SQL_ERROR ) {
-				sprintf(error, "Binding Error 1: %s", 
-						IBM_DB_G(__python_stmt_err_msg));
-				PyErr_SetString(PyExc_Exception, error);
-				return rc;
-			}
-			curr = curr->next;
+	if ( self->done ) {
+		return 1;
+	}
+	if ( self->mode == ASYNC_THREAD ) {
+		if ( wait ) {
+			Py_BEGIN_ALLOW_THREADS;
+			PyThread_acquire_lock(self->lock, WAIT_LOCK);
+			Py_END_ALLOW_THREADS;
+		} else if ( !PyThread_acquire_lock(self->lock, NOWAIT_LOCK) ) {
+			return 0;
 		}
-		return 0;
+		PyThread_release_lock(self->lock);
 	} else {
-		/* Bind only the data value passed in to the Current Node */
-		if ( data != NULL ) {
-			if ( bind_params ) {
-				/* This condition applies if the parameter has not been
-				* bound using ibm_db.bind_param. Need to describe the
-				* parameter and then bind it.
-				*/
-				param_no = ++stmt_res->num_params;
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLExecute((SQLHSTMT)self->stmt->hstmt);
+		while ( wait && rc == SQL_STILL_EXECUTING ) {
+			POOL_SLEEP(ASYNC_POLL_INTERVAL);
+			rc = SQLExecute((SQLHSTMT)self->stmt->hstmt);
+		}
+		Py_END_ALLOW_THREADS;
 
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, param_no,
-					(SQLSMALLINT*)&data_type, &precision, (SQLSMALLINT*)&scale,
-					(SQLSMALLINT*)&nullable);
-				Py_END_ALLOW_THREADS;
+		if ( rc == SQL_STILL_EXECUTING ) {
+			return 0;
+		}
+		self->rc = rc;
+		/* Later calls on the statement run synchronously again */
+		SQLSetStmtAttr((SQLHSTMT)self->stmt->hstmt, SQL_ATTR_ASYNC_ENABLE,
+			(SQLPOINTER)SQL_ASYNC_ENABLE_OFF, 0);
+	}
+	self->done = 1;
+	self->stmt->async_pending = 0;
+	return 1;
+}
 
-				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,
-												rc, 1, NULL, -1, 1);
-					sprintf(error, "Describe Param Failed: %s", 
-							IBM_DB_G(__python_stmt_err_msg));
-					PyErr_SetString(PyExc_Exception, error);
-					return rc;
-				}
+static void _python_ibm_db_free_async_handle(async_handle *self)
+{
+	if ( self->stmt != NULL && !self->done && self->mode == ASYNC_THREAD &&
+			_python_ibm_db_async_dequeue(self) ) {
+		/* The execute is abandoned before a worker started it */
+		PyThread_release_lock(self->lock);
+		self->done = 1;
+		self->stmt->async_pending = 0;
+	}
+	if ( self->stmt != NULL && !self->done ) {
+		/* The execute is abandoned, it must have returned before the
+		 * statement is released */
+		Py_BEGIN_ALLOW_THREADS;
+		SQLCancel((SQLHSTMT)self->stmt->hstmt);
+		Py_END_ALLOW_THREADS;
+		_python_ibm_db_async_complete(self, 1);
+	}
+	if ( self->lock != NULL ) {
+		PyThread_free_lock(self->lock);
+	}
+#ifndef _WIN32
+	if ( self->notify_fd[0] != -1 ) {
+		close(self->notify_fd[0]);
+		close(self->notify_fd[1]);
+	}
+#endif
+	Py_XDECREF(self->exc_type);
+	Py_XDECREF(self->exc_value);
+	Py_XDECREF(self->exc_tb);
+	Py_XDECREF(self->stmt);
+	self->ob_type->tp_free((PyObject*)self);
+}
 
-				curr = build_list(stmt_res, param_no, data_type, precision, 
-							  scale, nullable);
-				rc = _python_ibm_db_bind_data( stmt_res, curr, data);
-				if ( rc == SQL_ERROR ) {
-					sprintf(error, "Binding Error 2: %s", 
-							IBM_DB_G(__python_stmt_err_msg));
-					PyErr_SetString(PyExc_Exception, error);
-					return rc;
-				}
-			} else {
-				/* This is always at least the head_cache_node -- assigned in
-				* ibm_db.execute(), if params have been bound.
-				*/
-				curr = stmt_res->current_node;
-				if ( curr != NULL ) {
-					rc = _python_ibm_db_bind_data( stmt_res, curr, data);
-					if ( rc == SQL_ERROR ) {
-						sprintf(error, "Binding Error 2: %s", 
-							IBM_DB_G(__python_stmt_err_msg));
-						PyErr_SetString(PyExc_Exception, error);
-						return rc;
-					}
-					stmt_res->current_node = curr->next;
-				}
-			}
-			return rc;
+static PyObject *_python_ibm_db_async_poll(async_handle *self)
+{
+	return PyBool_FromLong(_python_ibm_db_async_complete(self, 0));
+}
+
+static PyObject *_python_ibm_db_async_fileno(async_handle *self)
+{
+#ifndef _WIN32
+	if ( self->notify_fd[0] != -1 ) {
+		return PyInt_FromLong(self->notify_fd[0]);
+	}
+#endif
+	PyErr_SetString(PyExc_Exception, "Only ASYNC_THREAD executes have a file descriptor, use poll()");
+	return NULL;
+}
+
+static PyObject *_python_ibm_db_async_result(async_handle *self)
+{
+	PyObject *return_value;
+
+	_python_ibm_db_async_complete(self, 1);
+	if ( !self->collected ) {
+		self->collected = 1;
+		/* Data of params bound with SQL_DATA_AT_EXEC is sent here */
+		return_value = _python_ibm_db_execute_result(self->stmt, self->rc);
+		if ( return_value != NULL ) {
+			return return_value;
 		}
+		PyErr_Fetch(&self->exc_type, &self->exc_value, &self->exc_tb);
 	}
-	return rc;
+	if ( self->exc_type != NULL ) {
+		Py_INCREF(self->exc_type);
+		Py_XINCREF(self->exc_value);
+		Py_XINCREF(self->exc_tb);
+		PyErr_Restore(self->exc_type, self->exc_value, self->exc_tb);
+		return NULL;
+	}
+	Py_INCREF(Py_True);
+	return Py_True;
 }
 
-/*
- * static PyObject *_python_ibm_db_execute_helper1(stmt_handle *stmt_res, PyObject *parameters_tuple)
+static PyMethodDef async_handle_methods[] = {
+	{"poll", (PyCFunction)_python_ibm_db_async_poll, METH_NOARGS, "Returns True once the execute has completed, without waiting"},
+	{"fileno", (PyCFunction)_python_ibm_db_async_fileno, METH_NOARGS, "Returns a file descriptor that becomes readable when an ASYNC_THREAD execute completes"},
+	{"result", (PyCFunction)_python_ibm_db_async_result, METH_NOARGS, "Waits for the execute and returns what ibm_db.execute returns, or raises its exception"},
+	{NULL} /* Sentinel */
+};
+
+static PyMemberDef async_handle_members[] = {
+	{"mode", T_INT, offsetof(async_handle, mode), READONLY, "ASYNC_CLI or ASYNC_THREAD"},
+	{NULL} /* Sentinel */
+};
+
+static PyTypeObject async_handleType = {
+	PyObject_HEAD_INIT(NULL)
+	0,						 /*ob_size			*/
+	"ibm_db.IBM_DBAsync",	 /*tp_name			 */
+	sizeof(async_handle),	 /*tp_basicsize			 */
+	0,						 /*tp_itemsize		*/
+	(destructor)_python_ibm_db_free_async_handle, /*tp_dealloc	*/
+	0,						 /*tp_print			*/
+	0,						 /*tp_getattr		 */
+	0,						 /*tp_setattr		 */
+	0,						 /*tp_compare		 */
+	0,						 /*tp_repr			*/
+	0,						 /*tp_as_number		*/
+	0,						 /*tp_as_sequence	 */
+	0,						 /*tp_as_mapping	  */
+	0,						 /*tp_hash			*/
+	0,						 /*tp_call			*/
+	0,						 /*tp_str			 */
+	0,						 /*tp_getattro		*/
+	0,						 /*tp_setattro		*/
+	0,						 /*tp_as_buffer		*/
+	Py_TPFLAGS_DEFAULT,		/*tp_flags			*/
+	"IBM DataServer asynchronous execute object", /* tp_doc		*/
+	0,						 /* tp_traverse		*/
+	0,						 /* tp_clear		  */
+	0,						 /* tp_richcompare	*/
+	0,						 /* tp_weaklistoffset */
+	0,						 /* tp_iter			*/
+	0,						 /* tp_iternext		*/
+	async_handle_methods,	 /* tp_methods		*/
+	async_handle_members,	 /* tp_members		*/
+	0,						 /* tp_getset		 */
+	0,						 /* tp_base			*/
+	0,						 /* tp_dict			*/
+	0,						 /* tp_descr_get	  */
+	0,						 /* tp_descr_set	  */
+	0,						 /* tp_dictoffset	 */
+	0,						 /* tp_init			*/
+};
+
+/*!# ibm_db.execute_async
+ *
+ * ===Description
+ * IBM_DBAsync ibm_db.execute_async ( IBM_DBStatement stmt [, tuple parameters [, int mode]] )
+ *
+ * ibm_db.execute_async() binds the parameters of a statement prepared by
+ * ibm_db.prepare() like ibm_db.execute() does and starts its execution,
+ * without waiting for the server. The statement must not be used until the
+ * result() method of the returned object has returned.
+ *
+ * In ASYNC_CLI mode the statement is executed with the CLI asynchronous
+ * execution of SQL_ATTR_ASYNC_ENABLE, no thread is used and poll() asks the
+ * driver whether the execute has completed. In ASYNC_THREAD mode SQLExecute
+ * is called by one of the ASYNC_THREAD_WORKERS (8) worker threads of the
+ * module, the executes started while all of them are busy wait for a free
+ * one, and fileno() is a descriptor that becomes readable when it returns,
+ * for select() or an event loop. The data of LOB parameters sent at execute
+ * is sent by result(), with ASYNC_AUTO their execute only starts then.
+ *
+ * ===Parameters
+ * ====stmt
+ *
+ *		A prepared statement returned from ibm_db.prepare().
+ *
+ * ====parameters
+ *
+ *		An tuple of input parameters matching any parameter markers contained
+ * in the prepared statement.
+ *
+ * ====mode
+ *
+ *		ibm_db.ASYNC_AUTO (default) uses ASYNC_CLI when the driver supports it
+ * for the statement or the statement has LOB parameters sent at execute,
+ * and ASYNC_THREAD otherwise. ibm_db.ASYNC_CLI raises an exception when it
+ * is not supported.
  *
- */ 
-static PyObject *_python_ibm_db_execute_helper1(stmt_handle *stmt_res, PyObject *parameters_tuple)
+ * ===Return Values
+ *
+ * Returns an IBM_DBAsync object with the methods poll(), fileno() and
+ * result(), and the mode used as its mode attribute. result() waits for the
+ * execute and returns True or raises the exception ibm_db.execute() would.
+ */
+static PyObject *ibm_db_execute_async(PyObject *self, PyObject *args)
 {
-	int rc, numOpts, i, bind_params = 0;
-	SQLSMALLINT num;
-	SQLPOINTER valuePtr;
-	PyObject *data;
+	PyObject *parameters_tuple = NULL;
+	stmt_handle *stmt_res;
+	async_handle *handle;
+	int mode = ASYNC_AUTO;
+	int data_at_exec = 0;
+	int rc, i;
 	char error[DB2_MAX_ERR_MSG_LEN];
-	/* This is used to loop over the param cache */
-	param_node *prev_ptr, *curr_ptr;
-	/* Free any cursors that might have been allocated in a previous call to 
-	* SQLExecute 
-	*/
-	Py_BEGIN_ALLOW_THREADS;
-	SQLFreeStmt((SQLHSTMT)stmt_res->hstmt, SQL_CLOSE);
-	Py_END_ALLOW_THREADS;
 
-	/* This ensures that each call to ibm_db.execute start from scratch */
-	stmt_res->current_node = stmt_res->head_cache_list;
-	
-	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLNumParams((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT*)&num);
-	Py_END_ALLOW_THREADS;
-	
-	if ( num != 0 ) {
-		/* Parameter Handling */
-		if ( !NIL_P(parameters_tuple) ) {
-			/* Make sure ibm_db.bind_param has been called */
-			/* If the param list is NULL -- ERROR */
-			if ( stmt_res->head_cache_list == NULL ) {
-				bind_params = 1;
-			}
+	if (!PyArg_ParseTuple(args, "O|Oi", &stmt_res, &parameters_tuple, &mode))
+		return NULL;
 
-			if (!PyTuple_Check(parameters_tuple)) {
-				PyErr_SetString(PyExc_Exception, "Param is not a tuple");
-				return NULL;
-			}
+	if ( NIL_P(stmt_res) || !PyObject_TypeCheck(stmt_res, &stmt_handleType) ) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	if ( mode != ASYNC_AUTO && mode != ASYNC_CLI && mode != ASYNC_THREAD ) {
+		PyErr_SetString(PyExc_Exception, "Invalid asynchronous execute mode");
+		return NULL;
+	}
+	if ( parameters_tuple == Py_None ) {
+		parameters_tuple = NULL;
+	}
+	if ( _python_ibm_db_bind_execute_params(stmt_res, parameters_tuple) ) {
+		return NULL;
+	}
 
-			numOpts = PyTuple_Size(parameters_tuple);
-	
-			if (numOpts > num) {
-				/* More are passed in -- Warning - Use the max number present */
-				sprintf(error, "%d params bound not matching %d required", 
-						numOpts, num);
-				PyErr_SetString(PyExc_Exception, error);
-				numOpts = stmt_res->num_params;
-			} else if (numOpts < num) {
-				/* If there are less params passed in, than are present 
-				* -- Error 
-				*/
-				sprintf(error, "%d params bound not matching %d required", 
-						numOpts, num);
+	for ( i = 0; i < stmt_res->param_cache_size; i++ ) {
+		if ( stmt_res->param_cache[i].param_num != 0 &&
+				stmt_res->param_cache[i].bind_indicator == SQL_DATA_AT_EXEC ) {
+			data_at_exec = 1;
+		}
+	}
+	if ( mode == ASYNC_CLI && data_at_exec ) {
+		PyErr_SetString(PyExc_Exception, "Parameters sent at execute cannot be used with ASYNC_CLI");
+		return NULL;
+	}
+	if ( mode != ASYNC_THREAD && !data_at_exec ) {
+		rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_ASYNC_ENABLE,
+			(SQLPOINTER)SQL_ASYNC_ENABLE_ON, 0);
+		if ( rc == SQL_ERROR ) {
+			if ( mode == ASYNC_CLI ) {
+				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+				sprintf(error, "Asynchronous execution is not supported: %s", IBM_DB_ERR(__python_stmt_err_msg));
 				PyErr_SetString(PyExc_Exception, error);
 				return NULL;
 			}
-
-			for ( i = 0; i < numOpts; i++) {
-				/* Bind values from the parameters_tuple to params */
-				data = PyTuple_GetItem(parameters_tuple, i);
-
-				/* The 0 denotes that you work only with the current node.
-				* The 4th argument specifies whether the data passed in
-				* has been described. So we need to call SQLDescribeParam
-				* before binding depending on this.
-				*/
-				rc = _python_ibm_db_execute_helper2(stmt_res, data, 0, bind_params);
-				if ( rc == SQL_ERROR) {
-					sprintf(error, "Binding Error: %s", IBM_DB_G(__python_stmt_err_msg));
-					PyErr_SetString(PyExc_Exception, error);
-					return NULL;
-				}
-			}
+			mode = ASYNC_THREAD;
 		} else {
-			/* No additional params passed in. Use values already bound. */
-			if ( num > stmt_res->num_params ) {
-				/* More parameters than we expected */
-				sprintf(error, "%d params bound not matching %d required", 
-						stmt_res->num_params, num);
-				PyErr_SetString(PyExc_Exception, error);
-			} else if ( num < stmt_res->num_params ) {
-				/* Fewer parameters than we expected */
-				sprintf(error, "%d params bound not matching %d required", 
-						stmt_res->num_params, num);
-				PyErr_SetString(PyExc_Exception, error);
-				return NULL;
-			}
-			
-			/* Param cache node list is empty -- No params bound */
-			if ( stmt_res->head_cache_list == NULL ) {
-				PyErr_SetString(PyExc_Exception, "Parameters not bound");
-				return NULL;
-			} else {
-				/* The 1 denotes that you work with the whole list 
-				 * And bind sequentially 				
-				 */
-				rc = _python_ibm_db_execute_helper2(stmt_res, NULL, 1, 0);
-				if ( rc == SQL_ERROR ) {
-					sprintf(error, "Binding Error 3: %s", IBM_DB_G(__python_stmt_err_msg));
-					PyErr_SetString(PyExc_Exception, error);
-					return NULL;
-				}
-			}
+			mode = ASYNC_CLI;
 		}
-	} else {
-		/* No Parameters 
-		 * We just execute the statement. No additional work needed. 
-		 */
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLExecute((SQLHSTMT)stmt_res->hstmt);
-		Py_END_ALLOW_THREADS;
-		
-		if ( rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			sprintf(error, "Statement Execute Failed: %s", IBM_DB_G(__python_stmt_err_msg));
-			PyErr_SetString(PyExc_Exception, error);
-			return NULL;
-		}
-		Py_INCREF(Py_True);
-		return Py_True;
+	} else if ( mode == ASYNC_AUTO ) {
+		/* SQLExecute returns SQL_NEED_DATA at once for parameters sent at
+		 * execute, their data is sent by result() */
+		mode = ASYNC_CLI;
 	}
-		
-	/* Execute Stmt -- All parameters bound */
-	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLExecute((SQLHSTMT)stmt_res->hstmt);
-	Py_END_ALLOW_THREADS;
-	
-	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-		sprintf(error, "Statement Execute Failed: %s", IBM_DB_G(__python_stmt_err_msg));
-		PyErr_SetString(PyExc_Exception, error);
+
+	handle = PyObject_NEW(async_handle, &async_handleType);
+	if ( handle == NULL ) {
 		return NULL;
 	}
-		
-	if ( rc == SQL_NEED_DATA ) {
-		rc = SQLParamData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER *)&valuePtr);
-		while ( rc == SQL_NEED_DATA ) {
-			/* passing data value for a parameter */
-			if ( !NIL_P(((param_node*)valuePtr)->svalue)) {
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLPutData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER)(((param_node*)valuePtr)->svalue), ((param_node*)valuePtr)->ivalue);
-				Py_END_ALLOW_THREADS;
-			} else {
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLPutData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER)(((param_node*)valuePtr)->uvalue), ((param_node*)valuePtr)->ivalue);
-				Py_END_ALLOW_THREADS;
-			}
-			
-			if ( rc == SQL_ERROR ) {
-				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,
-						rc, 1, NULL, -1, 1);
-				sprintf(error, "Sending data failed: %s", 
-						IBM_DB_G(__python_stmt_err_msg));
-				PyErr_SetString(PyExc_Exception, error);
-				return NULL;
-			}
+	Py_INCREF(stmt_res);
+	handle->stmt = stmt_res;
+	handle->mode = mode;
+	handle->done = 0;
+	handle->rc = SQL_SUCCESS;
+	handle->lock = NULL;
+	handle->notify_fd[0] = -1;
+	handle->notify_fd[1] = -1;
+	handle->queued = 0;
+	handle->next_queued = NULL;
+	handle->collected = 0;
+	handle->exc_type = NULL;
+	handle->exc_value = NULL;
+	handle->exc_tb = NULL;
+
+	if ( mode == ASYNC_CLI ) {
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLExecute((SQLHSTMT)stmt_res->hstmt);
+		Py_END_ALLOW_THREADS;
 
-			rc = SQLParamData((SQLHSTMT)stmt_res->hstmt, (SQLPOINTER *)&valuePtr);
+		if ( rc == SQL_STILL_EXECUTING ) {
+			stmt_res->async_pending = 1;
+		} else {
+			handle->rc = rc;
+			handle->done = 1;
+			SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_ASYNC_ENABLE,
+				(SQLPOINTER)SQL_ASYNC_ENABLE_OFF, 0);
 		}
+		return (PyObject *)handle;
+	}
 
-		if ( rc == SQL_ERROR ) {
-			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			sprintf(error, "Sending data failed: %s", IBM_DB_G(__python_stmt_err_msg));
-			PyErr_SetString(PyExc_Exception, error);
-			return NULL;
-		}
+	handle->lock = PyThread_allocate_lock();
+	if ( handle->lock == NULL ) {
+		handle->done = 1;
+		Py_DECREF(handle);
+		return PyErr_NoMemory();
 	}
-		
-	/* cleanup dynamic bindings if present */
-	if ( bind_params == 1 ) {
-		/* Free param cache list */
-		curr_ptr = stmt_res->head_cache_list;
-		prev_ptr = stmt_res->head_cache_list;
-			
-		while (curr_ptr != NULL) {
-			curr_ptr = curr_ptr->next;
-			
-			/* Free Values */
-			if ( prev_ptr->svalue) {
-				PyMem_Del(prev_ptr->svalue);
-			}
-			PyMem_Del(prev_ptr);
-			prev_ptr = curr_ptr;
-       		}
-		
-		stmt_res->head_cache_list = NULL;
-		stmt_res->num_params = 0;
+#ifndef _WIN32
+	if ( pipe(handle->notify_fd) ) {
+		handle->notify_fd[0] = -1;
+		handle->notify_fd[1] = -1;
 	}
-	
-	if ( rc != SQL_ERROR ) {
-		Py_INCREF(Py_True);
-		return Py_True;
+#endif
+	PyThread_acquire_lock(handle->lock, WAIT_LOCK);
+	stmt_res->async_pending = 1;
+	if ( _python_ibm_db_async_start(handle) < 0 ) {
+		PyThread_release_lock(handle->lock);
+		stmt_res->async_pending = 0;
+		handle->done = 1;
+		Py_DECREF(handle);
+		PyErr_SetString(PyExc_Exception, "Failed to start the asynchronous execute thread");
+		return NULL;
 	}
-	return NULL;
+	return (PyObject *)handle;
 }
 
-/*!# ibm_db.execute
+/*!# ibm_db.cancel
  *
  * ===Description
- * Py_True/Py_False ibm_db.execute ( IBM_DBStatement stmt [, tuple parameters] )
- *
- * ibm_db.execute() executes an SQL statement that was prepared by
- * ibm_db.prepare().
+ * bool ibm_db.cancel ( IBM_DBStatement stmt )
  *
- * If the SQL statement returns a result set, for example, a SELECT statement
- * or a CALL to a stored procedure that returns one or more result sets, you
- * can retrieve a row as an tuple/dictionary from the stmt resource using
- * ibm_db.fetch_assoc(), ibm_db.fetch_both(), or ibm_db.fetch_tuple().
- * Alternatively, you can use ibm_db.fetch_row() to move the result set pointer
- * to the next row and fetch a column at a time from that row with
- * ibm_db.result().
+ * ibm_db.cancel() asks the server to stop the processing of a statement.
+ * ibm_db.execute(), ibm_db.exec_immediate() and the fetch functions release
+ * the GIL while the CLI runs, so another thread can cancel a statement they
+ * are blocked on; the blocked call then fails with the cancellation error.
+ * An asynchronous execute started with ibm_db.execute_async() is canceled
+ * the same way. Canceling a statement that is not running has no effect.
  *
- * Refer to ibm_db.prepare() for a brief discussion of the advantages of using
- * ibm_db.prepare() and ibm_db.execute() rather than ibm_db.exec().
+ * To bound the time of every statement instead, set the
+ * SQL_ATTR_QUERY_TIMEOUT option of a connection or statement to a number of
+ * seconds.
  *
  * ===Parameters
  * ====stmt
  *
- *		A prepared statement returned from ibm_db.prepare().
- *
- * ====parameters
- *
- *		An tuple of input parameters matching any parameter markers contained
- * in the prepared statement.
+ *		A statement resource.
  *
  * ===Return Values
  *
- * Returns Py_True on success or Py_False on failure.
+ * Returns True on success or False on failure.
  */
-static PyObject *ibm_db_execute(PyObject *self, PyObject *args)			
+static PyObject *ibm_db_cancel(PyObject *self, PyObject *args)
 {
-	PyObject *parameters_tuple = NULL;
 	stmt_handle *stmt_res;
-	if (!PyArg_ParseTuple(args, "O|O", &stmt_res, &parameters_tuple))
+	int rc;
+
+	if (!PyArg_ParseTuple(args, "O", &stmt_res))
 		return NULL;
 
-	if (!NIL_P(stmt_res)) {
-		return _python_ibm_db_execute_helper1(stmt_res, parameters_tuple);
-	} else {
+	if ( NIL_P(stmt_res) || !PyObject_TypeCheck(stmt_res, &stmt_handleType) ) {
 		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
 		return NULL;
 	}
-	
-}
 
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLCancel((SQLHSTMT)stmt_res->hstmt);
+	Py_END_ALLOW_THREADS;
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		Py_INCREF(Py_False);
+		return Py_False;
+	}
+	Py_INCREF(Py_True);
+	return Py_True;
+}
 
 /*!# ibm_db.conn_errormsg
  *
@@ -5728,7 +9186,8 @@ static PyObject *ibm_db_execute(PyObject *self, PyObject *args)
  * string ibm_db.conn_errormsg ( [resource connection] )
  *
  * ibm_db.conn_errormsg() returns an error message and SQLCODE value
- * representing the reason the last database connection attempt failed.
+ * representing the reason the last database connection attempt of the calling
+ * thread failed.
  * As ibm_db.connect() returns FALSE in the event of a failed connection
  * attempt, do not pass any parameters to ibm_db.conn_errormsg() to retrieve
  * the associated error message and SQLCODE value.
@@ -5783,7 +9242,7 @@ static PyObject *ibm_db_conn_errormsg(PyObject *self, PyObject *args)
 		}
 		return retVal;
 	} else {
-		return PyString_FromString(IBM_DB_G(__python_conn_err_msg));
+		return PyString_FromString(IBM_DB_ERR(__python_conn_err_msg));
 	}
 }
 
@@ -5796,8 +9255,8 @@ static PyObject *ibm_db_conn_errormsg(PyObject *self, PyObject *args)
  *
  * If you do not pass a statement resource as an argument to
  * ibm_db.stmt_errormsg(), the driver returns the error message associated with
- * the last attempt to return a statement resource, for example, from
- * ibm_db.prepare() or ibm_db.exec().
+ * the last attempt of the calling thread to return a statement resource, for
+ * example, from ibm_db.prepare() or ibm_db.exec().
  *
  * ===Parameters
  *
@@ -5841,7 +9300,7 @@ static PyObject *ibm_db_stmt_errormsg(PyObject *self, PyObject *args)
 		}
 		return retVal;
 	} else {
-		return PyString_FromString(IBM_DB_G(__python_stmt_err_msg));
+		return PyString_FromString(IBM_DB_ERR(__python_stmt_err_msg));
 	}
 }
 
@@ -5850,7 +9309,7 @@ static PyObject *ibm_db_stmt_errormsg(PyObject *self, PyObject *args)
  * string ibm_db.conn_error ( [resource connection] )
  *
  * ibm_db.conn_error() returns an SQLSTATE value representing the reason the
- * last attempt to connect to a database failed. As ibm_db.connect() returns
+ * last attempt of the calling thread to connect to a database failed. As ibm_db.connect() returns
  * FALSE in the event of a failed connection attempt, you do not pass any
  * parameters to ibm_db.conn_error() to retrieve the SQLSTATE value.
  *
@@ -5906,7 +9365,7 @@ static PyObject *ibm_db_conn_error(PyObject *self, PyObject *args)
 		}
 		return retVal;
 	} else {
-		return PyString_FromString(IBM_DB_G(__python_conn_err_state));
+		return PyString_FromString(IBM_DB_ERR(__python_conn_err_state));
 	}
 }
 
@@ -5919,8 +9378,8 @@ static PyObject *ibm_db_conn_error(PyObject *self, PyObject *args)
  *
  * If you do not pass a statement resource as an argument to
  * ibm_db.stmt_error(), the driver returns the SQLSTATE value associated with
- * the last attempt to return a statement resource, for example, from
- * ibm_db.prepare() or ibm_db.exec().
+ * the last attempt of the calling thread to return a statement resource, for
+ * example, from ibm_db.prepare() or ibm_db.exec().
  *
  * To learn what the SQLSTATE value means, you can issue the following command
  * at a DB2 Command Line Processor prompt: db2 '? sqlstate-value'. You can also
@@ -5969,7 +9428,7 @@ static PyObject *ibm_db_stmt_error(PyObject *self, PyObject *args)
 		}
 		return retVal;
 	} else {
-		return PyString_FromString(IBM_DB_G(__python_stmt_err_state));
+		return PyString_FromString(IBM_DB_ERR(__python_stmt_err_state));
 	}
 }
 
@@ -6009,7 +9468,9 @@ static PyObject *ibm_db_next_result(PyObject *self, PyObject *args)
 		_python_ibm_db_clear_stmt_err_cache();
 
 		/* alloc handle and return only if it errors */
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLAllocHandle(SQL_HANDLE_STMT, stmt_res->hdbc, &new_hstmt);
+		Py_END_ALLOW_THREADS;
 		if ( rc < SQL_SUCCESS ) {
 			_python_ibm_db_check_sql_errors(stmt_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
 											NULL, -1, 1);
@@ -6026,7 +9487,9 @@ static PyObject *ibm_db_next_result(PyObject *self, PyObject *args)
 				_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, 
 												rc, 1, NULL, -1, 1);
 			}
+			Py_BEGIN_ALLOW_THREADS;
 			SQLFreeHandle(SQL_HANDLE_STMT, new_hstmt);
+			Py_END_ALLOW_THREADS;
 			Py_INCREF(Py_False);
 			return Py_False;
 		}
@@ -6037,15 +9500,39 @@ static PyObject *ibm_db_next_result(PyObject *self, PyObject *args)
 		new_stmt_res->s_bin_mode = stmt_res->s_bin_mode;
 		new_stmt_res->cursor_type = stmt_res->cursor_type;
 		new_stmt_res->s_case_mode = stmt_res->s_case_mode;
-		new_stmt_res->head_cache_list = NULL;
-		new_stmt_res->current_node = NULL;
+		new_stmt_res->s_native_types = stmt_res->s_native_types;
+		new_stmt_res->s_lob_reader = stmt_res->s_lob_reader;
+		new_stmt_res->param_cache = NULL;
+		memset(&new_stmt_res->param_descs, 0, sizeof(param_desc));
+		new_stmt_res->param_cache_size = 0;
+		new_stmt_res->current_param = 0;
+		new_stmt_res->dynamic_params = 0;
 		new_stmt_res->num_params = 0;
 		new_stmt_res->file_param = 0;
 		new_stmt_res->column_info = NULL;
 		new_stmt_res->num_columns = 0;
 		new_stmt_res->row_data = NULL;
+		new_stmt_res->row_array_size = stmt_res->row_array_size;
+		new_stmt_res->paramset_size = stmt_res->paramset_size;
+		new_stmt_res->bound_array_size = 0;
+		new_stmt_res->rows_fetched = 0;
+		new_stmt_res->row_block_pos = 0;
+		new_stmt_res->bound_native_types = NATIVE_TYPES_OFF;
+		new_stmt_res->options_changed = 0;
+		new_stmt_res->row_names = NULL;
+		new_stmt_res->row_index = NULL;
 		new_stmt_res->hstmt = new_hstmt;
 		new_stmt_res->hdbc = stmt_res->hdbc;
+		new_stmt_res->lob_hstmt = 0;
+		new_stmt_res->async_pending = 0;
+		new_stmt_res->query_timeout = 0;
+		new_stmt_res->sql = stmt_res->sql;
+		Py_XINCREF(new_stmt_res->sql);
+		memset(&new_stmt_res->stats, 0, sizeof(ibm_db_stats));
+		new_stmt_res->conn_stats = stmt_res->conn_stats;
+		if ( new_stmt_res->conn_stats != NULL ) {
+			new_stmt_res->conn_stats->refs++;
+		}
 
 		return (PyObject *)new_stmt_res;		
 	} else {
@@ -6095,7 +9582,7 @@ static PyObject *ibm_db_num_fields(PyObject *self, PyObject *args)
 			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
 											1, NULL, -1, 1);
 			sprintf(error, "SQLNumResultCols failed: %s", 
-					IBM_DB_G(__python_stmt_err_msg));
+					IBM_DB_ERR(__python_stmt_err_msg));
 			PyErr_SetString(PyExc_Exception, error);
 			Py_INCREF(Py_False);
 			return Py_False;
@@ -6162,7 +9649,7 @@ static PyObject *ibm_db_num_rows(PyObject *self, PyObject *args)
 			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 
 											1, NULL, -1, 1);
 			sprintf(error, "SQLRowCount failed: %s", 
-					IBM_DB_G(__python_stmt_err_msg));
+					IBM_DB_ERR(__python_stmt_err_msg));
 			PyErr_SetString(PyExc_Exception, error);
 			Py_INCREF(Py_False);
 			return Py_False;
@@ -6214,7 +9701,7 @@ static PyObject *ibm_db_get_num_result(PyObject *self, PyObject *args)
 			_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc,
 											1, NULL, -1, 1);
 			sprintf(error, "SQLGetDiagField failed: %s",
-					IBM_DB_G(__python_stmt_err_msg));
+					IBM_DB_ERR(__python_stmt_err_msg));
 			PyErr_SetString(PyExc_Exception, error);
 			Py_INCREF(Py_False);
 			return Py_False;
@@ -6303,7 +9790,8 @@ static PyObject *ibm_db_field_name(PyObject *self, PyObject *args)
 		Py_INCREF(Py_False);
 		return Py_False;
 	}
-	return PyString_FromString((char*)stmt_res->column_info[col].name);
+	Py_INCREF(stmt_res->column_info[col].key);
+	return stmt_res->column_info[col].key;
 }
 
 /*!# ibm_db.field_display_size
@@ -6746,6 +10234,8 @@ static PyObject *ibm_db_rollback(PyObject *self, PyObject *args)
 {
 	conn_handle *conn_res;
 	int rc;
+	double trace_start;
+	SQLCHAR sqlstate[SQL_SQLSTATE_SIZE + 1];
 
 	if (!PyArg_ParseTuple(args, "O", &conn_res))
 		return NULL;
@@ -6756,7 +10246,14 @@ static PyObject *ibm_db_rollback(PyObject *self, PyObject *args)
 			return NULL;
 		}
 
+		TRACE_START(trace_start);
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLEndTran(SQL_HANDLE_DBC, conn_res->hdbc, SQL_ROLLBACK);
+		Py_END_ALLOW_THREADS;
+		if ( trace_start != 0.0 ) {
+			_python_ibm_db_trace("rollback", NULL, 0, -1, 
+				_python_ibm_db_trace_sqlstate(SQL_HANDLE_DBC, conn_res->hdbc, rc, sqlstate), trace_start);
+		}
 
 		if ( rc == SQL_ERROR ) {
 			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
@@ -6802,77 +10299,121 @@ static PyObject *ibm_db_free_stmt(PyObject *self, PyObject *args)
 static RETCODE _python_ibm_db_get_data(stmt_handle *stmt_res, int col_num, short ctype, void *buff, int in_length, SQLINTEGER *out_length)
 {
 	RETCODE rc = SQL_SUCCESS;
+	double stats_start;
 	
+	STATS_START(stats_start);
 	Py_BEGIN_ALLOW_THREADS;
 	rc = SQLGetData((SQLHSTMT)stmt_res->hstmt, col_num, ctype, buff, in_length, 
 		out_length);
 	Py_END_ALLOW_THREADS;
+	STATS_TIME(stmt_res, STATS_FETCH, stats_start);
 	
 	if ( rc == SQL_ERROR ) {
 		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, 
 			NULL, -1, 1);
+	} else if ( buff != NULL && *out_length > 0 ) {
+		/* a truncated value fills the buffer */
+		STATS_ADD(stmt_res, bytes_fetched, *out_length < in_length ? *out_length : in_length);
 	}
 	return rc;
 }
 
-/* {{{ static RETCODE _python_ibm_db_get_length(stmt_handle* stmt_res, SQLUSMALLINT col_num, SQLINTEGER *sLength) */
-static RETCODE _python_ibm_db_get_length(stmt_handle* stmt_res, SQLUSMALLINT col_num, SQLINTEGER *sLength)
+/*	static RETCODE _python_ibm_db_get_lob_hstmt(stmt_handle *stmt_res)
+	allocates the statement handle used for the locator operations of the
+	statement once, instead of one handle per LOB value
+*/
+static RETCODE _python_ibm_db_get_lob_hstmt(stmt_handle *stmt_res)
 {
 	RETCODE rc = SQL_SUCCESS;
-	SQLHANDLE new_hstmt;
 
-	rc = SQLAllocHandle(SQL_HANDLE_STMT, stmt_res->hdbc, &new_hstmt);
-	if ( rc < SQL_SUCCESS ) {
-		_python_ibm_db_check_sql_errors(stmt_res->hdbc, SQL_HANDLE_STMT, rc, 1, 
-			NULL, -1, 1);
+	if ( !stmt_res->lob_hstmt ) {
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLAllocHandle(SQL_HANDLE_STMT, stmt_res->hdbc, &stmt_res->lob_hstmt);
+		Py_END_ALLOW_THREADS;
+		if ( rc < SQL_SUCCESS ) {
+			_python_ibm_db_check_sql_errors(stmt_res->hdbc, SQL_HANDLE_DBC, rc, 1, 
+				NULL, -1, 1);
+			stmt_res->lob_hstmt = 0;
+			return SQL_ERROR;
+		}
+	}
+	return rc;
+}
+
+/*	static RETCODE _python_ibm_db_get_lob_length(stmt_handle *stmt_res, SQLSMALLINT loc_type, SQLINTEGER locator, SQLINTEGER *length, SQLINTEGER *ind)
+	length of the LOB value of a locator of the statement, in the units of
+	the LOB type
+*/
+static RETCODE _python_ibm_db_get_lob_length(stmt_handle *stmt_res, SQLSMALLINT loc_type, SQLINTEGER locator, SQLINTEGER *length, SQLINTEGER *ind)
+{
+	RETCODE rc = SQL_SUCCESS;
+	double stats_start;
+
+	if ( _python_ibm_db_get_lob_hstmt(stmt_res) == SQL_ERROR ) {
 		return SQL_ERROR;
 	}
 
+	STATS_START(stats_start);
 	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLGetLength((SQLHSTMT)new_hstmt, 
-		stmt_res->column_info[col_num-1].loc_type,
-		stmt_res->column_info[col_num-1].lob_loc, sLength,
-		&stmt_res->column_info[col_num-1].loc_ind);
+	rc = SQLGetLength((SQLHSTMT)stmt_res->lob_hstmt, loc_type, locator, length, ind);
 	Py_END_ALLOW_THREADS;
+	STATS_TIME(stmt_res, STATS_LOB, stats_start);
 	
 	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors((SQLHSTMT)new_hstmt, SQL_HANDLE_STMT, rc,
+		_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->lob_hstmt, SQL_HANDLE_STMT, rc,
 			1, NULL, -1, 1);
 	}
-
-	SQLFreeHandle(SQL_HANDLE_STMT, new_hstmt);
-
 	return rc;
 }
-		
-/* {{{ static RETCODE _python_ibm_db_get_data2(stmt_handle *stmt_res, int col_num, short ctype, void *buff, int in_length, SQLINTEGER *out_length) */
-static RETCODE _python_ibm_db_get_data2(stmt_handle *stmt_res, SQLUSMALLINT col_num, SQLSMALLINT ctype, SQLPOINTER buff, SQLLEN in_length, SQLINTEGER *out_length)
+
+/*	static RETCODE _python_ibm_db_get_lob_substring(stmt_handle *stmt_res, SQLSMALLINT loc_type, SQLINTEGER locator, SQLUINTEGER start, SQLUINTEGER for_length, SQLSMALLINT ctype, SQLPOINTER buff, SQLINTEGER buff_length, SQLINTEGER *out_length, SQLINTEGER *ind)
+	reads for_length units of the LOB value of a locator of the statement
+	from position start, the first one being 1
+*/
+static RETCODE _python_ibm_db_get_lob_substring(stmt_handle *stmt_res, SQLSMALLINT loc_type, SQLINTEGER locator, SQLUINTEGER start, SQLUINTEGER for_length, SQLSMALLINT ctype, SQLPOINTER buff, SQLINTEGER buff_length, SQLINTEGER *out_length, SQLINTEGER *ind)
 {
 	RETCODE rc = SQL_SUCCESS;
-	SQLHANDLE new_hstmt;
-	SQLSMALLINT targetCType = ctype;
+	double stats_start;
 
-	rc = SQLAllocHandle(SQL_HANDLE_STMT, stmt_res->hdbc, &new_hstmt);
-	if ( rc < SQL_SUCCESS ) {
+	if ( _python_ibm_db_get_lob_hstmt(stmt_res) == SQL_ERROR ) {
 		return SQL_ERROR;
 	}
 
+	STATS_START(stats_start);
 	Py_BEGIN_ALLOW_THREADS;
-	rc = SQLGetSubString((SQLHSTMT)new_hstmt, 
-						stmt_res->column_info[col_num-1].loc_type,
-						stmt_res->column_info[col_num-1].lob_loc, 1, in_length,
-						targetCType, buff, in_length, out_length, 
-						&stmt_res->column_info[col_num-1].loc_ind);
+	rc = SQLGetSubString((SQLHSTMT)stmt_res->lob_hstmt, loc_type, locator, start, 
+						for_length, ctype, buff, buff_length, out_length, ind);
 	Py_END_ALLOW_THREADS;
+	STATS_TIME(stmt_res, STATS_LOB, stats_start);
 	
 	if ( rc == SQL_ERROR ) {
-		_python_ibm_db_check_sql_errors((SQLHSTMT)new_hstmt, SQL_HANDLE_STMT, rc,
+		_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->lob_hstmt, SQL_HANDLE_STMT, rc,
 									  1, NULL, -1, 1);
+	} else if ( *out_length > 0 ) {
+		STATS_ADD(stmt_res, bytes_fetched, *out_length < buff_length ? *out_length : buff_length);
 	}
-	SQLFreeHandle(SQL_HANDLE_STMT, new_hstmt);
 	return rc;
 }
 
+/* {{{ static RETCODE _python_ibm_db_get_length(stmt_handle* stmt_res, SQLUSMALLINT col_num, SQLINTEGER *sLength) */
+static RETCODE _python_ibm_db_get_length(stmt_handle* stmt_res, SQLUSMALLINT col_num, SQLINTEGER *sLength)
+{
+	return _python_ibm_db_get_lob_length(stmt_res, 
+		stmt_res->column_info[col_num-1].loc_type,
+		stmt_res->column_info[col_num-1].lob_loc, sLength,
+		&stmt_res->column_info[col_num-1].loc_ind);
+}
+		
+/* {{{ static RETCODE _python_ibm_db_get_data2(stmt_handle *stmt_res, int col_num, short ctype, void *buff, int in_length, SQLINTEGER *out_length) */
+static RETCODE _python_ibm_db_get_data2(stmt_handle *stmt_res, SQLUSMALLINT col_num, SQLSMALLINT ctype, SQLPOINTER buff, SQLLEN in_length, SQLINTEGER *out_length)
+{
+	return _python_ibm_db_get_lob_substring(stmt_res, 
+		stmt_res->column_info[col_num-1].loc_type,
+		stmt_res->column_info[col_num-1].lob_loc, 1, in_length,
+		ctype, buff, in_length, out_length, 
+		&stmt_res->column_info[col_num-1].loc_ind);
+}
+
 /*!# ibm_db.result
  *
  * ===Description
@@ -6929,7 +10470,7 @@ static PyObject *ibm_db_result(PyObject *self, PyObject *args)
 	if ( stmt_res->column_info == NULL ) {
 		if (_python_ibm_db_get_result_set_info(stmt_res)<0) {
 			sprintf(error, "Column information cannot be retrieved: %s", 
-					IBM_DB_G(__python_stmt_err_msg));
+					IBM_DB_ERR(__python_stmt_err_msg));
 			PyErr_SetString(PyExc_Exception, error);
 			Py_INCREF(Py_False);
 			return Py_False;
@@ -6940,6 +10481,19 @@ static PyObject *ibm_db_result(PyObject *self, PyObject *args)
 		PyErr_SetString(PyExc_Exception, "Column ordinal out of range");
 	}
 
+	/* a row of a bound block is read from the block, SQLGetData cannot
+	 * reach it */
+	if (stmt_res->bound_array_size > 1 && stmt_res->row_block_pos > 0 && 
+		col_num >= 0 && col_num < stmt_res->num_columns) {
+		return _python_ibm_db_get_column_value(stmt_res, col_num);
+	}
+
+	/* LOB values are handed out as readers of their locator */
+	if (stmt_res->s_lob_reader == LOB_READER_ON && col_num >= 0 && 
+		col_num < stmt_res->num_columns && stmt_res->column_info[col_num].loc_type != 0) {
+		return _python_ibm_db_new_lob_reader(stmt_res, col_num);
+	}
+
 	/* get the data */
 	column_type = stmt_res->column_info[col_num].type;
 	switch(column_type) {
@@ -7085,92 +10639,555 @@ static PyObject *ibm_db_result(PyObject *self, PyObject *args)
 				return NULL;
 			}
 
-			switch (stmt_res->s_bin_mode) {
-				case PASSTHRU:
-					return PyString_FromStringAndSize("", 0);
-					break;
-					/* returns here */
-				case CONVERT:
-					in_length *= 2;
-					lob_bind_type = SQL_C_CHAR;
-					/* fall-through */
+			switch (stmt_res->s_bin_mode) {
+				case PASSTHRU:
+					return PyString_FromStringAndSize("", 0);
+					break;
+					/* returns here */
+				case CONVERT:
+					in_length *= 2;
+					lob_bind_type = SQL_C_CHAR;
+					/* fall-through */
+
+				case BINARY:
+
+					out_ptr = (SQLPOINTER)ALLOC_N(char, in_length);
+					if ( out_ptr == NULL ) {
+						PyErr_SetString(PyExc_Exception, 
+								"Failed to Allocate Memory for LOB Data");
+						Py_INCREF(Py_False);
+						return Py_False;
+					}
+					rc = _python_ibm_db_get_data2(stmt_res, (SQLUSMALLINT)col_num + 1, 
+								lob_bind_type, (char *)out_ptr, 
+								in_length, &out_length);
+					if (rc == SQL_ERROR) {
+						if(out_ptr != NULL) {
+							PyMem_Del(out_ptr);
+							out_ptr = NULL;
+						}
+						Py_INCREF(Py_False);
+						return Py_False;
+					}
+					retVal = PyString_FromStringAndSize((char*)out_ptr, out_length);
+					if(out_ptr != NULL) {
+						PyMem_Del(out_ptr);
+						out_ptr = NULL;
+					}
+					return retVal;
+				default:
+					break;
+			}
+			break;
+
+		case SQL_XML:
+			rc = _python_ibm_db_get_data(stmt_res, (SQLUSMALLINT)col_num + 1, SQL_C_WCHAR, NULL, 
+					0, (SQLINTEGER *)&in_length);
+			if ( rc == SQL_ERROR ) {
+				Py_INCREF(Py_False);
+				return Py_False;
+			}
+			if (in_length == SQL_NULL_DATA) {
+				return NULL;
+			}
+			in_length = in_length + 1;
+			out_ptr = (SQLPOINTER)ALLOC_N(SQLWCHAR, in_length);
+			if ( out_ptr == NULL ) {
+				PyErr_SetString(PyExc_Exception, 
+						"Failed to Allocate Memory for XML Data");
+				Py_INCREF(Py_False);
+				return Py_False;
+			}
+			rc = _python_ibm_db_get_data2(stmt_res, (SQLUSMALLINT)col_num + 1, SQL_C_BINARY, 
+						  (SQLPOINTER)out_ptr, in_length * sizeof(SQLWCHAR), 
+						  &out_length);
+			if (rc == SQL_ERROR) {
+				if(out_ptr != NULL) {
+					PyMem_Del(out_ptr);
+					out_ptr = NULL;
+				}
+				Py_INCREF(Py_False);
+				return Py_False;
+			}
+			retVal = getSQLWCharAsPyUnicodeObject((SQLWCHAR*)out_ptr, out_length);
+			if(out_ptr != NULL) {
+				PyMem_Del(out_ptr);
+				out_ptr = NULL;
+			}
+			return retVal;
+
+		default:
+			break;
+		}
+	} else {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+	}
+
+	Py_INCREF(Py_False);
+	return Py_False;
+}
+
+/*	static int _python_ibm_db_init_fetch(stmt_handle *stmt_res)
+	describe and bind the result set columns if not yet done
+*/
+static int _python_ibm_db_init_fetch(stmt_handle *stmt_res)
+{
+	int rc;
+	char error[DB2_MAX_ERR_MSG_LEN];
+
+	/* get column header info */
+	if ( stmt_res->column_info == NULL ) {
+		if (_python_ibm_db_get_result_set_info(stmt_res)<0) {
+			sprintf(error, "Column information cannot be retrieved: %s", 
+				IBM_DB_ERR(__python_stmt_err_msg));
+			PyErr_SetString(PyExc_Exception, error);
+			return -1;
+		}
+	}
+	/* bind the data */
+	if ( stmt_res->row_data == NULL ) {
+		rc = _python_ibm_db_bind_column_helper(stmt_res);
+		if ( rc != SQL_SUCCESS && rc != SQL_SUCCESS_WITH_INFO ) {
+			sprintf(error, "Column binding cannot be done: %s", 
+				IBM_DB_ERR(__python_stmt_err_msg));
+			PyErr_SetString(PyExc_Exception, error);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*	static int _python_ibm_db_fetch_next_row(stmt_handle *stmt_res, SQLINTEGER row_number)
+	position on the next row, or on row_number if it is positive, fetching a
+	new block when the current one is exhausted.  Returns SQL_SUCCESS,
+	SQL_NO_DATA_FOUND, or SQL_ERROR with the exception set.
+*/
+static int _python_ibm_db_fetch_next_row(stmt_handle *stmt_res, SQLINTEGER row_number)
+{
+	int rc;
+	char error[DB2_MAX_ERR_MSG_LEN];
+	double stats_start = 0.0, trace_start = 0.0;
+
+	/* check if row_number is present */
+	if (row_number > 0) {
+		/* the block fetched starts at the requested row */
+		stmt_res->rows_fetched = 0;
+		stmt_res->row_block_pos = 0;
+		STATS_START(stats_start);
+		TRACE_START(trace_start);
+#ifndef PASE /* i5/OS problem with SQL_FETCH_ABSOLUTE (temporary until fixed) */
+		if (is_systemi) {
+
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_FIRST, 
+				row_number);
+			Py_END_ALLOW_THREADS;
+			
+			if (row_number>1 && (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO))
+				Py_BEGIN_ALLOW_THREADS;
+				rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_RELATIVE, 
+				row_number-1);
+				Py_END_ALLOW_THREADS;
+		} else {
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_ABSOLUTE, 
+				row_number);
+			Py_END_ALLOW_THREADS;
+		}
+#else /* PASE */
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_FIRST, 
+			row_number);
+		Py_END_ALLOW_THREADS;
+
+		if (row_number>1 && (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO))
+			Py_BEGIN_ALLOW_THREADS;
+
+			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_RELATIVE, 
+			row_number-1);
+
+			Py_END_ALLOW_THREADS;
+#endif /* PASE */
+	} else if (stmt_res->row_block_pos < stmt_res->rows_fetched) {
+		/* next row is already in the fetched block */
+		rc = SQL_SUCCESS;
+	} else {
+		/* row_number is NULL or 0; just fetch next row */
+		stmt_res->rows_fetched = 0;
+		stmt_res->row_block_pos = 0;
+		STATS_START(stats_start);
+		TRACE_START(trace_start);
+		Py_BEGIN_ALLOW_THREADS;
+
+		rc = SQLFetch((SQLHSTMT)stmt_res->hstmt);
+
+		Py_END_ALLOW_THREADS;
+	}
+	STATS_TIME(stmt_res, STATS_FETCH, stats_start);
+	if ( trace_start != 0.0 ) {
+		/* rows_fetched is only set for blocks of more than one row */
+		_python_ibm_db_trace_stmt(stmt_res, "fetch", rc, 
+			(rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO) ? 
+			(stmt_res->rows_fetched > 0 ? (long)stmt_res->rows_fetched : 1) : 0, trace_start);
+	}
+
+	if (rc == SQL_NO_DATA_FOUND) {
+		stmt_res->rows_fetched = 0;
+		stmt_res->row_block_pos = 0;
+		return SQL_NO_DATA_FOUND;
+	} else if ( rc != SQL_SUCCESS && rc != SQL_SUCCESS_WITH_INFO) {
+		stmt_res->rows_fetched = 0;
+		stmt_res->row_block_pos = 0;
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, 
+			NULL, -1, 1);
+		sprintf(error, "Fetch Failure: %s", IBM_DB_ERR(__python_stmt_err_msg));
+		PyErr_SetString(PyExc_Exception, error);
+		return SQL_ERROR;
+	}
+	if (stmt_res->rows_fetched == 0) {
+		stmt_res->rows_fetched = 1;
+	}
+	_python_ibm_db_load_row(stmt_res, stmt_res->row_block_pos++);
+	return SQL_SUCCESS;
+}
+
+/*	static PyObject *_python_ibm_db_get_column_value(stmt_handle *stmt_res, int column_number)
+	Python value of column column_number of the current row
+*/
+static PyObject *_python_ibm_db_get_column_value(stmt_handle *stmt_res, int column_number)
+{
+	int rc = -1;
+	SQLSMALLINT column_type, lob_bind_type = SQL_C_BINARY;
+	ibm_db_row_data_type *row_data;
+	SQLINTEGER out_length, tmp_length;
+	unsigned char *out_ptr = NULL;
+	SQLWCHAR *wout_ptr = NULL;
+	PyObject *value = NULL;
+	char error[DB2_MAX_ERR_MSG_LEN];
+
+	column_type = stmt_res->column_info[column_number].type;
+	row_data = &stmt_res->row_data[column_number].data;
+	out_length = stmt_res->row_data[column_number].out_length;
+
+	if (out_length == SQL_NULL_DATA) {
+		Py_INCREF(Py_None);
+		value = Py_None;
+	} else if (stmt_res->s_lob_reader == LOB_READER_ON && 
+		stmt_res->column_info[column_number].loc_type != 0) {
+		/* LOB values are handed out as readers of their locator */
+		value = _python_ibm_db_new_lob_reader(stmt_res, column_number);
+	} else {
+		switch(column_type) {
+			case SQL_CHAR:
+			case SQL_VARCHAR:
+			case SQL_WCHAR:
+			case SQL_WVARCHAR:
+			case SQL_GRAPHIC:
+			case SQL_VARGRAPHIC:
+			case SQL_LONGVARGRAPHIC:
+				tmp_length = stmt_res->column_info[column_number].size;
+				value = getSQLWCharAsPyUnicodeObject(row_data->w_val, out_length);
+				break;
+
+#ifndef PASE /* i5/OS SQL_LONGVARCHAR is SQL_VARCHAR */
+			case SQL_LONGVARCHAR:
+			case SQL_WLONGVARCHAR:
+#endif /* PASE */
+				/* i5/OS will xlate from EBCIDIC to ASCII (via SQLGetData) */
+				tmp_length = stmt_res->column_info[column_number].size;
+
+				wout_ptr = (SQLPOINTER)malloc(tmp_length * sizeof(SQLWCHAR) + 1);
+				if ( wout_ptr == NULL ) {
+					PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+					return NULL;
+				}
+				
+				/*  _python_ibm_db_get_data null terminates all output. */
+				rc = _python_ibm_db_get_data(stmt_res, column_number + 1, SQL_C_WCHAR, wout_ptr,
+					(tmp_length * sizeof(SQLWCHAR) + 1), &out_length);
+				if ( rc == SQL_ERROR ) {
+					return NULL;
+				}
+				if (out_length == SQL_NULL_DATA) {
+					Py_INCREF(Py_None);
+					value = Py_None;
+				} else {
+					value = getSQLWCharAsPyUnicodeObject(wout_ptr, out_length);
+				}
+				free(out_ptr);
+				break;
+			
+			case SQL_TYPE_DATE:
+			case SQL_TYPE_TIME:
+			case SQL_TYPE_TIMESTAMP:
+			case SQL_DECIMAL:
+			case SQL_NUMERIC:
+				if (stmt_res->bound_native_types == NATIVE_TYPES_ON) {
+					value = _python_ibm_db_native_value(column_type, row_data);
+					break;
+				}
+				/* fall-through */
+			case SQL_DECFLOAT:
+				value = PyString_FromString((char *)row_data->str_val);
+				break;
+
+			case SQL_BIGINT:
+				value = PyLong_FromString((char *)row_data->str_val, NULL, 10);
+				break;
+
+			case SQL_SMALLINT:
+				value = PyInt_FromLong(row_data->s_val);
+				break;
+
+			case SQL_INTEGER:
+				value = PyLong_FromLong(row_data->i_val);
+				break;
+
+			case SQL_REAL:
+				value = PyFloat_FromDouble(row_data->r_val);
+				break;
+
+			case SQL_FLOAT:
+				value = PyFloat_FromDouble(row_data->f_val);
+				break;
+
+			case SQL_DOUBLE:
+				value = PyFloat_FromDouble(row_data->d_val);
+				break;
+
+			case SQL_BINARY:
+#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
+			case SQL_LONGVARBINARY:
+#endif /* PASE */
+			case SQL_VARBINARY:
+				if ( stmt_res->s_bin_mode == PASSTHRU ) {
+					value = PyString_FromStringAndSize("", 0);
+				} else {
+					value = PyString_FromStringAndSize((char *)row_data->str_val, out_length);
+				}
+				break;
+
+			case SQL_BLOB:
+				out_ptr = NULL;
+				rc = _python_ibm_db_get_length(stmt_res, column_number + 1, &tmp_length);
 
-				case BINARY:
+				if (tmp_length == SQL_NULL_DATA) {
+					Py_INCREF(Py_None);
+					value = Py_None; 
+				} else {
+					if (rc == SQL_ERROR) tmp_length = 0;
+					switch (stmt_res->s_bin_mode) {
+						case PASSTHRU:
+							value = Py_None; 
+							Py_INCREF(Py_None);
+							break;
 
-					out_ptr = (SQLPOINTER)ALLOC_N(char, in_length);
-					if ( out_ptr == NULL ) {
-						PyErr_SetString(PyExc_Exception, 
-								"Failed to Allocate Memory for LOB Data");
-						Py_INCREF(Py_False);
-						return Py_False;
-					}
-					rc = _python_ibm_db_get_data2(stmt_res, (SQLUSMALLINT)col_num + 1, 
-								lob_bind_type, (char *)out_ptr, 
-								in_length, &out_length);
-					if (rc == SQL_ERROR) {
-						if(out_ptr != NULL) {
-							PyMem_Del(out_ptr);
-							out_ptr = NULL;
+						case CONVERT:
+							tmp_length = 2*tmp_length + 1;
+							lob_bind_type = SQL_C_CHAR;
+							/* fall-through */
+
+						case BINARY:
+							out_ptr = (SQLPOINTER)ALLOC_N(char, tmp_length);
+							if ( out_ptr == NULL ) {
+								PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+								return NULL;
+							}
+							rc = _python_ibm_db_get_data2(stmt_res, column_number + 1, 
+							lob_bind_type, (char *)out_ptr, tmp_length, &out_length);
+							if (rc == SQL_ERROR) {
+								PyMem_Del(out_ptr);
+								out_ptr = NULL;
+								out_length = 0;
+							}
+							value = PyString_FromStringAndSize((char*)out_ptr, out_length);
+							if(out_ptr != NULL) {
+								PyMem_Del(out_ptr);
+								out_ptr = NULL;
+							}
+				
+							break;
+						default:
+							break;
 						}
-						Py_INCREF(Py_False);
-						return Py_False;
-					}
-					retVal = PyString_FromStringAndSize((char*)out_ptr, out_length);
-					if(out_ptr != NULL) {
-						PyMem_Del(out_ptr);
-						out_ptr = NULL;
 					}
-					return retVal;
-				default:
-					break;
-			}
-			break;
-
+				break;				
+			
 		case SQL_XML:
-			rc = _python_ibm_db_get_data(stmt_res, (SQLUSMALLINT)col_num + 1, SQL_C_WCHAR, NULL, 
-					0, (SQLINTEGER *)&in_length);
+			wout_ptr = NULL;
+			rc = _python_ibm_db_get_data(stmt_res, column_number + 1, SQL_C_WCHAR, NULL, 
+				0, &tmp_length);
+			
 			if ( rc == SQL_ERROR ) {
-				Py_INCREF(Py_False);
-				return Py_False;
-			}
-			if (in_length == SQL_NULL_DATA) {
+				sprintf(error, "Failed to Determine XML Size: %s", 
+					IBM_DB_ERR(__python_stmt_err_msg));
+				PyErr_SetString(PyExc_Exception, error);
 				return NULL;
 			}
-			in_length = in_length + 1;
-			out_ptr = (SQLPOINTER)ALLOC_N(SQLWCHAR, in_length);
-			if ( out_ptr == NULL ) {
-				PyErr_SetString(PyExc_Exception, 
+
+			if (tmp_length == SQL_NULL_DATA) {
+				Py_INCREF(Py_None);
+				value = Py_None;
+			} else {
+				tmp_length = tmp_length + 1;
+				wout_ptr = (SQLWCHAR *)ALLOC_N(SQLWCHAR, tmp_length);
+
+				if ( wout_ptr == NULL ) {
+					PyErr_SetString(PyExc_Exception, 
 						"Failed to Allocate Memory for XML Data");
-				Py_INCREF(Py_False);
-				return Py_False;
-			}
-			rc = _python_ibm_db_get_data2(stmt_res, (SQLUSMALLINT)col_num + 1, SQL_C_BINARY, 
-						  (SQLPOINTER)out_ptr, in_length * sizeof(SQLWCHAR), 
-						  &out_length);
-			if (rc == SQL_ERROR) {
-				if(out_ptr != NULL) {
-					PyMem_Del(out_ptr);
-					out_ptr = NULL;
+					return NULL;
 				}
-				Py_INCREF(Py_False);
-				return Py_False;
-			}
-			retVal = getSQLWCharAsPyUnicodeObject((SQLWCHAR*)out_ptr, out_length);
-			if(out_ptr != NULL) {
-				PyMem_Del(out_ptr);
-				out_ptr = NULL;
+				rc = _python_ibm_db_get_data(stmt_res, column_number + 1, SQL_C_WCHAR, 
+					wout_ptr, tmp_length * sizeof(SQLWCHAR) , &out_length);
+				if (rc == SQL_ERROR) {
+					PyMem_Del(wout_ptr);
+					wout_ptr = NULL;
+					return NULL;
+				}
+				value = getSQLWCharAsPyUnicodeObject(wout_ptr, out_length);
+				if(wout_ptr != NULL) {
+					PyMem_Del(wout_ptr);
+					wout_ptr = NULL;
+				}
+			
+
 			}
-			return retVal;
+			break;
 
+		case SQL_CLOB:
+		case SQL_DBCLOB:
+			wout_ptr = NULL;
+			rc = _python_ibm_db_get_length(stmt_res, column_number + 1, &tmp_length);
+			if (tmp_length == SQL_NULL_DATA) {
+				Py_INCREF(Py_None);
+				value = Py_None; 
+			} else {
+				if (rc == SQL_ERROR) tmp_length = 0;
+				wout_ptr = (SQLPOINTER)ALLOC_N(SQLWCHAR, tmp_length + 1);
+				if ( wout_ptr == NULL ) {
+					PyErr_SetString(PyExc_Exception, 
+						"Failed to Allocate Memory for LOB Data");
+					return NULL;
+				}
+				rc = _python_ibm_db_get_data2(stmt_res, column_number + 1, SQL_C_WCHAR, 
+					wout_ptr , (tmp_length + 1) * sizeof(SQLWCHAR), 
+					&out_length);
+				if (rc == SQL_ERROR) {
+					PyMem_Del(wout_ptr);
+					wout_ptr = NULL;
+					tmp_length = 0;
+				} 
+				
+				value = getSQLWCharAsPyUnicodeObject(wout_ptr, (tmp_length) * sizeof(SQLWCHAR));
+			
+				if(wout_ptr != NULL) {
+					PyMem_Del(wout_ptr);
+					wout_ptr = NULL;
+				}					
+			}
+			break;
 		default:
+			Py_INCREF(Py_None);
+			value = Py_None;
 			break;
 		}
-	} else {
-		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
 	}
+	return value;
+}
 
-	Py_INCREF(Py_False);
-	return Py_False;
+/*	static PyObject *_python_ibm_db_new_row_object(stmt_handle *stmt_res)
+	new row object with room for the values of the result set, the column
+	names are shared by the rows and created on the first call
+*/
+static PyObject *_python_ibm_db_new_row_object(stmt_handle *stmt_res)
+{
+	row_object *row;
+	int i;
+
+	if ( stmt_res->row_names == NULL ) {
+		stmt_res->row_names = PyTuple_New(stmt_res->num_columns);
+		stmt_res->row_index = _PyDict_NewPresized(stmt_res->num_columns);
+		if ( stmt_res->row_names == NULL || stmt_res->row_index == NULL ) {
+			Py_CLEAR(stmt_res->row_names);
+			Py_CLEAR(stmt_res->row_index);
+			return NULL;
+		}
+		for (i = 0; i < stmt_res->num_columns; i++) {
+			Py_INCREF(stmt_res->column_info[i].key);
+			PyTuple_SET_ITEM(stmt_res->row_names, i, stmt_res->column_info[i].key);
+			if ( PyDict_SetItem(stmt_res->row_index, stmt_res->column_info[i].key, 
+				stmt_res->column_info[i].position) < 0 ) {
+				Py_CLEAR(stmt_res->row_names);
+				Py_CLEAR(stmt_res->row_index);
+				return NULL;
+			}
+		}
+	}
+	row = PyObject_NewVar(row_object, &row_objectType, stmt_res->num_columns);
+	if ( row == NULL ) {
+		return NULL;
+	}
+	for (i = 0; i < stmt_res->num_columns; i++) {
+		row->values[i] = NULL;
+	}
+	Py_INCREF(stmt_res->row_names);
+	row->names = stmt_res->row_names;
+	Py_INCREF(stmt_res->row_index);
+	row->index = stmt_res->row_index;
+	return (PyObject *)row;
+}
+
+/*	static PyObject *_python_ibm_db_build_row(stmt_handle *stmt_res, int op)
+	build the tuple (FETCH_INDEX), row object (FETCH_OBJECT) or dictionary of
+	the current row
+*/
+static PyObject *_python_ibm_db_build_row(stmt_handle *stmt_res, int op)
+{
+	int column_number;
+	PyObject *return_value = NULL;
+	PyObject *value = NULL;
+	double stats_start;
+
+	STATS_START(stats_start);
+
+	/* copy the data over return_value, the dictionary is sized for all the
+	 * keys up front; column names are folded and keys created at describe
+	 * time, see _python_ibm_db_build_column_keys */
+	if ( op & FETCH_ASSOC ) {
+		return_value = _PyDict_NewPresized(op == FETCH_BOTH ? 
+			2 * stmt_res->num_columns : stmt_res->num_columns);
+	} else if ( op == FETCH_INDEX ) {
+		return_value = PyTuple_New(stmt_res->num_columns);
+	} else if ( op == FETCH_OBJECT ) {
+		return_value = _python_ibm_db_new_row_object(stmt_res);
+	}
+	if ( return_value == NULL ) {
+		return NULL;
+	}
+
+	for (column_number = 0; column_number < stmt_res->num_columns; column_number++) {
+		value = _python_ibm_db_get_column_value(stmt_res, column_number);
+		if (value == NULL) {
+			Py_DECREF(return_value);
+			return NULL;
+		}
+		if (op & FETCH_ASSOC) {
+			PyDict_SetItem(return_value, stmt_res->column_info[column_number].key, value);
+		}
+		if (op == FETCH_INDEX) {
+			/* No need to call Py_DECREF as PyTuple_SetItem steals the reference */
+			PyTuple_SetItem(return_value, column_number, value);
+		} else if (op == FETCH_OBJECT) {
+			((row_object *)return_value)->values[column_number] = value;
+		} else {
+			if (op == FETCH_BOTH) {
+				PyDict_SetItem(return_value, stmt_res->column_info[column_number].position, value);
+			}
+			Py_DECREF(value);
+		}
+	}
+	STATS_TIME(stmt_res, STATS_CONVERT, stats_start);
+	return return_value;
 }
 
 /* static void _python_ibm_db_bind_fetch_helper(INTERNAL_FUNCTION_PARAMETERS, 
@@ -7178,21 +11195,11 @@ static PyObject *ibm_db_result(PyObject *self, PyObject *args)
 */
 static PyObject *_python_ibm_db_bind_fetch_helper(PyObject *args, int op)
 {
-	int rc = -1;
-	int column_number;
 	SQLINTEGER row_number = -1;
 	stmt_handle *stmt_res = NULL;
-	SQLSMALLINT column_type, lob_bind_type = SQL_C_BINARY;
-	ibm_db_row_data_type *row_data;
-	SQLINTEGER out_length, tmp_length;
-	unsigned char *out_ptr = NULL;
-	SQLWCHAR *wout_ptr = NULL;
-	PyObject *return_value = NULL;
-	PyObject *key = NULL;
-	PyObject *value = NULL;
 	PyObject *py_row_number = NULL;
-	char error[DB2_MAX_ERR_MSG_LEN];
-	
+	int rc;
+
 	if (!PyArg_ParseTuple(args, "O|O", &stmt_res, &py_row_number))
 		return NULL;
 
@@ -7210,590 +11217,1272 @@ static PyObject *_python_ibm_db_bind_fetch_helper(PyObject *args, int op)
 	}
 	_python_ibm_db_init_error_info(stmt_res);
 
+	if (_python_ibm_db_init_fetch(stmt_res) < 0) {
+		return NULL;
+	}
+	if (PyTuple_Size(args) == 2 && row_number < 0) {
+		PyErr_SetString(PyExc_Exception, 
+			"Requested row number must be a positive value");
+		return NULL;
+	}
+	rc = _python_ibm_db_fetch_next_row(stmt_res, row_number);
+	if (rc == SQL_NO_DATA_FOUND) {
+		Py_INCREF(Py_False);
+		return Py_False;
+	} else if (rc == SQL_ERROR) {
+		return NULL;
+	}
+	return _python_ibm_db_build_row(stmt_res, op);
+}
+
+/*!# ibm_db.fetch_row
+ *
+ * ===Description
+ * bool ibm_db.fetch_row ( resource stmt [, int row_number] )
+ *
+ * Sets the result set pointer to the next row or requested row
+ *
+ * Use ibm_db.fetch_row() to iterate through a result set, or to point to a
+ * specific row in a result set if you requested a scrollable cursor.
+ *
+ * To retrieve individual fields from the result set, call the ibm_db.result()
+ * function. Rather than calling ibm_db.fetch_row() and ibm_db.result(), most
+ * applications will call one of ibm_db.fetch_assoc(), ibm_db.fetch_both(), or
+ * ibm_db.fetch_array() to advance the result set pointer and return a complete
+ * row as an array.
+ *
+ * ===Parameters
+ * ====stmt
+ *		A valid stmt resource.
+ *
+ * ====row_number
+ *		With scrollable cursors, you can request a specific row number in the
+ * result set. Row numbering is 1-indexed.
+ *
+ * ===Return Values
+ *
+ * Returns TRUE if the requested row exists in the result set. Returns FALSE if
+ * the requested row does not exist in the result set.
+ */
+static PyObject *ibm_db_fetch_row(PyObject *self, PyObject *args)			
+{
+	PyObject *py_row_number = NULL;
+	SQLINTEGER row_number = -1;
+	stmt_handle* stmt_res = NULL;
+	int rc;
+	char error[DB2_MAX_ERR_MSG_LEN];
+	double stats_start, trace_start;
+
+	if (!PyArg_ParseTuple(args, "O|O", &stmt_res, &py_row_number))
+		return NULL;
+
+	if (NIL_P(stmt_res)) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	if (!NIL_P(py_row_number)) {
+		if (PyInt_Check(py_row_number)) {
+			row_number = (SQLINTEGER) PyInt_AsLong(py_row_number);
+		} else {
+			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+			return NULL;
+		}
+	}
 	/* get column header info */
 	if ( stmt_res->column_info == NULL ) {
 		if (_python_ibm_db_get_result_set_info(stmt_res)<0) {
 			sprintf(error, "Column information cannot be retrieved: %s", 
-				IBM_DB_G(__python_stmt_err_msg));
+				 IBM_DB_ERR(__python_stmt_err_msg));
 			PyErr_SetString(PyExc_Exception, error);
-			return NULL;
+			Py_INCREF(Py_False);
+			return Py_False;
 		}
 	}
-	/* bind the data */
-	if ( stmt_res->row_data == NULL ) {
-		rc = _python_ibm_db_bind_column_helper(stmt_res);
-		if ( rc != SQL_SUCCESS && rc != SQL_SUCCESS_WITH_INFO ) {
-			sprintf(error, "Column binding cannot be done: %s", 
-				IBM_DB_G(__python_stmt_err_msg));
-			PyErr_SetString(PyExc_Exception, error);
-			return NULL;
+
+	if (PyTuple_Size(args) == 2 && row_number < 0) {
+		PyErr_SetString(PyExc_Exception, 
+				  "Requested row number must be a positive value");
+		return NULL;
+	}
+	if (stmt_res->bound_array_size > 1) {
+		/* the columns are bound to a block of rows, step through it */
+		rc = _python_ibm_db_fetch_next_row(stmt_res, row_number);
+		if (rc == SQL_ERROR) {
+			/* the error is kept for stmt_error() */
+			PyErr_Clear();
+		}
+		if (rc == SQL_SUCCESS) {
+			Py_INCREF(Py_True);
+			return Py_True;
 		}
+		Py_INCREF(Py_False);
+		return Py_False;
 	}
-	/* check if row_number is present */
-	if (PyTuple_Size(args) == 2 && row_number > 0) {
-#ifndef PASE /* i5/OS problem with SQL_FETCH_ABSOLUTE (temporary until fixed) */
-		if (is_systemi) {
 
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_FIRST, 
-				row_number);
-			Py_END_ALLOW_THREADS;
-			
-			if (row_number>1 && (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO))
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_RELATIVE, 
-				row_number-1);
-				Py_END_ALLOW_THREADS;
-		} else {
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_ABSOLUTE, 
-				row_number);
-			Py_END_ALLOW_THREADS;
-		}
+	/* check if row_number is present */
+	STATS_START(stats_start);
+	TRACE_START(trace_start);
+	if (PyTuple_Size(args) == 2 && row_number > 0) { 
+#ifndef PASE /* i5/OS problem with SQL_FETCH_ABSOLUTE */
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_ABSOLUTE, 
+						  row_number);
+		Py_END_ALLOW_THREADS;
 #else /* PASE */
 		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_FIRST, 
-			row_number);
+						  row_number);
 		Py_END_ALLOW_THREADS;
 
 		if (row_number>1 && (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO))
 			Py_BEGIN_ALLOW_THREADS;
-
 			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_RELATIVE, 
-			row_number-1);
-
+							 row_number-1);
 			Py_END_ALLOW_THREADS;
 #endif /* PASE */
-	} else if (PyTuple_Size(args) == 2 && row_number < 0) {
-		PyErr_SetString(PyExc_Exception, 
-			"Requested row number must be a positive value");
-		return NULL;
 	} else {
 		/* row_number is NULL or 0; just fetch next row */
 		Py_BEGIN_ALLOW_THREADS;
-
 		rc = SQLFetch((SQLHSTMT)stmt_res->hstmt);
-
 		Py_END_ALLOW_THREADS;
 	}
+	STATS_TIME(stmt_res, STATS_FETCH, stats_start);
+	if ( trace_start != 0.0 ) {
+		_python_ibm_db_trace_stmt(stmt_res, "fetch", rc, 
+			(rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO) ? 1 : 0, trace_start);
+	}
 
-	if (rc == SQL_NO_DATA_FOUND) {
+	if (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO) {
+		STATS_ADD(stmt_res, rows_fetched, 1);
+		Py_INCREF(Py_True);
+		return Py_True;
+	} else if (rc == SQL_NO_DATA_FOUND) {
+		Py_INCREF(Py_False);
+		return Py_False;
+	} else {
+		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1,
+								  NULL, -1, 1);
 		Py_INCREF(Py_False);
 		return Py_False;
-	} else if ( rc != SQL_SUCCESS && rc != SQL_SUCCESS_WITH_INFO) {
-		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, 
-			NULL, -1, 1);
-		sprintf(error, "Fetch Failure: %s", IBM_DB_G(__python_stmt_err_msg));
-		PyErr_SetString(PyExc_Exception, error);
-		return NULL;
-	}
-	/* copy the data over return_value */
-	if ( op & FETCH_ASSOC ) {
-		return_value = PyDict_New();
-	} else if ( op == FETCH_INDEX ) {
-		return_value = PyTuple_New(stmt_res->num_columns);
 	}
+}
 
-	for (column_number = 0; column_number < stmt_res->num_columns; column_number++) {
-		column_type = stmt_res->column_info[column_number].type;
-		row_data = &stmt_res->row_data[column_number].data;
-		out_length = stmt_res->row_data[column_number].out_length;
+/*!# ibm_db.fetch_assoc
+ *
+ * ===Description
+ * dictionary ibm_db.fetch_assoc ( resource stmt [, int row_number] )
+ *
+ * Returns a dictionary, indexed by column name, representing a row in a result  * set.
+ *
+ * ===Parameters
+ * ====stmt
+ *		A valid stmt resource containing a result set.
+ *
+ * ====row_number
+ *
+ *		Requests a specific 1-indexed row from the result set. Passing this
+ * parameter results in a
+ *		Python warning if the result set uses a forward-only cursor.
+ *
+ * ===Return Values
+ *
+ * Returns an associative array with column values indexed by the column name
+ * representing the next
+ * or requested row in the result set. Returns FALSE if there are no rows left
+ * in the result set,
+ * or if the row requested by row_number does not exist in the result set.
+ */
+static PyObject *ibm_db_fetch_assoc(PyObject *self, PyObject *args)			
+{
+	return _python_ibm_db_bind_fetch_helper(args, FETCH_ASSOC);
+}
 
-		switch(stmt_res->s_case_mode) {
-			case CASE_LOWER:
-				stmt_res->column_info[column_number].name = 
-					(SQLCHAR*)strtolower((char*)stmt_res->column_info[column_number].name, 
-					strlen((char*)stmt_res->column_info[column_number].name));
-				break;
-			case CASE_UPPER:
-				stmt_res->column_info[column_number].name = 
-					(SQLCHAR*)strtoupper((char*)stmt_res->column_info[column_number].name, 
-					strlen((char*)stmt_res->column_info[column_number].name));
-				break;
-			case CASE_NATURAL:
-			default:
-					break;
+
+/*!# ibm_db.fetch_row_object
+ *
+ * ===Description
+ * object ibm_db.fetch_row_object ( resource stmt [, int row_number] )
+ *
+ * Returns an object representing a row in a result set, whose values can be
+ * accessed by column position, by column name, or as attributes named after
+ * the columns.
+ *
+ * The row holds its values like a tuple; the column names are created once
+ * per result set and shared by all its rows, so a row takes much less memory
+ * than the dictionaries returned by ibm_db.fetch_assoc() and
+ * ibm_db.fetch_both(). ibm_db.fetch_object() is a synonym of this function.
+ *
+ * ===Parameters
+ *
+ * ====stmt
+ *		A valid stmt resource containing a result set.
+ *
+ * ====row_number
+ *		Requests a specific 1-indexed row from the result set. Passing this
+ * parameter results in a warning if the result set uses a forward-only cursor.
+ *
+ * ===Return Values
+ *
+ * Returns an ibm_db.IBM_DBRow object representing the next or requested row
+ * in the result set. row[0] returns the value of the first column, row['NAME']
+ * and row.NAME the value of the column NAME, row.keys() the column names, and
+ * the row compares equal to the tuple of its values. The column names are
+ * folded according to the ATTR_CASE option of the statement; when a column
+ * is named after a method of the row, the column value is returned.
+ *
+ * If your SELECT statement calls a scalar function to modify the value of a
+ * column, the database servers return the column number as the name of the
+ * column in the result set. You can use the AS clause to assign a name to the
+ * column in the result set.
+ *
+ * Returns FALSE if there are no rows left in the result set, or if the row
+ * requested by row_number does not exist in the result set.
+ */
+static PyObject *ibm_db_fetch_row_object(PyObject *self, PyObject *args)
+{
+	return _python_ibm_db_bind_fetch_helper(args, FETCH_OBJECT);
+}
+
+/*!# ibm_db.fetch_array
+ *
+ * ===Description
+ *
+ * array ibm_db.fetch_array ( resource stmt [, int row_number] )
+ *
+ * Returns a tuple, indexed by column position, representing a row in a result
+ * set. The columns are 0-indexed.
+ *
+ * ===Parameters
+ *
+ * ====stmt
+ *		A valid stmt resource containing a result set.
+ *
+ * ====row_number
+ *		Requests a specific 1-indexed row from the result set. Passing this
+ * parameter results in a warning if the result set uses a forward-only cursor.
+ *
+ * ===Return Values
+ *
+ * Returns a 0-indexed tuple with column values indexed by the column position
+ * representing the next or requested row in the result set. Returns FALSE if
+ * there are no rows left in the result set, or if the row requested by
+ * row_number does not exist in the result set.
+ */
+static PyObject *ibm_db_fetch_array(PyObject *self, PyObject *args)
+{
+	return _python_ibm_db_bind_fetch_helper(args, FETCH_INDEX);
+}
+
+/*!# ibm_db.fetch_both
+ *
+ * ===Description
+ * dictionary ibm_db.fetch_both ( resource stmt [, int row_number] )
+ *
+ * Returns a dictionary, indexed by both column name and position, representing  * a row in a result set. Note that the row returned by ibm_db.fetch_both()
+ * requires more memory than the single-indexed dictionaries/arrays returned by  * ibm_db.fetch_assoc() or ibm_db.fetch_tuple().
+ *
+ * ===Parameters
+ *
+ * ====stmt
+ *		A valid stmt resource containing a result set.
+ *
+ * ====row_number
+ *		Requests a specific 1-indexed row from the result set. Passing this
+ * parameter results in a warning if the result set uses a forward-only cursor.
+ *
+ * ===Return Values
+ *
+ * Returns a dictionary with column values indexed by both the column name and
+ * 0-indexed column number.
+ * The dictionary represents the next or requested row in the result set.
+ * Returns FALSE if there are no rows left in the result set, or if the row
+ * requested by row_number does not exist in the result set.
+ */
+static PyObject *ibm_db_fetch_both(PyObject *self, PyObject *args)
+{
+	return _python_ibm_db_bind_fetch_helper(args, FETCH_BOTH);
+}
+
+/*	static PyObject *_python_ibm_db_fetch_many_helper(stmt_handle *stmt_res, long num_rows)
+	list of up to num_rows row tuples, or of all remaining rows if num_rows is
+	negative
+*/
+static PyObject *_python_ibm_db_fetch_many_helper(stmt_handle *stmt_res, long num_rows)
+{
+	PyObject *return_value = NULL;
+	PyObject *row = NULL;
+	long rows = 0;
+	long presize;
+	int rc;
+
+	_python_ibm_db_init_error_info(stmt_res);
+	_python_ibm_db_clear_stmt_err_cache();
+
+	if (_python_ibm_db_init_fetch(stmt_res) < 0) {
+		return NULL;
+	}
+	/* A large num_rows is not allocated before the rows are fetched */
+	presize = num_rows > 0 ? num_rows : 0;
+	if (presize > DEFAULT_ROW_ARRAY_SIZE) {
+		presize = DEFAULT_ROW_ARRAY_SIZE;
+	}
+	return_value = PyList_New(presize);
+	if (return_value == NULL) {
+		return NULL;
+	}
+	while (num_rows < 0 || rows < num_rows) {
+		rc = _python_ibm_db_fetch_next_row(stmt_res, -1);
+		if (rc == SQL_NO_DATA_FOUND) {
+			break;
+		} else if (rc == SQL_ERROR) {
+			/* The rows already fetched are dropped, a partial list would
+			 * look like the end of the result set */
+			Py_DECREF(return_value);
+			return NULL;
 		}
-		if (out_length == SQL_NULL_DATA) {
-			Py_INCREF(Py_None);
-			value = Py_None;
+		row = _python_ibm_db_build_row(stmt_res, FETCH_INDEX);
+		if (row == NULL) {
+			Py_DECREF(return_value);
+			return NULL;
+		}
+		if (rows < presize) {
+			/* PyList_SET_ITEM steals the reference */
+			PyList_SET_ITEM(return_value, rows, row);
 		} else {
-			switch(column_type) {
-				case SQL_CHAR:
-				case SQL_VARCHAR:
-				case SQL_WCHAR:
-				case SQL_WVARCHAR:
-				case SQL_GRAPHIC:
-				case SQL_VARGRAPHIC:
-				case SQL_LONGVARGRAPHIC:
-					tmp_length = stmt_res->column_info[column_number].size;
-					value = getSQLWCharAsPyUnicodeObject(row_data->w_val, out_length);
-					break;
+			rc = PyList_Append(return_value, row);
+			Py_DECREF(row);
+			if (rc == -1) {
+				Py_DECREF(return_value);
+				return NULL;
+			}
+		}
+		rows++;
+	}
+	if (rows < presize) {
+		PyList_SetSlice(return_value, rows, presize, NULL);
+	}
+	return return_value;
+}
 
-#ifndef PASE /* i5/OS SQL_LONGVARCHAR is SQL_VARCHAR */
-				case SQL_LONGVARCHAR:
-				case SQL_WLONGVARCHAR:
-#endif /* PASE */
-					/* i5/OS will xlate from EBCIDIC to ASCII (via SQLGetData) */
-					tmp_length = stmt_res->column_info[column_number].size;
+/*!# ibm_db.fetch_many
+ *
+ * ===Description
+ * list ibm_db.fetch_many ( resource stmt, int num_rows )
+ *
+ * Returns a list of up to num_rows tuples, each representing a row in a
+ * result set as returned by ibm_db.fetch_tuple().
+ *
+ * ===Parameters
+ *
+ * ====stmt
+ *		A valid stmt resource containing a result set.
+ *
+ * ====num_rows
+ *		The maximum number of rows to fetch.
+ *
+ * ===Return Values
+ *
+ * Returns a list of the next num_rows rows of the result set. The list is
+ * shorter than num_rows, or empty, when there are not enough rows left in the
+ * result set. If fetching a row fails, an exception is raised and the rows
+ * fetched by the call are discarded.
+ */
+static PyObject *ibm_db_fetch_many(PyObject *self, PyObject *args)
+{
+	stmt_handle *stmt_res = NULL;
+	PyObject *py_num_rows = NULL;
+	long num_rows = 0;
+
+	if (!PyArg_ParseTuple(args, "OO", &stmt_res, &py_num_rows))
+		return NULL;
+
+	if (NIL_P(stmt_res)) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	if (PyInt_Check(py_num_rows) || PyLong_Check(py_num_rows)) {
+		num_rows = PyInt_AsLong(py_num_rows);
+	} else {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	if (num_rows < 0) {
+		PyErr_SetString(PyExc_Exception, 
+			"Requested number of rows must be a positive value");
+		return NULL;
+	}
+	if (num_rows == 0) {
+		return PyList_New(0);
+	}
+	return _python_ibm_db_fetch_many_helper(stmt_res, num_rows);
+}
+
+/*!# ibm_db.fetch_all
+ *
+ * ===Description
+ * list ibm_db.fetch_all ( resource stmt )
+ *
+ * Returns a list of tuples, each representing one of the remaining rows of a
+ * result set as returned by ibm_db.fetch_tuple().
+ *
+ * ===Parameters
+ *
+ * ====stmt
+ *		A valid stmt resource containing a result set.
+ *
+ * ===Return Values
+ *
+ * Returns a list of all rows left in the result set. If fetching a row fails,
+ * an exception is raised and the rows fetched by the call are discarded.
+ */
+static PyObject *ibm_db_fetch_all(PyObject *self, PyObject *args)
+{
+	stmt_handle *stmt_res = NULL;
 
-					wout_ptr = (SQLPOINTER)malloc(tmp_length * sizeof(SQLWCHAR) + 1);
-					if ( wout_ptr == NULL ) {
-						PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-						return NULL;
-					}
-					
-					/*  _python_ibm_db_get_data null terminates all output. */
-					rc = _python_ibm_db_get_data(stmt_res, column_number + 1, SQL_C_WCHAR, wout_ptr,
-						(tmp_length * sizeof(SQLWCHAR) + 1), &out_length);
-					if ( rc == SQL_ERROR ) {
-						return NULL;
-					}
-					if (out_length == SQL_NULL_DATA) {
-						Py_INCREF(Py_None);
-						value = Py_None;
-					} else {
-						value = getSQLWCharAsPyUnicodeObject(wout_ptr, out_length);
-					}
-					free(out_ptr);
-					break;
-				
-				case SQL_TYPE_DATE:
-				case SQL_TYPE_TIME:
-				case SQL_TYPE_TIMESTAMP:
-				case SQL_DECIMAL:
-				case SQL_NUMERIC:
-				case SQL_DECFLOAT:
-					value = PyString_FromString((char *)row_data->str_val);
-					break;
+	if (!PyArg_ParseTuple(args, "O", &stmt_res))
+		return NULL;
 
-				case SQL_BIGINT:
-					value = PyLong_FromString((char *)row_data->str_val, NULL, 10);
-					break;
+	if (NIL_P(stmt_res)) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	return _python_ibm_db_fetch_many_helper(stmt_res, -1);
+}
 
-				case SQL_SMALLINT:
-					value = PyInt_FromLong(row_data->s_val);
-					break;
+/*	static PyObject *_python_ibm_db_new_array(char *typecode)
+	new empty array.array of the given type code
+*/
+static PyObject *_python_ibm_db_new_array(char *typecode)
+{
+	PyObject *array_module = NULL;
 
-				case SQL_INTEGER:
-					value = PyLong_FromLong(row_data->i_val);
-					break;
+	if (array_type == NULL) {
+		array_module = PyImport_ImportModule("array");
+		if (array_module == NULL) {
+			return NULL;
+		}
+		array_type = PyObject_GetAttrString(array_module, "array");
+		Py_DECREF(array_module);
+		if (array_type == NULL) {
+			return NULL;
+		}
+	}
+	return PyObject_CallFunction(array_type, "s", typecode);
+}
 
-				case SQL_REAL:
-					value = PyFloat_FromDouble(row_data->r_val);
-					break;
+/*	static int _python_ibm_db_array_append(PyObject *array, char *data, int size)
+	append size bytes of raw values to an array.array
+*/
+static int _python_ibm_db_array_append(PyObject *array, char *data, int size)
+{
+	PyObject *result = NULL;
 
-				case SQL_FLOAT:
-					value = PyFloat_FromDouble(row_data->f_val);
-					break;
+	if (size == 0) {
+		return 0;
+	}
+	result = PyObject_CallMethod(array, "fromstring", "s#", data, size);
+	if (result == NULL) {
+		return -1;
+	}
+	Py_DECREF(result);
+	return 0;
+}
 
-				case SQL_DOUBLE:
-					value = PyFloat_FromDouble(row_data->d_val);
-					break;
+/*	static char _python_ibm_db_column_array_type(SQLSMALLINT column_type)
+	array.array type code used by ibm_db.fetch_columns() for a column type,
+	0 if the column is returned as a list
+*/
+static char _python_ibm_db_column_array_type(SQLSMALLINT column_type)
+{
+	switch(column_type) {
+		case SQL_SMALLINT:
+		case SQL_INTEGER:
+			return 'l';
 
-				case SQL_BINARY:
-#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
-				case SQL_LONGVARBINARY:
-#endif /* PASE */
-				case SQL_VARBINARY:
-					if ( stmt_res->s_bin_mode == PASSTHRU ) {
-						value = PyString_FromStringAndSize("", 0);
-					} else {
-						value = PyString_FromStringAndSize((char *)row_data->str_val, out_length);
-					}
-					break;
+		case SQL_REAL:
+		case SQL_FLOAT:
+		case SQL_DOUBLE:
+			return 'd';
 
-				case SQL_BLOB:
-					out_ptr = NULL;
-					rc = _python_ibm_db_get_length(stmt_res, column_number + 1, &tmp_length);
+		default:
+			return 0;
+	}
+}
 
-					if (tmp_length == SQL_NULL_DATA) {
-						Py_INCREF(Py_None);
-						value = Py_None; 
-					} else {
-						if (rc == SQL_ERROR) tmp_length = 0;
-						switch (stmt_res->s_bin_mode) {
-							case PASSTHRU:
-								value = Py_None; 
-								Py_INCREF(Py_None);
-								break;
+/*	static PyObject *_python_ibm_db_fetch_columns_helper(stmt_handle *stmt_res, long num_rows)
+	(columns, nulls) tuple of up to num_rows rows, or of all remaining rows if
+	num_rows is negative, see ibm_db.fetch_columns()
+*/
+static PyObject *_python_ibm_db_fetch_columns_helper(stmt_handle *stmt_res, long num_rows)
+{
+	PyObject *columns = NULL;
+	PyObject *nulls = NULL;
+	PyObject *column = NULL;
+	PyObject *value = NULL;
+	ibm_db_row_type *row;
+	char *typecodes = NULL;
+	char *values = NULL;
+	char *null_flags = NULL;
+	char *data;
+	char typecode[2];
+	long rows = 0;
+	SQLULEN first, count, r;
+	SQLUINTEGER array_size;
+	int i, rc, has_lists = 0, is_null;
 
-							case CONVERT:
-								tmp_length = 2*tmp_length + 1;
-								lob_bind_type = SQL_C_CHAR;
-								/* fall-through */
+	_python_ibm_db_init_error_info(stmt_res);
+	_python_ibm_db_clear_stmt_err_cache();
 
-							case BINARY:
-								out_ptr = (SQLPOINTER)ALLOC_N(char, tmp_length);
-								if ( out_ptr == NULL ) {
-									PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
-									return NULL;
-								}
-								rc = _python_ibm_db_get_data2(stmt_res, column_number + 1, 
-								lob_bind_type, (char *)out_ptr, tmp_length, &out_length);
-								if (rc == SQL_ERROR) {
-									PyMem_Del(out_ptr);
-									out_ptr = NULL;
-									out_length = 0;
-								}
-								value = PyString_FromStringAndSize((char*)out_ptr, out_length);
-								if(out_ptr != NULL) {
-									PyMem_Del(out_ptr);
-									out_ptr = NULL;
-								}
-					
-								break;
-							default:
-								break;
-							}
-						}
-					break;				
-				
-			case SQL_XML:
-				wout_ptr = NULL;
-				rc = _python_ibm_db_get_data(stmt_res, column_number + 1, SQL_C_WCHAR, NULL, 
-					0, &tmp_length);
-				
-				if ( rc == SQL_ERROR ) {
-					sprintf(error, "Failed to Determine XML Size: %s", 
-						IBM_DB_G(__python_stmt_err_msg));
-					PyErr_SetString(PyExc_Exception, error);
-					return NULL;
-				}
+	if (_python_ibm_db_init_fetch(stmt_res) < 0) {
+		return NULL;
+	}
+	array_size = stmt_res->bound_array_size > 0 ? stmt_res->bound_array_size : 1;
 
-				if (tmp_length == SQL_NULL_DATA) {
-					Py_INCREF(Py_None);
-					value = Py_None;
-				} else {
-					tmp_length = tmp_length + 1;
-					wout_ptr = (SQLWCHAR *)ALLOC_N(SQLWCHAR, tmp_length);
+	columns = PyTuple_New(stmt_res->num_columns);
+	nulls = PyTuple_New(stmt_res->num_columns);
+	typecodes = ALLOC_N(char, stmt_res->num_columns + 1);
+	values = ALLOC_N(char, array_size * (sizeof(long) > sizeof(double) ? sizeof(long) : sizeof(double)));
+	null_flags = ALLOC_N(char, array_size * (stmt_res->num_columns + 1));
+	if (columns == NULL || nulls == NULL || typecodes == NULL || values == NULL || 
+		null_flags == NULL) {
+		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+		goto error;
+	}
 
-					if ( wout_ptr == NULL ) {
-						PyErr_SetString(PyExc_Exception, 
-							"Failed to Allocate Memory for XML Data");
-						return NULL;
-					}
-					rc = _python_ibm_db_get_data(stmt_res, column_number + 1, SQL_C_WCHAR, 
-						wout_ptr, tmp_length * sizeof(SQLWCHAR) , &out_length);
-					if (rc == SQL_ERROR) {
-						PyMem_Del(wout_ptr);
-						wout_ptr = NULL;
-						return NULL;
-					}
-					value = getSQLWCharAsPyUnicodeObject(wout_ptr, out_length);
-					if(wout_ptr != NULL) {
-						PyMem_Del(wout_ptr);
-						wout_ptr = NULL;
-					}
-				
+	typecode[1] = '\0';
+	for (i = 0; i < stmt_res->num_columns; i++) {
+		typecodes[i] = _python_ibm_db_column_array_type(stmt_res->column_info[i].type);
+		if (typecodes[i]) {
+			typecode[0] = typecodes[i];
+			column = _python_ibm_db_new_array(typecode);
+		} else {
+			column = PyList_New(0);
+			has_lists = 1;
+		}
+		if (column == NULL) {
+			goto error;
+		}
+		/* PyTuple_SET_ITEM steals the reference */
+		PyTuple_SET_ITEM(columns, i, column);
+		column = _python_ibm_db_new_array("B");
+		if (column == NULL) {
+			goto error;
+		}
+		PyTuple_SET_ITEM(nulls, i, column);
+	}
 
-				}
+	while (num_rows < 0 || rows < num_rows) {
+		rc = _python_ibm_db_fetch_next_row(stmt_res, -1);
+		if (rc == SQL_NO_DATA_FOUND) {
+			break;
+		} else if (rc == SQL_ERROR) {
+			if (rows > 0) {
+				/* Return the rows already fetched, the error is left for
+				 * ibm_db.stmt_errormsg() */
+				PyErr_Clear();
 				break;
+			}
+			goto error;
+		}
+		/* Consume the rest of the block fetched, the first of them is loaded */
+		first = stmt_res->row_block_pos - 1;
+		count = stmt_res->rows_fetched - first;
+		if (num_rows >= 0 && count > (SQLULEN)(num_rows - rows)) {
+			count = num_rows - rows;
+		}
 
-			case SQL_CLOB:
-			case SQL_DBCLOB:
-				wout_ptr = NULL;
-				rc = _python_ibm_db_get_length(stmt_res, column_number + 1, &tmp_length);
-				if (tmp_length == SQL_NULL_DATA) {
-					Py_INCREF(Py_None);
-					value = Py_None; 
-				} else {
-					if (rc == SQL_ERROR) tmp_length = 0;
-					wout_ptr = (SQLPOINTER)ALLOC_N(SQLWCHAR, tmp_length + 1);
-					if ( wout_ptr == NULL ) {
-						PyErr_SetString(PyExc_Exception, 
-							"Failed to Allocate Memory for LOB Data");
-						return NULL;
-					}
-					rc = _python_ibm_db_get_data2(stmt_res, column_number + 1, SQL_C_WCHAR, 
-						wout_ptr , (tmp_length + 1) * sizeof(SQLWCHAR), 
-						&out_length);
-					if (rc == SQL_ERROR) {
-						PyMem_Del(wout_ptr);
-						wout_ptr = NULL;
-						tmp_length = 0;
-					} 
-					
-					value = getSQLWCharAsPyUnicodeObject(wout_ptr, (tmp_length) * sizeof(SQLWCHAR));
-				
-					if(wout_ptr != NULL) {
-						PyMem_Del(wout_ptr);
-						wout_ptr = NULL;
-					}					
+		/* Numeric columns are copied straight out of the bound arrays */
+		for (i = 0; i < stmt_res->num_columns; i++) {
+			if (!typecodes[i]) {
+				continue;
+			}
+			row = &stmt_res->row_data[i];
+			for (r = 0; r < count; r++) {
+				data = (char *)row->buffer + (first + r) * row->buffer_size;
+				is_null = (row->out_lengths[first + r] == SQL_NULL_DATA);
+				null_flags[i * array_size + r] = (char)is_null;
+				switch(stmt_res->column_info[i].type) {
+					case SQL_SMALLINT:
+						((long *)values)[r] = is_null ? 0 : *(SQLSMALLINT *)data;
+						break;
+					case SQL_INTEGER:
+						((long *)values)[r] = is_null ? 0 : *(SQLINTEGER *)data;
+						break;
+					case SQL_REAL:
+						((double *)values)[r] = is_null ? 0 : *(SQLREAL *)data;
+						break;
+					default:
+						((double *)values)[r] = is_null ? 0 : *(SQLDOUBLE *)data;
+						break;
 				}
-				break;
-			default:
-				Py_INCREF(Py_None);
-				value = Py_None;
-				break;
+			}
+			if (_python_ibm_db_array_append(PyTuple_GET_ITEM(columns, i), values, 
+				count * (typecodes[i] == 'l' ? sizeof(long) : sizeof(double))) < 0) {
+				goto error;
 			}
 		}
-		if (op & FETCH_ASSOC) {
-			key = PyString_FromString((char*)stmt_res->column_info[column_number].name);
-			PyDict_SetItem(return_value, key, value);
-			Py_DECREF(key);
+
+		/* The other columns are converted one row at a time */
+		for (r = 0; has_lists && r < count; r++) {
+			if (r > 0) {
+				_python_ibm_db_load_row(stmt_res, first + r);
+			}
+			for (i = 0; i < stmt_res->num_columns; i++) {
+				if (typecodes[i]) {
+					continue;
+				}
+				value = _python_ibm_db_get_column_value(stmt_res, i);
+				if (value == NULL) {
+					goto error;
+				}
+				null_flags[i * array_size + r] = (char)(value == Py_None);
+				rc = PyList_Append(PyTuple_GET_ITEM(columns, i), value);
+				Py_DECREF(value);
+				if (rc < 0) {
+					goto error;
+				}
+			}
 		}
-		if (op == FETCH_INDEX) {
-			/* No need to call Py_DECREF as PyTuple_SetItem steals the reference */
-			PyTuple_SetItem(return_value, column_number, value);
-		} else {
-			if (op == FETCH_BOTH) {
-				key = PyInt_FromLong(column_number);
-				PyDict_SetItem(return_value, key, value);
-				Py_DECREF(key);
+
+		for (i = 0; i < stmt_res->num_columns; i++) {
+			if (_python_ibm_db_array_append(PyTuple_GET_ITEM(nulls, i), 
+				null_flags + i * array_size, count) < 0) {
+				goto error;
 			}
-			Py_DECREF(value);
 		}
+		stmt_res->row_block_pos = first + count;
+		rows += count;
 	}
-	return return_value;
+
+	PyMem_Del(typecodes);
+	PyMem_Del(values);
+	PyMem_Del(null_flags);
+	return Py_BuildValue("(NN)", columns, nulls);
+
+error:
+	Py_XDECREF(columns);
+	Py_XDECREF(nulls);
+	if (typecodes != NULL) {
+		PyMem_Del(typecodes);
+	}
+	if (values != NULL) {
+		PyMem_Del(values);
+	}
+	if (null_flags != NULL) {
+		PyMem_Del(null_flags);
+	}
+	return NULL;
 }
 
-/*!# ibm_db.fetch_row
+/*!# ibm_db.fetch_columns
  *
  * ===Description
- * bool ibm_db.fetch_row ( resource stmt [, int row_number] )
+ * tuple ibm_db.fetch_columns ( resource stmt [, int num_rows] )
  *
- * Sets the result set pointer to the next row or requested row
+ * Returns the next rows of a result set column by column, as a tuple
+ * (columns, nulls) of two tuples indexed by column position.
  *
- * Use ibm_db.fetch_row() to iterate through a result set, or to point to a
- * specific row in a result set if you requested a scrollable cursor.
+ * Each element of columns holds the values of one column: an array.array of
+ * type 'l' for SMALLINT and INTEGER columns, an array.array of type 'd' for
+ * REAL, FLOAT and DOUBLE columns, and a list of the values returned by
+ * ibm_db.fetch_tuple() for the other column types. The numeric columns are
+ * copied from the fetched block without creating a Python object per value.
  *
- * To retrieve individual fields from the result set, call the ibm_db.result()
- * function. Rather than calling ibm_db.fetch_row() and ibm_db.result(), most
- * applications will call one of ibm_db.fetch_assoc(), ibm_db.fetch_both(), or
- * ibm_db.fetch_array() to advance the result set pointer and return a complete
- * row as an array.
+ * Each element of nulls is an array.array of type 'B' with one entry per row,
+ * 1 when the value is NULL and 0 otherwise. NULL values are stored as 0 in the
+ * numeric arrays and as None in the lists.
  *
  * ===Parameters
+ *
  * ====stmt
- *		A valid stmt resource.
+ *		A valid stmt resource containing a result set.
  *
- * ====row_number
- *		With scrollable cursors, you can request a specific row number in the
- * result set. Row numbering is 1-indexed.
+ * ====num_rows
+ *		The maximum number of rows to fetch. All remaining rows are fetched if
+ * this parameter is omitted.
  *
  * ===Return Values
  *
- * Returns TRUE if the requested row exists in the result set. Returns FALSE if
- * the requested row does not exist in the result set.
+ * Returns a tuple (columns, nulls). The containers are shorter than num_rows,
+ * or empty, when there are not enough rows left in the result set. If fetching
+ * fails after some rows were retrieved, those rows are returned and the error
+ * is available from ibm_db.stmt_errormsg().
  */
-static PyObject *ibm_db_fetch_row(PyObject *self, PyObject *args)			
+static PyObject *ibm_db_fetch_columns(PyObject *self, PyObject *args)
 {
-	PyObject *py_row_number = NULL;
-	SQLINTEGER row_number = -1;
-	stmt_handle* stmt_res = NULL;
-	int rc;
-	char error[DB2_MAX_ERR_MSG_LEN];
+	stmt_handle *stmt_res = NULL;
+	PyObject *py_num_rows = NULL;
+	long num_rows = -1;
 
-	if (!PyArg_ParseTuple(args, "O|O", &stmt_res, &py_row_number))
+	if (!PyArg_ParseTuple(args, "O|O", &stmt_res, &py_num_rows))
 		return NULL;
 
 	if (NIL_P(stmt_res)) {
 		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
 		return NULL;
 	}
-	if (!NIL_P(py_row_number)) {
-		if (PyInt_Check(py_row_number)) {
-			row_number = (SQLINTEGER) PyInt_AsLong(py_row_number);
+	if (!NIL_P(py_num_rows)) {
+		if (PyInt_Check(py_num_rows) || PyLong_Check(py_num_rows)) {
+			num_rows = PyInt_AsLong(py_num_rows);
 		} else {
 			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
 			return NULL;
 		}
-	}
-	/* get column header info */
-	if ( stmt_res->column_info == NULL ) {
-		if (_python_ibm_db_get_result_set_info(stmt_res)<0) {
-			sprintf(error, "Column information cannot be retrieved: %s", 
-				 IBM_DB_G(__python_stmt_err_msg));
-			PyErr_SetString(PyExc_Exception, error);
-			Py_INCREF(Py_False);
-			return Py_False;
+		if (num_rows < 0) {
+			PyErr_SetString(PyExc_Exception, 
+				"Requested number of rows must be a positive value");
+			return NULL;
 		}
 	}
+	return _python_ibm_db_fetch_columns_helper(stmt_res, num_rows);
+}
 
-	/* check if row_number is present */
-	if (PyTuple_Size(args) == 2 && row_number > 0) { 
-#ifndef PASE /* i5/OS problem with SQL_FETCH_ABSOLUTE */
+/*	static char *_python_ibm_db_column_block_format(SQLSMALLINT column_type)
+	struct module format of the values of a column returned as a column block
+	by ibm_db.fetch_block(), NULL if the column is returned as a list
+*/
+static char *_python_ibm_db_column_block_format(SQLSMALLINT column_type)
+{
+	switch(column_type) {
+		case SQL_SMALLINT:
+			return "h";
+		case SQL_INTEGER:
+			return "i";
+		case SQL_REAL:
+			return "f";
+		case SQL_FLOAT:
+		case SQL_DOUBLE:
+			return "d";
+		default:
+			return NULL;
+	}
+}
 
-		rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_ABSOLUTE, 
-						  row_number);
-#else /* PASE */
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_FIRST, 
-						  row_number);
-		Py_END_ALLOW_THREADS;
+/*	static column_block *_python_ibm_db_new_column_block(char *buffer, SQLULEN first, SQLULEN count, Py_ssize_t itemsize, char *format, PyObject *indicators)
+	column block owning buffer, exporting count values starting at first.
+	The reference to indicators is stolen.
+*/
+static column_block *_python_ibm_db_new_column_block(char *buffer, SQLULEN first, SQLULEN count, Py_ssize_t itemsize, char *format, PyObject *indicators)
+{
+	column_block *block = PyObject_NEW(column_block, &column_blockType);
 
-		if (row_number>1 && (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO))
-			Py_BEGIN_ALLOW_THREADS;
-			rc = SQLFetchScroll((SQLHSTMT)stmt_res->hstmt, SQL_FETCH_RELATIVE, 
-							 row_number-1);
-			Py_END_ALLOW_THREADS;
-#endif /* PASE */
-	} else if (PyTuple_Size(args) == 2 && row_number < 0) {
-		PyErr_SetString(PyExc_Exception, 
-				  "Requested row number must be a positive value");
+	if ( block == NULL ) {
+		Py_XDECREF(indicators);
+		return NULL;
+	}
+	block->buffer = buffer;
+	block->data = buffer + first * itemsize;
+	block->length = count;
+	block->itemsize = itemsize;
+	block->format = format;
+	block->indicators = indicators;
+	return block;
+}
+
+/*	static PyObject *_python_ibm_db_detach_column_block(stmt_handle *stmt_res, int col, SQLULEN first, SQLULEN count)
+	hand the bound buffers of column col over to a column block and bind the
+	column to new buffers for the next block
+*/
+static PyObject *_python_ibm_db_detach_column_block(stmt_handle *stmt_res, int col, SQLULEN first, SQLULEN count)
+{
+	ibm_db_row_type *row = &stmt_res->row_data[col];
+	SQLSMALLINT target_type;
+	SQLPOINTER buffer = NULL;
+	SQLLEN *out_lengths = NULL;
+	PyObject *indicators = NULL;
+	column_block *block = NULL;
+	int rc;
+
+	buffer = (SQLPOINTER)ALLOC_N(char, row->buffer_size * stmt_res->bound_array_size);
+	out_lengths = ALLOC_N(SQLLEN, stmt_res->bound_array_size);
+	if ( buffer == NULL || out_lengths == NULL ) {
+		if ( buffer != NULL ) {
+			PyMem_Del(buffer);
+		}
+		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+		return NULL;
+	}
+	target_type = (stmt_res->column_info[col].type == SQL_REAL) ? SQL_C_FLOAT : SQL_C_DEFAULT;
+
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLBindCol((SQLHSTMT)stmt_res->hstmt, (SQLUSMALLINT)(col+1),
+		target_type, buffer, row->buffer_size, out_lengths);
+	Py_END_ALLOW_THREADS;
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, 
+			SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		PyMem_Del(buffer);
+		PyMem_Del(out_lengths);
+		PyErr_SetString(PyExc_Exception, IBM_DB_ERR(__python_stmt_err_msg));
 		return NULL;
-	} else {
-		/* row_number is NULL or 0; just fetch next row */
-		Py_BEGIN_ALLOW_THREADS;
-		rc = SQLFetch((SQLHSTMT)stmt_res->hstmt);
-		Py_END_ALLOW_THREADS;
 	}
 
-	if (rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO) {
-		Py_INCREF(Py_True);
-		return Py_True;
-	} else if (rc == SQL_NO_DATA_FOUND) {
-		Py_INCREF(Py_False);
-		return Py_False;
+	indicators = (PyObject *)_python_ibm_db_new_column_block((char *)row->out_lengths, 
+		first, count, sizeof(SQLLEN), SQLLEN_FORMAT, NULL);
+	if ( indicators == NULL ) {
+		PyMem_Del(row->out_lengths);
 	} else {
-		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1,
-								  NULL, -1, 1);
-		Py_INCREF(Py_False);
-		return Py_False;
+		block = _python_ibm_db_new_column_block((char *)row->buffer, first, count, 
+			row->buffer_size, _python_ibm_db_column_block_format(stmt_res->column_info[col].type), 
+			indicators);
 	}
+	if ( block == NULL ) {
+		PyMem_Del(row->buffer);
+	}
+	row->buffer = buffer;
+	row->out_lengths = out_lengths;
+	return (PyObject *)block;
 }
 
-/*!# ibm_db.fetch_assoc
+/*!# ibm_db.fetch_block
  *
  * ===Description
- * dictionary ibm_db.fetch_assoc ( resource stmt [, int row_number] )
- *
- * Returns a dictionary, indexed by column name, representing a row in a result  * set.
+ * tuple ibm_db.fetch_block ( resource stmt )
+ *
+ * Returns the rows left in the block of rows fetched from a result set, see the
+ * SQL_ATTR_ROW_ARRAY_SIZE option, fetching the next block first if needed.
+ *
+ * The tuple has one element per column, indexed by column position.
+ * SMALLINT, INTEGER, REAL, FLOAT and DOUBLE columns are returned as
+ * ibm_db.IBM_DBColumnBlock objects: the buffer the driver fetched the values
+ * into, exported read-only through the buffer protocol without copying, so that it can
+ * be wrapped with memoryview() or numpy.frombuffer(). The struct module format
+ * of the values is in the format attribute ('h', 'i', 'f' or 'd'). The
+ * indicators attribute is a column block of SQLLEN values holding
+ * SQL_NULL_DATA for NULL values, in format 'i', 'l' or 'q' depending on the
+ * size of SQLLEN in the CLI. A column block owns its buffers and stays valid when the
+ * statement moves on. The other columns are returned as lists of the values
+ * returned by ibm_db.fetch_tuple().
  *
  * ===Parameters
+ *
  * ====stmt
  *		A valid stmt resource containing a result set.
  *
- * ====row_number
- *
- *		Requests a specific 1-indexed row from the result set. Passing this
- * parameter results in a
- *		Python warning if the result set uses a forward-only cursor.
- *
  * ===Return Values
  *
- * Returns an associative array with column values indexed by the column name
- * representing the next
- * or requested row in the result set. Returns FALSE if there are no rows left
- * in the result set,
- * or if the row requested by row_number does not exist in the result set.
+ * Returns a tuple with the values of each column of the rows of the block.
+ * Returns FALSE if there are no rows left in the result set.
  */
-static PyObject *ibm_db_fetch_assoc(PyObject *self, PyObject *args)			
+static PyObject *ibm_db_fetch_block(PyObject *self, PyObject *args)
 {
-	return _python_ibm_db_bind_fetch_helper(args, FETCH_ASSOC);
-}
+	stmt_handle *stmt_res = NULL;
+	PyObject *return_value = NULL;
+	PyObject *column = NULL;
+	PyObject *value = NULL;
+	SQLULEN first, count, r;
+	int i, rc;
 
+	if (!PyArg_ParseTuple(args, "O", &stmt_res))
+		return NULL;
 
-/*
- * ibm_db.fetch_object --	Returns an object with properties representing columns in the fetched row
- * 
- * ===Description
- * object ibm_db.fetch_object ( resource stmt [, int row_number] )
- * 
- * Returns an object in which each property represents a column returned in the row fetched from a result set.
- * 
- * ===Parameters
- * 
- * stmt
- *		A valid stmt resource containing a result set. 
- * 
- * row_number
- *		Requests a specific 1-indexed row from the result set. Passing this parameter results in a
- *		Python warning if the result set uses a forward-only cursor. 
- * 
- * ===Return Values
- * 
- * Returns an object representing a single row in the result set. The properties of the object map
- * to the names of the columns in the result set.
- * 
- * The IBM DB2, Cloudscape, and Apache Derby database servers typically fold column names to upper-case,
- * so the object properties will reflect that case.
- * 
- * If your SELECT statement calls a scalar function to modify the value of a column, the database servers
- * return the column number as the name of the column in the result set. If you prefer a more
- * descriptive column name and object property, you can use the AS clause to assign a name
- * to the column in the result set.
- * 
- * Returns FALSE if no row was retrieved. 
- */
-/*
-PyObject *ibm_db_fetch_object(int argc, PyObject **argv, PyObject *self)
+	if (NIL_P(stmt_res)) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	_python_ibm_db_init_error_info(stmt_res);
+
+	if (_python_ibm_db_init_fetch(stmt_res) < 0) {
+		return NULL;
+	}
+	rc = _python_ibm_db_fetch_next_row(stmt_res, -1);
+	if (rc == SQL_NO_DATA_FOUND) {
+		Py_INCREF(Py_False);
+		return Py_False;
+	} else if (rc == SQL_ERROR) {
+		return NULL;
+	}
+	first = stmt_res->row_block_pos - 1;
+	count = stmt_res->rows_fetched - first;
+
+	return_value = PyTuple_New(stmt_res->num_columns);
+	if (return_value == NULL) {
+		return NULL;
+	}
+	/* Columns converted row by row go first, the first row is loaded */
+	for (i = 0; i < stmt_res->num_columns; i++) {
+		if (_python_ibm_db_column_block_format(stmt_res->column_info[i].type) == NULL ||
+			stmt_res->row_data[i].buffer == NULL) {
+			column = PyList_New(count);
+			if (column == NULL) {
+				Py_DECREF(return_value);
+				return NULL;
+			}
+			/* PyTuple_SET_ITEM steals the reference */
+			PyTuple_SET_ITEM(return_value, i, column);
+		}
+	}
+	for (r = 0; r < count; r++) {
+		if (r > 0) {
+			_python_ibm_db_load_row(stmt_res, first + r);
+		}
+		for (i = 0; i < stmt_res->num_columns; i++) {
+			column = PyTuple_GET_ITEM(return_value, i);
+			if (column == NULL) {
+				continue;
+			}
+			value = _python_ibm_db_get_column_value(stmt_res, i);
+			if (value == NULL) {
+				Py_DECREF(return_value);
+				return NULL;
+			}
+			PyList_SET_ITEM(column, r, value);
+		}
+	}
+	for (i = 0; i < stmt_res->num_columns; i++) {
+		if (PyTuple_GET_ITEM(return_value, i) == NULL) {
+			column = _python_ibm_db_detach_column_block(stmt_res, i, first, count);
+			if (column == NULL) {
+				Py_DECREF(return_value);
+				return NULL;
+			}
+			PyTuple_SET_ITEM(return_value, i, column);
+		}
+	}
+	stmt_res->row_block_pos = stmt_res->rows_fetched;
+	return return_value;
+}
+
+/*	static int _python_ibm_db_arrow_write_file(void *context, const char *data, size_t length)
+	arrow_write_func writing to the FILE * context
+*/
+static int _python_ibm_db_arrow_write_file(void *context, const char *data, size_t length)
 {
-	row_hash_struct *row_res;
+	if ( fwrite(data, 1, length, (FILE *)context) != length ) {
+		PyErr_SetFromErrno(PyExc_IOError);
+		return -1;
+	}
+	return 0;
+}
 
-	row_res = ALLOC(row_hash_struct);
-	row_res->hash = _python_ibm_db_bind_fetch_helper(argc, argv, FETCH_ASSOC);
+/*	static int _python_ibm_db_arrow_write_object(void *context, const char *data, size_t length)
+	arrow_write_func calling the write() method of the Python object context
+*/
+static int _python_ibm_db_arrow_write_object(void *context, const char *data, size_t length)
+{
+	PyObject *result = PyObject_CallMethod((PyObject *)context, "write", "s#", 
+		data, (int)length);
 
-	if (RTEST(row_res->hash)) {
-	  return Data_Wrap_Struct(le_row_struct,
-			_python_ibm_db_mark_row_struct, _python_ibm_db_free_row_struct,
-			row_res);
-	} else {
-	  free(row_res);
-	  return Py_False;
+	if ( result == NULL ) {
+		return -1;
 	}
+	Py_DECREF(result);
+	return 0;
 }
+
+/*	static arrow_type _python_ibm_db_arrow_type(SQLSMALLINT column_type)
+	Arrow type of the values of a column written by ibm_db.write_arrow()
 */
+static arrow_type _python_ibm_db_arrow_type(SQLSMALLINT column_type)
+{
+	switch(column_type) {
+		case SQL_SMALLINT:
+			return ARROW_INT16;
+		case SQL_INTEGER:
+			return ARROW_INT32;
+		case SQL_BIGINT:
+			return ARROW_INT64;
+		case SQL_REAL:
+			return ARROW_FLOAT32;
+		case SQL_FLOAT:
+		case SQL_DOUBLE:
+			return ARROW_FLOAT64;
+		case SQL_DECIMAL:
+		case SQL_NUMERIC:
+			return ARROW_DECIMAL128;
+		case SQL_TYPE_DATE:
+			return ARROW_DATE32;
+		case SQL_TYPE_TIME:
+			return ARROW_TIME32;
+		case SQL_TYPE_TIMESTAMP:
+			return ARROW_TIMESTAMP;
+		case SQL_BINARY:
+		case SQL_VARBINARY:
+		case SQL_LONGVARBINARY:
+		case SQL_BLOB:
+			return ARROW_BINARY;
+		default:
+			return ARROW_UTF8;
+	}
+}
 
-/*!# ibm_db.fetch_array
- *
- * ===Description
- *
- * array ibm_db.fetch_array ( resource stmt [, int row_number] )
- *
- * Returns a tuple, indexed by column position, representing a row in a result
- * set. The columns are 0-indexed.
- *
- * ===Parameters
- *
- * ====stmt
- *		A valid stmt resource containing a result set.
- *
- * ====row_number
- *		Requests a specific 1-indexed row from the result set. Passing this
- * parameter results in a warning if the result set uses a forward-only cursor.
- *
- * ===Return Values
- *
- * Returns a 0-indexed tuple with column values indexed by the column position
- * representing the next or requested row in the result set. Returns FALSE if
- * there are no rows left in the result set, or if the row requested by
- * row_number does not exist in the result set.
- */
-static PyObject *ibm_db_fetch_array(PyObject *self, PyObject *args)
+/*	static int _python_ibm_db_arrow_append_column(stmt_handle *stmt_res, arrow_stream *stream, int col)
+	append the value of column col of the current row to the stream
+*/
+static int _python_ibm_db_arrow_append_column(stmt_handle *stmt_res, arrow_stream *stream, int col)
 {
-	return _python_ibm_db_bind_fetch_helper(args, FETCH_INDEX);
+	ibm_db_row_type *row = &stmt_res->row_data[col];
+	PyObject *value = NULL, *bytes = NULL;
+	SQLINTEGER int_value;
+	SQLREAL real_value;
+	SQLDOUBLE double_value;
+	DATE_STRUCT *date_value;
+	TIME_STRUCT *time_value;
+	TIMESTAMP_STRUCT *ts_value;
+	SQLINTEGER length, out_length = 0;
+	char *lob_data;
+	int rc;
+
+	if ( row->buffer != NULL && row->out_length == SQL_NULL_DATA ) {
+		return arrow_append_null(stream, col);
+	}
+	switch(stmt_res->column_info[col].type) {
+		case SQL_SMALLINT:
+			return arrow_append_value(stream, col, &row->data.s_val, sizeof(row->data.s_val));
+
+		case SQL_INTEGER:
+			int_value = row->data.i_val;
+			return arrow_append_value(stream, col, &int_value, sizeof(int_value));
+
+		case SQL_REAL:
+			real_value = row->data.r_val;
+			return arrow_append_value(stream, col, &real_value, sizeof(real_value));
+
+		case SQL_FLOAT:
+			double_value = row->data.f_val;
+			return arrow_append_value(stream, col, &double_value, sizeof(double_value));
+
+		case SQL_DOUBLE:
+			double_value = row->data.d_val;
+			return arrow_append_value(stream, col, &double_value, sizeof(double_value));
+
+		case SQL_TYPE_DATE:
+			if ( stmt_res->bound_native_types == NATIVE_TYPES_ON ) {
+				date_value = (DATE_STRUCT *)row->data.str_val;
+				return arrow_append_datetime(stream, col, date_value->year, 
+					date_value->month, date_value->day, 0, 0, 0, 0);
+			}
+			return arrow_append_string(stream, col, (char *)row->data.str_val);
+
+		case SQL_TYPE_TIME:
+			if ( stmt_res->bound_native_types == NATIVE_TYPES_ON ) {
+				time_value = (TIME_STRUCT *)row->data.str_val;
+				return arrow_append_datetime(stream, col, 1970, 1, 1, time_value->hour, 
+					time_value->minute, time_value->second, 0);
+			}
+			return arrow_append_string(stream, col, (char *)row->data.str_val);
+
+		case SQL_TYPE_TIMESTAMP:
+			if ( stmt_res->bound_native_types == NATIVE_TYPES_ON ) {
+				ts_value = (TIMESTAMP_STRUCT *)row->data.str_val;
+				return arrow_append_datetime(stream, col, ts_value->year, 
+					ts_value->month, ts_value->day, ts_value->hour, ts_value->minute, 
+					ts_value->second, ts_value->fraction / 1000);
+			}
+			return arrow_append_string(stream, col, (char *)row->data.str_val);
+
+		case SQL_BIGINT:
+		case SQL_DECIMAL:
+		case SQL_NUMERIC:
+			return arrow_append_string(stream, col, (char *)row->data.str_val);
+
+		case SQL_CHAR:
+		case SQL_VARCHAR:
+		case SQL_WCHAR:
+		case SQL_WVARCHAR:
+		case SQL_GRAPHIC:
+		case SQL_VARGRAPHIC:
+		case SQL_LONGVARGRAPHIC:
+			return arrow_append_utf16(stream, col, (unsigned short *)row->data.w_val, 
+				row->out_length / sizeof(SQLWCHAR));
+
+		case SQL_BINARY:
+#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
+		case SQL_LONGVARBINARY:
+#endif /* PASE */
+		case SQL_VARBINARY:
+			/* the bytes are written whatever the BINARY mode, CONVERT binds
+			 * them as hexadecimal text */
+			if ( stmt_res->s_bin_mode == CONVERT ) {
+				return arrow_append_hex(stream, col, (char *)row->data.str_val, 
+					row->out_length);
+			}
+			return arrow_append_bytes(stream, col, (char *)row->data.str_val, 
+				row->out_length);
+
+		case SQL_BLOB:
+			/* read from the locator as bytes, not as the value of the BINARY
+			 * mode */
+			if ( _python_ibm_db_get_length(stmt_res, col + 1, &length) == SQL_ERROR ) {
+				return -1;
+			}
+			if ( length == SQL_NULL_DATA ) {
+				return arrow_append_null(stream, col);
+			}
+			lob_data = ALLOC_N(char, length + 1);
+			if ( lob_data == NULL ) {
+				PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+				return -1;
+			}
+			if ( length > 0 && _python_ibm_db_get_data2(stmt_res, col + 1, SQL_C_BINARY, 
+				lob_data, length, &out_length) == SQL_ERROR ) {
+				PyMem_Del(lob_data);
+				return -1;
+			}
+			rc = arrow_append_bytes(stream, col, lob_data, out_length);
+			PyMem_Del(lob_data);
+			return rc;
+
+		default:
+			/* Columns read with SQLGetData go through their Python value */
+			value = _python_ibm_db_get_column_value(stmt_res, col);
+			if ( value == NULL ) {
+				return -1;
+			}
+			if ( value == Py_None ) {
+				Py_DECREF(value);
+				return arrow_append_null(stream, col);
+			}
+			if ( PyUnicode_Check(value) ) {
+				bytes = PyUnicode_AsUTF8String(value);
+			} else {
+				bytes = PyObject_Str(value);
+			}
+			Py_DECREF(value);
+			if ( bytes == NULL ) {
+				return -1;
+			}
+			rc = arrow_append_bytes(stream, col, PyString_AS_STRING(bytes), 
+				PyString_GET_SIZE(bytes));
+			Py_DECREF(bytes);
+			return rc;
+	}
 }
 
-/*!# ibm_db.fetch_both
+/*!# ibm_db.write_arrow
  *
  * ===Description
- * dictionary ibm_db.fetch_both ( resource stmt [, int row_number] )
+ * int ibm_db.write_arrow ( resource stmt, mixed destination [, int batch_rows] )
  *
- * Returns a dictionary, indexed by both column name and position, representing  * a row in a result set. Note that the row returned by ibm_db.fetch_both()
- * requires more memory than the single-indexed dictionaries/arrays returned by  * ibm_db.fetch_assoc() or ibm_db.fetch_tuple().
+ * Writes the remaining rows of a result set as an Apache Arrow IPC stream.
+ *
+ * The stream holds the schema of the result set, followed by record batches
+ * of at most batch_rows rows, built in C directly from the fetched blocks; no
+ * Python object is created for the values of bound columns. Columns are
+ * written as:
+ *
+ *		SMALLINT, INTEGER, BIGINT: int16, int32, int64
+ *		REAL, FLOAT, DOUBLE: float, double
+ *		DECIMAL, NUMERIC: decimal128 of the column precision and scale
+ *		DATE, TIME, TIMESTAMP: date32, time32 (seconds), timestamp (microseconds)
+ *		BINARY, VARBINARY, BLOB: binary, the bytes of the value whatever the
+ *			BINARY mode of the statement
+ *		character, graphic, CLOB, DBCLOB, XML and other types: utf8 string
  *
  * ===Parameters
  *
  * ====stmt
  *		A valid stmt resource containing a result set.
  *
- * ====row_number
- *		Requests a specific 1-indexed row from the result set. Passing this
- * parameter results in a warning if the result set uses a forward-only cursor.
+ * ====destination
+ *		The path of the file to write, or an object with a write() method
+ * taking a string, such as a file opened in binary mode.
+ *
+ * ====batch_rows
+ *		The maximum number of rows in a record batch. Defaults to the size of
+ * the blocks of rows fetched, see the SQL_ATTR_ROW_ARRAY_SIZE option.
  *
  * ===Return Values
  *
- * Returns a dictionary with column values indexed by both the column name and
- * 0-indexed column number.
- * The dictionary represents the next or requested row in the result set.
- * Returns FALSE if there are no rows left in the result set, or if the row
- * requested by row_number does not exist in the result set.
+ * Returns the number of rows written.
  */
-static PyObject *ibm_db_fetch_both(PyObject *self, PyObject *args)
+static PyObject *ibm_db_write_arrow(PyObject *self, PyObject *args)
 {
-	return _python_ibm_db_bind_fetch_helper(args, FETCH_BOTH);
+	stmt_handle *stmt_res = NULL;
+	PyObject *destination = NULL;
+	PyObject *py_batch_rows = NULL;
+	FILE *file = NULL;
+	arrow_stream stream;
+	long batch_rows = 0, rows = 0;
+	int i, rc, failed = 0;
+
+	if (!PyArg_ParseTuple(args, "OO|O", &stmt_res, &destination, &py_batch_rows))
+		return NULL;
+
+	if (NIL_P(stmt_res) || NIL_P(destination)) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	if (!NIL_P(py_batch_rows)) {
+		if (PyInt_Check(py_batch_rows) || PyLong_Check(py_batch_rows)) {
+			batch_rows = PyInt_AsLong(py_batch_rows);
+		} else {
+			PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+			return NULL;
+		}
+		if (batch_rows <= 0) {
+			PyErr_SetString(PyExc_Exception, 
+				"Requested number of rows must be a positive value");
+			return NULL;
+		}
+	}
+	if (!PyString_Check(destination) && !PyObject_HasAttrString(destination, "write")) {
+		PyErr_SetString(PyExc_Exception, "Supplied parameter is invalid");
+		return NULL;
+	}
+	_python_ibm_db_init_error_info(stmt_res);
+	_python_ibm_db_clear_stmt_err_cache();
+
+	if (_python_ibm_db_init_fetch(stmt_res) < 0) {
+		return NULL;
+	}
+	if (batch_rows == 0) {
+		batch_rows = stmt_res->bound_array_size > 1 ? stmt_res->bound_array_size : 
+			DEFAULT_ROW_ARRAY_SIZE;
+	}
+
+	if (PyString_Check(destination)) {
+		file = fopen(PyString_AsString(destination), "wb");
+		if (file == NULL) {
+			PyErr_SetFromErrnoWithFilename(PyExc_IOError, PyString_AsString(destination));
+			return NULL;
+		}
+		rc = arrow_stream_init(&stream, stmt_res->num_columns, 
+			_python_ibm_db_arrow_write_file, file);
+	} else {
+		rc = arrow_stream_init(&stream, stmt_res->num_columns, 
+			_python_ibm_db_arrow_write_object, destination);
+	}
+	for (i = 0; rc == 0 && i < stmt_res->num_columns; i++) {
+		rc = arrow_stream_set_column(&stream, i, (char *)stmt_res->column_info[i].name, 
+			_python_ibm_db_arrow_type(stmt_res->column_info[i].type), 
+			stmt_res->column_info[i].size, stmt_res->column_info[i].scale);
+	}
+	if (rc == 0) {
+		rc = arrow_stream_write_schema(&stream);
+	}
+
+	while (rc == 0) {
+		rc = _python_ibm_db_fetch_next_row(stmt_res, -1);
+		if (rc == SQL_NO_DATA_FOUND) {
+			rc = arrow_stream_finish(&stream);
+			break;
+		} else if (rc == SQL_ERROR) {
+			failed = 1;
+			break;
+		}
+		for (i = 0; rc == 0 && i < stmt_res->num_columns; i++) {
+			rc = _python_ibm_db_arrow_append_column(stmt_res, &stream, i);
+		}
+		arrow_stream_end_row(&stream);
+		rows++;
+		if (rc == 0 && stream.num_rows >= batch_rows) {
+			rc = arrow_stream_write_batch(&stream);
+		}
+	}
+	if (rc != 0 && !failed && !PyErr_Occurred()) {
+		PyErr_SetString(PyExc_Exception, "Failed to Allocate Memory");
+	}
+	arrow_stream_free(&stream);
+	if (file != NULL && fclose(file) != 0 && rc == 0 && !failed) {
+		PyErr_SetFromErrno(PyExc_IOError);
+		return NULL;
+	}
+	if (rc != 0 || failed) {
+		return NULL;
+	}
+	return PyInt_FromLong(rows);
 }
 
 /*!# ibm_db.set_option
@@ -7849,20 +12538,27 @@ static PyObject *ibm_db_set_option(PyObject *self, PyObject *args)
 				rc = _python_ibm_db_parse_options(options, SQL_HANDLE_DBC, 
 					conn_res);
 				if (rc == SQL_ERROR) {
-					PyErr_SetString(PyExc_Exception, 
-						"Options Array must have string indexes");
+					/* keep the error of the option that was rejected */
+					if (!PyErr_Occurred()) {
+						PyErr_SetString(PyExc_Exception, 
+							"Options Array must have string indexes");
+					}
 					return NULL;
 				}
 			}
 		} else {
 			stmt_res = (stmt_handle *)conn_or_stmt;				  
+			stmt_res->options_changed = 1;
 
 			if ( !NIL_P(options) ) {
 				rc = _python_ibm_db_parse_options(options, SQL_HANDLE_STMT, 
 					stmt_res);
 				if (rc == SQL_ERROR) {
-					PyErr_SetString(PyExc_Exception, 
-						"Options Array must have string indexes");
+					/* keep the error of the option that was rejected */
+					if (!PyErr_Occurred()) {
+						PyErr_SetString(PyExc_Exception, 
+							"Options Array must have string indexes");
+					}
 					return NULL;
 				}
 			}
@@ -8823,8 +13519,10 @@ static PyObject *ibm_db_active(PyObject *self, PyObject *args)
 
 	if (!NIL_P(conn_res)) {
 #ifndef PASE
+		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLGetConnectAttr(conn_res->hdbc, SQL_ATTR_PING_DB, 
 			(SQLPOINTER)&conn_alive, 0, NULL);
+		Py_END_ALLOW_THREADS;
 		if ( rc == SQL_ERROR ) {
 			_python_ibm_db_check_sql_errors(conn_res->hdbc, SQL_HANDLE_DBC, rc, 1,
 				NULL, -1, 1);
@@ -8858,7 +13556,10 @@ static PyObject *ibm_db_active(PyObject *self, PyObject *args)
  *		A valid connection or statement resource containing a result set.
  *
  * ====options
- *		The options to be retrieved
+ *		The options to be retrieved. Besides the options that can be set,
+ *		a statement reports ATTR_BOUND_NATIVE_TYPES: the ATTR_NATIVE_TYPES
+ *		value its result set columns are bound with, which decides the
+ *		Python types fetched until the result set is freed.
  *
  * ====type
  *		A field that specifies the resource type (1 = Connection,
@@ -8915,6 +13616,25 @@ static PyObject *ibm_db_get_option(PyObject *self, PyObject *args)
 		 }
 			/* Check that the option given is not null */
 			if (!NIL_P(&op_integer)) {
+				/* Row and parameter array sizes are kept on the handle, not set on the connection */
+				if (op_integer == SQL_ATTR_ROW_ARRAY_SIZE) {
+					return PyInt_FromLong(conn_res->c_row_array_size);
+				}
+				if (op_integer == SQL_ATTR_PARAMSET_SIZE) {
+					return PyInt_FromLong(conn_res->c_paramset_size);
+				}
+				if (op_integer == SQL_ATTR_QUERY_TIMEOUT) {
+					return PyInt_FromLong(conn_res->c_query_timeout);
+				}
+				if (op_integer == ATTR_NATIVE_TYPES) {
+					return PyInt_FromLong(conn_res->c_native_types);
+				}
+				if (op_integer == ATTR_LOB_READER) {
+					return PyInt_FromLong(conn_res->c_lob_reader);
+				}
+				if (op_integer == ATTR_STMT_CACHE_SIZE) {
+					return PyInt_FromLong(conn_res->c_stmt_cache_size);
+				}
 				/* ACCTSTR_LEN is the largest possible length of the options to 
 				* retrieve 
 			 */
@@ -8964,6 +13684,25 @@ static PyObject *ibm_db_get_option(PyObject *self, PyObject *args)
 						return Py_False;
 					}
 					return PyInt_FromLong(value_int);
+				} else if (op_integer == SQL_ATTR_ROW_ARRAY_SIZE) {
+					/* 0 until set, the block size used is then chosen at bind time */
+					return PyInt_FromLong(stmt_res->row_array_size);
+				} else if (op_integer == SQL_ATTR_PARAMSET_SIZE) {
+					return PyInt_FromLong(stmt_res->paramset_size);
+				} else if (op_integer == SQL_ATTR_QUERY_TIMEOUT) {
+					return PyInt_FromLong(stmt_res->query_timeout);
+				} else if (op_integer == ATTR_NATIVE_TYPES) {
+					return PyInt_FromLong(stmt_res->s_native_types);
+				} else if (op_integer == ATTR_BOUND_NATIVE_TYPES) {
+					/* Until the columns are bound, the value they will be bound with */
+					if (stmt_res->row_data == NULL) {
+						return PyInt_FromLong(stmt_res->s_native_types);
+					}
+					return PyInt_FromLong(stmt_res->bound_native_types);
+				} else if (op_integer == ATTR_LOB_READER) {
+					return PyInt_FromLong(stmt_res->s_lob_reader);
+				} else if (op_integer == ATTR_PARAM_TYPES) {
+					return _python_ibm_db_get_param_types(stmt_res);
 				} else {
 					PyErr_SetString(PyExc_Exception,"Supplied parameter is invalid");
 					return NULL;
@@ -8986,7 +13725,7 @@ static int _ibm_db_chaining_flag(stmt_handle *stmt_res, SQLINTEGER flag, error_m
 	if ( flag == SQL_ATTR_CHAINING_BEGIN ) {
 		if ( rc == SQL_ERROR ) {
 			_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
-			PyErr_SetString(PyExc_Exception, IBM_DB_G(__python_stmt_err_msg));
+			PyErr_SetString(PyExc_Exception, IBM_DB_ERR(__python_stmt_err_msg));
 		}
 	} else {
 		if ( (rc != SQL_SUCCESS) || (client_err_cnt != 0) ) {
@@ -9011,7 +13750,7 @@ static int _ibm_db_chaining_flag(stmt_handle *stmt_res, SQLINTEGER flag, error_m
 			for ( errNo = client_err_cnt + 1; errNo <= (err_cnt + client_err_cnt); errNo++ ) {
 				sprintf(err_fmt,"%s\nError %d: %s", err_fmt, (int)errNo, "%s \n");
 				_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, SQL_HANDLE_STMT, SQL_ERROR, 1, NULL, -1, (errNo - client_err_cnt));
-				PyTuple_SetItem(errTuple, errNo - 1, PyString_FromString(IBM_DB_G(__python_stmt_err_msg)));
+				PyTuple_SetItem(errTuple, errNo - 1, PyString_FromString(IBM_DB_ERR(__python_stmt_err_msg)));
 			}
 			err_msg = PyString_Format(PyString_FromString(err_fmt), errTuple);
 			PyErr_SetString(PyExc_Exception, PyString_AsString(err_msg));
@@ -9038,14 +13777,564 @@ static void _build_client_err_list(error_msg_node *head_error_list, char *err_ms
 	}	
 } 
 
+/*	static void _python_ibm_db_raise_err_list(error_msg_node *error_list)
+	raises an exception listing the messages of error_list the way
+	_ibm_db_chaining_flag() reports the errors of a chained execution
+*/
+static void _python_ibm_db_raise_err_list(error_msg_node *error_list)
+{
+	PyObject *err_msg = PyString_FromString("");
+	int errNo = 1;
+
+	while ( error_list != NULL && err_msg != NULL ) {
+		PyString_ConcatAndDel(&err_msg, PyString_FromFormat("\nError %d: %s \n", errNo, error_list->err_msg));
+		error_list = error_list->next;
+		errNo++;
+	}
+	if ( err_msg != NULL ) {
+		PyErr_SetString(PyExc_Exception, PyString_AsString(err_msg));
+		Py_DECREF(err_msg);
+	}
+}
+
+/*	static int _python_ibm_db_is_binary_type(SQLSMALLINT data_type)
+	true for the SQL types string values are bound to as SQL_C_BINARY
+*/
+static int _python_ibm_db_is_binary_type(SQLSMALLINT data_type)
+{
+	switch ( data_type ) {
+		case SQL_BLOB:
+		case SQL_BINARY:
+#ifndef PASE /* i5/OS SQL_LONGVARBINARY is SQL_VARBINARY */
+		case SQL_LONGVARBINARY:
+#endif /* PASE */
+		case SQL_VARBINARY:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/*	static int _python_ibm_db_param_class(PyObject *value)
+	type of a parameter value of execute_many, True and False share a type
+*/
+static int _python_ibm_db_param_class(PyObject *value)
+{
+	int type = TYPE(value);
+	return (type == PYTHON_FALSE) ? PYTHON_TRUE : type;
+}
+
+/*	static int _python_ibm_db_check_param_row(PyObject *param, int row, int num_params, int *ref_class, error_msg_node *head_error_list)
+	checks the shape and value types of a row of execute_many, adds the error
+	to head_error_list and returns 0 if the row cannot be sent
+*/
+static int _python_ibm_db_check_param_row(PyObject *param, int row, int num_params, int *ref_class, error_msg_node *head_error_list)
+{
+	char error[DB2_MAX_ERR_MSG_LEN];
+	int j, type;
+
+	if ( !PyTuple_Check(param) ) {
+		sprintf(error, "Value parameter: %d is not a tuple", row + 1);
+	} else if ( PyTuple_GET_SIZE(param) > num_params ) {
+		sprintf(error, "Value parameter tuple: %d has more no of param", row + 1);
+	} else if ( PyTuple_GET_SIZE(param) < num_params ) {
+		sprintf(error, "Value parameter tuple: %d has less no of param", row + 1);
+	} else {
+		for ( j = 0; j < num_params; j++ ) {
+			type = _python_ibm_db_param_class(PyTuple_GET_ITEM(param, j));
+			if ( type == PYTHON_STREAM || ( type != PYTHON_NIL && type != ref_class[j] ) ) {
+				break;
+			}
+		}
+		if ( j == num_params ) {
+			return 1;
+		}
+		if ( type == PYTHON_STREAM ) {
+			sprintf(error, "Value parameter tuple: %d streams a LOB, use ibm_db.execute", row + 1);
+		} else {
+			sprintf(error, "Value parameters array %d is not homogeneous with privious parameters array", row + 1);
+		}
+	}
+	_build_client_err_list(head_error_list, error);
+	return 0;
+}
+
+/*	static SQLINTEGER _python_ibm_db_param_width_hint(PyObject *value)
+	estimated bytes a parameter value takes in its parameter array
+*/
+static SQLINTEGER _python_ibm_db_param_width_hint(PyObject *value)
+{
+	if ( PyString_Check(value) ) {
+		return PyString_GET_SIZE(value);
+	} else if ( PyUnicode_Check(value) ) {
+		return PyUnicode_GET_SIZE(value) * sizeof(SQLWCHAR);
+	}
+	return 32;
+}
+
+/*	static int _python_ibm_db_fill_param_array(param_array *arr, param_node *curr, int ref_class, PyObject *params, int *row_map, int num_rows, int col, PyObject **texts)
+	converts parameter col of the rows row_map[0..num_rows) of params into the
+	column-wise array arr. texts holds num_rows scratch slots. Returns -1 with
+	a Python exception set on failure
+*/
+static int _python_ibm_db_fill_param_array(param_array *arr, param_node *curr, int ref_class, PyObject *params, int *row_map, int num_rows, int col, PyObject **texts)
+{
+	PyObject *value = NULL;
+	const void *data = NULL;
+	Py_ssize_t length = 0;
+	SQLWCHAR *wvalue = NULL;
+	char *slot = NULL;
+	long ivalue = 0;
+	SQLINTEGER width = 0;
+	int i, isNewBuffer, as_text = 0;
+	int binary = _python_ibm_db_is_binary_type(curr->data_type);
+
+	/* Pick the C type of the batch and the width of its widest value */
+	switch ( ref_class ) {
+		case PYTHON_FIXNUM:
+			as_text = (curr->data_type == SQL_BIGINT || curr->data_type == SQL_DECIMAL);
+			for ( i = 0; i < num_rows && !as_text; i++ ) {
+				value = PyTuple_GET_ITEM(PyTuple_GET_ITEM(params, row_map[i]), col);
+				if ( value == Py_None ) {
+					continue;
+				}
+				ivalue = PyInt_Check(value) ? PyInt_AS_LONG(value) : PyLong_AsLong(value);
+				/* Values out of the SQLINTEGER range are sent as text */
+				if ( (ivalue == -1 && PyErr_Occurred()) || (long)(SQLINTEGER)ivalue != ivalue ) {
+					PyErr_Clear();
+					as_text = 1;
+				}
+			}
+			arr->value_type = as_text ? SQL_C_CHAR : SQL_C_LONG;
+			width = sizeof(SQLINTEGER);
+			break;
+
+		case PYTHON_TRUE:
+			arr->value_type = SQL_C_LONG;
+			width = sizeof(SQLINTEGER);
+			break;
+
+		case PYTHON_FLOAT:
+			arr->value_type = SQL_C_DOUBLE;
+			width = sizeof(double);
+			break;
+
+		case PYTHON_DECIMAL:
+			arr->value_type = SQL_C_CHAR;
+			as_text = 1;
+			break;
+
+		case PYTHON_STRING:
+		case PYTHON_UNICODE:
+			if ( binary ) {
+				arr->value_type = SQL_C_BINARY;
+			} else {
+				arr->value_type = (ref_class == PYTHON_STRING) ? SQL_C_CHAR : SQL_C_WCHAR;
+			}
+			for ( i = 0; i < num_rows; i++ ) {
+				value = PyTuple_GET_ITEM(PyTuple_GET_ITEM(params, row_map[i]), col);
+				if ( value == Py_None ) {
+					continue;
+				}
+				if ( binary ) {
+					PyObject_AsReadBuffer(value, &data, &length);
+				} else if ( ref_class == PYTHON_STRING ) {
+					length = PyString_GET_SIZE(value);
+				} else {
+					length = PyUnicode_GET_SIZE(value) * sizeof(SQLWCHAR);
+				}
+				if ( length > width ) {
+					width = (SQLINTEGER)length;
+				}
+			}
+			break;
+
+		default:
+			/* Parameters that are None in every row */
+			arr->value_type = SQL_C_CHAR;
+			width = 1;
+			break;
+	}
+
+	if ( as_text ) {
+		for ( i = 0; i < num_rows; i++ ) {
+			value = PyTuple_GET_ITEM(PyTuple_GET_ITEM(params, row_map[i]), col);
+			if ( value == Py_None ) {
+				texts[i] = NULL;
+				continue;
+			}
+			texts[i] = PyObject_Str(value);
+			if ( texts[i] == NULL ) {
+				while ( i-- > 0 ) {
+					Py_CLEAR(texts[i]);
+				}
+				return -1;
+			}
+			if ( PyString_GET_SIZE(texts[i]) > width ) {
+				width = (SQLINTEGER)PyString_GET_SIZE(texts[i]);
+			}
+		}
+	}
+
+	if ( width < 1 ) {
+		width = 1;
+	}
+	if ( width * num_rows > arr->capacity ) {
+		if ( arr->buffer != NULL ) {
+			PyMem_Del(arr->buffer);
+		}
+		arr->capacity = 0;
+		arr->buffer = ALLOC_N(char, width * num_rows);
+		if ( arr->buffer == NULL ) {
+			if ( as_text ) {
+				for ( i = 0; i < num_rows; i++ ) {
+					Py_CLEAR(texts[i]);
+				}
+			}
+			PyErr_NoMemory();
+			return -1;
+		}
+		arr->capacity = width * num_rows;
+	}
+	arr->width = width;
+
+	for ( i = 0; i < num_rows; i++ ) {
+		value = PyTuple_GET_ITEM(PyTuple_GET_ITEM(params, row_map[i]), col);
+		slot = arr->buffer + (size_t)i * width;
+		if ( value == Py_None ) {
+			arr->indicators[i] = SQL_NULL_DATA;
+			continue;
+		}
+		if ( as_text ) {
+			length = PyString_GET_SIZE(texts[i]);
+			memcpy(slot, PyString_AS_STRING(texts[i]), length);
+			arr->indicators[i] = (SQLLEN)length;
+			Py_CLEAR(texts[i]);
+			continue;
+		}
+		switch ( ref_class ) {
+			case PYTHON_FIXNUM:
+				ivalue = PyInt_Check(value) ? PyInt_AS_LONG(value) : PyLong_AsLong(value);
+				*(SQLINTEGER *)slot = (SQLINTEGER)ivalue;
+				arr->indicators[i] = sizeof(SQLINTEGER);
+				break;
+
+			case PYTHON_TRUE:
+				*(SQLINTEGER *)slot = (value == Py_True);
+				arr->indicators[i] = sizeof(SQLINTEGER);
+				break;
+
+			case PYTHON_FLOAT:
+				*(double *)slot = PyFloat_AsDouble(value);
+				arr->indicators[i] = sizeof(double);
+				break;
+
+			default:
+				if ( binary ) {
+					PyObject_AsReadBuffer(value, &data, &length);
+					memcpy(slot, data, length);
+				} else if ( ref_class == PYTHON_STRING ) {
+					length = PyString_GET_SIZE(value);
+					memcpy(slot, PyString_AS_STRING(value), length);
+				} else {
+					wvalue = getUnicodeDataAsSQLWCHAR(value, &isNewBuffer);
+					length = PyUnicode_GET_SIZE(value) * sizeof(SQLWCHAR);
+					memcpy(slot, wvalue, length);
+					if ( isNewBuffer ) {
+						PyMem_Del(wvalue);
+					}
+				}
+				arr->indicators[i] = (SQLLEN)length;
+				break;
+		}
+	}
+	return 0;
+}
+
+/*	static int _python_ibm_db_param_array_errors(stmt_handle *stmt_res, int rc, SQLUSMALLINT *status, int *row_map, int num_rows, error_msg_node *head_error_list)
+	adds the errors of the rows of an executed batch that failed to
+	head_error_list and returns their number
+*/
+static int _python_ibm_db_param_array_errors(stmt_handle *stmt_res, int rc, SQLUSMALLINT *status, int *row_map, int num_rows, error_msg_node *head_error_list)
+{
+	char error[DB2_MAX_ERR_MSG_LEN];
+	char msg[DB2_MAX_ERR_MSG_LEN];
+	SQLINTEGER num_recs = 0;
+	SQLINTEGER row_number;
+	int recno, i, count = 0;
+
+	SQLGetDiagField(SQL_HANDLE_STMT, (SQLHSTMT)stmt_res->hstmt, 0, SQL_DIAG_NUMBER,
+		(SQLPOINTER)&num_recs, SQL_IS_INTEGER, NULL);
+	for ( recno = 1; recno <= num_recs; recno++ ) {
+		row_number = 0;
+		SQLGetDiagField(SQL_HANDLE_STMT, (SQLHSTMT)stmt_res->hstmt, recno, SQL_DIAG_ROW_NUMBER,
+			(SQLPOINTER)&row_number, SQL_IS_INTEGER, NULL);
+		if ( row_number >= 1 && row_number <= num_rows ) {
+			/* Skip the warnings of rows that were applied */
+			if ( status[row_number - 1] != SQL_PARAM_ERROR ) {
+				continue;
+			}
+		} else if ( rc != SQL_ERROR ) {
+			continue;
+		}
+		msg[0] = '\0';
+		_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, SQL_HANDLE_STMT,
+			SQL_ERROR, 0, msg, DB2_ERRMSG, (SQLSMALLINT)recno);
+		if ( row_number >= 1 && row_number <= num_rows ) {
+			PyOS_snprintf(error, DB2_MAX_ERR_MSG_LEN, "Value parameter tuple: %d failed: %s",
+				row_map[row_number - 1] + 1, msg);
+		} else {
+			PyOS_snprintf(error, DB2_MAX_ERR_MSG_LEN, "%s", msg);
+		}
+		_build_client_err_list(head_error_list, error);
+		count++;
+	}
+
+	/* Rows the driver reported no diagnostics for */
+	if ( count == 0 ) {
+		for ( i = 0; i < num_rows; i++ ) {
+			if ( status[i] == SQL_PARAM_ERROR || rc == SQL_ERROR ) {
+				sprintf(error, "Value parameter tuple: %d failed", row_map[i] + 1);
+				_build_client_err_list(head_error_list, error);
+				count++;
+			}
+		}
+	}
+	return count;
+}
+
+/*	static int _python_ibm_db_execute_many_array(stmt_handle *stmt_res, PyObject *params, int num_params, error_msg_node *head_error_list, int *err_count, SQLINTEGER *row_cnt)
+	executes the rows of params in batches bound as column-wise parameter
+	arrays, see SQL_ATTR_PARAMSET_SIZE. Rows that cannot be sent or fail are
+	added to head_error_list and counted in err_count, the rows affected are
+	added to row_cnt. Returns 0 without executing anything when a parameter
+	holds values that are only bound a row at a time, -1 with a Python
+	exception set on failure and 1 otherwise
+*/
+static int _python_ibm_db_execute_many_array(stmt_handle *stmt_res, PyObject *params, int num_params, error_msg_node *head_error_list, int *err_count, SQLINTEGER *row_cnt)
+{
+	int num_rows = PyTuple_Size(params);
+	int *ref_class = NULL;
+	int *row_map = NULL;
+	param_array *arrays = NULL;
+	PyObject **texts = NULL;
+	SQLINTEGER *est_width = NULL;
+	SQLUSMALLINT *status = NULL;
+	SQLULEN processed = 0;
+	SQLUINTEGER batch_size;
+	SQLINTEGER batch_cnt, row_width, hint;
+	PyObject *param = NULL;
+	param_node *curr = NULL;
+	int i, j, rc, type, batch_rows, next = 0, result = 1;
+	double stats_start;
+
+	/* The type of a parameter is the type of its first value that is not None */
+	ref_class = ALLOC_N(int, num_params);
+	for ( j = 0; j < num_params; j++ ) {
+		ref_class[j] = PYTHON_NIL;
+	}
+	for ( i = 0; i < num_rows; i++ ) {
+		param = PyTuple_GET_ITEM(params, i);
+		if ( !PyTuple_Check(param) || PyTuple_GET_SIZE(param) != num_params ) {
+			continue;
+		}
+		for ( j = 0; j < num_params; j++ ) {
+			if ( ref_class[j] == PYTHON_NIL ) {
+				ref_class[j] = _python_ibm_db_param_class(PyTuple_GET_ITEM(param, j));
+			}
+		}
+	}
+	for ( j = 0; j < num_params; j++ ) {
+		type = ref_class[j];
+		if ( type != PYTHON_FIXNUM && type != PYTHON_TRUE && type != PYTHON_FLOAT &&
+			type != PYTHON_STRING && type != PYTHON_UNICODE &&
+			type != PYTHON_DECIMAL && type != PYTHON_NIL ) {
+			PyMem_Del(ref_class);
+			return 0;
+		}
+	}
+
+	batch_size = (stmt_res->paramset_size > 0) ? stmt_res->paramset_size : DEFAULT_PARAMSET_SIZE;
+	if ( batch_size > (SQLUINTEGER)num_rows ) {
+		batch_size = num_rows;
+	}
+	row_map = ALLOC_N(int, batch_size);
+	status = ALLOC_N(SQLUSMALLINT, batch_size);
+	texts = ALLOC_N(PyObject *, batch_size);
+	est_width = ALLOC_N(SQLINTEGER, num_params);
+	arrays = ALLOC_N(param_array, num_params);
+	if ( row_map == NULL || status == NULL || texts == NULL || est_width == NULL || arrays == NULL ) {
+		PyErr_NoMemory();
+		result = -1;
+		goto cleanup;
+	}
+	memset(arrays, 0, sizeof(param_array) * num_params);
+	for ( j = 0; j < num_params; j++ ) {
+		arrays[j].indicators = ALLOC_N(SQLLEN, batch_size);
+		if ( arrays[j].indicators == NULL ) {
+			PyErr_NoMemory();
+			result = -1;
+			goto cleanup;
+		}
+	}
+
+	/* Rows that fail do not stop the rows after them from being applied */
+	Py_BEGIN_ALLOW_THREADS;
+	rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAM_BIND_TYPE,
+		(SQLPOINTER)SQL_PARAM_BIND_BY_COLUMN, SQL_IS_INTEGER);
+	if ( rc != SQL_ERROR ) {
+		rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAM_STATUS_PTR,
+			(SQLPOINTER)status, SQL_IS_POINTER);
+	}
+	if ( rc != SQL_ERROR ) {
+		rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR,
+			(SQLPOINTER)&processed, SQL_IS_POINTER);
+	}
+#ifdef SQL_ATTR_PARAMOPT_ATOMIC
+	if ( rc != SQL_ERROR ) {
+		/* Not supported by every server, the default then applies */
+		SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAMOPT_ATOMIC,
+			(SQLPOINTER)SQL_ATOMIC_NO, SQL_IS_INTEGER);
+	}
+#endif
+	Py_END_ALLOW_THREADS;
+
+	if ( rc == SQL_ERROR ) {
+		_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+		result = -1;
+		goto cleanup;
+	}
+
+	while ( next < num_rows ) {
+		/* Collect the rows of the next batch, keeping a batch of the default
+		 * size within MAX_PARAM_ARRAY_BUFFER_SIZE bytes */
+		batch_rows = 0;
+		memset(est_width, 0, sizeof(SQLINTEGER) * num_params);
+		while ( next < num_rows && batch_rows < (int)batch_size ) {
+			param = PyTuple_GET_ITEM(params, next);
+			if ( !_python_ibm_db_check_param_row(param, next, num_params, ref_class, head_error_list) ) {
+				(*err_count)++;
+				next++;
+				continue;
+			}
+			if ( stmt_res->paramset_size == 0 ) {
+				row_width = 0;
+				for ( j = 0; j < num_params; j++ ) {
+					hint = _python_ibm_db_param_width_hint(PyTuple_GET_ITEM(param, j));
+					row_width += (hint > est_width[j]) ? hint : est_width[j];
+				}
+				if ( batch_rows > 0 && row_width * (batch_rows + 1) > MAX_PARAM_ARRAY_BUFFER_SIZE ) {
+					break;
+				}
+				for ( j = 0; j < num_params; j++ ) {
+					hint = _python_ibm_db_param_width_hint(PyTuple_GET_ITEM(param, j));
+					if ( hint > est_width[j] ) {
+						est_width[j] = hint;
+					}
+				}
+			}
+			row_map[batch_rows++] = next++;
+		}
+		if ( batch_rows == 0 ) {
+			break;
+		}
+
+		/* Convert and bind the parameter arrays of the batch */
+		for ( j = 0; j < num_params; j++ ) {
+			curr = &stmt_res->param_cache[j];
+			if ( _python_ibm_db_fill_param_array(&arrays[j], curr, ref_class[j], params, row_map, batch_rows, j, texts) ) {
+				result = -1;
+				goto cleanup;
+			}
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLBindParameter((SQLHSTMT)stmt_res->hstmt, curr->param_num, SQL_PARAM_INPUT,
+				arrays[j].value_type, curr->data_type, curr->param_size, curr->scale,
+				arrays[j].buffer, arrays[j].width, arrays[j].indicators);
+			Py_END_ALLOW_THREADS;
+
+			if ( rc == SQL_ERROR ) {
+				_python_ibm_db_check_sql_errors((SQLHSTMT)stmt_res->hstmt, SQL_HANDLE_STMT, rc, 1, NULL, -1, 1);
+				result = -1;
+				goto cleanup;
+			}
+		}
+
+		for ( i = 0; i < batch_rows; i++ ) {
+			status[i] = SQL_PARAM_UNUSED;
+		}
+		STATS_ADD(stmt_res, params_bound, num_params * batch_rows);
+		STATS_START(stats_start);
+		Py_BEGIN_ALLOW_THREADS;
+		rc = SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAMSET_SIZE,
+			(SQLPOINTER)(size_t)batch_rows, SQL_IS_INTEGER);
+		if ( rc != SQL_ERROR ) {
+			rc = SQLExecute((SQLHSTMT)stmt_res->hstmt);
+		}
+		Py_END_ALLOW_THREADS;
+		STATS_TIME(stmt_res, STATS_EXECUTE, stats_start);
+
+		if ( rc == SQL_SUCCESS_WITH_INFO || rc == SQL_ERROR ) {
+			*err_count += _python_ibm_db_param_array_errors(stmt_res, rc, status, row_map, batch_rows, head_error_list);
+		}
+		if ( rc == SQL_SUCCESS || rc == SQL_SUCCESS_WITH_INFO || (rc == SQL_ERROR && processed > 0) ) {
+			batch_cnt = 0;
+			Py_BEGIN_ALLOW_THREADS;
+			rc = SQLRowCount((SQLHSTMT)stmt_res->hstmt, &batch_cnt);
+			Py_END_ALLOW_THREADS;
+			if ( rc != SQL_ERROR && batch_cnt > 0 ) {
+				*row_cnt += batch_cnt;
+			}
+		}
+	}
+
+cleanup:
+	/* Leave the statement bound for single rows again */
+	Py_BEGIN_ALLOW_THREADS;
+	SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, SQL_IS_INTEGER);
+	SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAM_STATUS_PTR, NULL, SQL_IS_POINTER);
+	SQLSetStmtAttr((SQLHSTMT)stmt_res->hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, NULL, SQL_IS_POINTER);
+	SQLFreeStmt((SQLHSTMT)stmt_res->hstmt, SQL_RESET_PARAMS);
+	Py_END_ALLOW_THREADS;
+
+	if ( arrays != NULL ) {
+		for ( j = 0; j < num_params; j++ ) {
+			if ( arrays[j].buffer != NULL ) {
+				PyMem_Del(arrays[j].buffer);
+			}
+			if ( arrays[j].indicators != NULL ) {
+				PyMem_Del(arrays[j].indicators);
+			}
+		}
+		PyMem_Del(arrays);
+	}
+	if ( est_width != NULL ) {
+		PyMem_Del(est_width);
+	}
+	if ( texts != NULL ) {
+		PyMem_Del(texts);
+	}
+	if ( status != NULL ) {
+		PyMem_Del(status);
+	}
+	if ( row_map != NULL ) {
+		PyMem_Del(row_map);
+	}
+	PyMem_Del(ref_class);
+	return result;
+}
+
 /*
  * ibm_db.execute_many -- can be used to execute an SQL with multiple values of parameter marker.
  * ===Description
  * int ibm_db.execute_many(IBM_DBStatement, Parameters[, Options])
  * Returns number of inserted/updated/deleted rows if batch executed successfully.
  * return NULL if batch fully or partialy fails  (All the rows executed except for which error occurs).
+ * The rows are bound as arrays of parameters and sent in batches of
+ * SQL_ATTR_PARAMSET_SIZE rows, which Options may set for the statement.
+ * Parameters holding values that cannot be bound as arrays are sent a row at
+ * a time in a chained execution instead.
  */
-static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
+static PyObject* _python_ibm_db_execute_many_helper (PyObject *self, PyObject *args) {
 	PyObject *options = NULL;
 	PyObject *params = NULL;
 	stmt_handle *stmt_res = NULL;
@@ -9061,8 +14350,11 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 	int numOfParam = 0;
 	SQLINTEGER row_cnt = 0;
 	int chaining_start = 0;
+	double stats_start;
 
+	param_node *curr = NULL;
 	SQLSMALLINT *data_type;
+	SQLSMALLINT sql_data_type;
 	SQLUINTEGER precision;
 	SQLSMALLINT scale;
 	SQLSMALLINT nullable;
@@ -9082,37 +14374,49 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 		Py_END_ALLOW_THREADS;
 		
 		_python_ibm_db_clear_stmt_err_cache();
-		stmt_res->head_cache_list = NULL;
-		stmt_res->current_node = NULL;
+		_python_ibm_db_clear_param_cache(stmt_res);
+		stmt_res->current_param = 0;
+
+		if ( !NIL_P(options) ) {
+			if ( !PyDict_Check(options) ) {
+				PyErr_SetString(PyExc_Exception, "options Parameter must be of type dictionay");
+				return NULL;
+			}
+			if ( _python_ibm_db_parse_options(options, SQL_HANDLE_STMT, stmt_res) == SQL_ERROR ) {
+				return NULL;
+			}
+		}
 
 		/* Bind parameters */
 		Py_BEGIN_ALLOW_THREADS;
 		rc = SQLNumParams((SQLHSTMT)stmt_res->hstmt, (SQLSMALLINT*)&numOpts);
 		Py_END_ALLOW_THREADS;
 		
-		data_type = (SQLSMALLINT*)ALLOC_N(SQLSMALLINT, numOpts);
+		if ( _python_ibm_db_alloc_param_cache(stmt_res, numOpts) ) {
+			return NULL;
+		}
+		data_type = stmt_res->param_descs.data_type;
 		ref_data_type = (SQLSMALLINT*)ALLOC_N(SQLSMALLINT, numOpts);
 		for ( i = 0; i < numOpts; i++) {
 			ref_data_type[i] = -1;
 		}
 		if ( numOpts != 0 ) {
 			for ( i = 0; i < numOpts; i++ ) {
-				Py_BEGIN_ALLOW_THREADS;
-				rc = SQLDescribeParam((SQLHSTMT)stmt_res->hstmt, i + 1,
-					(SQLSMALLINT*)(data_type + i), &precision, (SQLSMALLINT*)&scale,
-					(SQLSMALLINT*)&nullable);
-				Py_END_ALLOW_THREADS;
+				/* Described once per prepared statement */
+				rc = _python_ibm_db_describe_param(stmt_res, i + 1, &sql_data_type,
+					&precision, &scale, &nullable);
 
 				if ( rc == SQL_ERROR ) {
-					_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT,
-												rc, 1, NULL, -1, 1);
-					PyErr_SetString(PyExc_Exception, IBM_DB_G(__python_stmt_err_msg));
+					PyMem_Del(ref_data_type);
+					PyErr_SetString(PyExc_Exception, IBM_DB_ERR(__python_stmt_err_msg));
 					return NULL;
 				}
 
-				build_list(stmt_res, i + 1, data_type[i], precision, 
-							  scale, nullable);
+				curr = _python_ibm_db_set_param_node(stmt_res, i + 1, sql_data_type,
+							  precision, scale, nullable);
+				curr->param_type = SQL_PARAM_INPUT;
 			}
+			stmt_res->dynamic_params = 1;
 		}
 
 		/* Execute SQL for all set of parameters */
@@ -9120,10 +14424,29 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 		head_error_list = ALLOC(error_msg_node);
 		memset(head_error_list, 0, sizeof(error_msg_node));
 		head_error_list->next = NULL;
+		if ( numOfRows > 0 && numOpts > 0 ) {
+			/* Send the rows as parameter arrays, falling back to chained
+			 * single rows for values that cannot be bound as arrays */
+			rc = _python_ibm_db_execute_many_array(stmt_res, params, numOpts, head_error_list, &err_count, &row_cnt);
+			if ( rc != 0 ) {
+				PyMem_Del(ref_data_type);
+				if ( rc > 0 && err_count != 0 ) {
+					_python_ibm_db_raise_err_list(head_error_list->next);
+				}
+				while ( head_error_list != NULL ) {
+					error_msg_node *tmp_err = head_error_list;
+					head_error_list = head_error_list->next;
+					PyMem_Del(tmp_err);
+				}
+				if ( rc < 0 || err_count != 0 ) {
+					return NULL;
+				}
+				return PyInt_FromLong(row_cnt);
+			}
+		}
 		if ( numOfRows > 0 ) {
 			for ( i = 0; i < numOfRows; i++ ) {
 				int j = 0;
-				param_node *curr = NULL;
 				PyObject *param = PyTuple_GET_ITEM(params, i);
 				error[0] = '\0';
 				if ( !PyTuple_Check(param) ) {
@@ -9151,9 +14474,8 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 				}
 
 				/* Bind values from the parameters_tuple to params */
-				curr = stmt_res->head_cache_list;
-
-				while ( curr != NULL ) {
+				for ( j = 0; j < numOpts; j++ ) {
+					curr = &stmt_res->param_cache[j];
 					data = PyTuple_GET_ITEM(param, j);
 					if ( data == NULL ) {
 						sprintf(error, "NULL value passed for value parameter: %d", i + 1);
@@ -9161,6 +14483,12 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 						err_count++;
 						break;
 					}
+					if ( TYPE(data) == PYTHON_STREAM ) {
+						sprintf(error, "Value parameter tuple: %d streams a LOB, use ibm_db.execute", i + 1);
+						_build_client_err_list(head_error_list, error);
+						err_count++;
+						break;
+					}
 
 					if ( chaining_start ) {
 						if ( ( TYPE(data) != PYTHON_NIL ) && ( ref_data_type[curr->param_num - 1] != TYPE(data) ) ) {
@@ -9252,6 +14580,7 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 								break;
 						}
 						curr->ivalue = SQL_NULL_DATA;
+						curr->bound_type = 0;
 
 						Py_BEGIN_ALLOW_THREADS;
 						rc = SQLBindParameter(stmt_res->hstmt, curr->param_num, curr->param_type, valueType, curr->data_type, curr->param_size, curr->scale, &curr->ivalue, 0, (SQLLEN *)&(curr->ivalue));
@@ -9259,13 +14588,11 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 					}
 					if ( rc != SQL_SUCCESS ) {
 						sprintf(error, "Binding Error 1: %s", 
-								IBM_DB_G(__python_stmt_err_msg));
+								IBM_DB_ERR(__python_stmt_err_msg));
 						_build_client_err_list(head_error_list, error);
 						err_count++;
 						break;
 					}
-					curr = curr->next;
-					j++;
 				}
 
 				if ( !chaining_start && ( error[0] == '\0' ) ) {
@@ -9278,9 +14605,12 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 				}
 
 				if ( error[0] == '\0' ) {
+					STATS_ADD(stmt_res, params_bound, numOfParam);
+					STATS_START(stats_start);
 					Py_BEGIN_ALLOW_THREADS;
 					rc = SQLExecute((SQLHSTMT)stmt_res->hstmt);
 					Py_END_ALLOW_THREADS;
+					STATS_TIME(stmt_res, STATS_EXECUTE, stats_start);
 				}
 			}
 		} else {
@@ -9311,13 +14641,30 @@ static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
 	
 	if ( (rc == SQL_ERROR) && (stmt_res != NULL) ) {
 		_python_ibm_db_check_sql_errors(stmt_res->hstmt, SQL_HANDLE_STMT, rc,1, NULL, -1, 1);
-		sprintf(error, "SQLRowCount failed: %s",IBM_DB_G(__python_stmt_err_msg));
+		sprintf(error, "SQLRowCount failed: %s",IBM_DB_ERR(__python_stmt_err_msg));
 		PyErr_SetString(PyExc_Exception, error);
 		return NULL;
 	}
 	return PyInt_FromLong(row_cnt);
 }
 
+static PyObject* ibm_db_execute_many (PyObject *self, PyObject *args) {
+	PyObject *result;
+	stmt_handle *stmt_res = NULL;
+	double trace_start;
+
+	TRACE_START(trace_start);
+	result = _python_ibm_db_execute_many_helper(self, args);
+	if ( trace_start != 0.0 && PyTuple_Size(args) > 0 &&
+			PyObject_TypeCheck(PyTuple_GET_ITEM(args, 0), &stmt_handleType) ) {
+		/* one report for all the rows, with the rows the batch affected */
+		stmt_res = (stmt_handle *)PyTuple_GET_ITEM(args, 0);
+		_python_ibm_db_trace_stmt(stmt_res, "execute", result == NULL ? SQL_ERROR : SQL_SUCCESS, 
+			(result != NULL && PyInt_Check(result)) ? PyInt_AsLong(result) : -1, trace_start);
+	}
+	return result;
+}
+
 /*
  * ===Description
  *  ibm_db.callproc( conn_handle conn_res, char *procName, (In/INOUT/OUT parameters tuple) )
@@ -9428,12 +14775,12 @@ static PyObject* ibm_db_callproc(PyObject *self, PyObject *args){
 		}
 	
 		if (!NIL_P(_python_ibm_db_execute_helper1(stmt_res, NULL))) {
-			tmp_curr = stmt_res->head_cache_list;
-			if(numOfParam != 0 && tmp_curr != NULL) {
+			if(numOfParam != 0 && stmt_res->num_params != 0) {
 				int paramCount = 1;
 				outTuple = PyTuple_New(numOfParam + 1);
 				PyTuple_SetItem(outTuple, 0, (PyObject*)stmt_res); 
-				while(tmp_curr != NULL && (paramCount <= numOfParam)) {
+				while(paramCount <= numOfParam && paramCount <= stmt_res->param_cache_size) {
+					tmp_curr = &stmt_res->param_cache[paramCount - 1];
 					if ( (tmp_curr->bind_indicator != SQL_NULL_DATA && tmp_curr->bind_indicator != SQL_NO_TOTAL )) {
 						switch (tmp_curr->data_type) {
 							case SQL_SMALLINT:
@@ -9468,7 +14815,6 @@ static PyObject* ibm_db_callproc(PyObject *self, PyObject *args){
 						PyTuple_SetItem(outTuple, paramCount, Py_None);
 						paramCount++;
 					}
-					tmp_curr = tmp_curr->next;
 				}
 			} else {
 				outTuple = (PyObject *)stmt_res;
@@ -9618,12 +14964,20 @@ static int _python_get_variable_type(PyObject *variable_value)
 	else if (PyComplex_Check(variable_value)){
 		return PYTHON_COMPLEX;
 	}
+	/* Instances of old-style classes such as StringIO.StringIO pass
+	 * PyNumber_Check */
+	else if (PyInstance_Check(variable_value) && PyObject_HasAttrString(variable_value, "read")){
+		return PYTHON_STREAM;
+	}
 	else if (PyNumber_Check(variable_value)){
 		return PYTHON_DECIMAL;
 	}
 	else if (variable_value == Py_None){
 		return PYTHON_NIL;
 	}
+	else if (PyObject_HasAttrString(variable_value, "read") || PyIter_Check(variable_value)){
+		return PYTHON_STREAM;
+	}
 	else return 0;
 }
 
@@ -9636,9 +14990,18 @@ static PyMethodDef ibm_db_Methods[] = {
 	{"prepare", (PyCFunction)ibm_db_prepare, METH_VARARGS, "Prepares an SQL statement."},
 	{"bind_param", (PyCFunction)ibm_db_bind_param, METH_VARARGS, "Binds a Python variable to an SQL statement parameter"},
 	{"execute", (PyCFunction)ibm_db_execute, METH_VARARGS, "Executes an SQL statement that was prepared by ibm_db.prepare()"},
+	{"execute_async", (PyCFunction)ibm_db_execute_async, METH_VARARGS, "Starts the execution of a prepared SQL statement and returns a handle to poll or wait for it"},
+	{"cancel", (PyCFunction)ibm_db_cancel, METH_VARARGS, "Cancels the SQL statement a statement resource is executing, from another thread"},
 	{"fetch_tuple", (PyCFunction)ibm_db_fetch_array, METH_VARARGS, "Returns an tuple, indexed by column position, representing a row in a result set"},
 	{"fetch_assoc", (PyCFunction)ibm_db_fetch_assoc, METH_VARARGS, "Returns a dictionary, indexed by column name, representing a row in a result set"},
 	{"fetch_both", (PyCFunction)ibm_db_fetch_both, METH_VARARGS, "Returns a dictionary, indexed by both column name and position, representing a row in a result set"},
+	{"fetch_many", (PyCFunction)ibm_db_fetch_many, METH_VARARGS, "Returns a list of up to the given number of tuples, each representing a row in a result set"},
+	{"fetch_all", (PyCFunction)ibm_db_fetch_all, METH_VARARGS, "Returns a list of tuples representing the remaining rows in a result set"},
+	{"fetch_columns", (PyCFunction)ibm_db_fetch_columns, METH_VARARGS, "Returns the values and NULL indicators of the next rows in a result set, one container per column"},
+	{"fetch_block", (PyCFunction)ibm_db_fetch_block, METH_VARARGS, "Returns the values of the rows in the current block of a result set, numeric columns as buffer protocol column blocks"},
+	{"write_arrow", (PyCFunction)ibm_db_write_arrow, METH_VARARGS, "Writes the remaining rows of a result set as an Apache Arrow IPC stream"},
+	{"fetch_row_object", (PyCFunction)ibm_db_fetch_row_object, METH_VARARGS, "Returns an object, indexed by column position and name, representing a row in a result set"},
+	{"fetch_object", (PyCFunction)ibm_db_fetch_row_object, METH_VARARGS, "Returns an object, indexed by column position and name, representing a row in a result set"},
 	{"fetch_row", (PyCFunction)ibm_db_fetch_row, METH_VARARGS, "Sets the result set pointer to the next row or requested row"},
 	{"result", (PyCFunction)ibm_db_result, METH_VARARGS, "Returns a single column from a row in the result set"},
 	{"active", (PyCFunction)ibm_db_active, METH_VARARGS, "Checks if the specified connection resource is active"},
@@ -9646,6 +15009,14 @@ static PyMethodDef ibm_db_Methods[] = {
 	{"callproc", (PyCFunction)ibm_db_callproc, METH_VARARGS, "Returns a tuple containing OUT/INOUT variable value"},
 	{"check_function_support", (PyCFunction)ibm_db_check_function_support, METH_VARARGS, "return true if fuction is supported otherwise return false"},
 	{"close", (PyCFunction)ibm_db_close, METH_VARARGS, "Close a database connection"},
+	{"get_stmt_cache_stats", (PyCFunction)ibm_db_get_stmt_cache_stats, METH_VARARGS, "Returns the counters of the prepared statement cache of a connection"},
+	{"set_pool_options", (PyCFunction)ibm_db_set_pool_options, METH_VARARGS | METH_KEYWORDS, "Sets the limits of the persistent connection pools"},
+	{"get_pool_stats", (PyCFunction)ibm_db_get_pool_stats, METH_NOARGS, "Returns the counters of the persistent connection pools"},
+	{"enable_stats", (PyCFunction)ibm_db_enable_stats, METH_VARARGS, "Turns the performance counters on or off"},
+	{"get_stats", (PyCFunction)ibm_db_get_stats, METH_VARARGS, "Returns the performance counters of a statement, a connection or the module"},
+	{"reset_stats", (PyCFunction)ibm_db_reset_stats, METH_VARARGS, "Sets the performance counters of a statement, a connection or the module to zero"},
+	{"set_trace_hook", (PyCFunction)ibm_db_set_trace_hook, METH_VARARGS, "Registers a function called after each prepare, execute, fetch, commit and rollback"},
+	{"set_slow_query_log", (PyCFunction)ibm_db_set_slow_query_log, METH_VARARGS, "Logs the operations slower than a threshold to a file"},
 	{"conn_error", (PyCFunction)ibm_db_conn_error, METH_VARARGS, "Returns a string containing the SQLSTATE returned by the last connection attempt"},
 	{"conn_errormsg", (PyCFunction)ibm_db_conn_errormsg, METH_VARARGS, "Returns an error message and SQLCODE value representing the reason the last database connection attempt failed"},
 	{"client_info", (PyCFunction)ibm_db_client_info, METH_VARARGS, "Returns a read-only object with information about the DB2 database client"},
@@ -9697,12 +15068,25 @@ static PyMethodDef ibm_db_Methods[] = {
 PyMODINIT_FUNC
 initibm_db(void) {
 	PyObject* m;
+	PyObject *sysmodule = NULL, *maxuni = NULL;
 
 	ibm_db_globals = ALLOC(struct _ibm_db_globals);
 	memset(ibm_db_globals, 0, sizeof(struct _ibm_db_globals));
 	python_ibm_db_init_globals(ibm_db_globals);
+	err_state_key = PyString_InternFromString(ERR_STATE_CAPSULE);
+
+	/* Unicode width of this interpreter and byte order of SQLWCHAR data */
+	sysmodule = PyImport_ImportModule("sys");
+	if (sysmodule != NULL) {
+		maxuni = PyObject_GetAttrString(sysmodule, "maxunicode");
+		if (maxuni != NULL) {
+			is_ucs2_python = (PyInt_AsLong(maxuni) <= 65536);
+			Py_DECREF(maxuni);
+		}
+		Py_DECREF(sysmodule);
+	}
+	sqlwchar_byteorder = is_bigendian() ? 1 : -1;
 
-	persistent_list = PyDict_New();
 
 	conn_handleType.tp_new = PyType_GenericNew;
 	if (PyType_Ready(&conn_handleType) < 0)
@@ -9720,6 +15104,18 @@ initibm_db(void) {
 	if (PyType_Ready(&server_infoType) < 0)
 		return;
 
+	if (PyType_Ready(&column_blockType) < 0)
+		return;
+
+	if (PyType_Ready(&row_objectType) < 0)
+		return;
+
+	if (PyType_Ready(&lob_readerType) < 0)
+		return;
+
+	if (PyType_Ready(&async_handleType) < 0)
+		return;
+
 	m = Py_InitModule3("ibm_db", ibm_db_Methods,
 					  "IBM DataServer Driver for Python.");
 
@@ -9733,11 +15129,27 @@ initibm_db(void) {
 	PyModule_AddIntConstant(m, "CASE_NATURAL", CASE_NATURAL);
 	PyModule_AddIntConstant(m, "CASE_LOWER", CASE_LOWER);
 	PyModule_AddIntConstant(m, "CASE_UPPER", CASE_UPPER);
+	PyModule_AddIntConstant(m, "ATTR_NATIVE_TYPES", ATTR_NATIVE_TYPES);
+	PyModule_AddIntConstant(m, "NATIVE_TYPES_OFF", NATIVE_TYPES_OFF);
+	PyModule_AddIntConstant(m, "NATIVE_TYPES_ON", NATIVE_TYPES_ON);
+	PyModule_AddIntConstant(m, "ATTR_BOUND_NATIVE_TYPES", ATTR_BOUND_NATIVE_TYPES);
+	PyModule_AddIntConstant(m, "ATTR_LOB_READER", ATTR_LOB_READER);
+	PyModule_AddIntConstant(m, "LOB_READER_OFF", LOB_READER_OFF);
+	PyModule_AddIntConstant(m, "LOB_READER_ON", LOB_READER_ON);
+	PyModule_AddIntConstant(m, "ASYNC_AUTO", ASYNC_AUTO);
+	PyModule_AddIntConstant(m, "ASYNC_CLI", ASYNC_CLI);
+	PyModule_AddIntConstant(m, "ASYNC_THREAD", ASYNC_THREAD);
+	PyModule_AddIntConstant(m, "ATTR_PARAM_TYPES", ATTR_PARAM_TYPES);
+	PyModule_AddIntConstant(m, "ATTR_STMT_CACHE_SIZE", ATTR_STMT_CACHE_SIZE);
 	PyModule_AddIntConstant(m, "SQL_ATTR_CURSOR_TYPE", SQL_ATTR_CURSOR_TYPE);
 	PyModule_AddIntConstant(m, "SQL_CURSOR_FORWARD_ONLY", SQL_CURSOR_FORWARD_ONLY);
 	PyModule_AddIntConstant(m, "SQL_CURSOR_KEYSET_DRIVEN", SQL_CURSOR_KEYSET_DRIVEN);
 	PyModule_AddIntConstant(m, "SQL_CURSOR_DYNAMIC", SQL_CURSOR_DYNAMIC);
 	PyModule_AddIntConstant(m, "SQL_CURSOR_STATIC", SQL_CURSOR_STATIC);
+	PyModule_AddIntConstant(m, "SQL_ATTR_ROW_ARRAY_SIZE", SQL_ATTR_ROW_ARRAY_SIZE);
+	PyModule_AddIntConstant(m, "SQL_ATTR_PARAMSET_SIZE", SQL_ATTR_PARAMSET_SIZE);
+	PyModule_AddIntConstant(m, "SQL_ATTR_QUERY_TIMEOUT", SQL_ATTR_QUERY_TIMEOUT);
+	PyModule_AddIntConstant(m, "SQL_NULL_DATA", SQL_NULL_DATA);
 	PyModule_AddIntConstant(m, "SQL_PARAM_INPUT", SQL_PARAM_INPUT);
 	PyModule_AddIntConstant(m, "SQL_PARAM_OUTPUT", SQL_PARAM_OUTPUT);
 	PyModule_AddIntConstant(m, "SQL_PARAM_INPUT_OUTPUT", SQL_PARAM_INPUT_OUTPUT);
@@ -9809,4 +15221,10 @@ initibm_db(void) {
 
 	Py_INCREF(&server_infoType);
 	PyModule_AddObject(m, "IBM_DBServerInfo", (PyObject *)&server_infoType);
+
+	Py_INCREF(&column_blockType);
+	PyModule_AddObject(m, "IBM_DBColumnBlock", (PyObject *)&column_blockType);
+
+	Py_INCREF(&row_objectType);
+	PyModule_AddObject(m, "IBM_DBRow", (PyObject *)&row_objectType);
 }
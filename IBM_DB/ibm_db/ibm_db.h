@@ -37,6 +37,7 @@
 #define PYTHON_UNICODE 7
 #define PYTHON_DECIMAL 8
 #define PYTHON_COMPLEX 9
+#define PYTHON_STREAM 10	/* file-like object or iterator of LOB data */
 
 #define ENABLE_NUMERIC_LITERALS 1 /* Enable CLI numeric literals */
 
@@ -104,6 +105,7 @@
 #define SQL_IS_INTEGER 0
 #define SQL_BEST_ROWID 0
 #define SQLLEN long
+#define SQLULEN unsigned long
 #define SQLFLOAT double
 #endif
 
@@ -111,6 +113,26 @@
 #define FETCH_INDEX	0x01
 #define FETCH_ASSOC	0x02
 #define FETCH_BOTH	0x03
+#define FETCH_OBJECT	0x04
+
+/* Row array (block) fetch.  SQL_ATTR_ROW_ARRAY_SIZE set through set_option or
+ * prepare options is kept on the handle; 0 lets the driver pick a block size
+ * of up to DEFAULT_ROW_ARRAY_SIZE rows (within MAX_ROW_ARRAY_BUFFER_SIZE bytes
+ * of column buffers) for forward-only cursors */
+#define DEFAULT_ROW_ARRAY_SIZE 100
+#define MAX_ROW_ARRAY_BUFFER_SIZE 1048576
+
+/* struct module format of the SQLLEN length/indicator values of a column
+ * block, 8 bytes in 64-bit ODBC builds */
+#define SQLLEN_FORMAT (sizeof(SQLLEN) == sizeof(SQLINTEGER) ? "i" : \
+	(sizeof(SQLLEN) == sizeof(long) ? "l" : "q"))
+
+/* Parameter arrays of execute_many.  SQL_ATTR_PARAMSET_SIZE set through
+ * set_option, prepare or execute_many options is kept on the handle; 0 sends
+ * up to DEFAULT_PARAMSET_SIZE rows per execution (within
+ * MAX_PARAM_ARRAY_BUFFER_SIZE bytes of parameter buffers) */
+#define DEFAULT_PARAMSET_SIZE 1000
+#define MAX_PARAM_ARRAY_BUFFER_SIZE 4194304
 
 /* Change column case */
 #define ATTR_CASE 3271982
@@ -118,6 +140,57 @@
 #define CASE_LOWER 1
 #define CASE_UPPER 2
 
+/* Return DATE, TIME and TIMESTAMP values as datetime.date, datetime.time and
+ * datetime.datetime objects and DECIMAL/NUMERIC values as decimal.Decimal */
+#define ATTR_NATIVE_TYPES 3271983
+#define NATIVE_TYPES_OFF 0
+#define NATIVE_TYPES_ON 1
+
+/* Read-only: the ATTR_NATIVE_TYPES value the columns of the result set are
+ * bound with, which stays in effect until the result set is freed */
+#define ATTR_BOUND_NATIVE_TYPES 3271987
+
+/* SQL types of the parameter markers of a prepared statement, used instead
+ * of describing the parameters on the server */
+#define ATTR_PARAM_TYPES 3271984
+
+/* Number of prepared statements a connection keeps for ibm_db.prepare,
+ * keyed by the statement text and options; 0 disables the cache */
+#define ATTR_STMT_CACHE_SIZE 3271985
+#define DEFAULT_STMT_CACHE_SIZE 0
+
+/* Return BLOB, CLOB and DBCLOB values as IBM_DBLob readers of their locator
+ * instead of reading the whole value */
+#define ATTR_LOB_READER 3271986
+#define LOB_READER_OFF 0
+#define LOB_READER_ON 1
+
+/* Bytes read from a file-like LOB parameter for each SQLPutData call */
+#define LOB_STREAM_CHUNK_SIZE 65536
+
+/* Modes of ibm_db.execute_async: CLI asynchronous execution polled from the
+ * calling thread, or SQLExecute on a worker thread of the module. ASYNC_AUTO
+ * uses the CLI when the driver supports it for the statement or the statement
+ * sends LOB parameters at execute */
+#define ASYNC_AUTO 0
+#define ASYNC_CLI 1
+#define ASYNC_THREAD 2
+/* Milliseconds between the polls of an ASYNC_CLI execute waited for */
+#define ASYNC_POLL_INTERVAL 5
+/* Worker threads shared by the ASYNC_THREAD executes, the others wait for
+ * a free one */
+#define ASYNC_THREAD_WORKERS 8
+
+/* Persistent connection pool of ibm_db.pconnect, see ibm_db.set_pool_options.
+ * By default the number of connections per credentials is not limited, a
+ * checkout waits up to DEFAULT_POOL_TIMEOUT seconds when it is and idle
+ * connections are kept until the process ends */
+#define DEFAULT_POOL_MIN_SIZE 0
+#define DEFAULT_POOL_MAX_SIZE 0
+#define DEFAULT_POOL_TIMEOUT 30
+#define DEFAULT_POOL_IDLE_TIMEOUT 0
+#define POOL_WAIT_INTERVAL 10	/* milliseconds between checks for a checked in connection */
+
 /* maximum sizes */
 #define USERID_LEN 16
 #define ACCTSTR_LEN 200
@@ -142,13 +215,20 @@ enum
 */
 struct _ibm_db_globals {
 	int  bin_mode;
+#ifdef PASE /* i5/OS ease of use turn off commit */
+	long i5_allow_commit;
+#endif /* PASE */
+};
+
+/*
+* Last connection and statement error of a thread, returned by
+* ibm_db.conn_errormsg() and friends when no handle is passed
+*/
+struct _ibm_db_err_state {
 	char __python_conn_err_msg[DB2_MAX_ERR_MSG_LEN];
 	char __python_conn_err_state[SQL_SQLSTATE_SIZE + 1];
 	char __python_stmt_err_msg[DB2_MAX_ERR_MSG_LEN];
 	char __python_stmt_err_state[SQL_SQLSTATE_SIZE + 1];
-#ifdef PASE /* i5/OS ease of use turn off commit */
-	long i5_allow_commit;
-#endif /* PASE */
 };
 
 typedef struct {
@@ -311,12 +391,13 @@ static PyTypeObject server_infoType = {
 
 
 
-/*
-* TODO: make this threadsafe
-*/
-
 #define IBM_DB_G(v) (ibm_db_globals->v)
 
+/* Error state of the calling thread, the GIL must be held */
+#define IBM_DB_ERR(v) (_python_ibm_db_err_state()->v)
+
+static struct _ibm_db_err_state *_python_ibm_db_err_state(void);
+
 static void _python_ibm_db_clear_stmt_err_cache(void);
 static void _python_ibm_db_clear_conn_err_cache(void);
 static int _python_get_variable_type(PyObject *variable_value);
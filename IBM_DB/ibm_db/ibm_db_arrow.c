@@ -0,0 +1,928 @@
+/*
++----------------------------------------------------------------------+
+|  Licensed Materials - Property of IBM                                |
+|                                                                      |
+| (C) Copyright IBM Corporation 2006-2009.                             |
++----------------------------------------------------------------------+
+| Apache Arrow IPC stream writer used by ibm_db.write_arrow()          |
+|                                                                      |
+| The stream is a schema message, one record batch message per batch   |
+| of rows and an end-of-stream marker. The flatbuffer metadata of the  |
+| messages is built by hand, front to back: every table is written     |
+| before the objects it refers to, so all offsets point forward.       |
++----------------------------------------------------------------------+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "ibm_db_arrow.h"
+
+#define ARROW_CONTINUATION	0xFFFFFFFF
+
+/* Members of the Message, MessageHeader and Type definitions in the Arrow
+ * flatbuffer schema (Schema.fbs, Message.fbs) */
+#define ARROW_METADATA_V5			4
+#define ARROW_HEADER_SCHEMA			1
+#define ARROW_HEADER_RECORD_BATCH	3
+#define ARROW_TYPE_INT				2
+#define ARROW_TYPE_FLOATING_POINT	3
+#define ARROW_TYPE_BINARY			4
+#define ARROW_TYPE_UTF8				5
+#define ARROW_TYPE_DECIMAL			7
+#define ARROW_TYPE_DATE				8
+#define ARROW_TYPE_TIME				9
+#define ARROW_TYPE_TIMESTAMP		10
+
+#define FB_OFFSET	0	/* size of an fb_field holding an offset to a child object */
+#define FB_MAX_FIELDS	8
+
+static const int arrow_check_i = 1;
+#define arrow_is_bigendian() ( (*(char*)&arrow_check_i) == 0 )
+
+/* Field of a flatbuffer table, pos is set to its position in the buffer */
+typedef struct _fb_field {
+	int id;
+	int size;
+	arrow_int64 value;
+	size_t pos;
+} fb_field;
+
+static int arrow_buffer_reserve(arrow_buffer *buf, size_t extra)
+{
+	size_t capacity = buf->capacity ? buf->capacity : 256;
+	char *data;
+
+	if ( buf->length + extra <= buf->capacity ) {
+		return 0;
+	}
+	while ( capacity < buf->length + extra ) {
+		capacity *= 2;
+	}
+	data = (char *)realloc(buf->data, capacity);
+	if ( data == NULL ) {
+		return -1;
+	}
+	buf->data = data;
+	buf->capacity = capacity;
+	return 0;
+}
+
+static int arrow_buffer_append(arrow_buffer *buf, const void *data, size_t length)
+{
+	if ( arrow_buffer_reserve(buf, length) < 0 ) {
+		return -1;
+	}
+	if ( data != NULL ) {
+		memcpy(buf->data + buf->length, data, length);
+	} else {
+		memset(buf->data + buf->length, 0, length);
+	}
+	buf->length += length;
+	return 0;
+}
+
+/* Append zero bytes until length % align == phase */
+static int arrow_buffer_pad(arrow_buffer *buf, size_t align, size_t phase)
+{
+	size_t pad = (align + phase - buf->length % align) % align;
+
+	return arrow_buffer_append(buf, NULL, pad);
+}
+
+static void arrow_put_le(char *dest, arrow_uint64 value, int size)
+{
+	int i;
+
+	for ( i = 0; i < size; i++ ) {
+		dest[i] = (char)(value & 0xFF);
+		value >>= 8;
+	}
+}
+
+static int arrow_buffer_append_le(arrow_buffer *buf, arrow_uint64 value, int size)
+{
+	if ( arrow_buffer_reserve(buf, size) < 0 ) {
+		return -1;
+	}
+	arrow_put_le(buf->data + buf->length, value, size);
+	buf->length += size;
+	return 0;
+}
+
+static void arrow_buffer_free(arrow_buffer *buf)
+{
+	if ( buf->data != NULL ) {
+		free(buf->data);
+	}
+	buf->data = NULL;
+	buf->length = buf->capacity = 0;
+}
+
+/*	static int fb_table(arrow_buffer *buf, fb_field *fields, int num_fields, size_t *table_pos)
+	write the vtable and the table of fields, offsets are patched later with
+	fb_patch()
+*/
+static int fb_table(arrow_buffer *buf, fb_field *fields, int num_fields, size_t *table_pos)
+{
+	size_t field_offsets[FB_MAX_FIELDS];
+	size_t offset = 4, vtable_pos;
+	int i, id, size, max_id = -1;
+
+	for ( i = 0; i < num_fields; i++ ) {
+		size = fields[i].size ? fields[i].size : 4;
+		offset = (offset + size - 1) / size * size;
+		field_offsets[i] = offset;
+		offset += size;
+		if ( fields[i].id > max_id ) {
+			max_id = fields[i].id;
+		}
+	}
+
+	if ( arrow_buffer_pad(buf, 2, 0) < 0 ) {
+		return -1;
+	}
+	vtable_pos = buf->length;
+	if ( arrow_buffer_append_le(buf, 4 + 2 * (max_id + 1), 2) < 0 ||
+		arrow_buffer_append_le(buf, offset, 2) < 0 ) {
+		return -1;
+	}
+	for ( id = 0; id <= max_id; id++ ) {
+		size = 0;
+		for ( i = 0; i < num_fields; i++ ) {
+			if ( fields[i].id == id ) {
+				size = (int)field_offsets[i];
+			}
+		}
+		if ( arrow_buffer_append_le(buf, size, 2) < 0 ) {
+			return -1;
+		}
+	}
+
+	/* Tables start 8 byte aligned so that the fields are naturally aligned */
+	if ( arrow_buffer_pad(buf, 8, 0) < 0 ) {
+		return -1;
+	}
+	*table_pos = buf->length;
+	if ( arrow_buffer_append(buf, NULL, offset) < 0 ) {
+		return -1;
+	}
+	arrow_put_le(buf->data + *table_pos, (arrow_uint64)(*table_pos - vtable_pos), 4);
+	for ( i = 0; i < num_fields; i++ ) {
+		fields[i].pos = *table_pos + field_offsets[i];
+		if ( fields[i].size ) {
+			arrow_put_le(buf->data + fields[i].pos, (arrow_uint64)fields[i].value, fields[i].size);
+		}
+	}
+	return 0;
+}
+
+/* Point the offset at field_pos to the object at target_pos */
+static void fb_patch(arrow_buffer *buf, size_t field_pos, size_t target_pos)
+{
+	arrow_put_le(buf->data + field_pos, (arrow_uint64)(target_pos - field_pos), 4);
+}
+
+static int fb_string(arrow_buffer *buf, const char *str, size_t *pos)
+{
+	size_t length = strlen(str);
+
+	if ( arrow_buffer_pad(buf, 4, 0) < 0 ) {
+		return -1;
+	}
+	*pos = buf->length;
+	if ( arrow_buffer_append_le(buf, length, 4) < 0 ||
+		arrow_buffer_append(buf, str, length + 1) < 0 ) {
+		return -1;
+	}
+	return 0;
+}
+
+/* Vector of num offsets, element i is at *pos + 4 + 4 * i */
+static int fb_offset_vector(arrow_buffer *buf, int num, size_t *pos)
+{
+	if ( arrow_buffer_pad(buf, 4, 0) < 0 ) {
+		return -1;
+	}
+	*pos = buf->length;
+	if ( arrow_buffer_append_le(buf, num, 4) < 0 ||
+		arrow_buffer_append(buf, NULL, 4 * num) < 0 ) {
+		return -1;
+	}
+	return 0;
+}
+
+/* Vector of num structs of two longs (FieldNode, Buffer) */
+static int fb_struct_vector(arrow_buffer *buf, const arrow_int64 *values, int num, size_t *pos)
+{
+	int i;
+
+	/* The structs follow the length and must be 8 byte aligned */
+	if ( arrow_buffer_pad(buf, 8, 4) < 0 ) {
+		return -1;
+	}
+	*pos = buf->length;
+	if ( arrow_buffer_append_le(buf, num, 4) < 0 ) {
+		return -1;
+	}
+	for ( i = 0; i < 2 * num; i++ ) {
+		if ( arrow_buffer_append_le(buf, (arrow_uint64)values[i], 8) < 0 ) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*	static int fb_message(arrow_buffer *buf, int header_type, arrow_int64 body_length, size_t *header_pos)
+	start the flatbuffer of a Message, *header_pos is the offset to patch to
+	the header table
+*/
+static int fb_message(arrow_buffer *buf, int header_type, arrow_int64 body_length, size_t *header_pos)
+{
+	fb_field fields[4];
+	size_t table_pos;
+
+	buf->length = 0;
+	/* root offset */
+	if ( arrow_buffer_append(buf, NULL, 4) < 0 ) {
+		return -1;
+	}
+	fields[0].id = 0; fields[0].size = 2; fields[0].value = ARROW_METADATA_V5;
+	fields[1].id = 1; fields[1].size = 1; fields[1].value = header_type;
+	fields[2].id = 2; fields[2].size = FB_OFFSET; fields[2].value = 0;
+	fields[3].id = 3; fields[3].size = 8; fields[3].value = body_length;
+	if ( fb_table(buf, fields, 4, &table_pos) < 0 ) {
+		return -1;
+	}
+	fb_patch(buf, 0, table_pos);
+	*header_pos = fields[2].pos;
+	return 0;
+}
+
+/* Type table of a column, returns the Type union member */
+static int fb_column_type(arrow_buffer *buf, arrow_column *column, size_t *pos)
+{
+	fb_field fields[3];
+	int num_fields = 0, type_type;
+
+	switch ( column->type ) {
+		case ARROW_INT16:
+		case ARROW_INT32:
+		case ARROW_INT64:
+			type_type = ARROW_TYPE_INT;
+			fields[0].id = 0; fields[0].size = 4;
+			fields[0].value = column->type == ARROW_INT16 ? 16 : (column->type == ARROW_INT32 ? 32 : 64);
+			fields[1].id = 1; fields[1].size = 1; fields[1].value = 1;
+			num_fields = 2;
+			break;
+
+		case ARROW_FLOAT32:
+		case ARROW_FLOAT64:
+			type_type = ARROW_TYPE_FLOATING_POINT;
+			/* Precision SINGLE or DOUBLE */
+			fields[0].id = 0; fields[0].size = 2;
+			fields[0].value = column->type == ARROW_FLOAT32 ? 1 : 2;
+			num_fields = 1;
+			break;
+
+		case ARROW_DECIMAL128:
+			type_type = ARROW_TYPE_DECIMAL;
+			fields[0].id = 0; fields[0].size = 4; fields[0].value = column->precision;
+			fields[1].id = 1; fields[1].size = 4; fields[1].value = column->scale;
+			fields[2].id = 2; fields[2].size = 4; fields[2].value = 128;
+			num_fields = 3;
+			break;
+
+		case ARROW_DATE32:
+			/* DateUnit DAY */
+			type_type = ARROW_TYPE_DATE;
+			fields[0].id = 0; fields[0].size = 2; fields[0].value = 0;
+			num_fields = 1;
+			break;
+
+		case ARROW_TIME32:
+			/* TimeUnit SECOND */
+			type_type = ARROW_TYPE_TIME;
+			fields[0].id = 0; fields[0].size = 2; fields[0].value = 0;
+			fields[1].id = 1; fields[1].size = 4; fields[1].value = 32;
+			num_fields = 2;
+			break;
+
+		case ARROW_TIMESTAMP:
+			/* TimeUnit MICROSECOND */
+			type_type = ARROW_TYPE_TIMESTAMP;
+			fields[0].id = 0; fields[0].size = 2; fields[0].value = 2;
+			num_fields = 1;
+			break;
+
+		case ARROW_BINARY:
+			type_type = ARROW_TYPE_BINARY;
+			break;
+
+		case ARROW_UTF8:
+		default:
+			type_type = ARROW_TYPE_UTF8;
+			break;
+	}
+	if ( fb_table(buf, fields, num_fields, pos) < 0 ) {
+		return -1;
+	}
+	return type_type;
+}
+
+/* Write the encapsulated message in stream->message followed by the body */
+static int arrow_write_message(arrow_stream *stream, arrow_buffer **body, int num_body)
+{
+	char prefix[8];
+	static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	size_t padded = (stream->message.length + 7) & ~(size_t)7;
+	int i;
+
+	arrow_put_le(prefix, ARROW_CONTINUATION, 4);
+	arrow_put_le(prefix + 4, padded, 4);
+	if ( stream->write(stream->context, prefix, 8) < 0 ||
+		stream->write(stream->context, stream->message.data, stream->message.length) < 0 ||
+		(padded > stream->message.length &&
+		stream->write(stream->context, zeros, padded - stream->message.length) < 0) ) {
+		return -1;
+	}
+	for ( i = 0; i < num_body; i++ ) {
+		if ( body[i]->length > 0 &&
+			stream->write(stream->context, body[i]->data, body[i]->length) < 0 ) {
+			return -1;
+		}
+		if ( (body[i]->length & 7) &&
+			stream->write(stream->context, zeros, 8 - (body[i]->length & 7)) < 0 ) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static size_t arrow_type_width(arrow_type type)
+{
+	switch ( type ) {
+		case ARROW_INT16:
+			return 2;
+		case ARROW_INT32:
+		case ARROW_FLOAT32:
+		case ARROW_DATE32:
+		case ARROW_TIME32:
+			return 4;
+		case ARROW_INT64:
+		case ARROW_FLOAT64:
+		case ARROW_TIMESTAMP:
+			return 8;
+		case ARROW_DECIMAL128:
+			return 16;
+		default:
+			return 0;
+	}
+}
+
+/* Empty the buffers of a column for the next record batch */
+static int arrow_column_reset(arrow_column *column)
+{
+	int zero = 0;
+
+	column->null_count = 0;
+	column->validity.length = 0;
+	column->values.length = 0;
+	column->offsets.length = 0;
+	if ( arrow_type_width(column->type) == 0 ) {
+		return arrow_buffer_append(&column->offsets, &zero, sizeof(zero));
+	}
+	return 0;
+}
+
+int arrow_stream_init(arrow_stream *stream, int num_columns, arrow_write_func write, void *context)
+{
+	memset(stream, 0, sizeof(arrow_stream));
+	stream->columns = (arrow_column *)calloc(num_columns > 0 ? num_columns : 1, sizeof(arrow_column));
+	if ( stream->columns == NULL ) {
+		return -1;
+	}
+	stream->num_columns = num_columns;
+	stream->write = write;
+	stream->context = context;
+	return 0;
+}
+
+int arrow_stream_set_column(arrow_stream *stream, int col, const char *name, arrow_type type, int precision, int scale)
+{
+	arrow_column *column = &stream->columns[col];
+
+	column->name = (char *)malloc(strlen(name) + 1);
+	if ( column->name == NULL ) {
+		return -1;
+	}
+	strcpy(column->name, name);
+	column->type = type;
+	column->precision = precision;
+	column->scale = scale;
+	return arrow_column_reset(column);
+}
+
+int arrow_stream_write_schema(arrow_stream *stream)
+{
+	arrow_buffer *buf = &stream->message;
+	fb_field schema[2], field[5];
+	size_t header_pos, schema_pos, vector_pos, field_pos, pos;
+	int i, type_type;
+
+	if ( fb_message(buf, ARROW_HEADER_SCHEMA, 0, &header_pos) < 0 ) {
+		return -1;
+	}
+	/* Endianness of the body buffers */
+	schema[0].id = 0; schema[0].size = 2; schema[0].value = arrow_is_bigendian() ? 1 : 0;
+	schema[1].id = 1; schema[1].size = FB_OFFSET; schema[1].value = 0;
+	if ( fb_table(buf, schema, 2, &schema_pos) < 0 ||
+		fb_offset_vector(buf, stream->num_columns, &vector_pos) < 0 ) {
+		return -1;
+	}
+	fb_patch(buf, header_pos, schema_pos);
+	fb_patch(buf, schema[1].pos, vector_pos);
+
+	for ( i = 0; i < stream->num_columns; i++ ) {
+		field[0].id = 0; field[0].size = FB_OFFSET; field[0].value = 0;
+		field[1].id = 1; field[1].size = 1; field[1].value = 1;
+		field[2].id = 2; field[2].size = 1; field[2].value = 0;
+		field[3].id = 3; field[3].size = FB_OFFSET; field[3].value = 0;
+		field[4].id = 5; field[4].size = FB_OFFSET; field[4].value = 0;
+		if ( fb_table(buf, field, 5, &field_pos) < 0 ) {
+			return -1;
+		}
+		fb_patch(buf, vector_pos + 4 + 4 * i, field_pos);
+
+		if ( fb_string(buf, stream->columns[i].name, &pos) < 0 ) {
+			return -1;
+		}
+		fb_patch(buf, field[0].pos, pos);
+
+		type_type = fb_column_type(buf, &stream->columns[i], &pos);
+		if ( type_type < 0 ) {
+			return -1;
+		}
+		buf->data[field[2].pos] = (char)type_type;
+		fb_patch(buf, field[3].pos, pos);
+
+		/* Readers require the children vector, even when empty */
+		if ( fb_offset_vector(buf, 0, &pos) < 0 ) {
+			return -1;
+		}
+		fb_patch(buf, field[4].pos, pos);
+	}
+	return arrow_write_message(stream, NULL, 0);
+}
+
+int arrow_stream_write_batch(arrow_stream *stream)
+{
+	arrow_buffer *buf = &stream->message;
+	arrow_buffer **body = NULL;
+	arrow_int64 *nodes = NULL, *buffers = NULL, body_length = 0;
+	fb_field batch[3];
+	size_t header_pos, batch_pos, pos;
+	int i, num_body = 0, rc = -1;
+	arrow_column *column;
+
+	if ( stream->num_rows == 0 ) {
+		return 0;
+	}
+	body = (arrow_buffer **)malloc(3 * stream->num_columns * sizeof(arrow_buffer *) + 1);
+	nodes = (arrow_int64 *)malloc(2 * stream->num_columns * sizeof(arrow_int64) + 1);
+	buffers = (arrow_int64 *)malloc(6 * stream->num_columns * sizeof(arrow_int64) + 1);
+	if ( body == NULL || nodes == NULL || buffers == NULL ) {
+		goto done;
+	}
+	for ( i = 0; i < stream->num_columns; i++ ) {
+		column = &stream->columns[i];
+		nodes[2 * i] = stream->num_rows;
+		nodes[2 * i + 1] = column->null_count;
+		body[num_body++] = &column->validity;
+		if ( arrow_type_width(column->type) == 0 ) {
+			body[num_body++] = &column->offsets;
+		}
+		body[num_body++] = &column->values;
+	}
+	for ( i = 0; i < num_body; i++ ) {
+		buffers[2 * i] = body_length;
+		buffers[2 * i + 1] = body[i]->length;
+		body_length += (body[i]->length + 7) & ~(size_t)7;
+	}
+
+	if ( fb_message(buf, ARROW_HEADER_RECORD_BATCH, body_length, &header_pos) < 0 ) {
+		goto done;
+	}
+	batch[0].id = 0; batch[0].size = 8; batch[0].value = stream->num_rows;
+	batch[1].id = 1; batch[1].size = FB_OFFSET; batch[1].value = 0;
+	batch[2].id = 2; batch[2].size = FB_OFFSET; batch[2].value = 0;
+	if ( fb_table(buf, batch, 3, &batch_pos) < 0 ) {
+		goto done;
+	}
+	fb_patch(buf, header_pos, batch_pos);
+	if ( fb_struct_vector(buf, nodes, stream->num_columns, &pos) < 0 ) {
+		goto done;
+	}
+	fb_patch(buf, batch[1].pos, pos);
+	if ( fb_struct_vector(buf, buffers, num_body, &pos) < 0 ) {
+		goto done;
+	}
+	fb_patch(buf, batch[2].pos, pos);
+
+	if ( arrow_write_message(stream, body, num_body) < 0 ) {
+		goto done;
+	}
+	for ( i = 0; i < stream->num_columns; i++ ) {
+		if ( arrow_column_reset(&stream->columns[i]) < 0 ) {
+			goto done;
+		}
+	}
+	stream->num_rows = 0;
+	rc = 0;
+
+done:
+	if ( body != NULL ) {
+		free(body);
+	}
+	if ( nodes != NULL ) {
+		free(nodes);
+	}
+	if ( buffers != NULL ) {
+		free(buffers);
+	}
+	return rc;
+}
+
+int arrow_stream_finish(arrow_stream *stream)
+{
+	char eos[8];
+
+	if ( arrow_stream_write_batch(stream) < 0 ) {
+		return -1;
+	}
+	arrow_put_le(eos, ARROW_CONTINUATION, 4);
+	arrow_put_le(eos + 4, 0, 4);
+	return stream->write(stream->context, eos, 8);
+}
+
+void arrow_stream_free(arrow_stream *stream)
+{
+	int i;
+
+	if ( stream->columns != NULL ) {
+		for ( i = 0; i < stream->num_columns; i++ ) {
+			if ( stream->columns[i].name != NULL ) {
+				free(stream->columns[i].name);
+			}
+			arrow_buffer_free(&stream->columns[i].validity);
+			arrow_buffer_free(&stream->columns[i].offsets);
+			arrow_buffer_free(&stream->columns[i].values);
+		}
+		free(stream->columns);
+		stream->columns = NULL;
+	}
+	arrow_buffer_free(&stream->message);
+}
+
+/* Record the validity of the value of column in the current row */
+static int arrow_append_validity(arrow_stream *stream, arrow_column *column, int valid)
+{
+	if ( stream->num_rows % 8 == 0 && arrow_buffer_append(&column->validity, NULL, 1) < 0 ) {
+		return -1;
+	}
+	if ( valid ) {
+		column->validity.data[stream->num_rows / 8] |= (char)(1 << (stream->num_rows % 8));
+	} else {
+		column->null_count++;
+	}
+	return 0;
+}
+
+static int arrow_append_offset(arrow_column *column)
+{
+	int offset = (int)column->values.length;
+
+	return arrow_buffer_append(&column->offsets, &offset, sizeof(offset));
+}
+
+int arrow_append_null(arrow_stream *stream, int col)
+{
+	arrow_column *column = &stream->columns[col];
+	size_t width = arrow_type_width(column->type);
+
+	if ( arrow_append_validity(stream, column, 0) < 0 ) {
+		return -1;
+	}
+	if ( width == 0 ) {
+		return arrow_append_offset(column);
+	}
+	return arrow_buffer_append(&column->values, NULL, width);
+}
+
+int arrow_append_value(arrow_stream *stream, int col, const void *value, size_t size)
+{
+	arrow_column *column = &stream->columns[col];
+
+	if ( size != arrow_type_width(column->type) ) {
+		return -1;
+	}
+	if ( arrow_append_validity(stream, column, 1) < 0 ) {
+		return -1;
+	}
+	return arrow_buffer_append(&column->values, value, size);
+}
+
+int arrow_append_bytes(arrow_stream *stream, int col, const char *data, size_t length)
+{
+	arrow_column *column = &stream->columns[col];
+
+	if ( arrow_type_width(column->type) != 0 ) {
+		return -1;
+	}
+	if ( arrow_append_validity(stream, column, 1) < 0 ||
+		arrow_buffer_append(&column->values, data, length) < 0 ) {
+		return -1;
+	}
+	return arrow_append_offset(column);
+}
+
+static int arrow_hex_digit(char c)
+{
+	if ( c >= '0' && c <= '9' ) {
+		return c - '0';
+	}
+	if ( c >= 'A' && c <= 'F' ) {
+		return c - 'A' + 10;
+	}
+	if ( c >= 'a' && c <= 'f' ) {
+		return c - 'a' + 10;
+	}
+	return 0;
+}
+
+/* Append the bytes of a hexadecimal string, two digits per byte */
+int arrow_append_hex(arrow_stream *stream, int col, const char *hex, size_t length)
+{
+	arrow_column *column = &stream->columns[col];
+	arrow_buffer *values = &column->values;
+	size_t i;
+
+	if ( arrow_type_width(column->type) != 0 ) {
+		return -1;
+	}
+	if ( arrow_append_validity(stream, column, 1) < 0 ||
+		arrow_buffer_reserve(values, length / 2) < 0 ) {
+		return -1;
+	}
+	for ( i = 0; i + 1 < length; i += 2 ) {
+		values->data[values->length++] = (char)(arrow_hex_digit(hex[i]) << 4 | 
+			arrow_hex_digit(hex[i + 1]));
+	}
+	return arrow_append_offset(column);
+}
+
+int arrow_append_utf16(arrow_stream *stream, int col, const unsigned short *data, size_t units)
+{
+	arrow_column *column = &stream->columns[col];
+	arrow_buffer *values = &column->values;
+	unsigned long code;
+	unsigned char *out;
+	size_t i;
+
+	if ( arrow_type_width(column->type) != 0 ) {
+		return -1;
+	}
+	if ( arrow_append_validity(stream, column, 1) < 0 ||
+		arrow_buffer_reserve(values, 3 * units) < 0 ) {
+		return -1;
+	}
+	out = (unsigned char *)values->data + values->length;
+	for ( i = 0; i < units; i++ ) {
+		code = data[i];
+		if ( code >= 0xD800 && code <= 0xDBFF && i + 1 < units &&
+			data[i + 1] >= 0xDC00 && data[i + 1] <= 0xDFFF ) {
+			code = 0x10000 + ((code - 0xD800) << 10) + (data[i + 1] - 0xDC00);
+			i++;
+		} else if ( code >= 0xD800 && code <= 0xDFFF ) {
+			/* Unpaired surrogate */
+			code = 0xFFFD;
+		}
+		if ( code < 0x80 ) {
+			*out++ = (unsigned char)code;
+		} else if ( code < 0x800 ) {
+			*out++ = (unsigned char)(0xC0 | (code >> 6));
+			*out++ = (unsigned char)(0x80 | (code & 0x3F));
+		} else if ( code < 0x10000 ) {
+			*out++ = (unsigned char)(0xE0 | (code >> 12));
+			*out++ = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+			*out++ = (unsigned char)(0x80 | (code & 0x3F));
+		} else {
+			/* The surrogate pair took two units, room for four bytes */
+			*out++ = (unsigned char)(0xF0 | (code >> 18));
+			*out++ = (unsigned char)(0x80 | ((code >> 12) & 0x3F));
+			*out++ = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+			*out++ = (unsigned char)(0x80 | (code & 0x3F));
+		}
+	}
+	values->length = (char *)out - values->data;
+	return arrow_append_offset(column);
+}
+
+/* Days from 1970-01-01 to the given date of the proleptic Gregorian calendar */
+static long arrow_days_from_civil(long year, long month, long day)
+{
+	long era, yoe, doy, doe;
+
+	year -= month <= 2;
+	era = (year >= 0 ? year : year - 399) / 400;
+	yoe = year - era * 400;
+	doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+/*	static int arrow_parse_numbers(const char *str, long *numbers, int max, long *micro)
+	split a date, time or timestamp string into its numbers, the fraction of
+	seconds following the sixth number is returned in microseconds
+*/
+static int arrow_parse_numbers(const char *str, long *numbers, int max, long *micro)
+{
+	int count = 0, digits;
+
+	*micro = 0;
+	while ( *str ) {
+		if ( *str < '0' || *str > '9' ) {
+			str++;
+			continue;
+		}
+		if ( count == 6 ) {
+			for ( digits = 0; digits < 6; digits++ ) {
+				*micro *= 10;
+				if ( *str >= '0' && *str <= '9' ) {
+					*micro += *str++ - '0';
+				}
+			}
+			break;
+		}
+		if ( count == max ) {
+			break;
+		}
+		numbers[count] = 0;
+		while ( *str >= '0' && *str <= '9' ) {
+			numbers[count] = numbers[count] * 10 + (*str++ - '0');
+		}
+		count++;
+	}
+	return count;
+}
+
+/* Decimal string to the 128 bit two's complement integer value * 10^scale */
+static int arrow_append_decimal(arrow_stream *stream, int col, const char *str)
+{
+	arrow_column *column = &stream->columns[col];
+	unsigned long limbs[4] = {0, 0, 0, 0};
+	unsigned char bytes[16];
+	arrow_uint64 carry;
+	int negative = 0, in_fraction = 0, fraction = 0, digit, i;
+
+	while ( *str == ' ' ) {
+		str++;
+	}
+	if ( *str == '-' || *str == '+' ) {
+		negative = (*str++ == '-');
+	}
+	for ( ;; ) {
+		if ( *str == '.' || *str == ',' ) {
+			in_fraction = 1;
+			str++;
+			continue;
+		}
+		if ( *str >= '0' && *str <= '9' ) {
+			if ( in_fraction && fraction >= column->scale ) {
+				str++;
+				continue;
+			}
+			digit = *str++ - '0';
+			fraction += in_fraction;
+		} else if ( fraction < column->scale ) {
+			/* Scale the value up to the scale of the column */
+			digit = 0;
+			fraction++;
+		} else {
+			break;
+		}
+		carry = digit;
+		for ( i = 0; i < 4; i++ ) {
+			carry += (arrow_uint64)limbs[i] * 10;
+			limbs[i] = (unsigned long)(carry & 0xFFFFFFFF);
+			carry >>= 32;
+		}
+	}
+	if ( negative ) {
+		carry = 1;
+		for ( i = 0; i < 4; i++ ) {
+			carry += (~limbs[i]) & 0xFFFFFFFF;
+			limbs[i] = (unsigned long)(carry & 0xFFFFFFFF);
+			carry >>= 32;
+		}
+	}
+	for ( i = 0; i < 16; i++ ) {
+		digit = (int)((limbs[i / 4] >> (8 * (i % 4))) & 0xFF);
+		bytes[arrow_is_bigendian() ? 15 - i : i] = (unsigned char)digit;
+	}
+	return arrow_append_value(stream, col, bytes, 16);
+}
+
+int arrow_append_datetime(arrow_stream *stream, int col, long year, long month, long day,
+	long hour, long minute, long second, long micro)
+{
+	arrow_int64 int64_value;
+	int int32_value;
+
+	switch ( stream->columns[col].type ) {
+		case ARROW_DATE32:
+			int32_value = (int)arrow_days_from_civil(year, month, day);
+			return arrow_append_value(stream, col, &int32_value, sizeof(int32_value));
+
+		case ARROW_TIME32:
+			int32_value = (int)(hour * 3600 + minute * 60 + second);
+			return arrow_append_value(stream, col, &int32_value, sizeof(int32_value));
+
+		default:
+			int64_value = (arrow_int64)arrow_days_from_civil(year, month, day) * 86400 +
+				hour * 3600 + minute * 60 + second;
+			int64_value = int64_value * 1000000 + micro;
+			return arrow_append_value(stream, col, &int64_value, sizeof(int64_value));
+	}
+}
+
+int arrow_append_string(arrow_stream *stream, int col, const char *str)
+{
+	arrow_column *column = &stream->columns[col];
+	long numbers[6] = {1970, 1, 1, 0, 0, 0};
+	long micro;
+	arrow_int64 int64_value;
+	int int32_value;
+	short int16_value;
+	double double_value;
+	float float_value;
+	int negative;
+
+	switch ( column->type ) {
+		case ARROW_INT16:
+			int16_value = (short)strtol(str, NULL, 10);
+			return arrow_append_value(stream, col, &int16_value, sizeof(int16_value));
+
+		case ARROW_INT32:
+			int32_value = (int)strtol(str, NULL, 10);
+			return arrow_append_value(stream, col, &int32_value, sizeof(int32_value));
+
+		case ARROW_INT64:
+			while ( *str == ' ' ) {
+				str++;
+			}
+			negative = (*str == '-');
+			if ( *str == '-' || *str == '+' ) {
+				str++;
+			}
+			int64_value = 0;
+			while ( *str >= '0' && *str <= '9' ) {
+				int64_value = int64_value * 10 + (*str++ - '0');
+			}
+			if ( negative ) {
+				int64_value = -int64_value;
+			}
+			return arrow_append_value(stream, col, &int64_value, sizeof(int64_value));
+
+		case ARROW_FLOAT32:
+			float_value = (float)strtod(str, NULL);
+			return arrow_append_value(stream, col, &float_value, sizeof(float_value));
+
+		case ARROW_FLOAT64:
+			double_value = strtod(str, NULL);
+			return arrow_append_value(stream, col, &double_value, sizeof(double_value));
+
+		case ARROW_DECIMAL128:
+			return arrow_append_decimal(stream, col, str);
+
+		case ARROW_DATE32:
+			arrow_parse_numbers(str, numbers, 3, &micro);
+			return arrow_append_datetime(stream, col, numbers[0], numbers[1], numbers[2], 0, 0, 0, 0);
+
+		case ARROW_TIME32:
+			arrow_parse_numbers(str, numbers + 3, 3, &micro);
+			return arrow_append_datetime(stream, col, 1970, 1, 1, numbers[3], numbers[4], numbers[5], 0);
+
+		case ARROW_TIMESTAMP:
+			arrow_parse_numbers(str, numbers, 6, &micro);
+			return arrow_append_datetime(stream, col, numbers[0], numbers[1], numbers[2],
+				numbers[3], numbers[4], numbers[5], micro);
+
+		default:
+			return arrow_append_bytes(stream, col, str, strlen(str));
+	}
+}
+
+void arrow_stream_end_row(arrow_stream *stream)
+{
+	stream->num_rows++;
+}
@@ -0,0 +1,88 @@
+/*
++----------------------------------------------------------------------+
+|  Licensed Materials - Property of IBM                                |
+|                                                                      |
+| (C) Copyright IBM Corporation 2006-2009.                             |
++----------------------------------------------------------------------+
+| Apache Arrow IPC stream writer used by ibm_db.write_arrow()          |
++----------------------------------------------------------------------+
+*/
+
+#ifndef IBM_DB_ARROW_H
+#define IBM_DB_ARROW_H
+
+#include <stddef.h>
+
+#ifdef _WIN32
+typedef __int64 arrow_int64;
+typedef unsigned __int64 arrow_uint64;
+#else
+typedef long long arrow_int64;
+typedef unsigned long long arrow_uint64;
+#endif
+
+/* Arrow column types produced by the writer */
+typedef enum {
+	ARROW_INT16,
+	ARROW_INT32,
+	ARROW_INT64,
+	ARROW_FLOAT32,
+	ARROW_FLOAT64,
+	ARROW_DECIMAL128,	/* precision and scale of the column */
+	ARROW_DATE32,		/* days since the epoch */
+	ARROW_TIME32,		/* seconds since midnight */
+	ARROW_TIMESTAMP,	/* microseconds since the epoch, no time zone */
+	ARROW_UTF8,
+	ARROW_BINARY
+} arrow_type;
+
+typedef struct _arrow_buffer {
+	char *data;
+	size_t length;
+	size_t capacity;
+} arrow_buffer;
+
+typedef struct _arrow_column {
+	char *name;
+	arrow_type type;
+	int precision;
+	int scale;
+	long null_count;
+	arrow_buffer validity;	/* one bit per row, set when the value is valid */
+	arrow_buffer offsets;	/* int32 offsets of ARROW_UTF8 and ARROW_BINARY values */
+	arrow_buffer values;
+} arrow_column;
+
+/* Sink of the stream, returns 0 on success and -1 on failure */
+typedef int (*arrow_write_func)(void *context, const char *data, size_t length);
+
+typedef struct _arrow_stream {
+	int num_columns;
+	arrow_column *columns;
+	long num_rows;			/* rows in the record batch being built */
+	arrow_write_func write;
+	void *context;
+	arrow_buffer message;	/* flatbuffer metadata of the message being written */
+} arrow_stream;
+
+/* All functions return 0 on success and -1 on allocation or write failure */
+int arrow_stream_init(arrow_stream *stream, int num_columns, arrow_write_func write, void *context);
+int arrow_stream_set_column(arrow_stream *stream, int col, const char *name, arrow_type type, int precision, int scale);
+int arrow_stream_write_schema(arrow_stream *stream);
+int arrow_stream_write_batch(arrow_stream *stream);
+int arrow_stream_finish(arrow_stream *stream);
+void arrow_stream_free(arrow_stream *stream);
+
+/* Append the value of column col of the current row, then end the row with
+ * arrow_stream_end_row() */
+int arrow_append_null(arrow_stream *stream, int col);
+int arrow_append_value(arrow_stream *stream, int col, const void *value, size_t size);
+int arrow_append_bytes(arrow_stream *stream, int col, const char *data, size_t length);
+int arrow_append_hex(arrow_stream *stream, int col, const char *hex, size_t length);
+int arrow_append_utf16(arrow_stream *stream, int col, const unsigned short *data, size_t units);
+int arrow_append_string(arrow_stream *stream, int col, const char *str);
+int arrow_append_datetime(arrow_stream *stream, int col, long year, long month, long day,
+	long hour, long minute, long second, long micro);
+void arrow_stream_end_row(arrow_stream *stream);
+
+#endif /* IBM_DB_ARROW_H */
@@ -20,7 +20,7 @@
 This module implements the Python DB API Specification v2.0 for DB2 database.
 """
 
-import types, string, time, datetime, decimal, exceptions
+import types, string, time, datetime, decimal, exceptions, select
 
 import ibm_db
 __version__ = ibm_db.__version__
@@ -28,12 +28,18 @@ __version__ = ibm_db.__version__
 # Constants for specifying database connection options.
 SQL_ATTR_AUTOCOMMIT = ibm_db.SQL_ATTR_AUTOCOMMIT
 SQL_ATTR_CURRENT_SCHEMA = ibm_db.SQL_ATTR_CURRENT_SCHEMA
+SQL_ATTR_QUERY_TIMEOUT = ibm_db.SQL_ATTR_QUERY_TIMEOUT
 SQL_AUTOCOMMIT_OFF = ibm_db.SQL_AUTOCOMMIT_OFF
 SQL_AUTOCOMMIT_ON = ibm_db.SQL_AUTOCOMMIT_ON
 ATTR_CASE = ibm_db.ATTR_CASE
 CASE_NATURAL = ibm_db.CASE_NATURAL
 CASE_LOWER = ibm_db.CASE_LOWER
 CASE_UPPER = ibm_db.CASE_UPPER
+ATTR_NATIVE_TYPES = ibm_db.ATTR_NATIVE_TYPES
+NATIVE_TYPES_OFF = ibm_db.NATIVE_TYPES_OFF
+NATIVE_TYPES_ON = ibm_db.NATIVE_TYPES_ON
+ATTR_BOUND_NATIVE_TYPES = ibm_db.ATTR_BOUND_NATIVE_TYPES
+ATTR_STMT_CACHE_SIZE = ibm_db.ATTR_STMT_CACHE_SIZE
 SQL_FALSE = ibm_db.SQL_FALSE
 SQL_TRUE = ibm_db.SQL_TRUE
 SQL_TABLE_STAT = ibm_db.SQL_TABLE_STAT
@@ -41,6 +47,12 @@ SQL_INDEX_CLUSTERED = ibm_db.SQL_INDEX_CLUSTERED
 SQL_INDEX_OTHER = ibm_db.SQL_INDEX_OTHER
 SQL_DBMS_VER = ibm_db.SQL_DBMS_VER
 SQL_DBMS_NAME = ibm_db.SQL_DBMS_NAME
+ASYNC_AUTO = ibm_db.ASYNC_AUTO
+ASYNC_CLI = ibm_db.ASYNC_CLI
+ASYNC_THREAD = ibm_db.ASYNC_THREAD
+
+# Prepared statements kept by each connection for its cursors
+DEFAULT_STMT_CACHE_SIZE = 100
 
 # Module globals
 apilevel = '2.0'
@@ -533,6 +545,13 @@ def connect(dsn, user='', password='', host='', database='', conn_options=None):
             conn_options[SQL_ATTR_AUTOCOMMIT] = SQL_AUTOCOMMIT_OFF
     else:
         conn_options = {SQL_ATTR_AUTOCOMMIT : SQL_AUTOCOMMIT_OFF}
+    # Date/time and decimal values are returned as Python objects
+    # by the driver.
+    if not ATTR_NATIVE_TYPES in conn_options:
+        conn_options[ATTR_NATIVE_TYPES] = NATIVE_TYPES_ON
+    # Statements executed again by the cursors are not prepared again.
+    if not ATTR_STMT_CACHE_SIZE in conn_options:
+        conn_options[ATTR_STMT_CACHE_SIZE] = DEFAULT_STMT_CACHE_SIZE
 
     # If the dsn does not contain port and protocal adding database
     # and hostname is no good.  Add these when required, that is,
@@ -583,6 +602,13 @@ def pconnect(dsn, user='', password='', host='', database='', conn_options=None)
             conn_options[SQL_ATTR_AUTOCOMMIT] = SQL_AUTOCOMMIT_OFF
     else:
         conn_options = {SQL_ATTR_AUTOCOMMIT : SQL_AUTOCOMMIT_OFF}
+    # Date/time and decimal values are returned as Python objects
+    # by the driver.
+    if not ATTR_NATIVE_TYPES in conn_options:
+        conn_options[ATTR_NATIVE_TYPES] = NATIVE_TYPES_ON
+    # Statements executed again by the cursors are not prepared again.
+    if not ATTR_STMT_CACHE_SIZE in conn_options:
+        conn_options[ATTR_STMT_CACHE_SIZE] = DEFAULT_STMT_CACHE_SIZE
 
     # If the dsn does not contain port and protocal adding database
     # and hostname is no good.  Add these when required, that is,
@@ -1067,6 +1093,10 @@ class Cursor(object):
         self._is_scrollable_cursor = False
         self.__connection = conn_object
         self.messages = []
+        self._return_types = None
+        self._return_types_stmt = None
+        self._return_types_native = None
+        self._pending = None
     
     # This method closes the statemente associated with the cursor object.
     # It takes no argument.
@@ -1081,6 +1111,10 @@ class Cursor(object):
             self.messages.append(ProgrammingError("Cursor cannot be closed; connection is no longer active."))
             raise self.messages[len(self.messages) - 1]
         try:
+            # The statement goes back to the statement cache of the
+            # connection, its cursor is closed here.
+            if self.stmt_handler is not None:
+                ibm_db.free_result(self.stmt_handler)
             return_value = ibm_db.free_stmt(self.stmt_handler)
         except Exception, inst:
             self.messages.append(_get_exception(inst))
@@ -1090,6 +1124,24 @@ class Cursor(object):
         self._all_stmt_handlers = None
         return return_value
 
+    def cancel(self):
+        """This method cancels the SQL statement the cursor is executing.
+        It can be called from another thread while execute() or a fetch
+        method of the cursor is blocked, the blocked call then raises the
+        cancellation error.  It takes no arguments.
+
+        """
+        stmt_handler = self.stmt_handler
+        if stmt_handler is None:
+            self.messages.append(ProgrammingError("No statement to cancel."))
+            raise self.messages[len(self.messages) - 1]
+        try:
+            return_value = ibm_db.cancel(stmt_handler)
+        except Exception, inst:
+            self.messages.append(_get_exception(inst))
+            raise self.messages[len(self.messages) - 1]
+        return return_value
+
     # helper for calling procedure
     def _callproc_helper(self, procname, parameters=None):
         if parameters is not None:
@@ -1145,10 +1197,16 @@ class Cursor(object):
 
     # Helper for preparing an SQL statement. 
     def _prepare_helper(self, operation, parameters=None):
-        try:
-            ibm_db.free_stmt(self.stmt_handler)
-        except:
-            pass
+        # The connection hands out a cached statement only when no one
+        # holds it, so close the cursor of the previous statement and
+        # drop the references to it.
+        if self.stmt_handler is not None:
+            try:
+                ibm_db.free_result(self.stmt_handler)
+            except:
+                pass
+        self.stmt_handler = None
+        self._return_types_stmt = None
 
         try:
             self.stmt_handler = ibm_db.prepare(self.conn_handler, operation)
@@ -1288,6 +1346,79 @@ class Cursor(object):
         self._execute_helper(parameters)
         return self._set_rowcount()
 
+    def execute_async(self, operation, parameters=None, mode=ASYNC_AUTO):
+        """
+        This method prepares an SQL statement and starts its execution 
+        without waiting for it, see ibm_db.execute_async.  poll() tells 
+        whether the execution has completed, fileno() returns a file 
+        descriptor for select() when the mode is ASYNC_THREAD, and wait() 
+        completes it like execute() does.  Rows are fetched after wait().
+        """
+        self.messages = []
+        if not isinstance(operation, basestring):
+            self.messages.append(InterfaceError("execute_async expects the first argument [%s] to be of type String or Unicode." % operation ))
+            raise self.messages[len(self.messages) - 1]
+        if parameters is not None:
+            if not isinstance(parameters, (types.ListType, types.TupleType)):
+                self.messages.append(InterfaceError("execute_async parameters argument should be sequence."))
+                raise self.messages[len(self.messages) - 1]
+            buff = []
+            CONVERT_STR = (datetime.datetime, datetime.date, datetime.time, buffer)
+            # Convert date/time and binary objects to string for 
+            # inserting into the database. 
+            for param in parameters:
+                if isinstance(param, CONVERT_STR):
+                    param = str(param)
+                buff.append(param)
+            parameters = tuple(buff)
+        self.__description = None
+        self._all_stmt_handlers = []
+        self._pending = None
+        self._prepare_helper(operation)
+        self._set_cursor_helper()
+        try:
+            self._pending = ibm_db.execute_async(self.stmt_handler, parameters, mode)
+        except Exception, inst:
+            self.messages.append(_get_exception(inst))
+            raise self.messages[len(self.messages) - 1]
+
+    def poll(self):
+        """Returns True once the execution started by execute_async has
+        completed, without waiting for it.
+        """
+        if self._pending is None:
+            return True
+        return self._pending.poll()
+
+    def fileno(self):
+        """Returns a file descriptor that becomes readable when the 
+        ASYNC_THREAD execution started by execute_async completes.
+        """
+        if self._pending is None:
+            self.messages.append(ProgrammingError("No asynchronous execute is pending."))
+            raise self.messages[len(self.messages) - 1]
+        try:
+            return self._pending.fileno()
+        except Exception, inst:
+            self.messages.append(_get_exception(inst))
+            raise self.messages[len(self.messages) - 1]
+
+    def wait(self):
+        """Waits for the execution started by execute_async and completes
+        it, raising the exception execute() would have raised.
+        """
+        if self._pending is None:
+            self.messages.append(ProgrammingError("No asynchronous execute is pending."))
+            raise self.messages[len(self.messages) - 1]
+        pending = self._pending
+        self._pending = None
+        try:
+            pending.result()
+        except Exception, inst:
+            self.messages.append(_get_exception(inst))
+            raise self.messages[len(self.messages) - 1]
+        return self._set_rowcount()
+
     def executemany(self, operation, seq_parameters):
         """
         This method can be used to prepare, and then execute an SQL 
@@ -1355,28 +1486,25 @@ class Cursor(object):
         if self.stmt_handler is None:
             self.messages.append(ProgrammingError("Please execute an SQL statement in order to get a row from result set."))
             raise self.messages[len(self.messages) - 1]
+        if self._pending is not None:
+            self.messages.append(ProgrammingError("Call wait() to complete the asynchronous execute before fetching rows."))
+            raise self.messages[len(self.messages) - 1]
         if self._result_set_produced == False:
             self.messages.append(ProgrammingError("The last call to execute did not produce any result set."))
             raise  self.messages[len(self.messages) - 1]
-        row_list = []
-        rows_fetched = 0
-        while (fetch_size == -1) or \
-              (fetch_size != -1 and rows_fetched < fetch_size):
-            try:
-                row = ibm_db.fetch_tuple(self.stmt_handler)
-            except Exception, inst:
-                self.messages.append(_get_exception(inst))
-                if len(row_list) == 0:
-                    raise self.messages[len(self.messages) - 1]
-                else:
-                    return row_list
-            
-            if row != False:
-                row_list.append(self._fix_return_data_type(row))
+        try:
+            if fetch_size == -1:
+                row_list = ibm_db.fetch_all(self.stmt_handler)
             else:
-                return row_list
-            rows_fetched = rows_fetched + 1
-        return row_list
+                row_list = ibm_db.fetch_many(self.stmt_handler, fetch_size)
+        except Exception, inst:
+            self.messages.append(_get_exception(inst))
+            raise self.messages[len(self.messages) - 1]
+
+        return_types = self._get_return_types()
+        if not return_types:
+            return row_list
+        return [self._fix_return_data_type(row, return_types) for row in row_list]
 
     def fetchone(self):
         """This method fetches one row from the database, after 
@@ -1452,16 +1580,35 @@ class Cursor(object):
     def _str_to_datetime(self, date_string, format):
         return datetime.datetime(*(time.strptime(date_string, format)[0:6]))
 
+    # This method returns the (index, type) pairs of the columns of the
+    # current result set whose values _fix_return_data_type converts.
+    # Date/time and decimal columns only need it when the driver does
+    # not return them as Python objects, see ATTR_NATIVE_TYPES. The value
+    # the columns were bound with decides that, not the current option.
+    def _get_return_types(self):
+        native_types = ibm_db.get_option(self.stmt_handler, ATTR_BOUND_NATIVE_TYPES, 0)
+        if self._return_types_stmt is not self.stmt_handler or \
+           self._return_types_native != native_types:
+            convert = ('BLOB',)
+            if native_types != NATIVE_TYPES_ON:
+                convert = ('TIMESTAMP', 'DATE', 'TIME', 'BLOB', 'DECIMAL')
+            return_types = []
+            for index in range(ibm_db.num_fields(self.stmt_handler)):
+                type = ibm_db.field_type(self.stmt_handler, index).upper()
+                if type in convert:
+                    return_types.append((index, type))
+            self._return_types = return_types
+            self._return_types_stmt = self.stmt_handler
+            self._return_types_native = native_types
+        return self._return_types
+
     # This method is used to convert a string representing date/time 
     # and binary data in a row tuple fetched from the database 
     # to date/time and binary objects, for returning it to the user.
-    def _fix_return_data_type(self, row):
+    def _fix_return_data_type(self, row, return_types):
         row = list(row)
-        for index in range(len(row)):
+        for index, type in return_types:
             if row[index] is not None:
-                type = ibm_db.field_type(self.stmt_handler, index)
-                type = type.upper()
-
                 try:
                     if type == 'TIMESTAMP':
                         # strptime() method does not support 
@@ -1490,3 +1637,27 @@ class Cursor(object):
                     self.messages.append(DataError("Data type format error: "+ str(inst)))
                     raise self.messages[len(self.messages) - 1]
         return tuple(row)
+
+
+def as_completed(cursors, poll_interval=0.005):
+    """Generator yielding the cursors of the list as the executions they
+    started with execute_async complete, call wait() on each of them to get
+    its result.  ASYNC_THREAD executions are waited for with select(), 
+    ASYNC_CLI ones are polled every poll_interval seconds.
+    """
+    pending = list(cursors)
+    while pending:
+        completed = [cursor for cursor in pending if cursor.poll()]
+        if not completed:
+            fds = [cursor.fileno() for cursor in pending
+                   if cursor._pending.mode == ASYNC_THREAD]
+            if len(fds) == len(pending):
+                select.select(fds, [], [])
+            elif fds:
+                select.select(fds, [], [], poll_interval)
+            else:
+                time.sleep(poll_interval)
+            continue
+        for cursor in completed:
+            pending.remove(cursor)
+            yield cursor
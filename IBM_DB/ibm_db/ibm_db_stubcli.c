@@ -0,0 +1,2599 @@
+/*
++----------------------------------------------------------------------+
+|  Licensed Materials - Property of IBM                                |
+|                                                                      |
+| (C) Copyright IBM Corporation 2006-2009.                             |
++----------------------------------------------------------------------+
+| Stub of the DB2 CLI functions called by ibm_db, for benchmarks and   |
+| tests of the driver that must run without a database server          |
+|                                                                      |
+| Connections always succeed and every query returns a result set      |
+| generated in memory, so the time measured is the time spent in       |
+| ibm_db and Python plus the latency the stub is told to add.          |
++----------------------------------------------------------------------+
+*/
+
+/*
+ * Building
+ *
+ *   IBM_DB_STUB_CLI=1 python setup.py build
+ *
+ * compiles this file into the ibm_db extension instead of linking it with
+ * libdb2; the CLI headers of IBM_DB_HOME are still needed. The stub can
+ * also be built as stub/libdb2.so.1, a library replacing libdb2 for an
+ * extension built as usual:
+ *
+ *   python setup.py build_stub_cli
+ *   LD_LIBRARY_PATH=stub python benchmarks/bench_unicode_fetch.py
+ *
+ * Result sets
+ *
+ * A statement starting with SELECT, WITH or VALUES returns a result set.
+ * Its shape is taken from options in the statement text, usually written
+ * in a comment so that the statement still runs on a server:
+ *
+ *   SELECT * FROM t -- ROWS=100000 COLUMNS=ID:INTEGER,3*VARCHAR(64),CLOB(1M)
+ *
+ *   ROWS=n          rows of the result set, or rows affected by other
+ *                   statements
+ *   COLUMNS=list    column types: SMALLINT, INTEGER, BIGINT, REAL, DOUBLE,
+ *                   DECIMAL(p,s), CHAR(n), VARCHAR(n), GRAPHIC(n),
+ *                   VARGRAPHIC(n), BINARY(n), VARBINARY(n), DATE, TIME,
+ *                   TIMESTAMP, BLOB(n), CLOB(n) and DBCLOB(n), n taking a
+ *                   K, M or G suffix. A type can be preceded by a count
+ *                   and * to repeat it and by a name and : to name the
+ *                   column, the others are named C1, C2, ...
+ *   NULLS=n         the value of column c in row r is NULL when r + c is
+ *                   a multiple of n
+ *   PARAMS=list     types SQLDescribeParam returns for the parameter
+ *                   markers, VARCHAR(32672) for the others
+ *   LATENCY=us      time the execute of the statement takes
+ *   SQLSTATE=xxxxx  the execute fails with this SQLSTATE
+ *
+ * Statements without these options use the environment variables
+ * IBM_DB_STUB_ROWS (100), IBM_DB_STUB_COLUMNS
+ * (INTEGER,VARCHAR(32),DOUBLE,DECIMAL(10,2),TIMESTAMP) and
+ * IBM_DB_STUB_NULLS (0, no NULL values).
+ *
+ * The values depend only on the row number and the column, character
+ * values fill the declared length of the column.
+ *
+ * Latency
+ *
+ * IBM_DB_STUB_LATENCY is the time in microseconds every call that would
+ * go to the server takes: connect, prepare, execute, each block of rows
+ * fetched, SQLGetData, the LOB locator calls, SQLPutData, commit and
+ * rollback. IBM_DB_STUB_EXECUTE_LATENCY is added to every execute, the
+ * LATENCY keyword of a connection string to that connect. An
+ * execute can be canceled with SQLCancel and ends with SQLSTATE HYT00
+ * when it takes longer than SQL_ATTR_QUERY_TIMEOUT. With
+ * SQL_ATTR_ASYNC_ENABLE on, SQLExecute returns SQL_STILL_EXECUTING until
+ * the latency has passed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <sqlcli1.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define strncasecmp _strnicmp
+#else
+#include <pthread.h>
+#include <time.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#ifndef SQL_API_FN
+#define SQL_API_FN
+#endif
+
+#ifndef SQL_ATTR_GET_GENERATED_VALUE
+#define SQL_ATTR_GET_GENERATED_VALUE 2578
+#endif
+
+#define STUB_MAX_HANDLES		65536
+#define STUB_MAX_COLUMNS		1012
+#define STUB_NUM_LOCATORS		4096	/* locators of a connection that stay valid */
+#define STUB_NUM_CONN_STRINGS	16
+#define STUB_STRING_LEN			256
+#define STUB_SLEEP_SLICE		1000	/* microseconds between checks for a cancel */
+#define STUB_DEFAULT_ROWS		100
+#define STUB_DEFAULT_COLUMNS	"INTEGER,VARCHAR(32),DOUBLE,DECIMAL(10,2),TIMESTAMP"
+#define STUB_DEFAULT_PARAM_SIZE	32672
+#define STUB_DBMS_NAME			"DB2/LINUX"
+#define STUB_DBMS_VER			"09.07.0000"
+#define STUB_CODEPAGE			1208
+
+typedef struct _stub_diag_record {
+	int set;
+	char sqlstate[SQL_SQLSTATE_SIZE + 1];
+	SQLINTEGER native;
+	char message[STUB_STRING_LEN];
+} stub_diag_record;
+
+/* First member of the environment, connection and statement handles */
+typedef struct _stub_handle {
+	SQLSMALLINT type;
+	stub_diag_record diag;
+} stub_handle;
+
+typedef struct _stub_column {
+	char name[32];
+	SQLSMALLINT type;
+	SQLULEN size;
+	SQLSMALLINT scale;
+} stub_column;
+
+typedef struct _stub_locator {
+	SQLINTEGER id;
+	SQLSMALLINT type;			/* SQL_BLOB, SQL_CLOB or SQL_DBCLOB */
+	SQLINTEGER length;
+	long row;
+} stub_locator;
+
+typedef struct _stub_conn_string {
+	SQLINTEGER attr;
+	char value[STUB_STRING_LEN];
+} stub_conn_string;
+
+typedef struct _stub_dbc {
+	stub_handle h;
+	int connected;
+	char dsn[STUB_STRING_LEN];
+	SQLUINTEGER autocommit;
+	SQLUINTEGER query_timeout;
+	stub_conn_string strings[STUB_NUM_CONN_STRINGS];
+	SQLINTEGER next_locator;
+	stub_locator locators[STUB_NUM_LOCATORS];	/* the last locators, by id modulo STUB_NUM_LOCATORS */
+} stub_dbc;
+
+typedef struct _stub_binding {
+	SQLSMALLINT ctype;
+	SQLPOINTER buffer;
+	SQLLEN buffer_length;
+	SQLLEN *ind;
+} stub_binding;
+
+typedef struct _stub_param {
+	int bound;
+	SQLSMALLINT ctype;
+	SQLPOINTER value;
+	SQLLEN *ind;
+} stub_param;
+
+typedef struct _stub_stmt {
+	stub_handle h;
+	stub_dbc *dbc;
+
+	/* statement text and the options read from it */
+	char *sql;
+	int is_query;
+	const char *fixed_value;	/* value of every character column, NULL for generated values */
+	long rows;
+	long null_every;
+	long latency;
+	char error_state[SQL_SQLSTATE_SIZE + 1];
+	int num_columns;
+	stub_column *columns;
+	int num_params;
+	stub_column *param_types;
+	char *scratch;				/* character value being converted */
+	SQLLEN scratch_size;
+
+	/* bindings */
+	int num_bindings;
+	stub_binding *bindings;
+	int num_bound_params;
+	stub_param *params;
+
+	/* cursor */
+	int cursor_open;
+	long rowset_start;			/* first row of the rowset, 0 before the first */
+	long rowset_length;
+	int getdata_col;
+	SQLLEN getdata_offset;		/* -1 once the value is returned */
+	SQLLEN row_count;
+
+	/* attributes */
+	SQLULEN row_array_size;
+	SQLULEN *rows_fetched_ptr;
+	SQLUINTEGER cursor_type;
+	SQLUINTEGER query_timeout;
+	SQLUINTEGER async_enable;
+	SQLULEN paramset_size;
+	SQLUSMALLINT *param_status_ptr;
+	SQLULEN *params_processed_ptr;
+
+	/* execute in progress */
+	int need_data;				/* SQLParamData is expected */
+	int data_param;				/* parameter SQLPutData sends data for */
+	int async_pending;
+	int async_timeout;
+	double async_deadline;
+	int chaining;
+	long chained;
+	volatile int canceled;
+} stub_stmt;
+
+static const struct {
+	const char *name;
+	SQLSMALLINT type;
+	SQLULEN size;
+	SQLSMALLINT scale;
+} stub_types[] = {
+	{"SMALLINT", SQL_SMALLINT, 5, 0},
+	{"INTEGER", SQL_INTEGER, 10, 0},
+	{"INT", SQL_INTEGER, 10, 0},
+	{"BIGINT", SQL_BIGINT, 19, 0},
+	{"REAL", SQL_REAL, 7, 0},
+	{"DOUBLE", SQL_DOUBLE, 15, 0},
+	{"FLOAT", SQL_DOUBLE, 15, 0},
+	{"DECIMAL", SQL_DECIMAL, 5, 0},
+	{"CHAR", SQL_CHAR, 1, 0},
+	{"VARCHAR", SQL_VARCHAR, 32, 0},
+	{"GRAPHIC", SQL_GRAPHIC, 1, 0},
+	{"VARGRAPHIC", SQL_VARGRAPHIC, 32, 0},
+	{"BINARY", SQL_BINARY, 1, 0},
+	{"VARBINARY", SQL_VARBINARY, 32, 0},
+	{"DATE", SQL_TYPE_DATE, 10, 0},
+	{"TIME", SQL_TYPE_TIME, 8, 0},
+	{"TIMESTAMP", SQL_TYPE_TIMESTAMP, 26, 6},
+	{"BLOB", SQL_BLOB, 1048576, 0},
+	{"CLOB", SQL_CLOB, 1048576, 0},
+	{"DBCLOB", SQL_DBCLOB, 1048576, 0},
+	{NULL, 0, 0, 0}
+};
+
+static stub_handle *stub_handles[STUB_MAX_HANDLES];
+static size_t stub_next_handle = 1;
+static int stub_configured = 0;
+static long stub_call_latency = 0;
+static long stub_execute_latency = 0;
+
+#ifdef _WIN32
+static SRWLOCK stub_mutex = SRWLOCK_INIT;
+#define STUB_LOCK()		AcquireSRWLockExclusive(&stub_mutex)
+#define STUB_UNLOCK()	ReleaseSRWLockExclusive(&stub_mutex)
+#else
+static pthread_mutex_t stub_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define STUB_LOCK()		pthread_mutex_lock(&stub_mutex)
+#define STUB_UNLOCK()	pthread_mutex_unlock(&stub_mutex)
+#endif
+
+#define STUB_ENV(handle)	stub_lookup((SQLHANDLE)(handle), SQL_HANDLE_ENV)
+#define STUB_DBC(handle)	((stub_dbc *)stub_lookup((SQLHANDLE)(handle), SQL_HANDLE_DBC))
+#define STUB_STMT(handle)	((stub_stmt *)stub_lookup((SQLHANDLE)(handle), SQL_HANDLE_STMT))
+
+/*	static double stub_clock()
+	monotonic time in seconds
+*/
+static double stub_clock(void)
+{
+#ifdef _WIN32
+	return GetTickCount64() / 1000.0;
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+#else
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+#endif
+}
+
+static void stub_sleep(long usec)
+{
+	if ( usec <= 0 ) {
+		return;
+	}
+#ifdef _WIN32
+	Sleep((DWORD)((usec + 999) / 1000));
+#else
+	usleep((useconds_t)usec);
+#endif
+}
+
+static long stub_getenv_long(const char *name, long default_value)
+{
+	const char *value = getenv(name);
+
+	if ( value == NULL || *value == '\0' ) {
+		return default_value;
+	}
+	return strtol(value, NULL, 10);
+}
+
+/*	static void stub_configure()
+	reads the latency of the environment variables once
+*/
+static void stub_configure(void)
+{
+	if ( !stub_configured ) {
+		stub_call_latency = stub_getenv_long("IBM_DB_STUB_LATENCY", 0);
+		stub_execute_latency = stub_getenv_long("IBM_DB_STUB_EXECUTE_LATENCY", 0);
+		stub_configured = 1;
+	}
+}
+
+/*	static SQLHANDLE stub_new_handle(stub_handle *h)
+	registers h, handles are indexes in stub_handles so that they fit the
+	integer handles of the CLI headers
+*/
+static SQLHANDLE stub_new_handle(stub_handle *h)
+{
+	size_t i, id = 0;
+
+	STUB_LOCK();
+	for ( i = 0; i < STUB_MAX_HANDLES - 1; i++ ) {
+		if ( stub_handles[stub_next_handle] == NULL ) {
+			id = stub_next_handle;
+			stub_handles[id] = h;
+		}
+		stub_next_handle = (stub_next_handle + 1) % STUB_MAX_HANDLES;
+		if ( stub_next_handle == 0 ) {
+			stub_next_handle = 1;
+		}
+		if ( id != 0 ) {
+			break;
+		}
+	}
+	STUB_UNLOCK();
+	return (SQLHANDLE)id;
+}
+
+static stub_handle *stub_lookup(SQLHANDLE handle, SQLSMALLINT type)
+{
+	size_t id = (size_t)handle;
+	stub_handle *h;
+
+	if ( id == 0 || id >= STUB_MAX_HANDLES ) {
+		return NULL;
+	}
+	h = stub_handles[id];
+	if ( h == NULL || h->type != type ) {
+		return NULL;
+	}
+	return h;
+}
+
+/*	static SQLRETURN stub_diag(stub_handle *h, SQLRETURN rc, const char *sqlstate, SQLINTEGER native, const char *message)
+	sets the diagnostic record of h and returns rc
+*/
+static SQLRETURN stub_diag(stub_handle *h, SQLRETURN rc, const char *sqlstate, SQLINTEGER native, const char *message)
+{
+	h->diag.set = 1;
+	strncpy(h->diag.sqlstate, sqlstate, SQL_SQLSTATE_SIZE);
+	h->diag.sqlstate[SQL_SQLSTATE_SIZE] = '\0';
+	h->diag.native = native;
+	sprintf(h->diag.message, "[IBM][CLI Driver][STUB] %.200s SQLSTATE=%s", message,
+		h->diag.sqlstate);
+	return rc;
+}
+
+#define stub_error(h, sqlstate, message)	stub_diag((h), SQL_ERROR, (sqlstate), -99999, (message))
+#define stub_warning(h, sqlstate, message)	stub_diag((h), SQL_SUCCESS_WITH_INFO, (sqlstate), 0, (message))
+
+/*	static SQLRETURN stub_wait(stub_stmt *stmt, long latency)
+	takes latency microseconds for a call of the statement, in slices so
+	that SQLCancel from another thread and the query timeout end it
+*/
+static SQLRETURN stub_wait(stub_stmt *stmt, long latency)
+{
+	double now = stub_clock();
+	double end = now + latency / 1e6;
+	double timeout_at = (stmt->query_timeout > 0) ? now + stmt->query_timeout : 0.0;
+	long slice;
+
+	while ( now < end ) {
+		if ( stmt->canceled ) {
+			stmt->canceled = 0;
+			return stub_diag(&stmt->h, SQL_ERROR, "HY008", -952, "Operation canceled.");
+		}
+		if ( timeout_at > 0.0 && now >= timeout_at ) {
+			return stub_diag(&stmt->h, SQL_ERROR, "HYT00", -952, "Timeout expired.");
+		}
+		slice = (long)((end - now) * 1e6);
+		stub_sleep(slice > STUB_SLEEP_SLICE ? STUB_SLEEP_SLICE : slice);
+		now = stub_clock();
+	}
+	return SQL_SUCCESS;
+}
+
+/*	static char *stub_narrow(SQLWCHAR *text, SQLINTEGER length)
+	copy of a SQLWCHAR string, characters outside ASCII become ?
+*/
+static char *stub_narrow(SQLWCHAR *text, SQLINTEGER length)
+{
+	char *result;
+	SQLINTEGER i;
+
+	if ( text == NULL ) {
+		length = 0;
+	} else if ( length == SQL_NTS ) {
+		for ( length = 0; text[length] != 0; length++ ) {
+		}
+	}
+	result = (char *)malloc(length + 1);
+	if ( result == NULL ) {
+		return NULL;
+	}
+	for ( i = 0; i < length; i++ ) {
+		result[i] = (text[i] < 128) ? (char)text[i] : '?';
+	}
+	result[length] = '\0';
+	return result;
+}
+
+/*	static int stub_copy_string(const char *value, SQLPOINTER buffer, SQLINTEGER buffer_length, SQLINTEGER *length)
+	copies a string result into a buffer of buffer_length bytes, returns 1
+	when it is truncated
+*/
+static int stub_copy_string(const char *value, SQLPOINTER buffer, SQLINTEGER buffer_length, SQLINTEGER *length)
+{
+	SQLINTEGER count = (SQLINTEGER)strlen(value);
+
+	if ( length != NULL ) {
+		*length = count;
+	}
+	if ( buffer == NULL || buffer_length <= 0 ) {
+		return count > 0;
+	}
+	if ( count >= buffer_length ) {
+		memcpy(buffer, value, buffer_length - 1);
+		((char *)buffer)[buffer_length - 1] = '\0';
+		return 1;
+	}
+	memcpy(buffer, value, count + 1);
+	return 0;
+}
+
+/*	static int stub_option(const char *sql, const char *key, const char **value)
+	finds the option key=value in the statement text, key is matched
+	without regard to case and has to start a word
+*/
+static int stub_option(const char *sql, const char *key, const char **value)
+{
+	size_t length = strlen(key);
+	const char *p;
+
+	for ( p = sql; *p != '\0'; p++ ) {
+		if ( (p == sql || !(isalnum((unsigned char)p[-1]) || p[-1] == '_')) &&
+			 strncasecmp(p, key, length) == 0 && p[length] == '=' ) {
+			*value = p + length + 1;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int stub_spec_end(const char *p)
+{
+	return *p == '\0' || isspace((unsigned char)*p) || (p[0] == '*' && p[1] == '/');
+}
+
+/*	static int stub_word(const char *p, char *word, size_t size)
+	reads an identifier into word in upper case, returns its length
+*/
+static int stub_word(const char *p, char *word, size_t size)
+{
+	size_t i = 0;
+	int n = 0;
+
+	while ( isalnum((unsigned char)p[n]) || p[n] == '_' ) {
+		if ( i < size - 1 ) {
+			word[i++] = (char)toupper((unsigned char)p[n]);
+		}
+		n++;
+	}
+	word[i] = '\0';
+	return n;
+}
+
+static long stub_parse_size(const char **p)
+{
+	char *end;
+	long size = strtol(*p, &end, 10);
+
+	switch ( toupper((unsigned char)*end) ) {
+		case 'K':
+			size *= 1024;
+			end++;
+			break;
+		case 'M':
+			size *= 1024 * 1024;
+			end++;
+			break;
+		case 'G':
+			size *= 1024 * 1024 * 1024;
+			end++;
+			break;
+	}
+	*p = end;
+	return size;
+}
+
+/*	static int stub_parse_columns(const char *spec, stub_column **columns)
+	parses a list of column types like ID:INTEGER,3*VARCHAR(32),CLOB(1M),
+	returns the number of columns or -1 when the list is not understood
+*/
+static int stub_parse_columns(const char *spec, stub_column **columns)
+{
+	stub_column column, *list = NULL, *grown;
+	char word[32];
+	const char *p = spec;
+	int count = 0, repeat, i;
+
+	while ( !stub_spec_end(p) ) {
+		repeat = 1;
+		if ( isdigit((unsigned char)*p) ) {
+			repeat = (int)strtol(p, (char **)&p, 10);
+			if ( *p++ != '*' || repeat <= 0 ) {
+				goto error;
+			}
+		}
+		memset(&column, 0, sizeof(column));
+		p += stub_word(p, word, sizeof(word));
+		if ( *p == ':' ) {
+			strcpy(column.name, word);
+			p++;
+			p += stub_word(p, word, sizeof(word));
+		}
+		for ( i = 0; stub_types[i].name != NULL; i++ ) {
+			if ( strcmp(word, stub_types[i].name) == 0 ) {
+				break;
+			}
+		}
+		if ( stub_types[i].name == NULL ) {
+			goto error;
+		}
+		column.type = stub_types[i].type;
+		column.size = stub_types[i].size;
+		column.scale = stub_types[i].scale;
+		if ( *p == '(' ) {
+			p++;
+			column.size = stub_parse_size(&p);
+			if ( *p == ',' && column.type == SQL_DECIMAL ) {
+				p++;
+				column.scale = (SQLSMALLINT)strtol(p, (char **)&p, 10);
+			}
+			if ( *p++ != ')' || column.size <= 0 || column.scale < 0 ||
+				 (SQLULEN)column.scale > column.size ) {
+				goto error;
+			}
+		}
+		if ( count + repeat > STUB_MAX_COLUMNS ) {
+			goto error;
+		}
+		grown = (stub_column *)realloc(list, sizeof(stub_column) * (count + repeat));
+		if ( grown == NULL ) {
+			goto error;
+		}
+		list = grown;
+		for ( i = 0; i < repeat; i++ ) {
+			list[count] = column;
+			if ( list[count].name[0] == '\0' ) {
+				sprintf(list[count].name, "C%d", count + 1);
+			}
+			count++;
+		}
+		if ( *p == ',' ) {
+			p++;
+		} else if ( !stub_spec_end(p) ) {
+			goto error;
+		}
+	}
+	*columns = list;
+	return count;
+
+error:
+	free(list);
+	return -1;
+}
+
+/*	static int stub_count_params(const char *sql)
+	number of parameter markers outside literals and comments
+*/
+static int stub_count_params(const char *sql)
+{
+	const char *p = sql;
+	char quote;
+	int count = 0;
+
+	while ( *p != '\0' ) {
+		if ( *p == '\'' || *p == '"' ) {
+			quote = *p++;
+			while ( *p != '\0' && *p != quote ) {
+				p++;
+			}
+		} else if ( p[0] == '/' && p[1] == '*' ) {
+			p += 2;
+			while ( *p != '\0' && !(p[0] == '*' && p[1] == '/') ) {
+				p++;
+			}
+			if ( *p != '\0' ) {
+				p++;
+			}
+		} else if ( p[0] == '-' && p[1] == '-' ) {
+			while ( *p != '\0' && *p != '\n' ) {
+				p++;
+			}
+		} else if ( *p == '?' ) {
+			count++;
+		}
+		if ( *p != '\0' ) {
+			p++;
+		}
+	}
+	return count;
+}
+
+static void stub_free_statement_text(stub_stmt *stmt)
+{
+	free(stmt->sql);
+	free(stmt->columns);
+	free(stmt->param_types);
+	free(stmt->scratch);
+	stmt->sql = NULL;
+	stmt->columns = NULL;
+	stmt->param_types = NULL;
+	stmt->scratch = NULL;
+	stmt->num_columns = 0;
+	stmt->num_params = 0;
+	stmt->is_query = 0;
+	stmt->fixed_value = NULL;
+}
+
+/*	static SQLRETURN stub_set_columns(stub_stmt *stmt, stub_column *columns, int num_columns)
+	makes columns the result set columns of the statement and sizes the
+	buffer its character values are built in
+*/
+static SQLRETURN stub_set_columns(stub_stmt *stmt, stub_column *columns, int num_columns)
+{
+	SQLLEN size = 64;
+	int i;
+
+	stmt->columns = columns;
+	stmt->num_columns = num_columns;
+	for ( i = 0; i < num_columns; i++ ) {
+		switch ( columns[i].type ) {
+			case SQL_BLOB:
+			case SQL_CLOB:
+			case SQL_DBCLOB:
+				/* LOB values are generated where they are copied */
+				break;
+			default:
+				/* binary values converted to hexadecimal take twice the size */
+				if ( (SQLLEN)columns[i].size * 2 + 64 > size ) {
+					size = (SQLLEN)columns[i].size * 2 + 64;
+				}
+				break;
+		}
+	}
+	stmt->scratch = (char *)malloc(size);
+	if ( stmt->scratch == NULL ) {
+		return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+	}
+	stmt->scratch_size = size;
+	return SQL_SUCCESS;
+}
+
+static void stub_close_cursor(stub_stmt *stmt)
+{
+	stmt->cursor_open = 0;
+	stmt->rowset_start = 0;
+	stmt->rowset_length = 0;
+	stmt->getdata_col = 0;
+}
+
+/*	static SQLRETURN stub_prepare(stub_stmt *stmt, char *sql)
+	takes ownership of the statement text and reads its options
+*/
+static SQLRETURN stub_prepare(stub_stmt *stmt, char *sql)
+{
+	stub_column *columns = NULL;
+	stub_param *params;
+	const char *value, *p;
+	char word[16];
+	int num_columns, i;
+
+	if ( sql == NULL ) {
+		return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+	}
+	stub_close_cursor(stmt);
+	stub_free_statement_text(stmt);
+	stmt->sql = sql;
+	stmt->error_state[0] = '\0';
+
+	for ( p = sql; isspace((unsigned char)*p) || *p == '('; p++ ) {
+	}
+	stub_word(p, word, sizeof(word));
+	stmt->is_query = (strcmp(word, "SELECT") == 0 || strcmp(word, "WITH") == 0 ||
+		strcmp(word, "VALUES") == 0);
+
+	stmt->rows = stub_option(sql, "ROWS", &value) ? strtol(value, NULL, 10) :
+		(stmt->is_query ? stub_getenv_long("IBM_DB_STUB_ROWS", STUB_DEFAULT_ROWS) : 1);
+	stmt->null_every = stub_option(sql, "NULLS", &value) ? strtol(value, NULL, 10) :
+		stub_getenv_long("IBM_DB_STUB_NULLS", 0);
+	stmt->latency = stub_option(sql, "LATENCY", &value) ? strtol(value, NULL, 10) : 0;
+	if ( stub_option(sql, "SQLSTATE", &value) ) {
+		strncpy(stmt->error_state, value, SQL_SQLSTATE_SIZE);
+		stmt->error_state[SQL_SQLSTATE_SIZE] = '\0';
+	}
+	if ( stmt->rows < 0 ) {
+		stmt->rows = 0;
+	}
+
+	if ( strncasecmp(p, "values current decfloat rounding mode", 37) == 0 ) {
+		/* Asked by ibm_db when it connects */
+		num_columns = stub_parse_columns("VARCHAR(15)", &columns);
+		stmt->rows = 1;
+		stmt->null_every = 0;
+		stmt->fixed_value = "ROUND_HALF_EVEN";
+	} else if ( stmt->is_query ) {
+		if ( !stub_option(sql, "COLUMNS", &value) ) {
+			value = getenv("IBM_DB_STUB_COLUMNS");
+			if ( value == NULL || *value == '\0' ) {
+				value = STUB_DEFAULT_COLUMNS;
+			}
+		}
+		num_columns = stub_parse_columns(value, &columns);
+		if ( num_columns <= 0 ) {
+			return stub_error(&stmt->h, "42601", "The COLUMNS option of the statement is not valid.");
+		}
+	} else {
+		num_columns = 0;
+	}
+	if ( stub_set_columns(stmt, columns, num_columns) == SQL_ERROR ) {
+		return SQL_ERROR;
+	}
+
+	stmt->num_params = stub_count_params(sql);
+	if ( stub_option(sql, "PARAMS", &value) &&
+		 stub_parse_columns(value, &stmt->param_types) < stmt->num_params ) {
+		free(stmt->param_types);
+		stmt->param_types = NULL;
+		return stub_error(&stmt->h, "42601", "The PARAMS option of the statement does not describe every parameter.");
+	}
+	if ( stmt->num_params > stmt->num_bound_params ) {
+		params = (stub_param *)realloc(stmt->params, sizeof(stub_param) * stmt->num_params);
+		if ( params == NULL ) {
+			return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+		}
+		for ( i = stmt->num_bound_params; i < stmt->num_params; i++ ) {
+			memset(&params[i], 0, sizeof(stub_param));
+		}
+		stmt->params = params;
+		stmt->num_bound_params = stmt->num_params;
+	}
+	return stub_wait(stmt, stub_call_latency);
+}
+
+/*	static int stub_is_null(stub_stmt *stmt, int col, long row) */
+static int stub_is_null(stub_stmt *stmt, int col, long row)
+{
+	return stmt->null_every > 0 && (row + col + 1) % stmt->null_every == 0;
+}
+
+static SQLBIGINT stub_int_value(stub_column *column, long row)
+{
+	switch ( column->type ) {
+		case SQL_SMALLINT:
+			return row % 32768;
+		case SQL_BIGINT:
+			return (SQLBIGINT)row * 1000003;
+		default:
+			return row;
+	}
+}
+
+static void stub_date_value(long row, DATE_STRUCT *date)
+{
+	date->year = (SQLSMALLINT)(2000 + (row / 336) % 100);
+	date->month = (SQLUSMALLINT)(1 + (row / 28) % 12);
+	date->day = (SQLUSMALLINT)(1 + row % 28);
+}
+
+static void stub_time_value(long row, TIME_STRUCT *time)
+{
+	time->hour = (SQLUSMALLINT)((row / 3600) % 24);
+	time->minute = (SQLUSMALLINT)((row / 60) % 60);
+	time->second = (SQLUSMALLINT)(row % 60);
+}
+
+static void stub_timestamp_value(long row, TIMESTAMP_STRUCT *ts)
+{
+	DATE_STRUCT date;
+	TIME_STRUCT time;
+
+	stub_date_value(row, &date);
+	stub_time_value(row, &time);
+	ts->year = date.year;
+	ts->month = date.month;
+	ts->day = date.day;
+	ts->hour = time.hour;
+	ts->minute = time.minute;
+	ts->second = time.second;
+	ts->fraction = (SQLUINTEGER)(row % 1000000) * 1000;
+}
+
+/*	static SQLLEN stub_value_text(stub_stmt *stmt, int col, long row, int hex)
+	builds the value of a column that is not a LOB in the scratch buffer as
+	text, or as bytes for binary columns unless hex is set, and returns its
+	length
+*/
+static SQLLEN stub_value_text(stub_stmt *stmt, int col, long row, int hex)
+{
+	stub_column *column = &stmt->columns[col];
+	char *text = stmt->scratch;
+	SQLBIGINT value;
+	DATE_STRUCT date;
+	TIME_STRUCT time;
+	TIMESTAMP_STRUCT ts;
+	SQLLEN length, i, digits;
+	char number[32];
+	int n, k;
+
+	switch ( column->type ) {
+		case SQL_SMALLINT:
+		case SQL_INTEGER:
+		case SQL_BIGINT:
+			value = stub_int_value(column, row);
+			n = 0;
+			do {
+				number[n++] = (char)('0' + value % 10);
+				value /= 10;
+			} while ( value > 0 );
+			for ( i = 0; i < n; i++ ) {
+				text[i] = number[n - 1 - i];
+			}
+			return n;
+
+		case SQL_REAL:
+		case SQL_DOUBLE:
+			return sprintf(text, "%ld.25", row);
+
+		case SQL_DECIMAL:
+			/* the integer digits of the row number and .25000... */
+			digits = (SQLLEN)column->size - column->scale;
+			n = sprintf(number, "%ld", row);
+			if ( digits <= 0 ) {
+				length = sprintf(text, "0");
+			} else {
+				length = (n > digits) ? digits : n;
+				memcpy(text, number + n - length, length);
+			}
+			if ( column->scale > 0 ) {
+				text[length++] = '.';
+				for ( i = 0; i < column->scale; i++ ) {
+					text[length++] = (i == 0) ? '2' : (i == 1) ? '5' : '0';
+				}
+			}
+			return length;
+
+		case SQL_TYPE_DATE:
+			stub_date_value(row, &date);
+			return sprintf(text, "%04d-%02d-%02d", date.year, date.month, date.day);
+
+		case SQL_TYPE_TIME:
+			stub_time_value(row, &time);
+			return sprintf(text, "%02d:%02d:%02d", time.hour, time.minute, time.second);
+
+		case SQL_TYPE_TIMESTAMP:
+			stub_timestamp_value(row, &ts);
+			return sprintf(text, "%04d-%02d-%02d %02d:%02d:%02d.%06lu", ts.year, ts.month,
+				ts.day, ts.hour, ts.minute, ts.second, (unsigned long)(ts.fraction / 1000));
+
+		case SQL_BINARY:
+		case SQL_VARBINARY:
+			length = (SQLLEN)column->size;
+			if ( hex ) {
+				for ( i = 0; i < length; i++ ) {
+					sprintf(text + 2 * i, "%02X", (unsigned)((row + i) & 0xff));
+				}
+				return 2 * length;
+			}
+			for ( i = 0; i < length; i++ ) {
+				text[i] = (char)((row + i) & 0xff);
+			}
+			return length;
+
+		default:
+			/* character columns: R<row>C<column> then letters up to the size */
+			length = (SQLLEN)column->size;
+			if ( stmt->fixed_value != NULL ) {
+				strcpy(text, stmt->fixed_value);
+				return (SQLLEN)strlen(text);
+			}
+			n = sprintf(number, "R%ldC%d", row, col + 1);
+			if ( n > length ) {
+				n = (int)length;
+			}
+			memcpy(text, number, n);
+			k = (int)((row + n) % 26);
+			for ( i = n; i < length; i++ ) {
+				text[i] = (char)('a' + k);
+				if ( ++k == 26 ) {
+					k = 0;
+				}
+			}
+			return length;
+	}
+}
+
+static int stub_lob_byte(stub_locator *loc, SQLLEN i)
+{
+	if ( loc->type == SQL_BLOB ) {
+		return (int)((loc->row + i) & 0xff);
+	}
+	return 'a' + (int)((loc->row + i) % 26);
+}
+
+/*	static SQLRETURN stub_copy_data(stub_handle *h, const char *src, stub_locator *loc, SQLLEN length, SQLSMALLINT ctype, SQLPOINTER buffer, SQLLEN buffer_length, SQLLEN *ind, SQLLEN *offset)
+	copies length characters of src, or of the LOB value of loc, from
+	*offset into buffer as SQL_C_CHAR, SQL_C_WCHAR, SQL_C_DBCHAR or
+	SQL_C_BINARY data. offset is moved past the data copied, -1 once all
+	of it was returned, NULL for a bound column
+*/
+static SQLRETURN stub_copy_data(stub_handle *h, const char *src, stub_locator *loc, SQLLEN length, SQLSMALLINT ctype, SQLPOINTER buffer, SQLLEN buffer_length, SQLLEN *ind, SQLLEN *offset)
+{
+	SQLLEN unit = (ctype == SQL_C_WCHAR || ctype == SQL_C_DBCHAR) ? sizeof(SQLWCHAR) : 1;
+	SQLLEN terminator = (ctype == SQL_C_BINARY) ? 0 : unit;
+	SQLLEN start = (offset != NULL) ? *offset : 0;
+	SQLLEN count, i;
+	int hex = (loc != NULL && loc->type == SQL_BLOB && ctype == SQL_C_CHAR);
+
+	if ( start < 0 ) {
+		return SQL_NO_DATA_FOUND;
+	}
+	if ( hex ) {
+		/* LOB bytes as two hexadecimal digits each */
+		length *= 2;
+	}
+	length -= start;
+	count = length;
+	if ( buffer == NULL || buffer_length < terminator ) {
+		count = 0;
+	} else if ( count * unit + terminator > buffer_length ) {
+		count = (buffer_length - terminator) / unit;
+	}
+	if ( count > 0 ) {
+		if ( loc != NULL ) {
+			for ( i = 0; i < count; i++ ) {
+				int c = hex ?
+					"0123456789ABCDEF"[(stub_lob_byte(loc, (start + i) / 2) >> (((start + i) % 2) ? 0 : 4)) & 0xf] :
+					stub_lob_byte(loc, start + i);
+				if ( unit == 1 ) {
+					((char *)buffer)[i] = (char)c;
+				} else {
+					((SQLWCHAR *)buffer)[i] = (SQLWCHAR)c;
+				}
+			}
+		} else if ( unit == 1 ) {
+			memcpy(buffer, src + start, count);
+		} else {
+			for ( i = 0; i < count; i++ ) {
+				((SQLWCHAR *)buffer)[i] = (SQLWCHAR)(unsigned char)src[start + i];
+			}
+		}
+	}
+	if ( buffer != NULL && terminator > 0 && buffer_length >= terminator ) {
+		if ( unit == 1 ) {
+			((char *)buffer)[count] = '\0';
+		} else {
+			((SQLWCHAR *)buffer)[count] = 0;
+		}
+	}
+	if ( ind != NULL ) {
+		*ind = length * unit;
+	}
+	if ( offset != NULL ) {
+		*offset = (count < length) ? start + count : -1;
+	}
+	if ( count < length ) {
+		return stub_warning(h, "01004", "Data truncated.");
+	}
+	return SQL_SUCCESS;
+}
+
+/*	static SQLINTEGER stub_new_locator(stub_dbc *dbc, stub_column *column, long row)
+	locator of the LOB value of a row, valid for the next STUB_NUM_LOCATORS
+	locators of the connection
+*/
+static SQLINTEGER stub_new_locator(stub_dbc *dbc, stub_column *column, long row)
+{
+	stub_locator *loc;
+	SQLINTEGER id;
+
+	STUB_LOCK();
+	if ( ++dbc->next_locator <= 0 ) {
+		dbc->next_locator = 1;
+	}
+	id = dbc->next_locator;
+	loc = &dbc->locators[id % STUB_NUM_LOCATORS];
+	loc->id = id;
+	loc->type = column->type;
+	loc->length = (SQLINTEGER)column->size;
+	loc->row = row;
+	STUB_UNLOCK();
+	return id;
+}
+
+static stub_locator *stub_find_locator(stub_dbc *dbc, SQLINTEGER id)
+{
+	stub_locator *loc;
+
+	if ( id <= 0 ) {
+		return NULL;
+	}
+	loc = &dbc->locators[id % STUB_NUM_LOCATORS];
+	return (loc->id == id) ? loc : NULL;
+}
+
+static SQLSMALLINT stub_default_ctype(SQLSMALLINT type)
+{
+	switch ( type ) {
+		case SQL_SMALLINT:
+			return SQL_C_SHORT;
+		case SQL_INTEGER:
+			return SQL_C_LONG;
+		case SQL_BIGINT:
+			return SQL_C_SBIGINT;
+		case SQL_REAL:
+			return SQL_C_FLOAT;
+		case SQL_DOUBLE:
+			return SQL_C_DOUBLE;
+		case SQL_TYPE_DATE:
+			return SQL_C_TYPE_DATE;
+		case SQL_TYPE_TIME:
+			return SQL_C_TYPE_TIME;
+		case SQL_TYPE_TIMESTAMP:
+			return SQL_C_TYPE_TIMESTAMP;
+		case SQL_GRAPHIC:
+		case SQL_VARGRAPHIC:
+		case SQL_DBCLOB:
+			return SQL_C_DBCHAR;
+		case SQL_BINARY:
+		case SQL_VARBINARY:
+		case SQL_BLOB:
+			return SQL_C_BINARY;
+		default:
+			return SQL_C_CHAR;
+	}
+}
+
+/*	static SQLRETURN stub_put_value(stub_stmt *stmt, int col, long row, SQLSMALLINT ctype, SQLPOINTER buffer, SQLLEN buffer_length, SQLLEN *ind, SQLLEN *offset)
+	converts the value of column col in row row to ctype, see
+	stub_copy_data for offset
+*/
+static SQLRETURN stub_put_value(stub_stmt *stmt, int col, long row, SQLSMALLINT ctype, SQLPOINTER buffer, SQLLEN buffer_length, SQLLEN *ind, SQLLEN *offset)
+{
+	stub_column *column = &stmt->columns[col];
+	stub_locator loc;
+	SQLLEN length = 0;
+
+	if ( offset != NULL && *offset < 0 ) {
+		return SQL_NO_DATA_FOUND;
+	}
+	if ( stub_is_null(stmt, col, row) ) {
+		if ( ind == NULL ) {
+			return stub_error(&stmt->h, "22002", "Indicator variable required but not supplied.");
+		}
+		*ind = SQL_NULL_DATA;
+		if ( offset != NULL ) {
+			*offset = -1;
+		}
+		return SQL_SUCCESS;
+	}
+	if ( ctype == SQL_C_DEFAULT ) {
+		ctype = stub_default_ctype(column->type);
+	}
+
+	switch ( ctype ) {
+		case SQL_C_CHAR:
+		case SQL_C_WCHAR:
+		case SQL_C_DBCHAR:
+		case SQL_C_BINARY:
+			if ( column->type == SQL_BLOB || column->type == SQL_CLOB || column->type == SQL_DBCLOB ) {
+				loc.id = 0;
+				loc.type = column->type;
+				loc.length = (SQLINTEGER)column->size;
+				loc.row = row;
+				return stub_copy_data(&stmt->h, NULL, &loc, loc.length, ctype, buffer,
+					buffer_length, ind, offset);
+			}
+			length = stub_value_text(stmt, col, row, ctype != SQL_C_BINARY);
+			return stub_copy_data(&stmt->h, stmt->scratch, NULL, length, ctype, buffer,
+				buffer_length, ind, offset);
+
+		case SQL_C_SHORT:
+		case SQL_C_SSHORT:
+			*(SQLSMALLINT *)buffer = (SQLSMALLINT)stub_int_value(column, row);
+			length = sizeof(SQLSMALLINT);
+			break;
+
+		case SQL_C_LONG:
+		case SQL_C_SLONG:
+			*(SQLINTEGER *)buffer = (SQLINTEGER)stub_int_value(column, row);
+			length = sizeof(SQLINTEGER);
+			break;
+
+		case SQL_C_SBIGINT:
+			*(SQLBIGINT *)buffer = stub_int_value(column, row);
+			length = sizeof(SQLBIGINT);
+			break;
+
+		case SQL_C_DOUBLE:
+			*(SQLDOUBLE *)buffer = row + 0.25;
+			length = sizeof(SQLDOUBLE);
+			break;
+
+		case SQL_C_FLOAT:
+			*(SQLREAL *)buffer = (SQLREAL)(row + 0.25);
+			length = sizeof(SQLREAL);
+			break;
+
+		case SQL_C_TYPE_DATE:
+			stub_date_value(row, (DATE_STRUCT *)buffer);
+			length = sizeof(DATE_STRUCT);
+			break;
+
+		case SQL_C_TYPE_TIME:
+			stub_time_value(row, (TIME_STRUCT *)buffer);
+			length = sizeof(TIME_STRUCT);
+			break;
+
+		case SQL_C_TYPE_TIMESTAMP:
+			stub_timestamp_value(row, (TIMESTAMP_STRUCT *)buffer);
+			length = sizeof(TIMESTAMP_STRUCT);
+			break;
+
+		case SQL_BLOB_LOCATOR:
+		case SQL_CLOB_LOCATOR:
+		case SQL_DBCLOB_LOCATOR:
+			if ( column->type != SQL_BLOB && column->type != SQL_CLOB && column->type != SQL_DBCLOB ) {
+				return stub_error(&stmt->h, "07006", "Restricted data type attribute violation.");
+			}
+			*(SQLINTEGER *)buffer = stub_new_locator(stmt->dbc, column, row);
+			length = sizeof(SQLINTEGER);
+			break;
+
+		default:
+			return stub_error(&stmt->h, "HY003", "Program type out of range.");
+	}
+	if ( ind != NULL ) {
+		*ind = length;
+	}
+	if ( offset != NULL ) {
+		*offset = -1;
+	}
+	return SQL_SUCCESS;
+}
+
+/*	static SQLRETURN stub_complete(stub_stmt *stmt)
+	result of an execute once its latency has passed
+*/
+static SQLRETURN stub_complete(stub_stmt *stmt)
+{
+	SQLULEN sets = (stmt->paramset_size > 0) ? stmt->paramset_size : 1;
+	SQLULEN i;
+	int failed = (stmt->error_state[0] != '\0');
+
+	if ( stmt->params_processed_ptr != NULL ) {
+		*stmt->params_processed_ptr = sets;
+	}
+	if ( stmt->param_status_ptr != NULL ) {
+		for ( i = 0; i < sets; i++ ) {
+			stmt->param_status_ptr[i] = failed ? SQL_PARAM_ERROR : SQL_PARAM_SUCCESS;
+		}
+	}
+	if ( failed ) {
+		stmt->row_count = 0;
+		return stub_error(&stmt->h, stmt->error_state, "Error requested by the SQLSTATE option of the statement.");
+	}
+	if ( stmt->is_query ) {
+		stmt->cursor_open = 1;
+		stmt->rowset_start = 0;
+		stmt->rowset_length = 0;
+		stmt->row_count = -1;
+	} else {
+		stmt->row_count = stmt->rows * (SQLLEN)(stmt->chained > 0 ? stmt->chained : sets);
+	}
+	stmt->chained = 0;
+	return SQL_SUCCESS;
+}
+
+/*	static SQLRETURN stub_run(stub_stmt *stmt)
+	executes the statement once the data at execute parameters are sent
+*/
+static SQLRETURN stub_run(stub_stmt *stmt)
+{
+	long latency = stub_call_latency + stub_execute_latency + stmt->latency;
+	SQLRETURN rc;
+
+	if ( stmt->async_enable == SQL_ASYNC_ENABLE_ON && latency > 0 ) {
+		stmt->async_pending = 1;
+		stmt->async_timeout = (stmt->query_timeout > 0 && latency / 1e6 > stmt->query_timeout);
+		stmt->async_deadline = stub_clock() +
+			(stmt->async_timeout ? (double)stmt->query_timeout : latency / 1e6);
+		return SQL_STILL_EXECUTING;
+	}
+	rc = stub_wait(stmt, latency);
+	if ( rc != SQL_SUCCESS ) {
+		return rc;
+	}
+	return stub_complete(stmt);
+}
+
+/*	static int stub_next_data_param(stub_stmt *stmt, int from)
+	first parameter from from on bound with SQL_DATA_AT_EXEC, -1 if none
+*/
+static int stub_next_data_param(stub_stmt *stmt, int from)
+{
+	int i;
+
+	for ( i = from; i < stmt->num_params && i < stmt->num_bound_params; i++ ) {
+		if ( stmt->params[i].bound && stmt->params[i].ind != NULL &&
+			 (*stmt->params[i].ind == SQL_DATA_AT_EXEC ||
+			  *stmt->params[i].ind <= SQL_LEN_DATA_AT_EXEC_OFFSET) ) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static SQLRETURN stub_execute(stub_stmt *stmt)
+{
+	SQLRETURN rc;
+
+	if ( stmt->async_pending ) {
+		/* Polled again by the application */
+		if ( stmt->canceled ) {
+			stmt->canceled = 0;
+			stmt->async_pending = 0;
+			return stub_diag(&stmt->h, SQL_ERROR, "HY008", -952, "Operation canceled.");
+		}
+		if ( stub_clock() < stmt->async_deadline ) {
+			return SQL_STILL_EXECUTING;
+		}
+		stmt->async_pending = 0;
+		if ( stmt->async_timeout ) {
+			return stub_diag(&stmt->h, SQL_ERROR, "HYT00", -952, "Timeout expired.");
+		}
+		return stub_complete(stmt);
+	}
+	if ( stmt->sql == NULL ) {
+		return stub_error(&stmt->h, "HY010", "Function sequence error.");
+	}
+	stmt->canceled = 0;
+	stub_close_cursor(stmt);
+	stmt->row_count = 0;
+	if ( stmt->chaining ) {
+		/* Sent with SQL_ATTR_CHAINING_END */
+		stmt->chained += (stmt->paramset_size > 0) ? (long)stmt->paramset_size : 1;
+		return SQL_SUCCESS;
+	}
+	if ( stub_next_data_param(stmt, 0) >= 0 ) {
+		stmt->need_data = 1;
+		stmt->data_param = -1;
+		return SQL_NEED_DATA;
+	}
+	rc = stub_run(stmt);
+	return rc;
+}
+
+/*	static SQLRETURN stub_fetch(stub_stmt *stmt, SQLSMALLINT orientation, SQLLEN offset)
+	moves to the rowset orientation and offset point to and fills the
+	bound columns
+*/
+static SQLRETURN stub_fetch(stub_stmt *stmt, SQLSMALLINT orientation, SQLLEN offset)
+{
+	SQLULEN array_size = (stmt->row_array_size > 0) ? stmt->row_array_size : 1;
+	SQLRETURN rc, result = SQL_SUCCESS;
+	stub_binding *b;
+	long start, count, i;
+	int col;
+
+	if ( !stmt->cursor_open ) {
+		return stub_error(&stmt->h, "24000", "Invalid cursor state.");
+	}
+	if ( orientation != SQL_FETCH_NEXT && stmt->cursor_type == SQL_CURSOR_FORWARD_ONLY ) {
+		return stub_error(&stmt->h, "HY106", "Fetch type out of range.");
+	}
+	switch ( orientation ) {
+		case SQL_FETCH_NEXT:
+			start = (stmt->rowset_start == 0) ? 1 : stmt->rowset_start + stmt->rowset_length;
+			break;
+		case SQL_FETCH_FIRST:
+			start = 1;
+			break;
+		case SQL_FETCH_LAST:
+			start = stmt->rows - (long)array_size + 1;
+			if ( start < 1 ) {
+				start = 1;
+			}
+			break;
+		case SQL_FETCH_PRIOR:
+			start = stmt->rowset_start - (long)array_size;
+			break;
+		case SQL_FETCH_ABSOLUTE:
+			start = (offset < 0) ? stmt->rows + (long)offset + 1 : (long)offset;
+			break;
+		case SQL_FETCH_RELATIVE:
+			start = stmt->rowset_start + (long)offset;
+			break;
+		default:
+			return stub_error(&stmt->h, "HY106", "Fetch type out of range.");
+	}
+	rc = stub_wait(stmt, stub_call_latency);
+	if ( rc != SQL_SUCCESS ) {
+		return rc;
+	}
+	stmt->getdata_col = 0;
+	if ( start < 1 || start > stmt->rows ) {
+		/* before the first or after the last row */
+		stmt->rowset_start = (start < 1) ? 0 : stmt->rows + 1;
+		stmt->rowset_length = 0;
+		if ( stmt->rows_fetched_ptr != NULL ) {
+			*stmt->rows_fetched_ptr = 0;
+		}
+		return SQL_NO_DATA_FOUND;
+	}
+	count = stmt->rows - start + 1;
+	if ( count > (long)array_size ) {
+		count = (long)array_size;
+	}
+	stmt->rowset_start = start;
+	stmt->rowset_length = count;
+
+	for ( col = 0; col < stmt->num_bindings && col < stmt->num_columns; col++ ) {
+		b = &stmt->bindings[col];
+		if ( b->buffer == NULL && b->ind == NULL ) {
+			continue;
+		}
+		for ( i = 0; i < count; i++ ) {
+			rc = stub_put_value(stmt, col, start + i, b->ctype,
+				b->buffer ? (char *)b->buffer + i * b->buffer_length : NULL,
+				b->buffer_length, b->ind ? b->ind + i : NULL, NULL);
+			if ( rc == SQL_ERROR ) {
+				return rc;
+			}
+			if ( rc == SQL_SUCCESS_WITH_INFO ) {
+				result = rc;
+			}
+		}
+	}
+	if ( stmt->rows_fetched_ptr != NULL ) {
+		*stmt->rows_fetched_ptr = (SQLULEN)count;
+	}
+	return result;
+}
+
+/*	static SQLRETURN stub_catalog(stub_stmt *stmt, const char *names)
+	empty result set of a catalog function with the columns names
+*/
+static SQLRETURN stub_catalog(stub_stmt *stmt, const char *names)
+{
+	stub_column *columns;
+	const char *p;
+	int count = 1, i, n;
+
+	stub_close_cursor(stmt);
+	stub_free_statement_text(stmt);
+	for ( p = names; *p != '\0'; p++ ) {
+		if ( *p == ',' ) {
+			count++;
+		}
+	}
+	columns = (stub_column *)calloc(count, sizeof(stub_column));
+	if ( columns == NULL ) {
+		return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+	}
+	for ( i = 0, p = names; i < count; i++ ) {
+		for ( n = 0; p[n] != ',' && p[n] != '\0'; n++ ) {
+		}
+		memcpy(columns[i].name, p, n);
+		columns[i].type = SQL_VARCHAR;
+		columns[i].size = 128;
+		p += n + 1;
+	}
+	if ( stub_set_columns(stmt, columns, count) == SQL_ERROR ) {
+		return SQL_ERROR;
+	}
+	stmt->sql = (char *)malloc(1);
+	if ( stmt->sql != NULL ) {
+		stmt->sql[0] = '\0';
+	}
+	stmt->is_query = 1;
+	stmt->rows = 0;
+	stmt->null_every = 0;
+	stmt->error_state[0] = '\0';
+	stmt->cursor_open = 1;
+	return stub_wait(stmt, stub_call_latency);
+}
+
+/* Handles */
+
+SQLRETURN SQL_API_FN SQLAllocHandle(SQLSMALLINT fHandleType, SQLHANDLE hInput, SQLHANDLE *phOutput)
+{
+	stub_handle *h;
+	stub_dbc *dbc;
+	stub_stmt *stmt;
+	size_t size;
+
+	*phOutput = (SQLHANDLE)0;
+	switch ( fHandleType ) {
+		case SQL_HANDLE_ENV:
+			STUB_LOCK();
+			stub_configure();
+			STUB_UNLOCK();
+			size = sizeof(stub_handle);
+			break;
+		case SQL_HANDLE_DBC:
+			if ( STUB_ENV(hInput) == NULL ) {
+				return SQL_INVALID_HANDLE;
+			}
+			size = sizeof(stub_dbc);
+			break;
+		case SQL_HANDLE_STMT:
+			dbc = STUB_DBC(hInput);
+			if ( dbc == NULL ) {
+				return SQL_INVALID_HANDLE;
+			}
+			if ( !dbc->connected ) {
+				return stub_error(&dbc->h, "08003", "Connection is closed.");
+			}
+			size = sizeof(stub_stmt);
+			break;
+		default:
+			return SQL_ERROR;
+	}
+	h = (stub_handle *)calloc(1, size);
+	if ( h == NULL ) {
+		return SQL_ERROR;
+	}
+	h->type = fHandleType;
+	if ( fHandleType == SQL_HANDLE_DBC ) {
+		((stub_dbc *)h)->autocommit = SQL_AUTOCOMMIT_ON;
+	} else if ( fHandleType == SQL_HANDLE_STMT ) {
+		stmt = (stub_stmt *)h;
+		stmt->dbc = STUB_DBC(hInput);
+		stmt->cursor_type = SQL_CURSOR_FORWARD_ONLY;
+		stmt->row_array_size = 1;
+		stmt->paramset_size = 1;
+		stmt->query_timeout = stmt->dbc->query_timeout;
+		stmt->async_enable = SQL_ASYNC_ENABLE_OFF;
+	}
+	*phOutput = stub_new_handle(h);
+	if ( *phOutput == (SQLHANDLE)0 ) {
+		free(h);
+		return SQL_ERROR;
+	}
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLFreeHandle(SQLSMALLINT fHandleType, SQLHANDLE hHandle)
+{
+	stub_handle *h = stub_lookup(hHandle, fHandleType);
+	stub_stmt *stmt;
+
+	if ( h == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	if ( fHandleType == SQL_HANDLE_STMT ) {
+		stmt = (stub_stmt *)h;
+		stub_free_statement_text(stmt);
+		free(stmt->bindings);
+		free(stmt->params);
+	}
+	STUB_LOCK();
+	stub_handles[(size_t)hHandle] = NULL;
+	STUB_UNLOCK();
+	free(h);
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLFreeStmt(SQLHSTMT hstmt, SQLUSMALLINT fOption)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	switch ( fOption ) {
+		case SQL_CLOSE:
+			stub_close_cursor(stmt);
+			break;
+		case SQL_UNBIND:
+			memset(stmt->bindings, 0, sizeof(stub_binding) * stmt->num_bindings);
+			break;
+		case SQL_RESET_PARAMS:
+			memset(stmt->params, 0, sizeof(stub_param) * stmt->num_bound_params);
+			break;
+		case SQL_DROP:
+			return SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+	}
+	return SQL_SUCCESS;
+}
+
+/* Environment and connections */
+
+SQLRETURN SQL_API_FN SQLSetEnvAttr(SQLHENV henv, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER StringLength)
+{
+	return STUB_ENV(henv) == NULL ? SQL_INVALID_HANDLE : SQL_SUCCESS;
+}
+
+/*	static SQLRETURN stub_connect(stub_dbc *dbc, char *dsn, long latency)
+	connects to dsn after the call latency and latency more microseconds
+*/
+static SQLRETURN stub_connect(stub_dbc *dbc, char *dsn, long latency)
+{
+	if ( dsn == NULL ) {
+		return stub_error(&dbc->h, "HY001", "Memory allocation failure.");
+	}
+	if ( dbc->connected ) {
+		free(dsn);
+		return stub_error(&dbc->h, "08002", "Connection name in use.");
+	}
+	strncpy(dbc->dsn, dsn, STUB_STRING_LEN - 1);
+	free(dsn);
+	stub_sleep(stub_call_latency + latency);
+	dbc->connected = 1;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLConnectW(SQLHDBC hdbc, SQLWCHAR *szDSN, SQLSMALLINT cbDSN, SQLWCHAR *szUID, SQLSMALLINT cbUID, SQLWCHAR *szAuthStr, SQLSMALLINT cbAuthStr)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	dbc->h.diag.set = 0;
+	return stub_connect(dbc, stub_narrow(szDSN, cbDSN), 0);
+}
+
+SQLRETURN SQL_API_FN SQLDriverConnectW(SQLHDBC hdbc, SQLHWND hwnd, SQLWCHAR *szConnStrIn, SQLSMALLINT cbConnStrIn, SQLWCHAR *szConnStrOut, SQLSMALLINT cbConnStrOutMax, SQLSMALLINT *pcbConnStrOut, SQLUSMALLINT fDriverCompletion)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+	char *connstr, *dsn;
+	const char *value;
+	long latency = 0;
+	size_t n;
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	dbc->h.diag.set = 0;
+	connstr = stub_narrow(szConnStrIn, cbConnStrIn);
+	if ( connstr == NULL ) {
+		return stub_error(&dbc->h, "HY001", "Memory allocation failure.");
+	}
+	/* LATENCY of the string slows down this connect only */
+	if ( stub_option(connstr, "LATENCY", &value) ) {
+		latency = strtol(value, NULL, 10);
+	}
+	/* The data source name is the DATABASE keyword of the string */
+	if ( stub_option(connstr, "DATABASE", &value) || stub_option(connstr, "DSN", &value) ) {
+		n = strcspn(value, ";");
+		memmove(connstr, value, n);
+		connstr[n] = '\0';
+	}
+	dsn = connstr;
+	if ( pcbConnStrOut != NULL ) {
+		*pcbConnStrOut = 0;
+	}
+	return stub_connect(dbc, dsn, latency);
+}
+
+SQLRETURN SQL_API_FN SQLDisconnect(SQLHDBC hdbc)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	dbc->h.diag.set = 0;
+	if ( !dbc->connected ) {
+		return stub_error(&dbc->h, "08003", "Connection is closed.");
+	}
+	dbc->connected = 0;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLEndTran(SQLSMALLINT fHandleType, SQLHANDLE hHandle, SQLSMALLINT fType)
+{
+	stub_dbc *dbc;
+
+	if ( fHandleType == SQL_HANDLE_ENV ) {
+		return STUB_ENV(hHandle) == NULL ? SQL_INVALID_HANDLE : SQL_SUCCESS;
+	}
+	dbc = STUB_DBC(hHandle);
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	dbc->h.diag.set = 0;
+	if ( !dbc->connected ) {
+		return stub_error(&dbc->h, "08003", "Connection is closed.");
+	}
+	stub_sleep(stub_call_latency);
+	return SQL_SUCCESS;
+}
+
+static SQLRETURN stub_set_connect_attr(stub_dbc *dbc, SQLINTEGER Attribute, SQLPOINTER Value, char *string)
+{
+	int i;
+
+	dbc->h.diag.set = 0;
+	if ( Attribute == SQL_ATTR_AUTOCOMMIT ) {
+		dbc->autocommit = (SQLUINTEGER)(size_t)Value;
+	} else if ( Attribute == SQL_ATTR_QUERY_TIMEOUT ) {
+		dbc->query_timeout = (SQLUINTEGER)(size_t)Value;
+	} else if ( string != NULL ) {
+		/* Client information and other string attributes are kept for
+		 * SQLGetConnectAttr */
+		for ( i = 0; i < STUB_NUM_CONN_STRINGS; i++ ) {
+			if ( dbc->strings[i].attr == Attribute || dbc->strings[i].attr == 0 ) {
+				dbc->strings[i].attr = Attribute;
+				strncpy(dbc->strings[i].value, string, STUB_STRING_LEN - 1);
+				break;
+			}
+		}
+	}
+	/* Other attributes are accepted and have no effect */
+	free(string);
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLSetConnectAttr(SQLHDBC hdbc, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER StringLength)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	return stub_set_connect_attr(dbc, Attribute, Value, NULL);
+}
+
+SQLRETURN SQL_API_FN SQLSetConnectAttrW(SQLHDBC hdbc, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER StringLength)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+	char *string = NULL;
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	if ( Attribute != SQL_ATTR_AUTOCOMMIT && Attribute != SQL_ATTR_QUERY_TIMEOUT &&
+		 (StringLength == SQL_NTS || StringLength >= 0) ) {
+		string = stub_narrow((SQLWCHAR *)Value,
+			(StringLength == SQL_NTS) ? SQL_NTS : StringLength / (SQLINTEGER)sizeof(SQLWCHAR));
+	}
+	return stub_set_connect_attr(dbc, Attribute, Value, string);
+}
+
+SQLRETURN SQL_API_FN SQLGetConnectAttr(SQLHDBC hdbc, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER BufferLength, SQLINTEGER *StringLength)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+	const char *string = "";
+	int i;
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	dbc->h.diag.set = 0;
+	if ( Attribute == SQL_ATTR_AUTOCOMMIT ) {
+		*(SQLUINTEGER *)Value = dbc->autocommit;
+		return SQL_SUCCESS;
+	} else if ( Attribute == SQL_ATTR_QUERY_TIMEOUT ) {
+		*(SQLUINTEGER *)Value = dbc->query_timeout;
+		return SQL_SUCCESS;
+	} else if ( Attribute == SQL_ATTR_PING_DB ) {
+		if ( !dbc->connected ) {
+			return stub_error(&dbc->h, "08003", "Connection is closed.");
+		}
+		/* round trip time in microseconds */
+		stub_sleep(stub_call_latency);
+		*(SQLINTEGER *)Value = (stub_call_latency > 0) ? (SQLINTEGER)stub_call_latency : 1;
+		return SQL_SUCCESS;
+	}
+	for ( i = 0; i < STUB_NUM_CONN_STRINGS; i++ ) {
+		if ( dbc->strings[i].attr == Attribute ) {
+			string = dbc->strings[i].value;
+			break;
+		}
+	}
+	if ( stub_copy_string(string, Value, BufferLength, StringLength) ) {
+		return stub_warning(&dbc->h, "01004", "Data truncated.");
+	}
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLGetInfo(SQLHDBC hdbc, SQLUSMALLINT fInfoType, SQLPOINTER rgbInfoValue, SQLSMALLINT cbInfoValueMax, SQLSMALLINT *pcbInfoValue)
+{
+	stub_dbc *dbc = STUB_DBC(hdbc);
+	const char *string = NULL;
+	SQLUINTEGER number = 0;
+	SQLINTEGER length;
+	int truncated;
+
+	if ( dbc == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	dbc->h.diag.set = 0;
+	switch ( fInfoType ) {
+		case SQL_DBMS_NAME:
+			string = STUB_DBMS_NAME;
+			break;
+		case SQL_DBMS_VER:
+			string = STUB_DBMS_VER;
+			break;
+		case SQL_DATABASE_NAME:
+		case SQL_DATA_SOURCE_NAME:
+			string = dbc->dsn;
+			break;
+		case SQL_SERVER_NAME:
+			string = "STUB";
+			break;
+		case SQL_DRIVER_NAME:
+			string = "ibm_db_stubcli";
+			break;
+		case SQL_DRIVER_VER:
+			string = STUB_DBMS_VER;
+			break;
+		case SQL_DRIVER_ODBC_VER:
+		case SQL_ODBC_VER:
+			string = "03.51";
+			break;
+		case SQL_IDENTIFIER_QUOTE_CHAR:
+			string = "\"";
+			break;
+		case SQL_KEYWORDS:
+			string = "";
+			break;
+		case SQL_SPECIAL_CHARACTERS:
+			string = "@#$";
+			break;
+		case SQL_LIKE_ESCAPE_CLAUSE:
+		case SQL_PROCEDURES:
+			string = "Y";
+			break;
+		case SQL_DATABASE_CODEPAGE:
+		case SQL_APPLICATION_CODEPAGE:
+		case SQL_CONNECT_CODEPAGE:
+			number = STUB_CODEPAGE;
+			break;
+		case SQL_DEFAULT_TXN_ISOLATION:
+			number = SQL_TXN_READ_COMMITTED;
+			break;
+		case SQL_TXN_ISOLATION_OPTION:
+			number = SQL_TXN_READ_UNCOMMITTED | SQL_TXN_READ_COMMITTED |
+				SQL_TXN_REPEATABLE_READ | SQL_TXN_SERIALIZABLE;
+			break;
+		case SQL_ODBC_SQL_CONFORMANCE:
+			number = SQL_OSC_EXTENDED;
+			break;
+		case SQL_NON_NULLABLE_COLUMNS:
+			number = SQL_NNC_NON_NULL;
+			break;
+		case SQL_MAX_COLUMN_NAME_LEN:
+		case SQL_MAX_IDENTIFIER_LEN:
+		case SQL_MAX_PROCEDURE_NAME_LEN:
+		case SQL_MAX_SCHEMA_NAME_LEN:
+		case SQL_MAX_TABLE_NAME_LEN:
+			number = 128;
+			break;
+		case SQL_MAX_ROW_SIZE:
+			number = 32677;
+			break;
+		case SQL_MAX_INDEX_SIZE:
+			number = 1024;
+			break;
+		case SQL_MAX_STATEMENT_LEN:
+			number = 2097152;
+			break;
+		default:
+			return stub_error(&dbc->h, "HY096", "Information type out of range.");
+	}
+	if ( string != NULL ) {
+		truncated = stub_copy_string(string, rgbInfoValue, cbInfoValueMax, &length);
+		if ( pcbInfoValue != NULL ) {
+			*pcbInfoValue = (SQLSMALLINT)length;
+		}
+		return truncated ? stub_warning(&dbc->h, "01004", "Data truncated.") : SQL_SUCCESS;
+	}
+	/* ibm_db passes the size of its variable for the numeric items */
+	if ( cbInfoValueMax == sizeof(SQLUSMALLINT) ) {
+		*(SQLUSMALLINT *)rgbInfoValue = (SQLUSMALLINT)number;
+	} else {
+		*(SQLUINTEGER *)rgbInfoValue = number;
+	}
+	if ( pcbInfoValue != NULL ) {
+		*pcbInfoValue = (cbInfoValueMax == sizeof(SQLUSMALLINT)) ?
+			sizeof(SQLUSMALLINT) : sizeof(SQLUINTEGER);
+	}
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLGetFunctions(SQLHDBC hdbc, SQLUSMALLINT fFunction, SQLUSMALLINT *pfExists)
+{
+	if ( STUB_DBC(hdbc) == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	*pfExists = SQL_TRUE;
+	return SQL_SUCCESS;
+}
+
+/* Statement attributes */
+
+static SQLRETURN stub_set_stmt_attr(stub_stmt *stmt, SQLINTEGER Attribute, SQLPOINTER Value)
+{
+	SQLRETURN rc;
+
+	stmt->h.diag.set = 0;
+	if ( Attribute == SQL_ATTR_ROW_ARRAY_SIZE ) {
+		stmt->row_array_size = (SQLULEN)(size_t)Value;
+	} else if ( Attribute == SQL_ATTR_ROWS_FETCHED_PTR ) {
+		stmt->rows_fetched_ptr = (SQLULEN *)Value;
+	} else if ( Attribute == SQL_ATTR_CURSOR_TYPE ) {
+		stmt->cursor_type = (SQLUINTEGER)(size_t)Value;
+	} else if ( Attribute == SQL_ATTR_QUERY_TIMEOUT ) {
+		stmt->query_timeout = (SQLUINTEGER)(size_t)Value;
+	} else if ( Attribute == SQL_ATTR_ASYNC_ENABLE ) {
+		stmt->async_enable = (SQLUINTEGER)(size_t)Value;
+	} else if ( Attribute == SQL_ATTR_PARAMSET_SIZE ) {
+		stmt->paramset_size = (SQLULEN)(size_t)Value;
+	} else if ( Attribute == SQL_ATTR_PARAM_STATUS_PTR ) {
+		stmt->param_status_ptr = (SQLUSMALLINT *)Value;
+	} else if ( Attribute == SQL_ATTR_PARAMS_PROCESSED_PTR ) {
+		stmt->params_processed_ptr = (SQLULEN *)Value;
+	} else if ( Attribute == SQL_ATTR_PARAM_BIND_TYPE ) {
+		if ( (SQLULEN)(size_t)Value != SQL_PARAM_BIND_BY_COLUMN ) {
+			return stub_error(&stmt->h, "HYC00", "Driver not capable.");
+		}
+	} else if ( Attribute == SQL_ATTR_CHAINING_BEGIN ) {
+		stmt->chaining = 1;
+		stmt->chained = 0;
+	} else if ( Attribute == SQL_ATTR_CHAINING_END ) {
+		if ( !stmt->chaining ) {
+			return stub_error(&stmt->h, "HY010", "Function sequence error.");
+		}
+		/* the chained executes are sent at once */
+		stmt->chaining = 0;
+		rc = stub_wait(stmt, stub_call_latency + stub_execute_latency + stmt->latency);
+		if ( rc != SQL_SUCCESS ) {
+			return rc;
+		}
+		return stub_complete(stmt);
+	}
+	/* Other attributes are accepted and have no effect */
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLSetStmtAttr(SQLHSTMT hstmt, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER StringLength)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	return stub_set_stmt_attr(stmt, Attribute, Value);
+}
+
+SQLRETURN SQL_API_FN SQLSetStmtAttrW(SQLHSTMT hstmt, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER StringLength)
+{
+	return SQLSetStmtAttr(hstmt, Attribute, Value, StringLength);
+}
+
+SQLRETURN SQL_API_FN SQLGetStmtAttr(SQLHSTMT hstmt, SQLINTEGER Attribute, SQLPOINTER Value, SQLINTEGER BufferLength, SQLINTEGER *StringLength)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( Attribute == SQL_ATTR_CURSOR_TYPE ) {
+		*(SQLUINTEGER *)Value = stmt->cursor_type;
+	} else if ( Attribute == SQL_ATTR_QUERY_TIMEOUT ) {
+		*(SQLUINTEGER *)Value = stmt->query_timeout;
+	} else if ( Attribute == SQL_ATTR_ASYNC_ENABLE ) {
+		*(SQLUINTEGER *)Value = stmt->async_enable;
+	} else if ( Attribute == SQL_ATTR_ROW_ARRAY_SIZE ) {
+		*(SQLULEN *)Value = stmt->row_array_size;
+	} else if ( Attribute == SQL_ATTR_PARAMSET_SIZE ) {
+		*(SQLULEN *)Value = stmt->paramset_size;
+	} else if ( Attribute == SQL_ATTR_GET_GENERATED_VALUE ) {
+		/* no identity columns */
+		stub_copy_string("", Value, BufferLength, StringLength);
+	} else {
+		return stub_error(&stmt->h, "HY092", "Option type out of range.");
+	}
+	return SQL_SUCCESS;
+}
+
+/* Statements */
+
+SQLRETURN SQL_API_FN SQLPrepareW(SQLHSTMT hstmt, SQLWCHAR *szSqlStr, SQLINTEGER cbSqlStr)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	stmt->canceled = 0;
+	return stub_prepare(stmt, stub_narrow(szSqlStr, cbSqlStr));
+}
+
+SQLRETURN SQL_API_FN SQLExecDirect(SQLHSTMT hstmt, SQLCHAR *szSqlStr, SQLINTEGER cbSqlStr)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	char *sql;
+	SQLRETURN rc;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( cbSqlStr == SQL_NTS ) {
+		cbSqlStr = (SQLINTEGER)strlen((char *)szSqlStr);
+	}
+	sql = (char *)malloc(cbSqlStr + 1);
+	if ( sql != NULL ) {
+		memcpy(sql, szSqlStr, cbSqlStr);
+		sql[cbSqlStr] = '\0';
+	}
+	stmt->canceled = 0;
+	rc = stub_prepare(stmt, sql);
+	if ( rc == SQL_ERROR ) {
+		return rc;
+	}
+	return stub_execute(stmt);
+}
+
+SQLRETURN SQL_API_FN SQLExecDirectW(SQLHSTMT hstmt, SQLWCHAR *szSqlStr, SQLINTEGER cbSqlStr)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	SQLRETURN rc;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	stmt->canceled = 0;
+	rc = stub_prepare(stmt, stub_narrow(szSqlStr, cbSqlStr));
+	if ( rc == SQL_ERROR ) {
+		return rc;
+	}
+	return stub_execute(stmt);
+}
+
+SQLRETURN SQL_API_FN SQLExecute(SQLHSTMT hstmt)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_execute(stmt);
+}
+
+SQLRETURN SQL_API_FN SQLCancel(SQLHSTMT hstmt)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	if ( stmt->need_data ) {
+		/* ends the data at execute sequence */
+		stmt->need_data = 0;
+		return SQL_SUCCESS;
+	}
+	stmt->canceled = 1;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLParamData(SQLHSTMT hstmt, SQLPOINTER *prgbValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	int next;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( !stmt->need_data ) {
+		return stub_error(&stmt->h, "HY010", "Function sequence error.");
+	}
+	next = stub_next_data_param(stmt, stmt->data_param + 1);
+	if ( next >= 0 ) {
+		stmt->data_param = next;
+		*prgbValue = stmt->params[next].value;
+		return SQL_NEED_DATA;
+	}
+	stmt->need_data = 0;
+	return stub_run(stmt);
+}
+
+SQLRETURN SQL_API_FN SQLPutData(SQLHSTMT hstmt, SQLPOINTER rgbValue, SQLLEN cbValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( !stmt->need_data || stmt->data_param < 0 ) {
+		return stub_error(&stmt->h, "HY010", "Function sequence error.");
+	}
+	if ( cbValue > 0 && rgbValue == NULL ) {
+		return stub_error(&stmt->h, "HY009", "Invalid argument value.");
+	}
+	/* the data is sent to nowhere */
+	return stub_wait(stmt, stub_call_latency);
+}
+
+SQLRETURN SQL_API_FN SQLNumParams(SQLHSTMT hstmt, SQLSMALLINT *pcpar)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	*pcpar = (SQLSMALLINT)stmt->num_params;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLDescribeParam(SQLHSTMT hstmt, SQLUSMALLINT ipar, SQLSMALLINT *pfSqlType, SQLULEN *pcbParamDef, SQLSMALLINT *pibScale, SQLSMALLINT *pfNullable)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_column *param;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( ipar < 1 || ipar > stmt->num_params ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	param = (stmt->param_types != NULL) ? &stmt->param_types[ipar - 1] : NULL;
+	if ( pfSqlType != NULL ) {
+		*pfSqlType = param ? param->type : SQL_VARCHAR;
+	}
+	if ( pcbParamDef != NULL ) {
+		*pcbParamDef = param ? param->size : STUB_DEFAULT_PARAM_SIZE;
+	}
+	if ( pibScale != NULL ) {
+		*pibScale = param ? param->scale : 0;
+	}
+	if ( pfNullable != NULL ) {
+		*pfNullable = SQL_NULLABLE;
+	}
+	return SQL_SUCCESS;
+}
+
+static stub_param *stub_get_param(stub_stmt *stmt, SQLUSMALLINT ipar)
+{
+	stub_param *params;
+	int i;
+
+	if ( ipar > stmt->num_bound_params ) {
+		params = (stub_param *)realloc(stmt->params, sizeof(stub_param) * ipar);
+		if ( params == NULL ) {
+			return NULL;
+		}
+		for ( i = stmt->num_bound_params; i < ipar; i++ ) {
+			memset(&params[i], 0, sizeof(stub_param));
+		}
+		stmt->params = params;
+		stmt->num_bound_params = ipar;
+	}
+	return &stmt->params[ipar - 1];
+}
+
+SQLRETURN SQL_API_FN SQLBindParameter(SQLHSTMT hstmt, SQLUSMALLINT ipar, SQLSMALLINT fParamType, SQLSMALLINT fCType, SQLSMALLINT fSqlType, SQLULEN cbColDef, SQLSMALLINT ibScale, SQLPOINTER rgbValue, SQLLEN cbValueMax, SQLLEN *pcbValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_param *param;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( ipar < 1 ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	param = stub_get_param(stmt, ipar);
+	if ( param == NULL ) {
+		return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+	}
+	param->bound = 1;
+	param->ctype = fCType;
+	param->value = rgbValue;
+	param->ind = pcbValue;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLBindFileToParam(SQLHSTMT hstmt, SQLUSMALLINT ipar, SQLSMALLINT fSqlType, SQLCHAR *FileName, SQLSMALLINT *FileNameLength, SQLUINTEGER *FileOptions, SQLSMALLINT MaxFileNameLength, SQLINTEGER *IndicatorValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_param *param;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( ipar < 1 ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	param = stub_get_param(stmt, ipar);
+	if ( param == NULL ) {
+		return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+	}
+	/* the file is not read */
+	param->bound = 1;
+	param->ctype = SQL_C_CHAR;
+	param->value = FileName;
+	param->ind = NULL;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLRowCount(SQLHSTMT hstmt, SQLLEN *pcrow)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	*pcrow = stmt->row_count;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLNextResult(SQLHSTMT hstmtSource, SQLHSTMT hstmtTarget)
+{
+	stub_stmt *stmt = STUB_STMT(hstmtSource);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	/* a single result set per statement */
+	return SQL_NO_DATA_FOUND;
+}
+
+/* Result sets */
+
+SQLRETURN SQL_API_FN SQLNumResultCols(SQLHSTMT hstmt, SQLSMALLINT *pccol)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	*pccol = (SQLSMALLINT)(stmt->is_query ? stmt->num_columns : 0);
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLDescribeCol(SQLHSTMT hstmt, SQLUSMALLINT icol, SQLCHAR *szColName, SQLSMALLINT cbColNameMax, SQLSMALLINT *pcbColName, SQLSMALLINT *pfSqlType, SQLULEN *pcbColDef, SQLSMALLINT *pibScale, SQLSMALLINT *pfNullable)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_column *column;
+	SQLINTEGER length;
+	int truncated;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( !stmt->is_query || icol < 1 || icol > stmt->num_columns ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	column = &stmt->columns[icol - 1];
+	truncated = stub_copy_string(column->name, szColName, cbColNameMax, &length);
+	if ( pcbColName != NULL ) {
+		*pcbColName = (SQLSMALLINT)length;
+	}
+	if ( pfSqlType != NULL ) {
+		*pfSqlType = column->type;
+	}
+	if ( pcbColDef != NULL ) {
+		*pcbColDef = column->size;
+	}
+	if ( pibScale != NULL ) {
+		*pibScale = column->scale;
+	}
+	if ( pfNullable != NULL ) {
+		*pfNullable = SQL_NULLABLE;
+	}
+	return truncated ? stub_warning(&stmt->h, "01004", "Data truncated.") : SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLColAttributes(SQLHSTMT hstmt, SQLUSMALLINT icol, SQLUSMALLINT fDescType, SQLPOINTER rgbDesc, SQLSMALLINT cbDescMax, SQLSMALLINT *pcbDesc, SQLLEN *pfDesc)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_column *column;
+	SQLLEN value;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( !stmt->is_query || icol < 1 || icol > stmt->num_columns ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	column = &stmt->columns[icol - 1];
+	switch ( column->type ) {
+		case SQL_SMALLINT:
+			value = (fDescType == SQL_DESC_DISPLAY_SIZE) ? 6 : 2;
+			break;
+		case SQL_INTEGER:
+			value = (fDescType == SQL_DESC_DISPLAY_SIZE) ? 11 : 4;
+			break;
+		case SQL_BIGINT:
+			value = (fDescType == SQL_DESC_DISPLAY_SIZE) ? 20 : 8;
+			break;
+		case SQL_REAL:
+			value = (fDescType == SQL_DESC_DISPLAY_SIZE) ? 14 : 4;
+			break;
+		case SQL_DOUBLE:
+			value = (fDescType == SQL_DESC_DISPLAY_SIZE) ? 24 : 8;
+			break;
+		case SQL_DECIMAL:
+			value = (SQLLEN)column->size + ((fDescType == SQL_DESC_DISPLAY_SIZE) ? 2 : 0);
+			break;
+		case SQL_BINARY:
+		case SQL_VARBINARY:
+		case SQL_BLOB:
+			value = (SQLLEN)column->size * ((fDescType == SQL_DESC_DISPLAY_SIZE) ? 2 : 1);
+			break;
+		default:
+			value = (SQLLEN)column->size;
+			break;
+	}
+	if ( fDescType != SQL_DESC_DISPLAY_SIZE && fDescType != SQL_DESC_LENGTH ) {
+		return stub_error(&stmt->h, "HY091", "Invalid descriptor field identifier.");
+	}
+	if ( pfDesc != NULL ) {
+		*pfDesc = value;
+	}
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLBindCol(SQLHSTMT hstmt, SQLUSMALLINT icol, SQLSMALLINT fCType, SQLPOINTER rgbValue, SQLLEN cbValueMax, SQLLEN *pcbValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_binding *bindings;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( icol < 1 || icol > STUB_MAX_COLUMNS ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	if ( icol > stmt->num_bindings ) {
+		bindings = (stub_binding *)realloc(stmt->bindings, sizeof(stub_binding) * icol);
+		if ( bindings == NULL ) {
+			return stub_error(&stmt->h, "HY001", "Memory allocation failure.");
+		}
+		memset(bindings + stmt->num_bindings, 0, sizeof(stub_binding) * (icol - stmt->num_bindings));
+		stmt->bindings = bindings;
+		stmt->num_bindings = icol;
+	}
+	stmt->bindings[icol - 1].ctype = fCType;
+	stmt->bindings[icol - 1].buffer = rgbValue;
+	stmt->bindings[icol - 1].buffer_length = cbValueMax;
+	stmt->bindings[icol - 1].ind = pcbValue;
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLFetch(SQLHSTMT hstmt)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_fetch(stmt, SQL_FETCH_NEXT, 0);
+}
+
+SQLRETURN SQL_API_FN SQLFetchScroll(SQLHSTMT hstmt, SQLSMALLINT fFetchOrientation, SQLLEN FetchOffset)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_fetch(stmt, fFetchOrientation, FetchOffset);
+}
+
+SQLRETURN SQL_API_FN SQLGetData(SQLHSTMT hstmt, SQLUSMALLINT icol, SQLSMALLINT fCType, SQLPOINTER rgbValue, SQLLEN cbValueMax, SQLLEN *pcbValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	SQLRETURN rc;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	if ( !stmt->cursor_open || stmt->rowset_length == 0 ) {
+		return stub_error(&stmt->h, "24000", "Invalid cursor state.");
+	}
+	if ( icol < 1 || icol > stmt->num_columns ) {
+		return stub_error(&stmt->h, "07009", "Invalid descriptor index.");
+	}
+	if ( icol != stmt->getdata_col ) {
+		/* the first part of a value */
+		stmt->getdata_col = icol;
+		stmt->getdata_offset = 0;
+	} else if ( stmt->getdata_offset < 0 ) {
+		return SQL_NO_DATA_FOUND;
+	}
+	rc = stub_wait(stmt, stub_call_latency);
+	if ( rc != SQL_SUCCESS ) {
+		return rc;
+	}
+	/* values of the first row of the rowset */
+	return stub_put_value(stmt, icol - 1, stmt->rowset_start, fCType, rgbValue,
+		cbValueMax, pcbValue, &stmt->getdata_offset);
+}
+
+/* LOB locators */
+
+SQLRETURN SQL_API_FN SQLGetLength(SQLHSTMT hstmt, SQLSMALLINT LocatorCType, SQLINTEGER Locator, SQLINTEGER *StringLength, SQLINTEGER *IndicatorValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_locator *loc;
+	SQLRETURN rc;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	loc = stub_find_locator(stmt->dbc, Locator);
+	if ( loc == NULL ) {
+		return stub_error(&stmt->h, "0F001", "The LOB token variable does not currently represent any value.");
+	}
+	rc = stub_wait(stmt, stub_call_latency);
+	if ( rc != SQL_SUCCESS ) {
+		return rc;
+	}
+	if ( StringLength != NULL ) {
+		*StringLength = loc->length;
+	}
+	if ( IndicatorValue != NULL ) {
+		*IndicatorValue = 0;
+	}
+	return SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLGetSubString(SQLHSTMT hstmt, SQLSMALLINT LocatorCType, SQLINTEGER SourceLocator, SQLUINTEGER FromPosition, SQLUINTEGER ForLength, SQLSMALLINT TargetCType, SQLPOINTER DataPtr, SQLINTEGER BufferLength, SQLINTEGER *StringLength, SQLINTEGER *IndicatorValue)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+	stub_locator *loc, part;
+	SQLLEN length = 0;
+	SQLRETURN rc;
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	loc = stub_find_locator(stmt->dbc, SourceLocator);
+	if ( loc == NULL ) {
+		return stub_error(&stmt->h, "0F001", "The LOB token variable does not currently represent any value.");
+	}
+	if ( FromPosition < 1 || FromPosition > (SQLUINTEGER)loc->length + 1 ) {
+		return stub_error(&stmt->h, "22011", "A substring error occurred.");
+	}
+	rc = stub_wait(stmt, stub_call_latency);
+	if ( rc != SQL_SUCCESS ) {
+		return rc;
+	}
+	/* the part of the value read, ForLength is cut at the end of the value */
+	part = *loc;
+	part.row = loc->row + (FromPosition - 1);
+	if ( ForLength > (SQLUINTEGER)loc->length - (FromPosition - 1) ) {
+		ForLength = (SQLUINTEGER)loc->length - (FromPosition - 1);
+	}
+	part.length = (SQLINTEGER)ForLength;
+	rc = stub_copy_data(&stmt->h, NULL, &part, part.length, TargetCType, DataPtr,
+		BufferLength, &length, NULL);
+	if ( StringLength != NULL ) {
+		*StringLength = (SQLINTEGER)length;
+	}
+	if ( IndicatorValue != NULL ) {
+		*IndicatorValue = 0;
+	}
+	return rc;
+}
+
+/* Diagnostics */
+
+SQLRETURN SQL_API_FN SQLGetDiagRec(SQLSMALLINT fHandleType, SQLHANDLE hHandle, SQLSMALLINT iRecord, SQLCHAR *szSqlState, SQLINTEGER *pfNativeError, SQLCHAR *szErrorMsg, SQLSMALLINT cbErrorMsgMax, SQLSMALLINT *pcbErrorMsg)
+{
+	stub_handle *h = stub_lookup(hHandle, fHandleType);
+	SQLINTEGER length;
+	int truncated;
+
+	if ( h == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	if ( iRecord != 1 || !h->diag.set ) {
+		return SQL_NO_DATA_FOUND;
+	}
+	if ( szSqlState != NULL ) {
+		memcpy(szSqlState, h->diag.sqlstate, SQL_SQLSTATE_SIZE + 1);
+	}
+	if ( pfNativeError != NULL ) {
+		*pfNativeError = h->diag.native;
+	}
+	truncated = stub_copy_string(h->diag.message, szErrorMsg, cbErrorMsgMax, &length);
+	if ( pcbErrorMsg != NULL ) {
+		*pcbErrorMsg = (SQLSMALLINT)length;
+	}
+	return truncated ? SQL_SUCCESS_WITH_INFO : SQL_SUCCESS;
+}
+
+SQLRETURN SQL_API_FN SQLGetDiagField(SQLSMALLINT fHandleType, SQLHANDLE hHandle, SQLSMALLINT iRecord, SQLSMALLINT fDiagField, SQLPOINTER rgbDiagInfo, SQLSMALLINT cbDiagInfoMax, SQLSMALLINT *pcbDiagInfo)
+{
+	stub_handle *h = stub_lookup(hHandle, fHandleType);
+	stub_stmt *stmt;
+
+	if ( h == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	if ( fDiagField == SQL_DIAG_NUMBER ) {
+		*(SQLINTEGER *)rgbDiagInfo = h->diag.set ? 1 : 0;
+	} else if ( fDiagField == SQL_DIAG_CURSOR_ROW_COUNT && fHandleType == SQL_HANDLE_STMT ) {
+		stmt = (stub_stmt *)h;
+		*(SQLINTEGER *)rgbDiagInfo = stmt->cursor_open ? (SQLINTEGER)stmt->rows : 0;
+	} else if ( fDiagField == SQL_DIAG_ROW_NUMBER ) {
+		if ( iRecord != 1 || !h->diag.set ) {
+			return SQL_NO_DATA_FOUND;
+		}
+		/* errors are not tied to a row of the parameter set */
+		*(SQLINTEGER *)rgbDiagInfo = 0;
+	} else {
+		return SQL_ERROR;
+	}
+	return SQL_SUCCESS;
+}
+
+/* Catalog functions, all returning empty result sets */
+
+SQLRETURN SQL_API_FN SQLTablesW(SQLHSTMT hstmt, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName, SQLWCHAR *szTableType, SQLSMALLINT cbTableType)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "TABLE_CAT,TABLE_SCHEM,TABLE_NAME,TABLE_TYPE,REMARKS");
+}
+
+SQLRETURN SQL_API_FN SQLTablePrivilegesW(SQLHSTMT hstmt, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "TABLE_CAT,TABLE_SCHEM,TABLE_NAME,GRANTOR,GRANTEE,PRIVILEGE,IS_GRANTABLE");
+}
+
+SQLRETURN SQL_API_FN SQLColumnsW(SQLHSTMT hstmt, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName, SQLWCHAR *szColumnName, SQLSMALLINT cbColumnName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "TABLE_CAT,TABLE_SCHEM,TABLE_NAME,COLUMN_NAME,DATA_TYPE,"
+		"TYPE_NAME,COLUMN_SIZE,BUFFER_LENGTH,DECIMAL_DIGITS,NUM_PREC_RADIX,NULLABLE,"
+		"REMARKS,COLUMN_DEF,SQL_DATA_TYPE,SQL_DATETIME_SUB,CHAR_OCTET_LENGTH,"
+		"ORDINAL_POSITION,IS_NULLABLE");
+}
+
+SQLRETURN SQL_API_FN SQLColumnPrivilegesW(SQLHSTMT hstmt, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName, SQLWCHAR *szColumnName, SQLSMALLINT cbColumnName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "TABLE_CAT,TABLE_SCHEM,TABLE_NAME,COLUMN_NAME,GRANTOR,"
+		"GRANTEE,PRIVILEGE,IS_GRANTABLE");
+}
+
+SQLRETURN SQL_API_FN SQLPrimaryKeysW(SQLHSTMT hstmt, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "TABLE_CAT,TABLE_SCHEM,TABLE_NAME,COLUMN_NAME,KEY_SEQ,PK_NAME");
+}
+
+SQLRETURN SQL_API_FN SQLForeignKeysW(SQLHSTMT hstmt, SQLWCHAR *szPkCatalogName, SQLSMALLINT cbPkCatalogName, SQLWCHAR *szPkSchemaName, SQLSMALLINT cbPkSchemaName, SQLWCHAR *szPkTableName, SQLSMALLINT cbPkTableName, SQLWCHAR *szFkCatalogName, SQLSMALLINT cbFkCatalogName, SQLWCHAR *szFkSchemaName, SQLSMALLINT cbFkSchemaName, SQLWCHAR *szFkTableName, SQLSMALLINT cbFkTableName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "PKTABLE_CAT,PKTABLE_SCHEM,PKTABLE_NAME,PKCOLUMN_NAME,"
+		"FKTABLE_CAT,FKTABLE_SCHEM,FKTABLE_NAME,FKCOLUMN_NAME,KEY_SEQ,UPDATE_RULE,"
+		"DELETE_RULE,FK_NAME,PK_NAME,DEFERRABILITY");
+}
+
+SQLRETURN SQL_API_FN SQLProceduresW(SQLHSTMT hstmt, SQLWCHAR *szProcCatalog, SQLSMALLINT cbProcCatalog, SQLWCHAR *szProcSchema, SQLSMALLINT cbProcSchema, SQLWCHAR *szProcName, SQLSMALLINT cbProcName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "PROCEDURE_CAT,PROCEDURE_SCHEM,PROCEDURE_NAME,"
+		"NUM_INPUT_PARAMS,NUM_OUTPUT_PARAMS,NUM_RESULT_SETS,REMARKS,PROCEDURE_TYPE");
+}
+
+SQLRETURN SQL_API_FN SQLProcedureColumnsW(SQLHSTMT hstmt, SQLWCHAR *szProcCatalog, SQLSMALLINT cbProcCatalog, SQLWCHAR *szProcSchema, SQLSMALLINT cbProcSchema, SQLWCHAR *szProcName, SQLSMALLINT cbProcName, SQLWCHAR *szColumnName, SQLSMALLINT cbColumnName)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "PROCEDURE_CAT,PROCEDURE_SCHEM,PROCEDURE_NAME,COLUMN_NAME,"
+		"COLUMN_TYPE,DATA_TYPE,TYPE_NAME,COLUMN_SIZE,BUFFER_LENGTH,DECIMAL_DIGITS,"
+		"NUM_PREC_RADIX,NULLABLE,REMARKS,COLUMN_DEF,SQL_DATA_TYPE,SQL_DATETIME_SUB,"
+		"CHAR_OCTET_LENGTH,ORDINAL_POSITION,IS_NULLABLE");
+}
+
+SQLRETURN SQL_API_FN SQLSpecialColumnsW(SQLHSTMT hstmt, SQLUSMALLINT fColType, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName, SQLUSMALLINT fScope, SQLUSMALLINT fNullable)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "SCOPE,COLUMN_NAME,DATA_TYPE,TYPE_NAME,COLUMN_SIZE,"
+		"BUFFER_LENGTH,DECIMAL_DIGITS,PSEUDO_COLUMN");
+}
+
+SQLRETURN SQL_API_FN SQLStatisticsW(SQLHSTMT hstmt, SQLWCHAR *szCatalogName, SQLSMALLINT cbCatalogName, SQLWCHAR *szSchemaName, SQLSMALLINT cbSchemaName, SQLWCHAR *szTableName, SQLSMALLINT cbTableName, SQLUSMALLINT fUnique, SQLUSMALLINT fAccuracy)
+{
+	stub_stmt *stmt = STUB_STMT(hstmt);
+
+	if ( stmt == NULL ) {
+		return SQL_INVALID_HANDLE;
+	}
+	stmt->h.diag.set = 0;
+	return stub_catalog(stmt, "TABLE_CAT,TABLE_SCHEM,TABLE_NAME,NON_UNIQUE,"
+		"INDEX_QUALIFIER,INDEX_NAME,TYPE,ORDINAL_POSITION,COLUMN_NAME,ASC_OR_DESC,"
+		"CARDINALITY,PAGES,FILTER_CONDITION");
+}
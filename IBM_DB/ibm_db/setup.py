@@ -3,7 +3,10 @@ import sys
 import struct
 import warnings
 from setuptools import setup, find_packages
-from distutils.core import setup, Extension
+from distutils.core import setup, Extension, Command
+from distutils.ccompiler import new_compiler
+from distutils.sysconfig import customize_compiler
+from distutils.errors import DistutilsPlatformError
 
 PACKAGE = 'ibm_db'
 VERSION = '1.0.6'
@@ -57,11 +60,54 @@ library = ['db2']
 if (sys.platform[0:3] == 'win'):
   library = ['db2cli']
 
+sources = ['ibm_db.c', 'ibm_db_arrow.c']
+# IBM_DB_STUB_CLI builds the driver with the stub CLI of ibm_db_stubcli.c in
+# place of libdb2, for benchmarks and tests run without a database
+if os.environ.has_key('IBM_DB_STUB_CLI'):
+  print "Building with the stub CLI, the driver will not connect to a database\n"
+  sources.append('ibm_db_stubcli.c')
+  library = []
+  if (sys.platform[0:3] != 'win'):
+    library = ['pthread']
+
+# python setup.py build_stub_cli builds the stub CLI as a library replacing
+# libdb2 for an extension built as usual, run it with LD_LIBRARY_PATH=stub
+class build_stub_cli(Command):
+  description = "build the stub CLI of ibm_db_stubcli.c as stub/libdb2.so.1"
+  user_options = [('build-dir=', 'b', "directory of the library [default: stub]")]
+
+  def initialize_options(self):
+    self.build_dir = None
+
+  def finalize_options(self):
+    if self.build_dir is None:
+      self.build_dir = 'stub'
+
+  def run(self):
+    if (sys.platform[0:3] == 'win'):
+      raise DistutilsPlatformError("the stub CLI library is built on Unix only, use IBM_DB_STUB_CLI=1")
+    compiler = new_compiler(verbose=self.verbose, dry_run=self.dry_run, force=self.force)
+    customize_compiler(compiler)
+    objects = compiler.compile(['ibm_db_stubcli.c'],
+                               output_dir = os.path.join(self.build_dir, 'obj'),
+                               include_dirs = [ibm_db_dir + '/include'])
+    soname = 'libdb2.so.1'
+    link_args = ['-Wl,-soname,' + soname]
+    if (sys.platform == 'darwin'):
+      soname = 'libdb2.dylib'
+      link_args = ['-install_name', '@rpath/' + soname]
+    compiler.link_shared_object(objects, soname, output_dir = self.build_dir,
+                                libraries = ['pthread'], extra_postargs = link_args)
+    # libdb2.so for linking an extension with -L stub
+    link = os.path.join(self.build_dir, 'libdb2.so')
+    if (soname != 'libdb2.dylib' and not self.dry_run and not os.path.exists(link)):
+      os.symlink(soname, link)
+
 ibm_db = Extension('ibm_db',
                     include_dirs = [ibm_db_dir + '/include'],
                     libraries = library,
                     library_dirs = [ibm_db_lib],
-                    sources = ['ibm_db.c'])
+                    sources = sources)
 
 modules = ['config', 'ibm_db_dbi', 'testfunctions', 'tests']
 
@@ -86,6 +132,7 @@ setup( name    = PACKAGE,
                       The extension supports DB2 (LUW, zOS, i5) and IDS (Informix Dynamic Server)''',
        platforms = 'LinuxIA32, Win32',
        ext_modules  = [ibm_db],
+       cmdclass     = {'build_stub_cli': build_stub_cli},
        py_modules   = modules,
        packages     = find_packages(),
        package_data = { 'tests': [ '*.png', '*.jpg']},
@@ -106,6 +106,14 @@ class IbmDbTestFunctions(unittest.TestCase):
     finally:
       del callstack
       
+  # This function tells if the driver was built with the stub CLI of
+  #   ibm_db_stubcli.c, for the tests that need its simulated latency.
+  def stub_cli(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    client = ibm_db.client_info(conn)
+    ibm_db.close(conn)
+    return client.DRIVER_NAME == "ibm_db_stubcli"
+
   #def assert_throw_blocks(self, testFuncName):
   #  callstack = inspect.stack(0)
   #  try:
@@ -22,7 +22,8 @@ class IbmDbTestCase(unittest.TestCase):
       pconn[i] = ibm_db.pconnect(config.database, config.user, config.password)
     
     if pconn[33]:
-      conn = pconn[22]
+      # Pooled connections are distinct, roll back on the one that updated
+      conn = pconn[33]
       ibm_db.autocommit(conn, ibm_db.SQL_AUTOCOMMIT_OFF)
       stmt = ibm_db.exec_immediate(pconn[33], "UPDATE animals SET name = 'flyweight' WHERE weight < 10.0")
       print "Number of affected rows:", ibm_db.num_rows( stmt )
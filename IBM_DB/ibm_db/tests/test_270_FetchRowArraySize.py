@@ -0,0 +1,86 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_270_FetchRowArraySize(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_270)
+
+  def run_test_270(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.prepare(conn, "SELECT id, breed FROM animals ORDER BY id", {ibm_db.SQL_ATTR_ROW_ARRAY_SIZE : 3, ibm_db.ATTR_CASE : ibm_db.CASE_UPPER})
+      print "row array size:", ibm_db.get_option(stmt, ibm_db.SQL_ATTR_ROW_ARRAY_SIZE, 0)
+      ibm_db.execute(stmt)
+      row = ibm_db.fetch_tuple(stmt)
+      while ( row ):
+        print row[0], row[1]
+        row = ibm_db.fetch_assoc(stmt)
+        if row:
+          print row['ID'], row['BREED']
+          row = ibm_db.fetch_tuple(stmt)
+
+      # Executing again starts from a new block
+      ibm_db.execute(stmt)
+      row = ibm_db.fetch_tuple(stmt)
+      print row[0], row[1]
+      ibm_db.set_option(stmt, {ibm_db.SQL_ATTR_ROW_ARRAY_SIZE : 1}, 0)
+      print "row array size:", ibm_db.get_option(stmt, ibm_db.SQL_ATTR_ROW_ARRAY_SIZE, 0)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#row array size: 3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#4 budgerigar
+#5 goat
+#6 llama
+#0 cat
+#row array size: 1
+#__ZOS_EXPECTED__
+#row array size: 3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#4 budgerigar
+#5 goat
+#6 llama
+#0 cat
+#row array size: 1
+#__SYSTEMI_EXPECTED__
+#row array size: 3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#4 budgerigar
+#5 goat
+#6 llama
+#0 cat
+#row array size: 1
+#__IDS_EXPECTED__
+#row array size: 3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#4 budgerigar
+#5 goat
+#6 llama
+#0 cat
+#row array size: 1
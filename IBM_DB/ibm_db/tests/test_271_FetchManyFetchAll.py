@@ -0,0 +1,86 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_271_FetchManyFetchAll(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_271)
+
+  def run_test_271(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.exec_immediate(conn, "SELECT id, breed FROM animals ORDER BY id")
+      rows = ibm_db.fetch_many(stmt, 3)
+      print len(rows)
+      for row in rows:
+        print row[0], row[1]
+      row = ibm_db.fetch_tuple(stmt)
+      print row[0], row[1]
+      rows = ibm_db.fetch_all(stmt)
+      print len(rows)
+      for row in rows:
+        print row[0], row[1]
+      print ibm_db.fetch_many(stmt, 3)
+      print ibm_db.fetch_all(stmt)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#3
+#4 budgerigar
+#5 goat
+#6 llama
+#[]
+#[]
+#__ZOS_EXPECTED__
+#3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#3
+#4 budgerigar
+#5 goat
+#6 llama
+#[]
+#[]
+#__SYSTEMI_EXPECTED__
+#3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#3
+#4 budgerigar
+#5 goat
+#6 llama
+#[]
+#[]
+#__IDS_EXPECTED__
+#3
+#0 cat
+#1 dog
+#2 horse
+#3 gold fish
+#3
+#4 budgerigar
+#5 goat
+#6 llama
+#[]
+#[]
@@ -0,0 +1,87 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_272_FetchColumns(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_272)
+
+  def run_test_272(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.exec_immediate(conn, "SELECT id, NULLIF(id, 1), CAST(weight AS DOUBLE), breed FROM animals ORDER BY id")
+      columns, nulls = ibm_db.fetch_columns(stmt, 3)
+      print columns[0].typecode, columns[1].typecode, columns[2].typecode
+      print columns[0].tolist()
+      print columns[1].tolist(), nulls[1].tolist()
+      print columns[2].tolist()
+      for breed in columns[3]:
+        print breed
+      print nulls[3].tolist()
+      columns, nulls = ibm_db.fetch_columns(stmt)
+      print columns[0].tolist()
+      print len(columns[3]), len(nulls[3])
+      columns, nulls = ibm_db.fetch_columns(stmt)
+      print len(columns[0]), len(columns[3])
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#l l d
+#[0, 1, 2]
+#[0, 0, 2] [0, 1, 0]
+#[3.2, 12.3, 350.0]
+#cat
+#dog
+#horse
+#[0, 0, 0]
+#[3, 4, 5, 6]
+#4 4
+#0 0
+#__ZOS_EXPECTED__
+#l l d
+#[0, 1, 2]
+#[0, 0, 2] [0, 1, 0]
+#[3.2, 12.3, 350.0]
+#cat
+#dog
+#horse
+#[0, 0, 0]
+#[3, 4, 5, 6]
+#4 4
+#0 0
+#__SYSTEMI_EXPECTED__
+#l l d
+#[0, 1, 2]
+#[0, 0, 2] [0, 1, 0]
+#[3.2, 12.3, 350.0]
+#cat
+#dog
+#horse
+#[0, 0, 0]
+#[3, 4, 5, 6]
+#4 4
+#0 0
+#__IDS_EXPECTED__
+#l l d
+#[0, 1, 2]
+#[0, 0, 2] [0, 1, 0]
+#[3.2, 12.3, 350.0]
+#cat
+#dog
+#horse
+#[0, 0, 0]
+#[3, 4, 5, 6]
+#4 4
+#0 0
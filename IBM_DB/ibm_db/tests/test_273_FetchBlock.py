@@ -0,0 +1,86 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_273_FetchBlock(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_273)
+
+  def run_test_273(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.prepare(conn, "SELECT id, NULLIF(id, 1), breed FROM animals ORDER BY id", {ibm_db.SQL_ATTR_ROW_ARRAY_SIZE : 3})
+      ibm_db.execute(stmt)
+      first = ibm_db.fetch_block(stmt)
+      view = memoryview(first[0])
+      print first[0].format, view.format, view.itemsize, view.shape, view.strides, view.readonly
+      print list(first[0])
+      print [ind == ibm_db.SQL_NULL_DATA for ind in first[1].indicators]
+      for breed in first[2]:
+        print breed
+      row = ibm_db.fetch_tuple(stmt)
+      print row[0], row[2]
+      block = ibm_db.fetch_block(stmt)
+      while ( block ):
+        print list(block[0]), list(block[1])
+        block = ibm_db.fetch_block(stmt)
+      # The first block still owns its values
+      print list(first[0]), [ind == ibm_db.SQL_NULL_DATA for ind in first[1].indicators]
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#i i 4 (3L,) (4L,) True
+#[0, 1, 2]
+#[False, True, False]
+#cat
+#dog
+#horse
+#3 gold fish
+#[4, 5] [4, 5]
+#[6] [6]
+#[0, 1, 2] [False, True, False]
+#__ZOS_EXPECTED__
+#i i 4 (3L,) (4L,) True
+#[0, 1, 2]
+#[False, True, False]
+#cat
+#dog
+#horse
+#3 gold fish
+#[4, 5] [4, 5]
+#[6] [6]
+#[0, 1, 2] [False, True, False]
+#__SYSTEMI_EXPECTED__
+#i i 4 (3L,) (4L,) True
+#[0, 1, 2]
+#[False, True, False]
+#cat
+#dog
+#horse
+#3 gold fish
+#[4, 5] [4, 5]
+#[6] [6]
+#[0, 1, 2] [False, True, False]
+#__IDS_EXPECTED__
+#i i 4 (3L,) (4L,) True
+#[0, 1, 2]
+#[False, True, False]
+#cat
+#dog
+#horse
+#3 gold fish
+#[4, 5] [4, 5]
+#[6] [6]
+#[0, 1, 2] [False, True, False]
@@ -0,0 +1,202 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, os, struct
+import ibm_db
+import config
+from StringIO import StringIO
+from testfunctions import IbmDbTestFunctions
+
+# Minimal reader of the flatbuffer metadata of an Arrow IPC stream
+
+def fb_field(buf, table, id):
+  vtable = table - struct.unpack_from('<i', buf, table)[0]
+  vtable_size = struct.unpack_from('<H', buf, vtable)[0]
+  if 4 + 2 * id >= vtable_size:
+    return None
+  offset = struct.unpack_from('<H', buf, vtable + 4 + 2 * id)[0]
+  if offset == 0:
+    return None
+  return table + offset
+
+def fb_deref(buf, pos):
+  return pos + struct.unpack_from('<I', buf, pos)[0]
+
+def fb_structs(buf, pos):
+  vector = fb_deref(buf, pos)
+  count = struct.unpack_from('<I', buf, vector)[0]
+  return [struct.unpack_from('<qq', buf, vector + 4 + 16 * i) for i in range(count)]
+
+# (header type, metadata, header table, body) of each message
+def read_arrow(data):
+  messages = []
+  pos = 0
+  while True:
+    length = struct.unpack_from('<i', data, pos + 4)[0]
+    pos += 8
+    if length == 0:
+      return messages
+    meta = data[pos:pos + length]
+    pos += length
+    message = fb_deref(meta, 0)
+    header_type = ord(meta[fb_field(meta, message, 1)])
+    header = fb_deref(meta, fb_field(meta, message, 2))
+    body_length = 0
+    if fb_field(meta, message, 3) is not None:
+      body_length = struct.unpack_from('<q', meta, fb_field(meta, message, 3))[0]
+    messages.append((header_type, meta, header, data[pos:pos + body_length]))
+    pos += body_length
+
+# names and Type union members of the fields of a schema message
+def schema_fields(meta, schema):
+  vector = fb_deref(meta, fb_field(meta, schema, 1))
+  names, types = [], []
+  for i in range(struct.unpack_from('<I', meta, vector)[0]):
+    field = fb_deref(meta, vector + 4 + 4 * i)
+    name = fb_deref(meta, fb_field(meta, field, 0))
+    names.append(meta[name + 4:name + 4 + struct.unpack_from('<I', meta, name)[0]].upper())
+    types.append(ord(meta[fb_field(meta, field, 2)]))
+  return names, types
+
+# rows, field nodes and buffers of a record batch message
+def batch_layout(meta, batch):
+  length = struct.unpack_from('<q', meta, fb_field(meta, batch, 0))[0]
+  return length, fb_structs(meta, fb_field(meta, batch, 1)), fb_structs(meta, fb_field(meta, batch, 2))
+
+def buffer_data(body, buffer):
+  return body[buffer[0]:buffer[0] + buffer[1]]
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_274_WriteArrow(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_274)
+
+  def run_test_274(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.exec_immediate(conn, "SELECT id, breed, name, weight FROM animals ORDER BY id")
+      out = StringIO()
+      print ibm_db.write_arrow(stmt, out, 3)
+      data = out.getvalue()
+      print repr(data[:4])
+      print repr(data[-8:])
+      # the schema carries the column names
+      print data.upper().find("BREED") > 0, data.upper().find("WEIGHT") > 0
+      print ibm_db.write_arrow(stmt, out)
+
+      # decode the schema and the first record batch
+      messages = read_arrow(data)
+      print [message[0] for message in messages]
+      print schema_fields(messages[0][1], messages[0][2])
+      length, nodes, buffers = batch_layout(messages[1][1], messages[1][2])
+      body = messages[1][3]
+      print length, nodes
+      print [buffer[1] for buffer in buffers]
+      print [buffer[0] % 8 for buffer in buffers] == [0] * len(buffers)
+      print struct.unpack('<3i', buffer_data(body, buffers[1]))
+      offsets = struct.unpack('<4i', buffer_data(body, buffers[3]))
+      breeds = buffer_data(body, buffers[4])
+      print [breeds[offsets[i]:offsets[i + 1]] for i in range(3)]
+      weights = buffer_data(body, buffers[9])
+      print [struct.unpack_from('<q', weights, 16 * i)[0] for i in range(3)]
+
+      # BLOB values are written as their bytes
+      stmt = ibm_db.exec_immediate(conn, "SELECT picture FROM animal_pics WHERE name = 'Spook'")
+      out = StringIO()
+      print ibm_db.write_arrow(stmt, out)
+      messages = read_arrow(out.getvalue())
+      print schema_fields(messages[0][1], messages[0][2])[1]
+      length, nodes, buffers = batch_layout(messages[1][1], messages[1][2])
+      picture = buffer_data(messages[1][3], buffers[2])
+      print picture == open('tests/spook.png', 'rb').read()
+
+      stmt = ibm_db.exec_immediate(conn, "SELECT id FROM animals WHERE id < 0")
+      path = "test_274.arrows"
+      print ibm_db.write_arrow(stmt, path)
+      print os.path.getsize(path) > 8
+      os.remove(path)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#7
+#'\xff\xff\xff\xff'
+#'\xff\xff\xff\xff\x00\x00\x00\x00'
+#True True
+#0
+#[1, 3, 3, 3]
+#(['ID', 'BREED', 'NAME', 'WEIGHT'], [2, 5, 5, 7])
+#3 [(3, 0), (3, 0), (3, 0), (3, 0)]
+#[1, 12, 1, 16, 11, 1, 16, 48, 1, 48]
+#True
+#(0, 1, 2)
+#['cat', 'dog', 'horse']
+#[320, 1230, 35000]
+#1
+#[4]
+#True
+#0
+#True
+#__ZOS_EXPECTED__
+#7
+#'\xff\xff\xff\xff'
+#'\xff\xff\xff\xff\x00\x00\x00\x00'
+#True True
+#0
+#[1, 3, 3, 3]
+#(['ID', 'BREED', 'NAME', 'WEIGHT'], [2, 5, 5, 7])
+#3 [(3, 0), (3, 0), (3, 0), (3, 0)]
+#[1, 12, 1, 16, 11, 1, 16, 48, 1, 48]
+#True
+#(0, 1, 2)
+#['cat', 'dog', 'horse']
+#[320, 1230, 35000]
+#1
+#[4]
+#True
+#0
+#True
+#__SYSTEMI_EXPECTED__
+#7
+#'\xff\xff\xff\xff'
+#'\xff\xff\xff\xff\x00\x00\x00\x00'
+#True True
+#0
+#[1, 3, 3, 3]
+#(['ID', 'BREED', 'NAME', 'WEIGHT'], [2, 5, 5, 7])
+#3 [(3, 0), (3, 0), (3, 0), (3, 0)]
+#[1, 12, 1, 16, 11, 1, 16, 48, 1, 48]
+#True
+#(0, 1, 2)
+#['cat', 'dog', 'horse']
+#[320, 1230, 35000]
+#1
+#[4]
+#True
+#0
+#True
+#__IDS_EXPECTED__
+#7
+#'\xff\xff\xff\xff'
+#'\xff\xff\xff\xff\x00\x00\x00\x00'
+#True True
+#0
+#[1, 3, 3, 3]
+#(['ID', 'BREED', 'NAME', 'WEIGHT'], [2, 5, 5, 7])
+#3 [(3, 0), (3, 0), (3, 0), (3, 0)]
+#[1, 12, 1, 16, 11, 1, 16, 48, 1, 48]
+#True
+#(0, 1, 2)
+#['cat', 'dog', 'horse']
+#[320, 1230, 35000]
+#1
+#[4]
+#True
+#0
+#True
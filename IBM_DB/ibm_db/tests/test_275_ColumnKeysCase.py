@@ -0,0 +1,60 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_275_ColumnKeysCase(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_275)
+
+  def run_test_275(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.prepare(conn, "SELECT id, breed FROM animals WHERE id < 2 ORDER BY id", {ibm_db.ATTR_CASE : ibm_db.CASE_LOWER})
+      ibm_db.execute(stmt)
+      # names are folded as soon as the result set is described
+      print ibm_db.field_name(stmt, 0), ibm_db.field_name(stmt, 1)
+      row = ibm_db.fetch_assoc(stmt)
+      print sorted(row.keys())
+      print row['id'], row['breed']
+      ibm_db.set_option(stmt, {ibm_db.ATTR_CASE : ibm_db.CASE_UPPER}, 0)
+      row = ibm_db.fetch_both(stmt)
+      print len(row), row['ID'], row[0], row['BREED'], row[1]
+      print ibm_db.field_name(stmt, 1)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#id breed
+#['breed', 'id']
+#0 cat
+#4 1 1 dog dog
+#BREED
+#__ZOS_EXPECTED__
+#id breed
+#['breed', 'id']
+#0 cat
+#4 1 1 dog dog
+#BREED
+#__SYSTEMI_EXPECTED__
+#id breed
+#['breed', 'id']
+#0 cat
+#4 1 1 dog dog
+#BREED
+#__IDS_EXPECTED__
+#id breed
+#['breed', 'id']
+#0 cat
+#4 1 1 dog dog
+#BREED
@@ -0,0 +1,72 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_276_FetchRowObject(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_276)
+
+  def run_test_276(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.exec_immediate(conn, "SELECT id, breed FROM animals WHERE id < 3 ORDER BY id", {ibm_db.ATTR_CASE : ibm_db.CASE_UPPER})
+      row = ibm_db.fetch_row_object(stmt)
+      print type(row).__name__, len(row), row.keys()
+      print row[0], row[-1], row['ID'], row.BREED
+      print row == (0, 'cat'), tuple(row)
+      row = ibm_db.fetch_object(stmt)
+      id, breed = row
+      print id, breed, row[1:]
+      row = ibm_db.fetch_row_object(stmt)
+      print row
+      try:
+        row.NAME
+      except AttributeError:
+        print "no NAME column"
+      print ibm_db.fetch_row_object(stmt)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#IBM_DBRow 2 ['ID', 'BREED']
+#0 cat 0 cat
+#True (0, 'cat')
+#1 dog ('dog',)
+#IBM_DBRow(ID=2, BREED='horse')
+#no NAME column
+#False
+#__ZOS_EXPECTED__
+#IBM_DBRow 2 ['ID', 'BREED']
+#0 cat 0 cat
+#True (0, 'cat')
+#1 dog ('dog',)
+#IBM_DBRow(ID=2, BREED='horse')
+#no NAME column
+#False
+#__SYSTEMI_EXPECTED__
+#IBM_DBRow 2 ['ID', 'BREED']
+#0 cat 0 cat
+#True (0, 'cat')
+#1 dog ('dog',)
+#IBM_DBRow(ID=2, BREED='horse')
+#no NAME column
+#False
+#__IDS_EXPECTED__
+#IBM_DBRow 2 ['ID', 'BREED']
+#0 cat 0 cat
+#True (0, 'cat')
+#1 dog ('dog',)
+#IBM_DBRow(ID=2, BREED='horse')
+#no NAME column
+#False
@@ -0,0 +1,108 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_277_NativeTypes(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_277)
+
+  def run_test_277(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    
+    if conn:
+      drop = 'DROP TABLE table_277'
+      try:
+        result = ibm_db.exec_immediate(conn, drop)
+      except:
+        pass
+
+      server = ibm_db.server_info( conn )
+      if (server.DBMS_NAME[0:3] == 'IDS'):
+        statement = "CREATE TABLE table_277 (col1 DATETIME HOUR TO SECOND, col2 DATE, col3 DATETIME YEAR TO FRACTION(5), col4 DECIMAL(9,3))"
+        result = ibm_db.exec_immediate(conn, statement)
+        statement = "INSERT INTO table_277 (col1, col2, col3, col4) values ('10:42:34', '1981-07-08', '1981-07-08 10:42:34.12345', -1234.567)"
+        result = ibm_db.exec_immediate(conn, statement)
+      else:
+        statement = "CREATE TABLE table_277 (col1 TIME, col2 DATE, col3 TIMESTAMP, col4 DECIMAL(9,3))"
+        result = ibm_db.exec_immediate(conn, statement)
+        statement = "INSERT INTO table_277 (col1, col2, col3, col4) values ('10.42.34', '1981-07-08', '1981-07-08-10.42.34.123450', -1234.567)"
+        result = ibm_db.exec_immediate(conn, statement)
+      statement = "INSERT INTO table_277 (col1, col2, col3, col4) values (NULL, NULL, NULL, NULL)"
+      result = ibm_db.exec_immediate(conn, statement)
+
+      statement = "SELECT * FROM table_277"
+      stmt = ibm_db.exec_immediate(conn, statement, {ibm_db.ATTR_NATIVE_TYPES : ibm_db.NATIVE_TYPES_ON})
+      print ibm_db.get_option(stmt, ibm_db.ATTR_NATIVE_TYPES, 0) == ibm_db.NATIVE_TYPES_ON
+      row = ibm_db.fetch_tuple(stmt)
+      for value in row:
+        print repr(value)
+      print ibm_db.fetch_tuple(stmt)
+
+      # Strings stay the default
+      stmt = ibm_db.exec_immediate(conn, statement)
+      row = ibm_db.fetch_tuple(stmt)
+      print type(row[1]).__name__, type(row[3]).__name__
+
+      ibm_db.set_option(conn, {ibm_db.ATTR_NATIVE_TYPES : ibm_db.NATIVE_TYPES_ON}, 1)
+      stmt = ibm_db.exec_immediate(conn, statement)
+      row = ibm_db.fetch_tuple(stmt)
+      print type(row[1]).__name__, type(row[3]).__name__
+
+      # The columns stay bound with the value in effect when they were bound
+      ibm_db.set_option(stmt, {ibm_db.ATTR_NATIVE_TYPES : ibm_db.NATIVE_TYPES_OFF}, 0)
+      print ibm_db.get_option(stmt, ibm_db.ATTR_NATIVE_TYPES, 0), ibm_db.get_option(stmt, ibm_db.ATTR_BOUND_NATIVE_TYPES, 0)
+      
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#True
+#datetime.time(10, 42, 34)
+#datetime.date(1981, 7, 8)
+#datetime.datetime(1981, 7, 8, 10, 42, 34, 123450)
+#Decimal('-1234.567')
+#(None, None, None, None)
+#str str
+#date Decimal
+#0 1
+#__ZOS_EXPECTED__
+#True
+#datetime.time(10, 42, 34)
+#datetime.date(1981, 7, 8)
+#datetime.datetime(1981, 7, 8, 10, 42, 34, 123450)
+#Decimal('-1234.567')
+#(None, None, None, None)
+#str str
+#date Decimal
+#0 1
+#__SYSTEMI_EXPECTED__
+#True
+#datetime.time(10, 42, 34)
+#datetime.date(1981, 7, 8)
+#datetime.datetime(1981, 7, 8, 10, 42, 34, 123450)
+#Decimal('-1234.567')
+#(None, None, None, None)
+#str str
+#date Decimal
+#0 1
+#__IDS_EXPECTED__
+#True
+#datetime.time(10, 42, 34)
+#datetime.date(1981, 7, 8)
+#datetime.datetime(1981, 7, 8, 10, 42, 34, 123450)
+#Decimal('-1234.567')
+#(None, None, None, None)
+#str str
+#date Decimal
+#0 1
@@ -0,0 +1,94 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_278_ExecuteManyArray(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_278)
+
+  def run_test_278(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      try:
+        ibm_db.exec_immediate(conn, "DROP TABLE tabarray")
+      except:
+        pass
+      ibm_db.exec_immediate(conn, "CREATE TABLE tabarray (id INTEGER NOT NULL, big BIGINT, name VARCHAR(32), price DOUBLE)")
+
+      # 5 rows sent as parameter arrays of 2 rows
+      stmt = ibm_db.prepare(conn, "INSERT INTO tabarray VALUES (?, ?, ?, ?)")
+      params = ((1, 2**40, 'Sanders', 1.5), (2, None, None, None), (3, -7, u'Pernal', 2.25),
+                (4, 0, '', None), (5, 12, 'Marenghi', 0.0))
+      print ibm_db.execute_many(stmt, params, {ibm_db.SQL_ATTR_PARAMSET_SIZE : 2})
+      print ibm_db.get_option(stmt, ibm_db.SQL_ATTR_PARAMSET_SIZE, 0)
+
+      # Rows that cannot be sent are reported, the others are inserted
+      params = ((6, 1, 'Hanes', 3.0), (7, 'x'), (8, 1, 'Quigley', None))
+      try:
+        ibm_db.execute_many(stmt, params)
+      except Exception, inst:
+        print inst
+
+      result = ibm_db.exec_immediate(conn, "SELECT * FROM tabarray ORDER BY id")
+      row = ibm_db.fetch_tuple(result)
+      while row:
+        print row
+        row = ibm_db.fetch_tuple(result)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#5
+#2
+#Error 1: Value parameter tuple: 2 has less no of param 
+#(1, 1099511627776L, 'Sanders', 1.5)
+#(2, None, None, None)
+#(3, -7L, 'Pernal', 2.25)
+#(4, 0L, '', None)
+#(5, 12L, 'Marenghi', 0.0)
+#(6, 1L, 'Hanes', 3.0)
+#(8, 1L, 'Quigley', None)
+#__ZOS_EXPECTED__
+#5
+#2
+#Error 1: Value parameter tuple: 2 has less no of param 
+#(1, 1099511627776L, 'Sanders', 1.5)
+#(2, None, None, None)
+#(3, -7L, 'Pernal', 2.25)
+#(4, 0L, '', None)
+#(5, 12L, 'Marenghi', 0.0)
+#(6, 1L, 'Hanes', 3.0)
+#(8, 1L, 'Quigley', None)
+#__SYSTEMI_EXPECTED__
+#5
+#2
+#Error 1: Value parameter tuple: 2 has less no of param 
+#(1, 1099511627776L, 'Sanders', 1.5)
+#(2, None, None, None)
+#(3, -7L, 'Pernal', 2.25)
+#(4, 0L, '', None)
+#(5, 12L, 'Marenghi', 0.0)
+#(6, 1L, 'Hanes', 3.0)
+#(8, 1L, 'Quigley', None)
+#__IDS_EXPECTED__
+#5
+#2
+#Error 1: Value parameter tuple: 2 has less no of param 
+#(1, 1099511627776L, 'Sanders', 1.5)
+#(2, None, None, None)
+#(3, -7L, 'Pernal', 2.25)
+#(4, 0L, '', None)
+#(5, 12L, 'Marenghi', 0.0)
+#(6, 1L, 'Hanes', 3.0)
+#(8, 1L, 'Quigley', None)
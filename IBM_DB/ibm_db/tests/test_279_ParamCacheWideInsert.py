@@ -0,0 +1,72 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_279_ParamCacheWideInsert(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_279)
+
+  def run_test_279(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      # Params bound out of order
+      stmt = ibm_db.prepare(conn, "SELECT id, breed, name, weight FROM animals WHERE id < ? AND weight > ? ORDER BY id")
+      ibm_db.bind_param(stmt, 2, 2.0)
+      ibm_db.bind_param(stmt, 1, 2)
+      ibm_db.execute(stmt)
+      row = ibm_db.fetch_tuple(stmt)
+      while row:
+        print row[0], row[1].strip(), row[2].strip(), row[3]
+        row = ibm_db.fetch_tuple(stmt)
+
+      # A statement with many parameter markers, executed more than once
+      try:
+        ibm_db.exec_immediate(conn, "DROP TABLE tabwide")
+      except:
+        pass
+      columns = 60
+      ibm_db.exec_immediate(conn, "CREATE TABLE tabwide (%s)" % ", ".join(["c%d INTEGER" % i for i in range(columns)]))
+      stmt = ibm_db.prepare(conn, "INSERT INTO tabwide VALUES (%s)" % ", ".join(["?"] * columns))
+      ibm_db.execute(stmt, tuple(range(0, columns * 10, 10)))
+      ibm_db.execute(stmt, (5,) + tuple(range(10, columns * 10, 10)))
+      result = ibm_db.exec_immediate(conn, "SELECT * FROM tabwide ORDER BY c0")
+      row = ibm_db.fetch_tuple(result)
+      values = list(row)
+      row = ibm_db.fetch_tuple(result)
+      print sorted(set(values + list(row)))
+      result = ibm_db.exec_immediate(conn, "SELECT COUNT(*) FROM tabwide WHERE c59 = 590")
+      print ibm_db.fetch_tuple(result)[0]
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#0 cat Pook 3.20
+#1 dog Peaches 12.30
+#[0, 5, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250, 260, 270, 280, 290, 300, 310, 320, 330, 340, 350, 360, 370, 380, 390, 400, 410, 420, 430, 440, 450, 460, 470, 480, 490, 500, 510, 520, 530, 540, 550, 560, 570, 580, 590]
+#2
+#__ZOS_EXPECTED__
+#0 cat Pook 3.20
+#1 dog Peaches 12.30
+#[0, 5, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250, 260, 270, 280, 290, 300, 310, 320, 330, 340, 350, 360, 370, 380, 390, 400, 410, 420, 430, 440, 450, 460, 470, 480, 490, 500, 510, 520, 530, 540, 550, 560, 570, 580, 590]
+#2
+#__SYSTEMI_EXPECTED__
+#0 cat Pook 3.20
+#1 dog Peaches 12.30
+#[0, 5, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250, 260, 270, 280, 290, 300, 310, 320, 330, 340, 350, 360, 370, 380, 390, 400, 410, 420, 430, 440, 450, 460, 470, 480, 490, 500, 510, 520, 530, 540, 550, 560, 570, 580, 590]
+#2
+#__IDS_EXPECTED__
+#0 cat Pook 3.20
+#1 dog Peaches 12.30
+#[0, 5, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250, 260, 270, 280, 290, 300, 310, 320, 330, 340, 350, 360, 370, 380, 390, 400, 410, 420, 430, 440, 450, 460, 470, 480, 490, 500, 510, 520, 530, 540, 550, 560, 570, 580, 590]
+#2
@@ -0,0 +1,74 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_280_ParamTypes(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_280)
+
+  def run_test_280(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      # Parameter types given at prepare time are not described on the server
+      types = (ibm_db.SQL_INTEGER, (ibm_db.SQL_VARCHAR, 32))
+      stmt = ibm_db.prepare(conn, "SELECT id, name FROM animals WHERE id = ? AND breed = ?", {ibm_db.ATTR_PARAM_TYPES : types})
+      param_types = ibm_db.get_option(stmt, ibm_db.ATTR_PARAM_TYPES, 0)
+      print param_types[0], param_types[1]
+      for params in ((0, 'cat'), (1, 'dog')):
+        ibm_db.execute(stmt, params)
+        row = ibm_db.fetch_tuple(stmt)
+        print row[0], row[1].strip()
+
+      # Other parameters are described on the first execute only
+      stmt = ibm_db.prepare(conn, "SELECT COUNT(*) FROM animals WHERE weight > ?")
+      print ibm_db.get_option(stmt, ibm_db.ATTR_PARAM_TYPES, 0)
+      for weight in (10, 100):
+        ibm_db.execute(stmt, (weight,))
+        print ibm_db.fetch_tuple(stmt)[0]
+      print ibm_db.get_option(stmt, ibm_db.ATTR_PARAM_TYPES, 0)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#(4, 0, 0) (12, 32, 0)
+#0 Pook
+#1 Peaches
+#(None,)
+#3
+#2
+#((3, 7, 2),)
+#__ZOS_EXPECTED__
+#(4, 0, 0) (12, 32, 0)
+#0 Pook
+#1 Peaches
+#(None,)
+#3
+#2
+#((3, 7, 2),)
+#__SYSTEMI_EXPECTED__
+#(4, 0, 0) (12, 32, 0)
+#0 Pook
+#1 Peaches
+#(None,)
+#3
+#2
+#((3, 7, 2),)
+#__IDS_EXPECTED__
+#(4, 0, 0) (12, 32, 0)
+#0 Pook
+#1 Peaches
+#(None,)
+#3
+#2
+#((3, 7, 2),)
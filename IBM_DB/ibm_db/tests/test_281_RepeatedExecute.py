@@ -0,0 +1,73 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_281_RepeatedExecute(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_281)
+
+  def run_test_281(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      try:
+        ibm_db.exec_immediate(conn, "DROP TABLE tabrepeat")
+      except:
+        pass
+      ibm_db.exec_immediate(conn, "CREATE TABLE tabrepeat (id INTEGER, str VARCHAR(32), dbl DOUBLE, num INTEGER, ustr VARCHAR(32))")
+
+      # Values are copied into the buffers bound by the previous execute,
+      # strings longer than the bound buffer and changed types are bound again
+      stmt = ibm_db.prepare(conn, "INSERT INTO tabrepeat VALUES (?, ?, ?, ?, ?)")
+      rows = (
+        (1, 'a', 1.5, None, u'u'),
+        (2, 'longer value', 2.25, 7, u'unicode value'),
+        (3, None, 3.0, 8, None),
+        (4, 'b', 4.75, None, u'x'),
+        (5, 'the longest value of all', 5.5, 9, u'a longer unicode value'),
+      )
+      for row in rows:
+        ibm_db.execute(stmt, row)
+
+      result = ibm_db.exec_immediate(conn, "SELECT * FROM tabrepeat ORDER BY id")
+      row = ibm_db.fetch_tuple(result)
+      while row:
+        print row[0], row[1], row[2], row[3], row[4]
+        row = ibm_db.fetch_tuple(result)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#1 a 1.5 None u
+#2 longer value 2.25 7 unicode value
+#3 None 3.0 8 None
+#4 b 4.75 None x
+#5 the longest value of all 5.5 9 a longer unicode value
+#__ZOS_EXPECTED__
+#1 a 1.5 None u
+#2 longer value 2.25 7 unicode value
+#3 None 3.0 8 None
+#4 b 4.75 None x
+#5 the longest value of all 5.5 9 a longer unicode value
+#__SYSTEMI_EXPECTED__
+#1 a 1.5 None u
+#2 longer value 2.25 7 unicode value
+#3 None 3.0 8 None
+#4 b 4.75 None x
+#5 the longest value of all 5.5 9 a longer unicode value
+#__IDS_EXPECTED__
+#1 a 1.5 None u
+#2 longer value 2.25 7 unicode value
+#3 None 3.0 8 None
+#4 b 4.75 None x
+#5 the longest value of all 5.5 9 a longer unicode value
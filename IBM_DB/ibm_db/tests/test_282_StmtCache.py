@@ -0,0 +1,92 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_282_StmtCache(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_282)
+
+  def run_test_282(self):
+    conn = ibm_db.connect(config.database, config.user, config.password, {ibm_db.ATTR_STMT_CACHE_SIZE : 2})
+    if conn:
+      print ibm_db.get_option(conn, ibm_db.ATTR_STMT_CACHE_SIZE, 1)
+      sql = "SELECT name FROM animals WHERE id = ?"
+      stmt = ibm_db.prepare(conn, sql)
+      # A statement held by the application is not handed out again
+      held = ibm_db.prepare(conn, sql)
+      print held is stmt
+      del held
+      first = id(stmt)
+      ibm_db.execute(stmt, (0,))
+      print ibm_db.fetch_tuple(stmt)[0].strip()
+
+      # Once released it is taken from the cache
+      stmt = None
+      stmt = ibm_db.prepare(conn, sql)
+      print id(stmt) == first
+      ibm_db.execute(stmt, (1,))
+      print ibm_db.fetch_tuple(stmt)[0].strip()
+      stmt = None
+
+      # Options are part of the key, the least recently used is evicted
+      stmt = ibm_db.prepare(conn, sql, {ibm_db.ATTR_CASE : ibm_db.CASE_LOWER})
+      stmt = None
+      stmt = ibm_db.prepare(conn, "SELECT COUNT(*) FROM animals")
+      stmt = None
+      stats = ibm_db.get_stmt_cache_stats(conn)
+      print stats['size'], stats['statements'], stats['hits'], stats['misses'], stats['evictions']
+
+      # A statement changed with set_option is prepared again
+      stmt = ibm_db.prepare(conn, "SELECT COUNT(*) FROM animals")
+      ibm_db.set_option(stmt, {ibm_db.ATTR_CASE : ibm_db.CASE_UPPER}, 0)
+      stmt = None
+      stmt = ibm_db.prepare(conn, "SELECT COUNT(*) FROM animals")
+      stmt = None
+      stats = ibm_db.get_stmt_cache_stats(conn)
+      print stats['hits'], stats['misses']
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#2
+#False
+#Pook
+#True
+#Peaches
+#2 2 1 4 1
+#2 5
+#__ZOS_EXPECTED__
+#2
+#False
+#Pook
+#True
+#Peaches
+#2 2 1 4 1
+#2 5
+#__SYSTEMI_EXPECTED__
+#2
+#False
+#Pook
+#True
+#Peaches
+#2 2 1 4 1
+#2 5
+#__IDS_EXPECTED__
+#2
+#False
+#Pook
+#True
+#Peaches
+#2 2 1 4 1
+#2 5
@@ -0,0 +1,133 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_283_ConnPool(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_283)
+
+  def pool_stats(self):
+    for stats in ibm_db.get_pool_stats():
+      if stats['database'] == config.database and stats['user'] == config.user:
+        return stats
+
+  def run_test_283(self):
+    ibm_db.set_pool_options(max_size = 2, timeout = 0)
+    first = ibm_db.pconnect(config.database, config.user, config.password)
+    if first:
+      before = self.pool_stats()
+      # Two callers with the same credentials get separate connections
+      second = ibm_db.pconnect(config.database, config.user, config.password)
+      print first is second
+      print self.pool_stats()['in_use']
+
+      # The pool is full
+      try:
+        ibm_db.pconnect(config.database, config.user, config.password)
+      except Exception, e:
+        print e
+      print self.pool_stats()['timeouts'] - before['timeouts']
+
+      # A closed connection is handed out again, rolled back
+      ibm_db.autocommit(second, ibm_db.SQL_AUTOCOMMIT_OFF)
+      ibm_db.exec_immediate(second, "UPDATE animals SET name = 'pooled' WHERE id = 0")
+      ibm_db.close(second)
+      print self.pool_stats()['in_use']
+      # The closed resource cannot reach the connection any more
+      try:
+        ibm_db.exec_immediate(second, "SELECT name FROM animals WHERE id = 0")
+      except Exception, e:
+        print e
+      third = ibm_db.pconnect(config.database, config.user, config.password)
+      print third is second
+      print ibm_db.autocommit(third)
+      stmt = ibm_db.exec_immediate(third, "SELECT name FROM animals WHERE id = 0")
+      print ibm_db.fetch_tuple(stmt)[0].strip()
+
+      stats = self.pool_stats()
+      print stats['checkouts'] - before['checkouts']
+
+      # A connection dropped without ibm_db.close() goes back to the pool
+      stmt = None
+      third = None
+      print self.pool_stats()['in_use']
+      third = ibm_db.pconnect(config.database, config.user, config.password)
+      print self.pool_stats()['created'] - stats['created']
+      ibm_db.close(third)
+      ibm_db.close(first)
+      print self.pool_stats()['in_use']
+      print 'password' in stats
+      ibm_db.set_pool_options(max_size = 0, timeout = 30)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#False
+#2
+#Connection pool exhausted: no connection was checked in within the pool timeout
+#1
+#1
+#Connection is not active
+#False
+#1
+#cat
+#2
+#1
+#0
+#0
+#False
+#__ZOS_EXPECTED__
+#False
+#2
+#Connection pool exhausted: no connection was checked in within the pool timeout
+#1
+#1
+#Connection is not active
+#False
+#1
+#cat
+#2
+#1
+#0
+#0
+#False
+#__SYSTEMI_EXPECTED__
+#False
+#2
+#Connection pool exhausted: no connection was checked in within the pool timeout
+#1
+#1
+#Connection is not active
+#False
+#1
+#cat
+#2
+#1
+#0
+#0
+#False
+#__IDS_EXPECTED__
+#False
+#2
+#Connection pool exhausted: no connection was checked in within the pool timeout
+#1
+#1
+#Connection is not active
+#False
+#1
+#cat
+#2
+#1
+#0
+#0
+#False
@@ -0,0 +1,75 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, threading
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_284_ThreadErrors(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_284)
+
+  def run_test_284(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      results = {}
+      start = threading.Event()
+
+      def worker(table):
+        start.wait()
+        for i in range(20):
+          try:
+            ibm_db.exec_immediate(conn, "SELECT * FROM %s" % table)
+          except:
+            pass
+          # Errors of the other threads are not seen
+          if table.upper() not in ibm_db.stmt_errormsg():
+            results[table] = False
+            return
+        results[table] = len(ibm_db.stmt_error()) == 5
+
+      threads = [threading.Thread(target=worker, args=("no_such_table_%d" % i,)) for i in range(4)]
+      for thread in threads:
+        thread.start()
+      start.set()
+      for thread in threads:
+        thread.join()
+      for table in sorted(results.keys()):
+        print table, results[table]
+      # The main thread had no error
+      print repr(ibm_db.stmt_errormsg())
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#no_such_table_0 True
+#no_such_table_1 True
+#no_such_table_2 True
+#no_such_table_3 True
+#''
+#__ZOS_EXPECTED__
+#no_such_table_0 True
+#no_such_table_1 True
+#no_such_table_2 True
+#no_such_table_3 True
+#''
+#__SYSTEMI_EXPECTED__
+#no_such_table_0 True
+#no_such_table_1 True
+#no_such_table_2 True
+#no_such_table_3 True
+#''
+#__IDS_EXPECTED__
+#no_such_table_0 True
+#no_such_table_1 True
+#no_such_table_2 True
+#no_such_table_3 True
+#''
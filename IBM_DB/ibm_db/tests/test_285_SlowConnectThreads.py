@@ -0,0 +1,64 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, threading, time
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_285_SlowConnectThreads(self):
+    obj = IbmDbTestFunctions()
+    if not obj.stub_cli():
+      self.skipTest("needs the latency of the stub CLI")
+    obj.assert_expect(self.run_test_285)
+
+  def run_test_285(self):
+    # The stub CLI makes the connect take the LATENCY of the connection
+    # string, two seconds
+    dsn = "DATABASE=%s;UID=%s;PWD=%s;LATENCY=2000000;" % (config.database, config.user, config.password)
+    ticks = [0]
+    done = threading.Event()
+
+    def ticker():
+      while not done.is_set():
+        ticks[0] += 1
+        time.sleep(0.01)
+
+    thread = threading.Thread(target=ticker)
+    thread.start()
+    start = time.time()
+    try:
+      conn = ibm_db.connect(dsn, "", "")
+      print "Connected."
+      ibm_db.close(conn)
+    except:
+      print "Connection failed."
+    elapsed = time.time() - start
+    done.set()
+    thread.join()
+    # The other thread kept running while the connect waited
+    print elapsed > 1
+    print ticks[0] > elapsed * 50
+
+#__END__
+#__LUW_EXPECTED__
+#Connected.
+#True
+#True
+#__ZOS_EXPECTED__
+#Connected.
+#True
+#True
+#__SYSTEMI_EXPECTED__
+#Connected.
+#True
+#True
+#__IDS_EXPECTED__
+#Connected.
+#True
+#True
@@ -0,0 +1,116 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, array
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_286_LobReader(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_286)
+
+  def run_test_286(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      try:
+        ibm_db.exec_immediate(conn, "DROP TABLE tablobreader")
+      except:
+        pass
+      ibm_db.exec_immediate(conn, "CREATE TABLE tablobreader (id INTEGER, b BLOB(64K), c CLOB(64K))")
+      stmt = ibm_db.prepare(conn, "INSERT INTO tablobreader VALUES (?, ?, ?)")
+      ibm_db.execute(stmt, (1, '0123456789' * 1000, 'abcdefghij' * 500))
+      ibm_db.execute(stmt, (2, None, None))
+
+      stmt = ibm_db.prepare(conn, "SELECT id, b, c FROM tablobreader ORDER BY id", {ibm_db.ATTR_LOB_READER : ibm_db.LOB_READER_ON})
+      print ibm_db.get_option(stmt, ibm_db.ATTR_LOB_READER, 0)
+      ibm_db.execute(stmt)
+      row = ibm_db.fetch_tuple(stmt)
+      blob = row[1]
+      clob = row[2]
+      print type(blob).__name__, len(blob), len(clob)
+
+      # The value is read in chunks of bounded size
+      data = ''
+      chunk = blob.read(4096)
+      while chunk:
+        data += chunk
+        chunk = blob.read(4096)
+      print len(data), data == '0123456789' * 1000, blob.tell()
+
+      blob.seek(-5, 2)
+      print blob.read()
+      blob.seek(3)
+      buf = array.array('c', ' ' * 8)
+      print blob.readinto(buf), buf.tostring(), blob.tell()
+
+      print repr(clob.read(12)), clob.tell()
+      clob.seek(4990)
+      print repr(clob.read())
+      try:
+        clob.readinto(buf)
+      except Exception, e:
+        print e
+
+      # NULL values are None
+      row = ibm_db.fetch_tuple(stmt)
+      print row[1], row[2]
+
+      ibm_db.set_option(stmt, {ibm_db.ATTR_LOB_READER : ibm_db.LOB_READER_OFF}, 0)
+      ibm_db.execute(stmt)
+      row = ibm_db.fetch_tuple(stmt)
+      print type(row[1]).__name__, len(row[1])
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#1
+#IBM_DBLob 10000 5000
+#10000 True 10000
+#56789
+#8 34567890 11
+#u'abcdefghijab' 12
+#u'abcdefghij'
+#readinto() is only supported for BLOB values
+#None None
+#str 10000
+#__ZOS_EXPECTED__
+#1
+#IBM_DBLob 10000 5000
+#10000 True 10000
+#56789
+#8 34567890 11
+#u'abcdefghijab' 12
+#u'abcdefghij'
+#readinto() is only supported for BLOB values
+#None None
+#str 10000
+#__SYSTEMI_EXPECTED__
+#1
+#IBM_DBLob 10000 5000
+#10000 True 10000
+#56789
+#8 34567890 11
+#u'abcdefghijab' 12
+#u'abcdefghij'
+#readinto() is only supported for BLOB values
+#None None
+#str 10000
+#__IDS_EXPECTED__
+#1
+#IBM_DBLob 10000 5000
+#10000 True 10000
+#56789
+#8 34567890 11
+#u'abcdefghijab' 12
+#u'abcdefghij'
+#readinto() is only supported for BLOB values
+#None None
+#str 10000
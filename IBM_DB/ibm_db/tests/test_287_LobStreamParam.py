@@ -0,0 +1,134 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, StringIO, io
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_287_LobStreamParam(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_287)
+
+  def run_test_287(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      try:
+        ibm_db.exec_immediate(conn, "DROP TABLE tablobstream")
+      except:
+        pass
+      ibm_db.exec_immediate(conn, "CREATE TABLE tablobstream (id INTEGER, b BLOB(1M), c CLOB(1M))")
+      stmt = ibm_db.prepare(conn, "INSERT INTO tablobstream VALUES (?, ?, ?)")
+
+      # File-like objects are read in chunks, iterators one item at a time
+      def chunks():
+        for i in range(100):
+          yield 'abcdefghij' * 100
+      blob = StringIO.StringIO('0123456789' * 20000)
+      print ibm_db.execute(stmt, (1, blob, chunks()))
+      print blob.tell()
+
+      # Empty streams insert empty values
+      print ibm_db.execute(stmt, (2, StringIO.StringIO(''), iter([])))
+
+      # The statement is reused with plain string values
+      print ibm_db.execute(stmt, (3, 'xyz', 'uvw'))
+
+      # Unicode streams, such as text files, are sent as SQLWCHAR data
+      text = io.StringIO(u'klmnopqrst' * 10000)
+      print ibm_db.execute(stmt, (6, 'xyz', text))
+      print ibm_db.execute(stmt, (7, 'xyz', iter([u'unicode ', u'items'])))
+      try:
+        ibm_db.execute(stmt, (8, 'xyz', iter([u'abc', 'def'])))
+      except Exception, e:
+        print e
+
+      # Errors raised by the stream are passed on
+      def failing():
+        yield 'abc'
+        raise ValueError("stream failed")
+      try:
+        ibm_db.execute(stmt, (4, 'xyz', failing()))
+      except ValueError, e:
+        print e
+
+      try:
+        ibm_db.execute(stmt, (5, 'xyz', iter([1, 2])))
+      except Exception, e:
+        print e
+
+      stmt = ibm_db.exec_immediate(conn, "SELECT id, LENGTH(b), LENGTH(c), b, c FROM tablobstream ORDER BY id")
+      row = ibm_db.fetch_tuple(stmt)
+      while row:
+        print row[0], row[1], row[2], repr(row[3][:5]), repr(row[4][:5])
+        row = ibm_db.fetch_tuple(stmt)
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#True
+#200000
+#True
+#True
+#True
+#True
+#LOB stream of param 3 mixes strings and unicode
+#stream failed
+#LOB stream of param 3 must produce strings
+#1 200000 100000 '01234' 'abcde'
+#2 0 0 '' ''
+#3 3 3 'xyz' 'uvw'
+#6 3 100000 'xyz' 'klmno'
+#7 3 13 'xyz' 'unico'
+#__ZOS_EXPECTED__
+#True
+#200000
+#True
+#True
+#True
+#True
+#LOB stream of param 3 mixes strings and unicode
+#stream failed
+#LOB stream of param 3 must produce strings
+#1 200000 100000 '01234' 'abcde'
+#2 0 0 '' ''
+#3 3 3 'xyz' 'uvw'
+#6 3 100000 'xyz' 'klmno'
+#7 3 13 'xyz' 'unico'
+#__SYSTEMI_EXPECTED__
+#True
+#200000
+#True
+#True
+#True
+#True
+#LOB stream of param 3 mixes strings and unicode
+#stream failed
+#LOB stream of param 3 must produce strings
+#1 200000 100000 '01234' 'abcde'
+#2 0 0 '' ''
+#3 3 3 'xyz' 'uvw'
+#6 3 100000 'xyz' 'klmno'
+#7 3 13 'xyz' 'unico'
+#__IDS_EXPECTED__
+#True
+#200000
+#True
+#True
+#True
+#True
+#LOB stream of param 3 mixes strings and unicode
+#stream failed
+#LOB stream of param 3 must produce strings
+#1 200000 100000 '01234' 'abcde'
+#2 0 0 '' ''
+#3 3 3 'xyz' 'uvw'
+#6 3 100000 'xyz' 'klmno'
+#7 3 13 'xyz' 'unico'
@@ -0,0 +1,127 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, select
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_288_ExecuteAsync(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_288)
+
+  def run_test_288(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      stmt = ibm_db.prepare(conn, "SELECT id, breed FROM animals WHERE id < ? ORDER BY id")
+
+      # The mode the driver supports is picked by default
+      handle = ibm_db.execute_async(stmt, (3,))
+      print handle.mode in (ibm_db.ASYNC_CLI, ibm_db.ASYNC_THREAD)
+      print handle.result()
+      print handle.poll()
+      print ibm_db.fetch_tuple(stmt)
+
+      # A worker thread executes the statement and signals the descriptor
+      handle = ibm_db.execute_async(stmt, (2,), ibm_db.ASYNC_THREAD)
+      print handle.mode == ibm_db.ASYNC_THREAD
+      try:
+        ibm_db.execute(stmt, (2,))
+      except Exception, e:
+        print e
+      readable = select.select([handle.fileno()], [], [], 60)[0]
+      print readable == [handle.fileno()], handle.poll()
+      print handle.result()
+      row = ibm_db.fetch_tuple(stmt)
+      while row:
+        print row
+        row = ibm_db.fetch_tuple(stmt)
+
+      # Executes started while every worker thread is busy wait for one
+      stmts = [ibm_db.prepare(conn, "SELECT id FROM animals WHERE id < ?") for i in range(20)]
+      handles = [ibm_db.execute_async(stmts[i], (i % 7,), ibm_db.ASYNC_THREAD) for i in range(20)]
+      print [handle.result() for handle in handles] == [True] * 20
+      rows = 0
+      for stmt in stmts:
+        while ibm_db.fetch_tuple(stmt):
+          rows += 1
+      print rows
+
+      # Errors of the execute are raised by result()
+      stmt = ibm_db.prepare(conn, "INSERT INTO animals (id) VALUES (?)")
+      handle = ibm_db.execute_async(stmt, ('x',), ibm_db.ASYNC_THREAD)
+      for i in range(2):
+        try:
+          handle.result()
+        except Exception, e:
+          print str(e).startswith("Statement Execute Failed")
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#True
+#True
+#True
+#(0, 'cat')
+#True
+#Statement has an asynchronous execute pending
+#True True
+#True
+#(0, 'cat')
+#(1, 'dog')
+#True
+#57
+#True
+#True
+#__ZOS_EXPECTED__
+#True
+#True
+#True
+#(0, 'cat')
+#True
+#Statement has an asynchronous execute pending
+#True True
+#True
+#(0, 'cat')
+#(1, 'dog')
+#True
+#57
+#True
+#True
+#__SYSTEMI_EXPECTED__
+#True
+#True
+#True
+#(0, 'cat')
+#True
+#Statement has an asynchronous execute pending
+#True True
+#True
+#(0, 'cat')
+#(1, 'dog')
+#True
+#57
+#True
+#True
+#__IDS_EXPECTED__
+#True
+#True
+#True
+#(0, 'cat')
+#True
+#Statement has an asynchronous execute pending
+#True True
+#True
+#(0, 'cat')
+#(1, 'dog')
+#True
+#57
+#True
+#True
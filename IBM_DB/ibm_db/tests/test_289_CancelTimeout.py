@@ -0,0 +1,121 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, threading, time
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+# A cross join of a catalog table with itself that runs for minutes on each
+# server; the stub CLI takes the LATENCY in the comment (10 minutes)
+SLOW_QUERIES = {
+  'LUW' : "SELECT COUNT(*) FROM SYSCAT.COLUMNS a, SYSCAT.COLUMNS b, SYSCAT.COLUMNS c",
+  'ZOS' : "SELECT COUNT(*) FROM SYSIBM.SYSCOLUMNS a, SYSIBM.SYSCOLUMNS b, SYSIBM.SYSCOLUMNS c",
+  'AS' : "SELECT COUNT(*) FROM QSYS2.SYSCOLUMNS a, QSYS2.SYSCOLUMNS b, QSYS2.SYSCOLUMNS c",
+  'IDS' : "SELECT COUNT(*) FROM syscolumns a, syscolumns b, syscolumns c",
+}
+STUB_LATENCY = " -- LATENCY=600000000"
+
+# SQLSTATEs of a canceled or timed out statement
+CANCEL_STATES = ('HY008', 'HYT00', '57014')
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_289_CancelTimeout(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_289)
+
+  def run_test_289(self):
+    conn = ibm_db.connect(config.database, config.user, config.password, {ibm_db.SQL_ATTR_QUERY_TIMEOUT : 600})
+    if conn:
+      server = ibm_db.server_info(conn)
+      if (server.DBMS_NAME[0:2] == "AS"):
+        SLOW_QUERY = SLOW_QUERIES['AS']
+      elif (server.DBMS_NAME == "DB2"):
+        SLOW_QUERY = SLOW_QUERIES['ZOS']
+      elif (server.DBMS_NAME[0:3] == "IDS"):
+        SLOW_QUERY = SLOW_QUERIES['IDS']
+      else:
+        SLOW_QUERY = SLOW_QUERIES['LUW']
+      SLOW_QUERY += STUB_LATENCY
+      print ibm_db.get_option(conn, ibm_db.SQL_ATTR_QUERY_TIMEOUT, 1)
+
+      # Statements take the timeout of the connection unless given one
+      stmt = ibm_db.prepare(conn, SLOW_QUERY)
+      print ibm_db.get_option(stmt, ibm_db.SQL_ATTR_QUERY_TIMEOUT, 0)
+      stmt = ibm_db.prepare(conn, SLOW_QUERY, {ibm_db.SQL_ATTR_QUERY_TIMEOUT : 2})
+      print ibm_db.get_option(stmt, ibm_db.SQL_ATTR_QUERY_TIMEOUT, 0)
+      start = time.time()
+      try:
+        ibm_db.execute(stmt)
+        ibm_db.fetch_tuple(stmt)
+        print "Query completed."
+      except Exception, e:
+        print "Timed out:", ibm_db.stmt_error() in CANCEL_STATES, time.time() - start < 60
+
+      # A statement blocked in another thread is canceled
+      ibm_db.set_option(conn, {ibm_db.SQL_ATTR_QUERY_TIMEOUT : 0}, 1)
+      stmt = ibm_db.prepare(conn, SLOW_QUERY)
+      print ibm_db.get_option(stmt, ibm_db.SQL_ATTR_QUERY_TIMEOUT, 0)
+      def cancel():
+        time.sleep(1)
+        print ibm_db.cancel(stmt)
+      thread = threading.Thread(target=cancel)
+      thread.start()
+      start = time.time()
+      try:
+        ibm_db.execute(stmt)
+        ibm_db.fetch_tuple(stmt)
+        print "Query completed."
+      except Exception, e:
+        print "Canceled:", ibm_db.stmt_error() in CANCEL_STATES, time.time() - start < 60
+      thread.join()
+
+      try:
+        ibm_db.set_option(stmt, {ibm_db.SQL_ATTR_QUERY_TIMEOUT : -1}, 0)
+      except Exception, e:
+        print e
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#600
+#600
+#2
+#Timed out: True True
+#0
+#True
+#Canceled: True True
+#SQL_ATTR_QUERY_TIMEOUT attribute must be a non-negative integer
+#__ZOS_EXPECTED__
+#600
+#600
+#2
+#Timed out: True True
+#0
+#True
+#Canceled: True True
+#SQL_ATTR_QUERY_TIMEOUT attribute must be a non-negative integer
+#__SYSTEMI_EXPECTED__
+#600
+#600
+#2
+#Timed out: True True
+#0
+#True
+#Canceled: True True
+#SQL_ATTR_QUERY_TIMEOUT attribute must be a non-negative integer
+#__IDS_EXPECTED__
+#600
+#600
+#2
+#Timed out: True True
+#0
+#True
+#Canceled: True True
+#SQL_ATTR_QUERY_TIMEOUT attribute must be a non-negative integer
@@ -0,0 +1,104 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_290_PerfStats(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_290)
+
+  def run_test_290(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      print ibm_db.enable_stats(True)
+      ibm_db.reset_stats()
+
+      stmt = ibm_db.prepare(conn, "SELECT id, breed FROM animals WHERE id >= ? ORDER BY id")
+      ibm_db.execute(stmt, (0,))
+      row = ibm_db.fetch_tuple(stmt)
+      while row:
+        row = ibm_db.fetch_tuple(stmt)
+      stats = ibm_db.get_stats(stmt)
+      print sorted(stats.keys())
+      print stats['rows_fetched'], stats['params_bound']
+      print stats['cli_calls'] > 0, stats['bytes_fetched'] > 0
+      print stats['prepare_time'] > 0, stats['execute_time'] > 0, stats['fetch_time'] > 0
+
+      # the connection and the module add up the statements
+      stmt2 = ibm_db.exec_immediate(conn, "SELECT id FROM animals WHERE id < 2")
+      ibm_db.fetch_tuple(stmt2)
+      print ibm_db.get_stats(stmt2)['rows_fetched'], ibm_db.get_stats(conn)['rows_fetched']
+      print ibm_db.get_stats()['rows_fetched'] >= 8
+
+      # nothing is counted while the counters are off
+      print ibm_db.enable_stats(False)
+      ibm_db.fetch_tuple(stmt2)
+      print ibm_db.get_stats(stmt2)['rows_fetched']
+
+      ibm_db.reset_stats(conn)
+      print ibm_db.get_stats(conn)['rows_fetched'], ibm_db.get_stats(stmt)['rows_fetched']
+      try:
+        ibm_db.get_stats(1)
+      except Exception, e:
+        print e
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#False
+#['bytes_fetched', 'cli_calls', 'convert_time', 'describe_time', 'execute_time', 'fetch_time', 'lob_time', 'params_bound', 'prepare_time', 'rows_fetched']
+#7 1
+#True True
+#True True True
+#1 8
+#True
+#True
+#1
+#0 7
+#Supplied parameter is invalid
+#__ZOS_EXPECTED__
+#False
+#['bytes_fetched', 'cli_calls', 'convert_time', 'describe_time', 'execute_time', 'fetch_time', 'lob_time', 'params_bound', 'prepare_time', 'rows_fetched']
+#7 1
+#True True
+#True True True
+#1 8
+#True
+#True
+#1
+#0 7
+#Supplied parameter is invalid
+#__SYSTEMI_EXPECTED__
+#False
+#['bytes_fetched', 'cli_calls', 'convert_time', 'describe_time', 'execute_time', 'fetch_time', 'lob_time', 'params_bound', 'prepare_time', 'rows_fetched']
+#7 1
+#True True
+#True True True
+#1 8
+#True
+#True
+#1
+#0 7
+#Supplied parameter is invalid
+#__IDS_EXPECTED__
+#False
+#['bytes_fetched', 'cli_calls', 'convert_time', 'describe_time', 'execute_time', 'fetch_time', 'lob_time', 'params_bound', 'prepare_time', 'rows_fetched']
+#7 1
+#True True
+#True True True
+#1 8
+#True
+#True
+#1
+#0 7
+#Supplied parameter is invalid
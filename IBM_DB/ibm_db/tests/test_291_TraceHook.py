@@ -0,0 +1,109 @@
+# 
+#  Licensed Materials - Property of IBM
+#
+#  (c) Copyright IBM Corp. 2007-2008
+#
+
+import unittest, sys, os, tempfile
+import ibm_db
+import config
+from testfunctions import IbmDbTestFunctions
+
+class IbmDbTestCase(unittest.TestCase):
+
+  def test_291_TraceHook(self):
+    obj = IbmDbTestFunctions()
+    obj.assert_expect(self.run_test_291)
+
+  def run_test_291(self):
+    conn = ibm_db.connect(config.database, config.user, config.password)
+    if conn:
+      events = []
+      def hook(event, sql, params, elapsed, rows, sqlstate):
+        events.append((event, sql, params, elapsed >= 0, rows, sqlstate))
+      print ibm_db.set_trace_hook(hook)
+
+      stmt = ibm_db.prepare(conn, "SELECT id FROM animals WHERE id < ? ORDER BY id")
+      ibm_db.execute(stmt, (2,))
+      row = ibm_db.fetch_tuple(stmt)
+      while row:
+        row = ibm_db.fetch_tuple(stmt)
+      ibm_db.commit(conn)
+      print events[0]
+      print events[1][:4]
+      fetches = [e for e in events if e[0] == 'fetch']
+      print sum([e[4] for e in fetches]), fetches[-1][4]
+      print events[-1]
+
+      # failures carry their SQLSTATE
+      del events[:]
+      try:
+        ibm_db.exec_immediate(conn, "SELECT * FROM no_such_table")
+      except Exception, e:
+        pass
+      print events[0][0], events[0][1], events[0][5] is not None
+
+      # the hook is removed with None, an exception of the hook is ignored
+      def bad_hook(*args):
+        raise ValueError("hook failed")
+      ibm_db.set_trace_hook(bad_hook)
+      stmt = ibm_db.exec_immediate(conn, "SELECT id FROM animals WHERE id = 0")
+      print ibm_db.fetch_tuple(stmt)
+      ibm_db.set_trace_hook(None)
+
+      # statements over the threshold go to the slow query log
+      fd, path = tempfile.mkstemp()
+      os.close(fd)
+      ibm_db.set_slow_query_log(path, 0.0)
+      stmt = ibm_db.exec_immediate(conn, "SELECT id FROM animals WHERE id = 0")
+      ibm_db.set_slow_query_log(None)
+      ibm_db.exec_immediate(conn, "SELECT id FROM animals WHERE id = 1")
+      lines = open(path).readlines()
+      os.remove(path)
+      print len(lines)
+      print lines[0].split()[2], lines[0].split(' sqlstate=- ')[1].strip()
+      ibm_db.close(conn)
+    else:
+      print "Connection failed."
+
+#__END__
+#__LUW_EXPECTED__
+#True
+#('prepare', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True, -1, None)
+#('execute', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True)
+#2 0
+#('commit', None, 0, True, -1, None)
+#execute SELECT * FROM no_such_table True
+#(0,)
+#1
+#execute SELECT id FROM animals WHERE id = 0
+#__ZOS_EXPECTED__
+#True
+#('prepare', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True, -1, None)
+#('execute', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True)
+#2 0
+#('commit', None, 0, True, -1, None)
+#execute SELECT * FROM no_such_table True
+#(0,)
+#1
+#execute SELECT id FROM animals WHERE id = 0
+#__SYSTEMI_EXPECTED__
+#True
+#('prepare', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True, -1, None)
+#('execute', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True)
+#2 0
+#('commit', None, 0, True, -1, None)
+#execute SELECT * FROM no_such_table True
+#(0,)
+#1
+#execute SELECT id FROM animals WHERE id = 0
+#__IDS_EXPECTED__
+#True
+#('prepare', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True, -1, None)
+#('execute', u'SELECT id FROM animals WHERE id < ? ORDER BY id', 1, True)
+#2 0
+#('commit', None, 0, True, -1, None)
+#execute SELECT * FROM no_such_table True
+#(0,)
+#1
+#execute SELECT id FROM animals WHERE id = 0